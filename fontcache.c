@@ -32,10 +32,27 @@
 #include "fontcache.h"
 #include "dejavu-sans-condensed.h"
 
+/*
+** Glyph runs laid out by msLayoutTextSymbol(), keyed by the text and the
+** label parameters that influence the layout. The glyphs point into the
+** face caches of the same ft_cache, so entries live as long as those.
+*/
+#define MS_LAYOUT_CACHE_SIZE 2048
+
+typedef struct {
+  char *key;
+  int numglyphs;
+  int numlines;
+  rectObj bbox;
+  glyphObj *glyphs;
+  UT_hash_handle hh;
+} layout_element;
+
 typedef struct {
   FT_Library library;
   face_element *face_cache;
   glyph_element *bitmap_glyph_cache;
+  layout_element *layout_cache; /* in least recently used order */
 } ft_cache;
 
 #ifdef USE_THREAD
@@ -61,6 +78,13 @@ void msFreeFontCache(ft_cache *c) {
   /* ... TODO ... */
   face_element *cur_face,*tmp_face;
   glyph_element *cur_bitmap, *tmp_bitmap;
+  layout_element *cur_layout, *tmp_layout;
+  UT_HASH_ITER(hh, c->layout_cache, cur_layout, tmp_layout) {
+    UT_HASH_DEL(c->layout_cache, cur_layout);
+    free(cur_layout->key);
+    free(cur_layout->glyphs);
+    free(cur_layout);
+  }
   UT_HASH_ITER(hh, c->face_cache, cur_face, tmp_face) {
       index_element *cur_index,*tmp_index;
       outline_element *cur_outline,*tmp_outline;
@@ -88,6 +112,7 @@ void msFreeFontCache(ft_cache *c) {
 #endif
       FT_Done_Face(cur_face->face);
       free(cur_face->font);
+      free(cur_face->fontfile);
       UT_HASH_DEL(c->face_cache,cur_face);
       free(cur_face);
   }
@@ -170,6 +195,81 @@ void msFontCacheSetup() {
 #endif
 }
 
+/*
+** Returns MS_TRUE if all threads share a single font cache, in which case
+** glyph lookups from several threads at once are not safe.
+*/
+int msFontCacheIsGlobal() {
+#ifdef USE_THREAD
+  return use_global_ft_cache ? MS_TRUE : MS_FALSE;
+#else
+  return MS_TRUE;
+#endif
+}
+
+/*
+** Unlinks the calling thread's font cache so no other thread can pick it
+** up, e.g. a later thread that gets the same id. Used by short lived worker
+** threads: the caller rebinds the text paths laid out with it using
+** msRebindTextPath() and then frees it with msFontCacheFreeDetached().
+*/
+void* msFontCacheDetach() {
+#ifdef USE_THREAD
+  void* nThreadId = msGetThreadId();
+  ft_thread_cache *prev = NULL, *cur;
+
+  if (use_global_ft_cache)
+    return NULL;
+
+  msAcquireLock( TLOCK_TTF );
+  cur = ft_caches;
+  while( cur != NULL && cur->thread_id != nThreadId ) {
+    prev = cur;
+    cur = cur->next;
+  }
+  if( cur != NULL ) {
+    if( prev != NULL )
+      prev->next = cur->next;
+    else
+      ft_caches = cur->next;
+    cur->next = NULL;
+  }
+  msReleaseLock( TLOCK_TTF );
+  return cur;
+#else
+  return NULL;
+#endif
+}
+
+void msFontCacheFreeDetached(void *detached) {
+#ifdef USE_THREAD
+  ft_thread_cache *cur = (ft_thread_cache*)detached;
+  if(!cur) return;
+  msFreeFontCache(&cur->cache);
+  free(cur);
+#endif
+}
+
+/*
+** Points the glyphs of a text path laid out with another thread's font
+** cache to the same glyphs in the calling thread's cache.
+*/
+int msRebindTextPath(fontSetObj *fontset, textPathObj *tp) {
+  int i;
+  face_element *from = NULL, *to = NULL;
+  for(i=0; i<tp->numglyphs; i++) {
+    glyphObj *g = &tp->glyphs[i];
+    if(g->face != from) {
+      from = g->face;
+      to = msGetFontFace(from->font, fontset);
+      if(!to) return MS_FAILURE;
+    }
+    g->glyph = msGetGlyphByIndex(to, g->glyph->key.size, g->glyph->key.codepoint);
+    g->face = to;
+  }
+  return MS_SUCCESS;
+}
+
 void msFontCacheCleanup() {
 #ifndef USE_THREAD
   ft_cache *c = msGetFontCache();
@@ -209,29 +309,28 @@ unsigned int msGetGlyphIndex(face_element *face, unsigned int unicode) {
 face_element* msGetFontFace(char *key, fontSetObj *fontset) {
   face_element *fc;
   int error;
+  const char *fontfile = NULL;
   ft_cache *cache = msGetFontCache();
   if(!key) {
     key = MS_DEFAULT_FONT_KEY;
   }
+  if(fontset && strcmp(key,MS_DEFAULT_FONT_KEY)) {
+    fontfile = msLookupHashTable(&(fontset->fonts),key);
+    if(!fontfile) {
+      msSetError(MS_MISCERR, "Could not find font with key \"%s\" in fontset", "msGetFontFace()", key);
+      return NULL;
+    }
+  }
 #ifdef USE_THREAD
   if (use_global_ft_cache)
     msAcquireLock(TLOCK_TTF);
 #endif
-  UT_HASH_FIND_STR(cache->face_cache,key,fc);
+  /* faces are keyed on the font file, an alias may be bound to another
+     file in another map's fontset */
+  UT_HASH_FIND_STR(cache->face_cache,fontfile?fontfile:MS_DEFAULT_FONT_KEY,fc);
   if(!fc) {
-    const char *fontfile = NULL;
     fc = msSmallCalloc(1,sizeof(face_element));
-    if(fontset && strcmp(key,MS_DEFAULT_FONT_KEY)) {
-      fontfile = msLookupHashTable(&(fontset->fonts),key);
-      if(!fontfile) {
-        msSetError(MS_MISCERR, "Could not find font with key \"%s\" in fontset", "msGetFontFace()", key);
-        free(fc);
-#ifdef USE_THREAD
-        if (use_global_ft_cache)
-          msReleaseLock(TLOCK_TTF);
-#endif
-        return NULL;
-      }
+    if(fontfile) {
       error = FT_New_Face(cache->library,fontfile,0, &(fc->face));
     } else {
       error = FT_New_Memory_Face(cache->library,dejavu_sans_condensed_ttf, dejavu_sans_condensed_ttf_len , 0, &(fc->face));
@@ -252,7 +351,8 @@ face_element* msGetFontFace(char *key, fontSetObj *fontset) {
       /* the previous calls may have failed, we ignore as there's nothing much left to do */
     }
     fc->font = msStrdup(key);
-    UT_HASH_ADD_KEYPTR(hh,cache->face_cache,fc->font, strlen(key), fc);
+    fc->fontfile = msStrdup(fontfile?fontfile:MS_DEFAULT_FONT_KEY);
+    UT_HASH_ADD_KEYPTR(hh,cache->face_cache,fc->fontfile, strlen(fc->fontfile), fc);
   }
 #ifdef USE_THREAD
   if (use_global_ft_cache)
@@ -336,6 +436,69 @@ outline_element* msGetGlyphOutline(face_element *face, glyph_element *glyph) {
   return oc;
 }
 
+/*
+** Copies the cached layout for key into tp. Returns MS_TRUE on a hit.
+*/
+int msGetCachedTextLayout(const char *key, textPathObj *tp) {
+  ft_cache *cache = msGetFontCache();
+  layout_element *le;
+#ifdef USE_THREAD
+  if (use_global_ft_cache)
+    msAcquireLock(TLOCK_TTF);
+#endif
+  UT_HASH_FIND_STR(cache->layout_cache, key, le);
+  if(le) {
+    /* re-add to move it to the most recently used end */
+    UT_HASH_DEL(cache->layout_cache, le);
+    UT_HASH_ADD_KEYPTR(hh, cache->layout_cache, le->key, strlen(le->key), le);
+    tp->numglyphs = le->numglyphs;
+    tp->numlines = le->numlines;
+    tp->bounds.bbox = le->bbox;
+    if(le->numglyphs > 0) {
+      tp->glyphs = msSmallMalloc(le->numglyphs * sizeof(glyphObj));
+      memcpy(tp->glyphs, le->glyphs, le->numglyphs * sizeof(glyphObj));
+    }
+  }
+#ifdef USE_THREAD
+  if (use_global_ft_cache)
+    msReleaseLock(TLOCK_TTF);
+#endif
+  return le ? MS_TRUE : MS_FALSE;
+}
+
+void msAddCachedTextLayout(const char *key, textPathObj *tp) {
+  ft_cache *cache = msGetFontCache();
+  layout_element *le;
+#ifdef USE_THREAD
+  if (use_global_ft_cache)
+    msAcquireLock(TLOCK_TTF);
+#endif
+  UT_HASH_FIND_STR(cache->layout_cache, key, le);
+  if(!le) {
+    if(UT_HASH_COUNT(cache->layout_cache) >= MS_LAYOUT_CACHE_SIZE) {
+      le = cache->layout_cache; /* least recently used */
+      UT_HASH_DEL(cache->layout_cache, le);
+      free(le->key);
+      free(le->glyphs);
+      free(le);
+    }
+    le = msSmallCalloc(1, sizeof(layout_element));
+    le->key = msStrdup(key);
+    le->numglyphs = tp->numglyphs;
+    le->numlines = tp->numlines;
+    le->bbox = tp->bounds.bbox;
+    if(tp->numglyphs > 0) {
+      le->glyphs = msSmallMalloc(tp->numglyphs * sizeof(glyphObj));
+      memcpy(le->glyphs, tp->glyphs, tp->numglyphs * sizeof(glyphObj));
+    }
+    UT_HASH_ADD_KEYPTR(hh, cache->layout_cache, le->key, strlen(le->key), le);
+  }
+#ifdef USE_THREAD
+  if (use_global_ft_cache)
+    msReleaseLock(TLOCK_TTF);
+#endif
+}
+
 int msIsGlyphASpace(glyphObj *glyph) {
   /* space or tab, for now */
   unsigned int space,tab;
@@ -66,6 +66,7 @@ typedef struct {
 
 struct face_element{
   char *font;
+  char *fontfile; /* hash key: the font file, as several fontsets can share an alias */
   FT_Face face;
   index_element *index_cache;
   glyph_element *glyph_cache;
@@ -81,6 +82,8 @@ glyph_element* msGetBitmapGlyph(rendererVTableObj *renderer, unsigned int size,
 unsigned int msGetGlyphIndex(face_element *face, unsigned int unicode);
 glyph_element* msGetGlyphByIndex(face_element *face, unsigned int size, unsigned int codepoint);
 int msIsGlyphASpace(glyphObj *glyph);
+int msGetCachedTextLayout(const char *key, textPathObj *tp);
+void msAddCachedTextLayout(const char *key, textPathObj *tp);
 
 #ifdef __cplusplus
 }
@@ -227,7 +227,7 @@ int msComputeKernelDensityDataset(mapObj *map, imageObj *image, layerObj *kernel
                   layer->class[c]->styles[s]->minscaledenom,
                   layer->class[c]->styles[s]->maxscaledenom)) {
             if(layer->class[c]->styles[s]->bindings[MS_STYLE_BINDING_SIZE].index != -1) {
-              weight = atof(shape.values[layer->class[c]->styles[s]->bindings[MS_STYLE_BINDING_SIZE].index]);
+              weight = msShapeGetValueAsDouble(&shape, layer->class[c]->styles[s]->bindings[MS_STYLE_BINDING_SIZE].index);
             } else {
               weight = layer->class[c]->styles[s]->size;
             }
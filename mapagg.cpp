@@ -650,6 +650,53 @@ int agg2RenderVectorSymbol(imageObj *img, double x, double y,
   return MS_SUCCESS;
 }
 
+/*
+** Composites a premultiplied tile with the image's pixel layout onto the
+** image at an integer pixel offset. This is the arithmetic of the AGG
+** blend_from() with full coverage, but transparent pixels are skipped and
+** runs of opaque pixels are copied with memcpy(), which is what most of a
+** marker tile is made of.
+*/
+static void agg2BlendTile(AGG2Renderer *r, const band_type *src, int width, int height,
+                          int stride, int dstx, int dsty)
+{
+  int x0 = MS_MAX(0, -dstx);
+  int y0 = MS_MAX(0, -dsty);
+  int x1 = MS_MIN(width, (int)r->m_rendering_buffer.width() - dstx);
+  int y1 = MS_MIN(height, (int)r->m_rendering_buffer.height() - dsty);
+
+  for(int j=y0; j<y1; j++) {
+    const band_type *ps = src + j * stride + x0 * 4;
+    band_type *pd = r->m_rendering_buffer.row_ptr(dsty + j) + (dstx + x0) * 4;
+    int i = x0;
+    while(i < x1) {
+      unsigned alpha = ps[band_order::A];
+      if(alpha == 0) {
+        ps += 4;
+        pd += 4;
+        i++;
+      } else if(alpha == 255) {
+        int n = 1;
+        while(i + n < x1 && ps[n * 4 + band_order::A] == 255)
+          n++;
+        memcpy(pd, ps, n * 4);
+        ps += n * 4;
+        pd += n * 4;
+        i += n;
+      } else {
+        alpha = 255 - alpha;
+        pd[band_order::R] = (band_type)(((pd[band_order::R] * alpha) >> 8) + ps[band_order::R]);
+        pd[band_order::G] = (band_type)(((pd[band_order::G] * alpha) >> 8) + ps[band_order::G]);
+        pd[band_order::B] = (band_type)(((pd[band_order::B] * alpha) >> 8) + ps[band_order::B]);
+        pd[band_order::A] = (band_type)(255 - ((alpha * (255 - pd[band_order::A])) >> 8));
+        ps += 4;
+        pd += 4;
+        i++;
+      }
+    }
+  }
+}
+
 int agg2RenderPixmapSymbol(imageObj *img, double x, double y, symbolObj *symbol, symbolStyleObj * style)
 {
   AGG2Renderer *r = AGG_RENDERER(img);
@@ -692,7 +739,8 @@ int agg2RenderPixmapSymbol(imageObj *img, double x, double y, symbolObj *symbol,
   } else {
     //just copy the image at the correct location (we place the pixmap on
     //the nearest integer pixel to avoid blurring)
-    r->m_renderer_base.blend_from(pf,0,MS_NINT(x-pixmap->width/2.),MS_NINT(y-pixmap->height/2.));
+    agg2BlendTile(r, pixmap->data.rgba.pixels, pixmap->width, pixmap->height, pixmap->data.rgba.row_step,
+                  MS_NINT(x-pixmap->width/2.), MS_NINT(y-pixmap->height/2.));
   }
   return MS_SUCCESS;
 }
@@ -734,11 +782,11 @@ int agg2RenderEllipseSymbol(imageObj *image, double x, double y,
 
 int agg2RenderTile(imageObj *img, imageObj *tile, double x, double y)
 {
-  /*
-  AGG2Renderer *imgRenderer = agg2GetRenderer(img);
-  AGG2Renderer *tileRenderer = agg2GetRenderer(tile);
-  */
-  return MS_FAILURE;
+  AGG2Renderer *r = AGG_RENDERER(img);
+  AGG2Renderer *t = AGG_RENDERER(tile);
+  agg2BlendTile(r, t->buffer, tile->width, tile->height, t->m_rendering_buffer.stride(),
+                MS_NINT(x - tile->width / 2.), MS_NINT(y - tile->height / 2.));
+  return MS_SUCCESS;
 }
 
 int aggInitializeRasterBuffer(rasterBufferObj *rb, int width, int height, int mode)
@@ -1031,45 +1031,49 @@ int msRenderRasterizedSVGSymbol(imageObj *img, double x, double y, symbolObj *sy
       svg_cache->pixmap_buffer = msSmallCalloc(1,sizeof(rasterBufferObj));
     }
 
-    //increase pixmap size to accomodate scaling/rotation
-    if (style->scale != 1.0) {
-      width = surface_w = (symbol->sizex * style->scale + 0.5);
-      height = surface_h = (symbol->sizey * style->scale + 0.5);
-    } else {
-      width = surface_w = symbol->sizex;
-      height = surface_h = symbol->sizey;
-    }
-    if (style->rotation != 0) {
-      surface_w = surface_h = MS_NINT(MS_MAX(height, width) * 1.415);
-    }
+    /* another map may already have rasterized this file the same way */
+    if(!msSymbolCacheGetRaster(symbol->full_pixmap_path, style->scale, style->rotation, svg_cache->pixmap_buffer)) {
+      //increase pixmap size to accomodate scaling/rotation
+      if (style->scale != 1.0) {
+        width = surface_w = (symbol->sizex * style->scale + 0.5);
+        height = surface_h = (symbol->sizey * style->scale + 0.5);
+      } else {
+        width = surface_w = symbol->sizex;
+        height = surface_h = symbol->sizey;
+      }
+      if (style->rotation != 0) {
+        surface_w = surface_h = MS_NINT(MS_MAX(height, width) * 1.415);
+      }
 
-    surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, surface_w, surface_h);
-    cr = cairo_create(surface);
+      surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, surface_w, surface_h);
+      cr = cairo_create(surface);
 
-    if (style->rotation != 0) {
-      cairo_translate(cr, surface_w / 2, surface_h / 2);
-      cairo_rotate(cr, -style->rotation);
-      cairo_translate(cr, -width / 2, -height / 2);
-    }
-    if (style->scale != 1.0) {
-      cairo_scale(cr, style->scale, style->scale);
-    }
+      if (style->rotation != 0) {
+        cairo_translate(cr, surface_w / 2, surface_h / 2);
+        cairo_rotate(cr, -style->rotation);
+        cairo_translate(cr, -width / 2, -height / 2);
+      }
+      if (style->scale != 1.0) {
+        cairo_scale(cr, style->scale, style->scale);
+      }
 #ifdef USE_SVG_CAIRO
-    if(svg_cairo_render(svg_cache->svgc, cr) != SVG_CAIRO_STATUS_SUCCESS) {
-      return MS_FAILURE;
-    }
+      if(svg_cairo_render(svg_cache->svgc, cr) != SVG_CAIRO_STATUS_SUCCESS) {
+        return MS_FAILURE;
+      }
 #else
-  rsvg_handle_render_cairo(svg_cache->svgc, cr);
+      rsvg_handle_render_cairo(svg_cache->svgc, cr);
 #endif
-    pb = cairo_image_surface_get_data(surface);
-
-    //set up raster
-    initializeRasterBufferCairo(svg_cache->pixmap_buffer, surface_w, surface_h, 0);
-    memcpy(svg_cache->pixmap_buffer->data.rgba.pixels, pb, surface_w * surface_h * 4 * sizeof (unsigned char));
+      pb = cairo_image_surface_get_data(surface);
+
+      //set up raster
+      initializeRasterBufferCairo(svg_cache->pixmap_buffer, surface_w, surface_h, 0);
+      memcpy(svg_cache->pixmap_buffer->data.rgba.pixels, pb, surface_w * surface_h * 4 * sizeof (unsigned char));
+      cairo_destroy(cr);
+      cairo_surface_destroy(surface);
+      msSymbolCacheAddRaster(symbol->full_pixmap_path, style->scale, style->rotation, svg_cache->pixmap_buffer);
+    }
     svg_cache->scale = style->scale;
     svg_cache->rotation = style->rotation;
-    cairo_destroy(cr);
-    cairo_surface_destroy(surface);
   }
   assert(svg_cache->pixmap_buffer->height && svg_cache->pixmap_buffer->width);
 
@@ -564,6 +564,7 @@ static void InitShapeAttributes(layerObj* layer, clusterInfo* base)
       base->shape.values[i] = msStrdup("1"); /* initial count */
     }
   }
+  msShapeInvalidateValueCache(&base->shape);
 }
 
 /* update the shape attributes (aggregate) */
@@ -611,6 +612,8 @@ static void UpdateShapeAttributes(layerObj* layer, clusterInfo* base, clusterInf
       }
     }
   }
+  msShapeInvalidateValueCache(&base->shape);
+  msShapeInvalidateValueCache(&current->shape);
 }
 
 static int BuildFeatureAttributes(layerObj* layer, msClusterLayerInfo* layerinfo, shapeObj* shape)
@@ -354,6 +354,7 @@ int msCopyLabel(labelObj *dst, labelObj *src)
 
   MS_COPYSTELEM(mindistance);
   MS_COPYSTELEM(partials);
+  MS_COPYSTELEM(polylabel);
   MS_COPYSTELEM(force);
   MS_COPYSTELEM(priority);
 
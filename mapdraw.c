@@ -35,6 +35,10 @@
 #include "mapfile.h"
 #include "mapows.h"
 
+#ifdef USE_THREAD
+#include "cpl_multiproc.h"
+#endif
+
 
 /* msPrepareImage()
  *
@@ -259,6 +263,90 @@ static int msCompositeRasterBuffer(mapObj *map, imageObj *img, rasterBufferObj *
   return ret;
 }
 
+#ifdef USE_POSTGIS
+/*
+ * Send the queries of the visible PostGIS layers before drawing starts, so that
+ * the database runs them concurrently instead of one layer at a time. Enabled
+ * with CONFIG "MS_POSTGIS_PREFETCH" "ON". Each layer is opened and its items
+ * and search rectangle set up as msDrawVectorLayer() will do, so that the
+ * prefetched results match the query issued at draw time. Failures are not
+ * fatal: the layer then just runs its query when drawn. Prefetching never
+ * waits for a pooled connection.
+ */
+static void msDrawMapPrefetchLayers(mapObj *map)
+{
+  int i;
+  const char *prefetch = msGetConfigOption(map, "MS_POSTGIS_PREFETCH");
+
+  if(!prefetch || !(strcasecmp(prefetch, "ON") == 0 ||
+                    strcasecmp(prefetch, "YES") == 0 ||
+                    strcasecmp(prefetch, "TRUE") == 0))
+    return;
+
+  for(i=0; i<map->numlayers; i++) {
+    layerObj *lp;
+    rectObj searchrect;
+    int status;
+
+    if(map->layerorder[i] == -1)
+      continue;
+
+    lp = GET_LAYER(map, map->layerorder[i]);
+    if(lp->connectiontype != MS_POSTGIS || lp->cluster.region ||
+       lp->type == MS_LAYER_RASTER || lp->type == MS_LAYER_CHART)
+      continue;
+    if(!msLayerIsVisible(map, lp))
+      continue;
+    if(lp->compositer && !lp->compositer->next && lp->compositer->opacity == 0)
+      continue;
+
+    /* each prefetched query needs a connection of its own: skip the layer
+       rather than wait for one at CONNECTION_POOL_MAX */
+    if(!msLayerIsOpen(lp) && !msConnPoolIdleAvailable(lp)) {
+      if(lp->debug || map->debug)
+        msDebug("msDrawMap(): no connection left to prefetch layer %s, it will be queried when drawn.\n", lp->name);
+      continue;
+    }
+
+    if(msLayerOpen(lp) != MS_SUCCESS) {
+      msResetErrorList();
+      continue;
+    }
+
+    if (lp->styleitem && (strncasecmp(lp->styleitem, "javascript://", 13) == 0)) {
+      status = msLayerWhichItems(lp, MS_TRUE, NULL);
+    } else {
+      status = msLayerWhichItems(lp, MS_FALSE, NULL);
+    }
+    if(status != MS_SUCCESS) {
+      msResetErrorList();
+      msLayerClose(lp);
+      continue;
+    }
+
+    if(lp->transform == MS_TRUE) {
+      searchrect = map->extent;
+      if((map->projection.numargs > 0) && (lp->projection.numargs > 0))
+        msProjectRect(&map->projection, &lp->projection, &searchrect);
+    } else {
+      searchrect.minx = searchrect.miny = 0;
+      searchrect.maxx = map->width-1;
+      searchrect.maxy = map->height-1;
+    }
+
+    /* as msLayerWhichShapes() does */
+    if(!msLayerSupportsCommonFilters(lp))
+      msLayerTranslateFilter(lp, &lp->filter, lp->filteritem);
+
+    if(msPostGISLayerPrefetch(lp, searchrect) != MS_SUCCESS) {
+      if(lp->debug || map->debug)
+        msDebug("msDrawMap(): unable to prefetch layer %s, it will be queried when drawn.\n", lp->name);
+      msResetErrorList();
+    }
+  }
+}
+#endif /* USE_POSTGIS */
+
 /*
  * Generic function to render the map file.
  * The type of the image created is based on the imagetype parameter in the map file.
@@ -396,6 +484,21 @@ imageObj *msDrawMap(mapObj *map, int querymap)
 
 #endif /* USE_WMS_LYR || USE_WFS_LYR */
 
+#ifdef USE_POSTGIS
+  if(!querymap) {
+    if(map->debug >= MS_DEBUGLEVEL_TUNING) msGettimeofday(&starttime, NULL);
+
+    msDrawMapPrefetchLayers(map);
+
+    if(map->debug >= MS_DEBUGLEVEL_TUNING) {
+      msGettimeofday(&endtime, NULL);
+      msDebug("msDrawMap(): PostGIS prefetch, %.3fs\n",
+              (endtime.tv_sec+endtime.tv_usec/1.0e6)-
+              (starttime.tv_sec+starttime.tv_usec/1.0e6) );
+    }
+  }
+#endif
+
   /* OK, now we can start drawing */
   for(i=0; i<map->numlayers; i++) {
 
@@ -2021,7 +2124,12 @@ int polygonLayerDrawShape(mapObj *map, imageObj *image, layerObj *layer,
   if(MS_DRAW_LABELS(drawmode)) {
     if (layer->class[c]->numlabels > 0) {
       double minfeaturesize = layer->class[c]->labels[0]->minfeaturesize * image->resolutionfactor;
-      if (msPolygonLabelPoint(anno_shape, &annopnt, minfeaturesize) == MS_SUCCESS) {
+      int status;
+      if (layer->class[c]->labels[0]->polylabel) /* anno_shape is in pixels, one pixel is precise enough */
+        status = msPolygonPoleOfInaccessibility(anno_shape, &annopnt, minfeaturesize, 1.0);
+      else
+        status = msPolygonLabelPoint(anno_shape, &annopnt, minfeaturesize);
+      if (status == MS_SUCCESS) {
         for (i = 0; i < layer->class[c]->numlabels; i++)
           if (layer->class[c]->labels[i]->angle != 0) layer->class[c]->labels[i]->angle -= map->gt.rotation_angle; /* TODO: is this correct ??? */
         if (layer->labelcache) {
@@ -2197,10 +2305,10 @@ int msDrawShape(mapObj *map, layerObj *layer, shapeObj *shape, imageObj *image,
       cliprect.maxx = image->width + clip_buf;
       cliprect.maxy = image->height + clip_buf;
       if(shape->type == MS_SHAPE_POLYGON) {
-        msClipPolygonRect(shape, cliprect);
+        msClipPolygonRectEx(shape, cliprect, &image->clipscratch, &image->clipscratchsize);
       } else {
         assert(shape->type == MS_SHAPE_LINE);
-        msClipPolylineRect(shape, cliprect);
+        msClipPolylineRectEx(shape, cliprect, &image->clipscratch, &image->clipscratchsize);
       }
       if(bNeedUnclippedAnnoShape) {
         anno_shape = unclipped_shape;
@@ -2223,10 +2331,10 @@ int msDrawShape(mapObj *map, layerObj *layer, shapeObj *shape, imageObj *image,
       cliprect.maxx = map->extent.maxx + clip_buf_d;
       cliprect.maxy = map->extent.maxy + clip_buf_d;
       if(shape->type == MS_SHAPE_POLYGON) {
-        msClipPolygonRect(shape, cliprect);
+        msClipPolygonRectEx(shape, cliprect, &image->clipscratch, &image->clipscratchsize);
       } else {
         assert(shape->type == MS_SHAPE_LINE);
-        msClipPolylineRect(shape, cliprect);
+        msClipPolylineRectEx(shape, cliprect, &image->clipscratch, &image->clipscratchsize);
       }
       msTransformShape(shape, map->extent, map->cellsize, image);
       msComputeBounds(shape);
@@ -3020,6 +3128,124 @@ static int getLabelPositionFromString(char *pszString) {
   else return MS_CC;
 }
 
+#ifdef USE_THREAD
+/*
+** Parallel text layout for msDrawLabelCache(). Shaping the label texts is
+** by far the most expensive part of label placement and doesn't depend on
+** which labels end up being placed, so with CONFIG MS_LABELCACHE_THREADS
+** it is done up front by worker threads. The serial placement pass then
+** only computes bounds and tests collisions, in the same order as before.
+*/
+#define MS_LABELCACHE_LAYOUT_MIN_PER_THREAD 64
+
+typedef struct {
+  mapObj *map;
+  textSymbolObj **textsymbols;
+  int numtextsymbols;
+  int first, stride; /* this worker lays out textsymbols[first + k*stride] */
+  void *fontcache; /* the worker's detached font cache */
+  int status;
+  int errorcode;
+  char routine[ROUTINELENGTH];
+  char message[MESSAGELENGTH];
+} labelLayoutTaskObj;
+
+static void msLabelLayoutThread(void *arg)
+{
+  labelLayoutTaskObj *task = (labelLayoutTaskObj*)arg;
+  int i;
+
+  for(i=task->first; i<task->numtextsymbols; i+=task->stride) {
+    if(msComputeTextPath(task->map, task->textsymbols[i]) != MS_SUCCESS) {
+      errorObj *error = msGetErrorObj();
+      task->status = MS_FAILURE;
+      task->errorcode = error->code;
+      strlcpy(task->routine, error->routine, sizeof(task->routine));
+      strlcpy(task->message, error->message, sizeof(task->message));
+      break;
+    }
+  }
+
+  /* the glyphs point into this thread's font cache, hand it over */
+  task->fontcache = msFontCacheDetach();
+  msResetErrorList();
+}
+
+static int msLayoutLabelCacheParallel(mapObj *map, int nthreads)
+{
+  int priority, l, ll, i, t, n = 0, status = MS_SUCCESS;
+  textSymbolObj **textsymbols;
+  labelLayoutTaskObj *tasks;
+  CPLJoinableThread **threads;
+
+  for(priority=0; priority<MS_MAX_LABEL_PRIORITY; priority++)
+    for(l=0; l<map->labelcache.slots[priority].numlabels; l++)
+      n += map->labelcache.slots[priority].labels[l].numtextsymbols;
+
+  nthreads = MS_MIN(nthreads, n / MS_LABELCACHE_LAYOUT_MIN_PER_THREAD);
+  if(nthreads < 2) return MS_SUCCESS; /* not worth it */
+
+  /* the text symbols the placement pass would lay out */
+  textsymbols = (textSymbolObj**)msSmallMalloc(n * sizeof(textSymbolObj*));
+  n = 0;
+  for(priority=0; priority<MS_MAX_LABEL_PRIORITY; priority++) {
+    labelCacheSlotObj *cacheslot = &(map->labelcache.slots[priority]);
+    for(l=0; l<cacheslot->numlabels; l++) {
+      labelCacheMemberObj *cachePtr = &(cacheslot->labels[l]);
+      for(ll=0; ll<cachePtr->numtextsymbols; ll++) {
+        textSymbolObj *ts = cachePtr->textsymbols[ll];
+        if(ts->annotext && !ts->textpath)
+          textsymbols[n++] = ts;
+      }
+    }
+  }
+
+  tasks = (labelLayoutTaskObj*)msSmallCalloc(nthreads, sizeof(labelLayoutTaskObj));
+  threads = (CPLJoinableThread**)msSmallCalloc(nthreads, sizeof(CPLJoinableThread*));
+  for(t=0; t<nthreads; t++) {
+    tasks[t].map = map;
+    tasks[t].textsymbols = textsymbols;
+    tasks[t].numtextsymbols = n;
+    tasks[t].first = t;
+    tasks[t].stride = nthreads;
+    tasks[t].status = MS_SUCCESS;
+    /* if a thread can't be started its labels are simply laid out by the placement pass */
+    threads[t] = CPLCreateJoinableThread(msLabelLayoutThread, &tasks[t]);
+  }
+
+  for(t=0; t<nthreads; t++) {
+    if(!threads[t]) continue;
+    CPLJoinThread(threads[t]);
+
+    for(i=tasks[t].first; i<n; i+=nthreads) {
+      textSymbolObj *ts = textsymbols[i];
+      if(!ts->textpath) continue;
+      if(tasks[t].status != MS_SUCCESS || status != MS_SUCCESS || msRebindTextPath(&map->fontset, ts->textpath) != MS_SUCCESS) {
+        /* failed layouts (and anything left after a failure) can't be kept */
+        if(status == MS_SUCCESS && tasks[t].status == MS_SUCCESS) status = MS_FAILURE; /* error set by msRebindTextPath() */
+        freeTextPath(ts->textpath);
+        free(ts->textpath);
+        ts->textpath = NULL;
+      }
+    }
+    msFontCacheFreeDetached(tasks[t].fontcache);
+
+    if(tasks[t].status != MS_SUCCESS && status == MS_SUCCESS) {
+      msSetError(tasks[t].errorcode, "%s", tasks[t].routine, tasks[t].message);
+      status = MS_FAILURE;
+    }
+  }
+
+  if(map->debug >= MS_DEBUGLEVEL_TUNING)
+    msDebug("msDrawLabelCache(): laid out %d labels in %d threads\n", n, nthreads);
+
+  free(threads);
+  free(tasks);
+  free(textsymbols);
+  return status;
+}
+#endif
+
 int msDrawLabelCache(mapObj *map, imageObj *image)
 {
   int nReturnVal = MS_SUCCESS;
@@ -3071,6 +3297,14 @@ int msDrawLabelCache(mapObj *map, imageObj *image)
         if(map->debug) msDebug("msDrawLabelCache(): labelcache_map_edge_buffer = %d\n", map->labelcache.gutter);
       }
 
+#ifdef USE_THREAD
+      if((value = msGetConfigOption(map, "MS_LABELCACHE_THREADS")) != NULL && !msFontCacheIsGlobal()) {
+        int nthreads = strcasecmp(value, "ALL_CPUS") ? atoi(value) : CPLGetNumCPUs();
+        if(nthreads > 1 && msLayoutLabelCacheParallel(map, nthreads) != MS_SUCCESS)
+          return MS_FAILURE;
+      }
+#endif
+
       for(priority=MS_MAX_LABEL_PRIORITY-1; priority>=0; priority--) {
         labelCacheSlotObj *cacheslot;
         cacheslot = &(map->labelcache.slots[priority]);
@@ -1549,8 +1549,8 @@ LoadGDALImages( GDALDatasetH hDS, int band_numbers[4], int band_count,
 /*                       msGetGDALGeoTransform()                        */
 /*                                                                      */
 /*      Cover function that tries GDALGetGeoTransform(), a world        */
-/*      file or OWS extents.  It is assumed that TLOCK_GDAL is held     */
-/*      before this function is called.                                 */
+/*      file or OWS extents.  The caller must have exclusive use of     */
+/*      hDS (see the dataset pool in mapraster.c).                      */
 /************************************************************************/
 
 int msGetGDALGeoTransform( GDALDatasetH hDS, mapObj *map, layerObj *layer,
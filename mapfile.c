@@ -1254,15 +1254,6 @@ int msLoadProjectionStringEPSG(projectionObj *p, const char *value)
   msFreeProjectionExceptContext(p);
 
   p->gt.need_geotransform = MS_FALSE;
-#ifdef USE_PROJ_FASTPATHS
-  if(strcasestr(value,"epsg:4326")) {
-    p->wellknownprojection = wkp_lonlat;
-  } else if(strcasestr(value,"epsg:3857")) {
-    p->wellknownprojection = wkp_gmerc;
-  } else {
-    p->wellknownprojection = wkp_none;
-  }
-#endif
 
   if( msLoadProjectionStringEPSGLike(p, value, "EPSG:", MS_TRUE) == 0 )
   {
@@ -1394,6 +1385,7 @@ void initLabel(labelObj *label)
   label->repeatdistance = 0; /* no repeat */
   label->maxoverlapangle = 22.5; /* default max overlap angle */
   label->partials = MS_FALSE;
+  label->polylabel = MS_FALSE;
   label->wrap = '\0';
   label->maxlength = 0;
   label->minlength = 0;
@@ -1675,6 +1667,9 @@ static int loadLabel(labelObj *label)
       case(PARTIALS):
         if((label->partials = getSymbol(2, MS_TRUE,MS_FALSE)) == -1) return(-1);
         break;
+      case(POLYLABEL):
+        if((label->polylabel = getSymbol(2, MS_TRUE,MS_FALSE)) == -1) return(-1);
+        break;
       case(POSITION):
         if((label->position = getSymbol(11, MS_UL,MS_UC,MS_UR,MS_CL,MS_CC,MS_CR,MS_LL,MS_LC,MS_LR,MS_AUTO,MS_BINDING)) == -1)
           return(-1);
@@ -1888,6 +1883,7 @@ static void writeLabel(FILE *stream, int indent, labelObj *label)
 
   writeNumber(stream, indent, "OUTLINEWIDTH", 1, label->outlinewidth);
   writeKeyword(stream, indent, "PARTIALS", label->partials, 1, MS_TRUE, "TRUE");
+  writeKeyword(stream, indent, "POLYLABEL", label->polylabel, 1, MS_TRUE, "TRUE");
 
   if(label->numbindings > 0 && label->bindings[MS_LABEL_BINDING_POSITION].item)
     writeAttributeBinding(stream, indent, "POSITION", &(label->bindings[MS_LABEL_BINDING_POSITION]));
@@ -331,4 +331,6 @@ enum MS_TOKEN_SOURCES {MS_FILE_TOKENS=0, MS_STRING_TOKENS, MS_URL_TOKENS};
 
 #define CONNECTIONOPTIONS 2001
 
+#define POLYLABEL 2002
+
 #endif /* MAPFILE_H */
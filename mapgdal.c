@@ -68,6 +68,11 @@ void msGDALCleanup( void )
   if( bGDALInitialized ) {
     int iRepeat = 5;
 
+    /* Release the raster dataset pool first so the loop below does */
+    /* not close handles the pool still references.                 */
+    msDrawRasterCleanupDatasetPool();
+    msDrawRasterCleanupTileIndexCache();
+
       /*
       ** Cleanup any unreferenced but open datasets as will tend
       ** to exist due to deferred close requests.  We are careful
@@ -128,217 +133,122 @@ void msCleanVSIDir( const char *pszDir )
 }
 
 /************************************************************************/
-/*                          msSaveImageGDAL()                           */
+/*                      msGDALGetImageBandLayout()                      */
+/*                                                                      */
+/*      Number of bands and data type of a GDAL dataset holding an      */
+/*      image of the given output format.                               */
 /************************************************************************/
 
-int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
+static int msGDALGetImageBandLayout( outputFormatObj *format, int *pnBands,
+                                     GDALDataType *peDataType )
 
 {
-  int  bFileIsTemporary = MS_FALSE;
-  GDALDatasetH hMemDS, hOutputDS;
-  GDALDriverH  hMemDriver, hOutputDriver;
-  int          nBands = 1;
-  int          iLine;
-  GByte       *pabyAlphaLine = NULL;
-  char        **papszOptions = NULL;
-  outputFormatObj *format = image->format;
-  rasterBufferObj rb;
-  GDALDataType eDataType = GDT_Byte;
-  int bUseXmp = MS_FALSE;
-  const char   *filename = NULL;
-  char         *filenameToFree = NULL;
-  const char   *gdal_driver_shortname = format->driver+5;
-
-  msGDALInitialize();
-  memset(&rb,0,sizeof(rasterBufferObj));
-
-#ifdef USE_EXEMPI
-  if( map != NULL ) {
-    bUseXmp = msXmpPresent(map);
-  }
-#endif
-
-
-  /* -------------------------------------------------------------------- */
-  /*      Identify the proposed output driver.                            */
-  /* -------------------------------------------------------------------- */
-  msAcquireLock( TLOCK_GDAL );
-  hOutputDriver = GDALGetDriverByName( gdal_driver_shortname );
-  if( hOutputDriver == NULL ) {
-    msReleaseLock( TLOCK_GDAL );
-    msSetError( MS_MISCERR, "Failed to find %s driver.",
-                "msSaveImageGDAL()", gdal_driver_shortname );
-    return MS_FAILURE;
-  }
-
-  /* -------------------------------------------------------------------- */
-  /*      We will need to write the output to a temporary file and        */
-  /*      then stream to stdout if no filename is passed.  If the         */
-  /*      driver supports virtualio then we hold the temporary file in    */
-  /*      memory, otherwise we try to put it in a reasonable temporary    */
-  /*      file location.                                                  */
-  /* -------------------------------------------------------------------- */
-  if( filenameIn == NULL ) {
-    const char *pszExtension = format->extension;
-    if( pszExtension == NULL )
-      pszExtension = "img.tmp";
-
-    if( bUseXmp == MS_FALSE &&
-        GDALGetMetadataItem( hOutputDriver, GDAL_DCAP_VIRTUALIO, NULL ) != NULL &&
-        /* We need special testing here for the netCDF driver, since recent */
-        /* GDAL versions advertize VirtualIO support, but this is only for the */
-        /* read-side of the driver, not the write-side. */
-        !EQUAL(gdal_driver_shortname, "netCDF") ) {
-      msCleanVSIDir( "/vsimem/msout" );
-      filenameToFree = msTmpFile(map, NULL, "/vsimem/msout/", pszExtension );
-    }
-
-    if( filenameToFree == NULL && map != NULL)
-      filenameToFree = msTmpFile(map, map->mappath,NULL,pszExtension);
-    else if( filenameToFree == NULL ) {
-      filenameToFree = msTmpFile(map, NULL, NULL, pszExtension );
-    }
-    filename = filenameToFree;
-
-    bFileIsTemporary = MS_TRUE;
-  }
-  else {
-    filename = filenameIn;
-  }
-
-  /* -------------------------------------------------------------------- */
-  /*      Establish the characteristics of our memory, and final          */
-  /*      dataset.                                                        */
-  /* -------------------------------------------------------------------- */
+  *pnBands = 1;
+  *peDataType = GDT_Byte;
 
   if( format->imagemode == MS_IMAGEMODE_RGB ) {
-    nBands = 3;
-    assert( MS_RENDERER_PLUGIN(format) && format->vtable->supports_pixel_buffer );
-    if(UNLIKELY(MS_FAILURE == format->vtable->getRasterBufferHandle(image,&rb))) {
-      msReleaseLock( TLOCK_GDAL );
-      return MS_FAILURE;
-    }
+    *pnBands = 3;
   } else if( format->imagemode == MS_IMAGEMODE_RGBA ) {
-    pabyAlphaLine = (GByte *) calloc(image->width,1);
-    if (pabyAlphaLine == NULL) {
-      msReleaseLock( TLOCK_GDAL );
-      msSetError( MS_MEMERR, "Out of memory allocating %u bytes.\n", "msSaveImageGDAL()", image->width);
-      return MS_FAILURE;
-    }
-    nBands = 4;
-    assert( MS_RENDERER_PLUGIN(format) && format->vtable->supports_pixel_buffer );
-    if(UNLIKELY(MS_FAILURE == format->vtable->getRasterBufferHandle(image,&rb))) {
-      msReleaseLock( TLOCK_GDAL );
-      return MS_FAILURE;
-    }
+    *pnBands = 4;
   } else if( format->imagemode == MS_IMAGEMODE_INT16 ) {
-    nBands = format->bands;
-    eDataType = GDT_Int16;
+    *pnBands = format->bands;
+    *peDataType = GDT_Int16;
   } else if( format->imagemode == MS_IMAGEMODE_FLOAT32 ) {
-    nBands = format->bands;
-    eDataType = GDT_Float32;
+    *pnBands = format->bands;
+    *peDataType = GDT_Float32;
   } else if( format->imagemode == MS_IMAGEMODE_BYTE ) {
-    nBands = format->bands;
-    eDataType = GDT_Byte;
+    *pnBands = format->bands;
+    *peDataType = GDT_Byte;
   } else {
-    msReleaseLock( TLOCK_GDAL );
-    msSetError( MS_MEMERR, "Unknown format. This is a bug.", "msSaveImageGDAL()");
+    msSetError( MS_MEMERR, "Unknown format. This is a bug.",
+                "msGDALGetImageBandLayout()");
     return MS_FAILURE;
   }
 
-  /* -------------------------------------------------------------------- */
-  /*      Create a memory dataset which we can use as a source for a      */
-  /*      CreateCopy().                                                   */
-  /* -------------------------------------------------------------------- */
-  hMemDriver = GDALGetDriverByName( "MEM" );
-  if( hMemDriver == NULL ) {
-    msReleaseLock( TLOCK_GDAL );
-    msSetError( MS_MISCERR, "Failed to find MEM driver.",
-                "msSaveImageGDAL()" );
-    return MS_FAILURE;
-  }
+  return MS_SUCCESS;
+}
 
-  hMemDS = GDALCreate( hMemDriver, "msSaveImageGDAL_temp",
-                       image->width, image->height, nBands,
-                       eDataType, NULL );
-  if( hMemDS == NULL ) {
-    msReleaseLock( TLOCK_GDAL );
-    msSetError( MS_MISCERR, "Failed to create MEM dataset.",
-                "msSaveImageGDAL()" );
-    return MS_FAILURE;
-  }
+/************************************************************************/
+/*                        msGDALWriteImageLines()                       */
+/*                                                                      */
+/*      Copy all the lines of an image into a GDAL dataset, starting    */
+/*      at line nYOff of the dataset.  rb is only used for RGB and      */
+/*      RGBA images.                                                    */
+/************************************************************************/
+
+static int msGDALWriteImageLines( GDALDatasetH hDS, imageObj *image,
+                                  rasterBufferObj *rb, int nBands, int nYOff )
+
+{
+  outputFormatObj *format = image->format;
+  int iLine;
 
-  /* -------------------------------------------------------------------- */
-  /*      Copy the gd image into the memory dataset.                      */
-  /* -------------------------------------------------------------------- */
   for( iLine = 0; iLine < image->height; iLine++ ) {
     int iBand;
 
     for( iBand = 0; iBand < nBands; iBand++ ) {
       CPLErr eErr;
-      GDALRasterBandH hBand = GDALGetRasterBand( hMemDS, iBand+1 );
+      GDALRasterBandH hBand = GDALGetRasterBand( hDS, iBand+1 );
 
       if( format->imagemode == MS_IMAGEMODE_INT16 ) {
-        eErr = GDALRasterIO( hBand, GF_Write, 0, iLine, image->width, 1,
+        eErr = GDALRasterIO( hBand, GF_Write, 0, nYOff + iLine, image->width, 1,
                       image->img.raw_16bit + iLine * image->width
                       + iBand * image->width * image->height,
                       image->width, 1, GDT_Int16, 2, 0 );
 
       } else if( format->imagemode == MS_IMAGEMODE_FLOAT32 ) {
-        eErr = GDALRasterIO( hBand, GF_Write, 0, iLine, image->width, 1,
+        eErr = GDALRasterIO( hBand, GF_Write, 0, nYOff + iLine, image->width, 1,
                       image->img.raw_float + iLine * image->width
                       + iBand * image->width * image->height,
                       image->width, 1, GDT_Float32, 4, 0 );
       } else if( format->imagemode == MS_IMAGEMODE_BYTE ) {
-        eErr = GDALRasterIO( hBand, GF_Write, 0, iLine, image->width, 1,
+        eErr = GDALRasterIO( hBand, GF_Write, 0, nYOff + iLine, image->width, 1,
                       image->img.raw_byte + iLine * image->width
                       + iBand * image->width * image->height,
                       image->width, 1, GDT_Byte, 1, 0 );
       } else {
         GByte *pabyData;
         unsigned char *pixptr = NULL;
-        assert( rb.type == MS_BUFFER_BYTE_RGBA );
+        assert( rb->type == MS_BUFFER_BYTE_RGBA );
         switch(iBand) {
           case 0:
-            pixptr = rb.data.rgba.r;
+            pixptr = rb->data.rgba.r;
             break;
           case 1:
-            pixptr = rb.data.rgba.g;
+            pixptr = rb->data.rgba.g;
             break;
           case 2:
-            pixptr = rb.data.rgba.b;
+            pixptr = rb->data.rgba.b;
             break;
           case 3:
-            pixptr = rb.data.rgba.a;
+            pixptr = rb->data.rgba.a;
             break;
         }
         assert(pixptr);
         if( pixptr == NULL ) {
-          msReleaseLock( TLOCK_GDAL );
           msSetError( MS_MISCERR, "Missing RGB or A buffer.\n",
-                      "msSaveImageGDAL()" );
-          GDALClose(hMemDS);
+                      "msGDALWriteImageLines()" );
           return MS_FAILURE;
         }
 
-        pabyData = (GByte *)(pixptr + iLine*rb.data.rgba.row_step);
+        pabyData = (GByte *)(pixptr + iLine*rb->data.rgba.row_step);
 
-        if( rb.data.rgba.a == NULL || iBand == 3 ) {
-          eErr = GDALRasterIO( hBand, GF_Write, 0, iLine, image->width, 1,
+        if( rb->data.rgba.a == NULL || iBand == 3 ) {
+          eErr = GDALRasterIO( hBand, GF_Write, 0, nYOff + iLine, image->width, 1,
                         pabyData, image->width, 1, GDT_Byte,
-                        rb.data.rgba.pixel_step, 0 );
+                        rb->data.rgba.pixel_step, 0 );
         } else { /* We need to un-pre-multiple RGB by alpha. */
           GByte *pabyUPM = (GByte*) malloc(image->width);
-          GByte *pabyAlpha= (GByte *)(rb.data.rgba.a + iLine*rb.data.rgba.row_step);
+          GByte *pabyAlpha= (GByte *)(rb->data.rgba.a + iLine*rb->data.rgba.row_step);
           int i;
 
           for( i = 0; i < image->width; i++ ) {
-            int alpha = pabyAlpha[i*rb.data.rgba.pixel_step];
+            int alpha = pabyAlpha[i*rb->data.rgba.pixel_step];
 
             if( alpha == 0 )
               pabyUPM[i] = 0;
             else {
-              int result = (pabyData[i*rb.data.rgba.pixel_step] * 255) / alpha;
+              int result = (pabyData[i*rb->data.rgba.pixel_step] * 255) / alpha;
 
               if( result > 255 )
                 result = 255;
@@ -347,58 +257,67 @@ int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
             }
           }
 
-          eErr = GDALRasterIO( hBand, GF_Write, 0, iLine, image->width, 1,
+          eErr = GDALRasterIO( hBand, GF_Write, 0, nYOff + iLine, image->width, 1,
                         pabyUPM, image->width, 1, GDT_Byte, 1, 0 );
           free( pabyUPM );
         }
       }
       if( eErr != CE_None ) {
-          msReleaseLock( TLOCK_GDAL );
           msSetError( MS_MISCERR, "GDALRasterIO() failed.\n",
-                      "msSaveImageGDAL()" );
-          GDALClose(hMemDS);
+                      "msGDALWriteImageLines()" );
           return MS_FAILURE;
       }
     }
   }
 
-  if( pabyAlphaLine != NULL )
-    free( pabyAlphaLine );
+  return MS_SUCCESS;
+}
+
+/************************************************************************/
+/*                       msGDALSetImageMetadata()                       */
+/*                                                                      */
+/*      Color interpretation, georeferencing, nodata value and          */
+/*      resolution of an output dataset.                                */
+/************************************************************************/
+
+static void msGDALSetImageMetadata( GDALDatasetH hDS, mapObj *map,
+                                    outputFormatObj *format,
+                                    double resolution, int nBands )
 
+{
   /* -------------------------------------------------------------------- */
   /*      Attach the palette if appropriate.                              */
   /* -------------------------------------------------------------------- */
-    if( format->imagemode == MS_IMAGEMODE_RGB ) {
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 1 ), GCI_RedBand );
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 2 ), GCI_GreenBand );
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 3 ), GCI_BlueBand );
-    } else if( format->imagemode == MS_IMAGEMODE_RGBA ) {
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 1 ), GCI_RedBand );
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 2 ), GCI_GreenBand );
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 3 ), GCI_BlueBand );
-      GDALSetRasterColorInterpretation(
-        GDALGetRasterBand( hMemDS, 4 ), GCI_AlphaBand );
-    }
+  if( format->imagemode == MS_IMAGEMODE_RGB ) {
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 1 ), GCI_RedBand );
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 2 ), GCI_GreenBand );
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 3 ), GCI_BlueBand );
+  } else if( format->imagemode == MS_IMAGEMODE_RGBA ) {
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 1 ), GCI_RedBand );
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 2 ), GCI_GreenBand );
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 3 ), GCI_BlueBand );
+    GDALSetRasterColorInterpretation(
+      GDALGetRasterBand( hDS, 4 ), GCI_AlphaBand );
+  }
 
   /* -------------------------------------------------------------------- */
-  /*      Assign the projection and coordinate system to the memory       */
-  /*      dataset.                                                        */
+  /*      Assign the projection and coordinate system to the dataset.     */
   /* -------------------------------------------------------------------- */
 
   if( map != NULL ) {
     char *pszWKT;
 
-    GDALSetGeoTransform( hMemDS, map->gt.geotransform );
+    GDALSetGeoTransform( hDS, map->gt.geotransform );
 
     pszWKT = msProjectionObj2OGCWKT( &(map->projection) );
     if( pszWKT != NULL ) {
-      GDALSetProjection( hMemDS, pszWKT );
+      GDALSetProjection( hDS, pszWKT );
       msFree( pszWKT );
     }
   }
@@ -412,7 +331,7 @@ int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
                             "NULLVALUE",NULL);
 
     for( iBand = 0; iBand < nBands; iBand++ ) {
-      GDALRasterBandH hBand = GDALGetRasterBand( hMemDS, iBand+1 );
+      GDALRasterBandH hBand = GDALGetRasterBand( hDS, iBand+1 );
       GDALSetRasterNoDataValue( hBand, atof(nullvalue) );
     }
   }
@@ -420,15 +339,145 @@ int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
   /* -------------------------------------------------------------------- */
   /*  Try to save resolution in the output file.                          */
   /* -------------------------------------------------------------------- */
-  if( image->resolution > 0 ) {
+  if( resolution > 0 ) {
     char res[30];
 
-    sprintf( res, "%lf", image->resolution );
-    GDALSetMetadataItem( hMemDS, "TIFFTAG_XRESOLUTION", res, NULL );
-    GDALSetMetadataItem( hMemDS, "TIFFTAG_YRESOLUTION", res, NULL );
-    GDALSetMetadataItem( hMemDS, "TIFFTAG_RESOLUTIONUNIT", "2", NULL );
+    sprintf( res, "%lf", resolution );
+    GDALSetMetadataItem( hDS, "TIFFTAG_XRESOLUTION", res, NULL );
+    GDALSetMetadataItem( hDS, "TIFFTAG_YRESOLUTION", res, NULL );
+    GDALSetMetadataItem( hDS, "TIFFTAG_RESOLUTIONUNIT", "2", NULL );
+  }
+}
+
+/************************************************************************/
+/*                          msSaveImageGDAL()                           */
+/************************************************************************/
+
+int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
+
+{
+  int  bFileIsTemporary = MS_FALSE;
+  GDALDatasetH hMemDS, hOutputDS;
+  GDALDriverH  hMemDriver, hOutputDriver;
+  int          nBands = 1;
+  char        **papszOptions = NULL;
+  outputFormatObj *format = image->format;
+  rasterBufferObj rb;
+  GDALDataType eDataType = GDT_Byte;
+  int bUseXmp = MS_FALSE;
+  const char   *filename = NULL;
+  char         *filenameToFree = NULL;
+  const char   *gdal_driver_shortname = format->driver+5;
+
+  msGDALInitialize();
+  memset(&rb,0,sizeof(rasterBufferObj));
+
+#ifdef USE_EXEMPI
+  if( map != NULL ) {
+    bUseXmp = msXmpPresent(map);
+  }
+#endif
+
+
+  /* -------------------------------------------------------------------- */
+  /*      Identify the proposed output driver.                            */
+  /* -------------------------------------------------------------------- */
+  msAcquireLock( TLOCK_GDAL );
+  hOutputDriver = GDALGetDriverByName( gdal_driver_shortname );
+  if( hOutputDriver == NULL ) {
+    msReleaseLock( TLOCK_GDAL );
+    msSetError( MS_MISCERR, "Failed to find %s driver.",
+                "msSaveImageGDAL()", gdal_driver_shortname );
+    return MS_FAILURE;
+  }
+
+  /* -------------------------------------------------------------------- */
+  /*      We will need to write the output to a temporary file and        */
+  /*      then stream to stdout if no filename is passed.  If the         */
+  /*      driver supports virtualio then we hold the temporary file in    */
+  /*      memory, otherwise we try to put it in a reasonable temporary    */
+  /*      file location.                                                  */
+  /* -------------------------------------------------------------------- */
+  if( filenameIn == NULL ) {
+    const char *pszExtension = format->extension;
+    if( pszExtension == NULL )
+      pszExtension = "img.tmp";
+
+    if( bUseXmp == MS_FALSE &&
+        GDALGetMetadataItem( hOutputDriver, GDAL_DCAP_VIRTUALIO, NULL ) != NULL &&
+        /* We need special testing here for the netCDF driver, since recent */
+        /* GDAL versions advertize VirtualIO support, but this is only for the */
+        /* read-side of the driver, not the write-side. */
+        !EQUAL(gdal_driver_shortname, "netCDF") ) {
+      msCleanVSIDir( "/vsimem/msout" );
+      filenameToFree = msTmpFile(map, NULL, "/vsimem/msout/", pszExtension );
+    }
+
+    if( filenameToFree == NULL && map != NULL)
+      filenameToFree = msTmpFile(map, map->mappath,NULL,pszExtension);
+    else if( filenameToFree == NULL ) {
+      filenameToFree = msTmpFile(map, NULL, NULL, pszExtension );
+    }
+    filename = filenameToFree;
+
+    bFileIsTemporary = MS_TRUE;
+  }
+  else {
+    filename = filenameIn;
+  }
+
+  /* -------------------------------------------------------------------- */
+  /*      Establish the characteristics of our memory, and final          */
+  /*      dataset.                                                        */
+  /* -------------------------------------------------------------------- */
+
+  if( msGDALGetImageBandLayout( format, &nBands, &eDataType ) != MS_SUCCESS ) {
+    msReleaseLock( TLOCK_GDAL );
+    return MS_FAILURE;
+  }
+
+  if( format->imagemode == MS_IMAGEMODE_RGB ||
+      format->imagemode == MS_IMAGEMODE_RGBA ) {
+    assert( MS_RENDERER_PLUGIN(format) && format->vtable->supports_pixel_buffer );
+    if(UNLIKELY(MS_FAILURE == format->vtable->getRasterBufferHandle(image,&rb))) {
+      msReleaseLock( TLOCK_GDAL );
+      return MS_FAILURE;
+    }
+  }
+
+  /* -------------------------------------------------------------------- */
+  /*      Create a memory dataset which we can use as a source for a      */
+  /*      CreateCopy().                                                   */
+  /* -------------------------------------------------------------------- */
+  hMemDriver = GDALGetDriverByName( "MEM" );
+  if( hMemDriver == NULL ) {
+    msReleaseLock( TLOCK_GDAL );
+    msSetError( MS_MISCERR, "Failed to find MEM driver.",
+                "msSaveImageGDAL()" );
+    return MS_FAILURE;
+  }
+
+  hMemDS = GDALCreate( hMemDriver, "msSaveImageGDAL_temp",
+                       image->width, image->height, nBands,
+                       eDataType, NULL );
+  if( hMemDS == NULL ) {
+    msReleaseLock( TLOCK_GDAL );
+    msSetError( MS_MISCERR, "Failed to create MEM dataset.",
+                "msSaveImageGDAL()" );
+    return MS_FAILURE;
+  }
+
+  /* -------------------------------------------------------------------- */
+  /*      Copy the gd image into the memory dataset.                      */
+  /* -------------------------------------------------------------------- */
+  if( msGDALWriteImageLines( hMemDS, image, &rb, nBands, 0 ) != MS_SUCCESS ) {
+    msReleaseLock( TLOCK_GDAL );
+    GDALClose( hMemDS );
+    return MS_FAILURE;
   }
 
+  msGDALSetImageMetadata( hMemDS, map, format, image->resolution, nBands );
+
   /* -------------------------------------------------------------------- */
   /*      Create a disk image in the selected output format from the      */
   /*      memory image.                                                   */
@@ -517,6 +566,265 @@ int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filenameIn )
   return MS_SUCCESS;
 }
 
+/************************************************************************/
+/*                      msGDALStdoutWriteFunction()                     */
+/************************************************************************/
+
+/* Used by /vsistdout/ */
+static size_t msGDALStdoutWriteFunction( const void* ptr, size_t size,
+                                         size_t nmemb, FILE* stream )
+{
+  msIOContext *ioctx = (msIOContext*) stream;
+  return msIO_contextWrite( ioctx, ptr, size * nmemb ) / size;
+}
+
+/* -------------------------------------------------------------------- */
+/*      State of an image being streamed to the client.  The            */
+/*      /vsistdout/ redirection is global to GDAL, so it is only        */
+/*      pointed at our output context while we hold TLOCK_GDAL, and     */
+/*      no dirty block of the dataset is left in the GDAL block cache   */
+/*      when we release it.                                             */
+/* -------------------------------------------------------------------- */
+typedef struct {
+  GDALDatasetH hDS;
+  msIOContext *ioctx;
+  int nBands;
+  int nBlockYSize;
+} msGDALImageStream;
+
+static void msGDALRedirectStdout( msGDALImageStream *psStream )
+{
+  if( psStream->ioctx != NULL )
+    VSIStdoutSetRedirection( msGDALStdoutWriteFunction,
+                             (FILE*) psStream->ioctx );
+  else
+    VSIStdoutSetRedirection( fwrite, stdout );
+}
+
+/************************************************************************/
+/*                        msGDALCanStreamImage()                        */
+/*                                                                      */
+/*      Can images in this output format be written progressively to    */
+/*      the client with msGDALOpenImageStream() instead of going        */
+/*      through msSaveImageGDAL() and a temporary file?  This needs a   */
+/*      driver advertising the STREAMABLE_OUTPUT creation option        */
+/*      (GTiff), the format to ask for it, and a layout the driver      */
+/*      can write sequentially: no compression, tiling, band            */
+/*      interleaving nor sparse file.                                   */
+/************************************************************************/
+
+int msGDALCanStreamImage( mapObj *map, outputFormatObj *format )
+
+{
+  GDALDriverH hDriver;
+  const char *pszOptionList;
+  const char *pszCompress;
+
+  if( format == NULL || strncasecmp(format->driver,"GDAL/",5) != 0 )
+    return MS_FALSE;
+
+  if( !CSLTestBoolean(msGetOutputFormatOption(format,"STREAMABLE_OUTPUT","NO")) )
+    return MS_FALSE;
+
+  pszCompress = msGetOutputFormatOption(format,"COMPRESS","NONE");
+  if( !EQUAL(pszCompress,"NONE") ||
+      CSLTestBoolean(msGetOutputFormatOption(format,"TILED","NO")) )
+    return MS_FALSE;
+
+  /* strips hold all the bands of their lines, so band interleaving would
+     need seeking back in the file, as would sparse files or overviews */
+  if( EQUAL(msGetOutputFormatOption(format,"INTERLEAVE","PIXEL"),"BAND") ||
+      CSLTestBoolean(msGetOutputFormatOption(format,"SPARSE_OK","NO")) ||
+      CSLTestBoolean(msGetOutputFormatOption(format,"COPY_SRC_OVERVIEWS","NO")) )
+    return MS_FALSE;
+
+#ifdef USE_EXEMPI
+  if( map != NULL && msXmpPresent(map) )
+    return MS_FALSE;
+#else
+  (void)map;
+#endif
+
+  msGDALInitialize();
+
+  hDriver = GDALGetDriverByName( format->driver+5 );
+  if( hDriver == NULL ||
+      GDALGetMetadataItem( hDriver, GDAL_DCAP_CREATE, NULL ) == NULL )
+    return MS_FALSE;
+
+  pszOptionList = GDALGetMetadataItem( hDriver, GDAL_DMD_CREATIONOPTIONLIST,
+                                       NULL );
+  if( pszOptionList == NULL ||
+      strstr(pszOptionList, "STREAMABLE_OUTPUT") == NULL )
+    return MS_FALSE;
+
+  return MS_TRUE;
+}
+
+/************************************************************************/
+/*                        msGDALOpenImageStream()                       */
+/*                                                                      */
+/*      Create a width x height dataset in the map output format        */
+/*      written directly to the msIO stdout context through             */
+/*      /vsistdout/, georeferenced with the current map geotransform.   */
+/*      Lines are then written top to bottom with                       */
+/*      msGDALWriteImageStream(), and the stream is finished with       */
+/*      msGDALCloseImageStream().  The driver writes nothing to the     */
+/*      client before the first lines, so headers can still be sent     */
+/*      until then.                                                     */
+/************************************************************************/
+
+void *msGDALOpenImageStream( mapObj *map, outputFormatObj *format,
+                             int width, int height, double resolution )
+
+{
+  GDALDriverH hDriver;
+  GDALDataType eDataType;
+  msGDALImageStream *psStream;
+  char **papszOptions;
+  int nBlockXSize = 0;
+
+  msGDALInitialize();
+
+  psStream = (msGDALImageStream *) msSmallCalloc(1, sizeof(msGDALImageStream));
+  if( msGDALGetImageBandLayout( format, &psStream->nBands,
+                                &eDataType ) != MS_SUCCESS ) {
+    msFree( psStream );
+    return NULL;
+  }
+
+  if( msIO_needBinaryStdout() == MS_FAILURE ) {
+    msFree( psStream );
+    return NULL;
+  }
+
+  if( !msIO_isStdContext() ) {
+    psStream->ioctx = msIO_getHandler( stdout );
+    if( psStream->ioctx == NULL ) {
+      msSetError( MS_IOERR, "No output context to stream the image to.",
+                  "msGDALOpenImageStream()" );
+      msFree( psStream );
+      return NULL;
+    }
+  }
+
+  msAcquireLock( TLOCK_GDAL );
+  hDriver = GDALGetDriverByName( format->driver+5 );
+  if( hDriver == NULL ) {
+    msReleaseLock( TLOCK_GDAL );
+    msSetError( MS_MISCERR, "Failed to find %s driver.",
+                "msGDALOpenImageStream()", format->driver+5 );
+    msFree( psStream );
+    return NULL;
+  }
+
+  papszOptions = (char**)msSmallCalloc(sizeof(char *),(format->numformatoptions+1));
+  memcpy( papszOptions, format->formatoptions,
+          sizeof(char *) * format->numformatoptions );
+
+  msGDALRedirectStdout( psStream );
+  psStream->hDS = GDALCreate( hDriver, "/vsistdout/", width, height,
+                              psStream->nBands, eDataType, papszOptions );
+  free( papszOptions );
+
+  if( psStream->hDS == NULL ) {
+    msReleaseLock( TLOCK_GDAL );
+    msSetError( MS_MISCERR, "Failed to create streamed %s output.\n%s",
+                "msGDALOpenImageStream()", format->driver+5,
+                CPLGetLastErrorMsg() );
+    msFree( psStream );
+    return NULL;
+  }
+
+  /* Must all be known before the first line is written. */
+  msGDALSetImageMetadata( psStream->hDS, map, format, resolution,
+                          psStream->nBands );
+
+  GDALGetBlockSize( GDALGetRasterBand( psStream->hDS, 1 ),
+                    &nBlockXSize, &psStream->nBlockYSize );
+  if( psStream->nBlockYSize < 1 )
+    psStream->nBlockYSize = 1;
+  msReleaseLock( TLOCK_GDAL );
+
+  return psStream;
+}
+
+/************************************************************************/
+/*                    msGDALImageStreamBlockHeight()                    */
+/*                                                                      */
+/*      Lines per block of the streamed dataset.  Images passed to      */
+/*      msGDALWriteImageStream() should cover whole blocks, except      */
+/*      the last one.                                                   */
+/************************************************************************/
+
+int msGDALImageStreamBlockHeight( void *hStream )
+
+{
+  return ((msGDALImageStream *) hStream)->nBlockYSize;
+}
+
+/************************************************************************/
+/*                       msGDALWriteImageStream()                       */
+/*                                                                      */
+/*      Write all the lines of image at line nYOff of the streamed      */
+/*      dataset.  Calls must be made in increasing line order.          */
+/************************************************************************/
+
+int msGDALWriteImageStream( void *hStream, imageObj *image, int nYOff )
+
+{
+  msGDALImageStream *psStream = (msGDALImageStream *) hStream;
+  outputFormatObj *format = image->format;
+  rasterBufferObj rb;
+  int status;
+
+  memset(&rb,0,sizeof(rasterBufferObj));
+  if( format->imagemode == MS_IMAGEMODE_RGB ||
+      format->imagemode == MS_IMAGEMODE_RGBA ) {
+    assert( MS_RENDERER_PLUGIN(format) && format->vtable->supports_pixel_buffer );
+    if(UNLIKELY(MS_FAILURE == format->vtable->getRasterBufferHandle(image,&rb)))
+      return MS_FAILURE;
+  }
+
+  msAcquireLock( TLOCK_GDAL );
+  msGDALRedirectStdout( psStream );
+  CPLErrorReset();
+  status = msGDALWriteImageLines( psStream->hDS, image, &rb,
+                                  psStream->nBands, nYOff );
+  GDALFlushCache( psStream->hDS );
+  if( status == MS_SUCCESS && CPLGetLastErrorType() == CE_Failure ) {
+    msSetError( MS_MISCERR, "Failed to stream %s output.\n%s",
+                "msGDALWriteImageStream()", format->driver+5,
+                CPLGetLastErrorMsg() );
+    status = MS_FAILURE;
+  }
+  msReleaseLock( TLOCK_GDAL );
+
+  return status;
+}
+
+/************************************************************************/
+/*                       msGDALCloseImageStream()                       */
+/************************************************************************/
+
+int msGDALCloseImageStream( void *hStream )
+
+{
+  msGDALImageStream *psStream = (msGDALImageStream *) hStream;
+
+  if( psStream == NULL )
+    return MS_SUCCESS;
+
+  msAcquireLock( TLOCK_GDAL );
+  msGDALRedirectStdout( psStream );
+  GDALClose( psStream->hDS );
+  VSIStdoutSetRedirection( fwrite, stdout );
+  msReleaseLock( TLOCK_GDAL );
+
+  msFree( psStream );
+  return MS_SUCCESS;
+}
+
 /************************************************************************/
 /*                       msInitGDALOutputFormat()                       */
 /************************************************************************/
@@ -560,6 +868,21 @@ int msInitDefaultGDALOutputFormat( outputFormatObj *format )
     format->extension =
       msStrdup(GDALGetMetadataItem(hDriver,GDAL_DMD_EXTENSION,NULL));
 
+  /* -------------------------------------------------------------------- */
+  /*      Cloud optimized GeoTIFFs (GDAL >= 3.1) are always tiled with    */
+  /*      internal overviews.  Default to compressed tiles, with the      */
+  /*      overviews and compression computed on all cores, and use the    */
+  /*      COG media type so that clients can ask for it rather than a     */
+  /*      plain GeoTIFF.                                                  */
+  /* -------------------------------------------------------------------- */
+  if( EQUAL(format->driver+5, "COG") ) {
+    msFree( format->mimetype );
+    format->mimetype =
+      msStrdup("image/tiff; application=geotiff; profile=cloud-optimized");
+    msSetOutputFormatOption( format, "COMPRESS", "DEFLATE" );
+    msSetOutputFormatOption( format, "NUM_THREADS", "ALL_CPUS" );
+  }
+
   return MS_SUCCESS;
 }
 
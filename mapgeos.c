@@ -37,6 +37,10 @@
 
 #include <geos_c.h>
 
+#if GEOS_VERSION_MAJOR > 3 || (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 3)
+#define MS_GEOS_PREPARED
+#endif
+
 /*
 ** Error handling...
 */
@@ -719,6 +723,13 @@ void msGEOSFreeGeometry(shapeObj *shape)
   if(!shape || !shape->geometry)
     return;
 
+#ifdef MS_GEOS_PREPARED
+  if(shape->preparedgeometry) { /* refers to the geometry, goes first */
+    GEOSPreparedGeom_destroy_r(handle, (const GEOSPreparedGeometry*) shape->preparedgeometry);
+    shape->preparedgeometry = NULL;
+  }
+#endif
+
   g = (GEOSGeom) shape->geometry;
   GEOSGeom_destroy_r(handle,g);
   shape->geometry = NULL;
@@ -1089,6 +1100,60 @@ shapeObj *msGEOSSymDifference(shapeObj *shape1, shapeObj *shape2)
 ** Binary predicates exposed to MapServer/MapScript
 */
 
+/*
+** Prepares the GEOS geometry of a shape that is going to be tested against
+** many others, such as a query shape or a literal shape in an expression.
+** The binary predicates below go through the prepared geometry of either
+** argument when there is one, which indexes its segments instead of
+** testing all segment pairs. msGEOSFreeGeometry() releases it.
+*/
+int msGEOSPrepareShape(shapeObj *shape)
+{
+#ifdef MS_GEOS_PREPARED
+  GEOSContextHandle_t handle = msGetGeosContextHandle();
+
+  if(!shape)
+    return MS_FAILURE;
+  if(shape->preparedgeometry)
+    return MS_SUCCESS;
+
+  if(!shape->geometry) /* if no geometry for the shape then build one */
+    shape->geometry = (GEOSGeom) msGEOSShape2Geometry(shape);
+  if(!shape->geometry)
+    return MS_FAILURE;
+
+  shape->preparedgeometry = (void*) GEOSPrepare_r(handle, (GEOSGeom) shape->geometry);
+  return shape->preparedgeometry ? MS_SUCCESS : MS_FAILURE;
+#else
+  return MS_FAILURE;
+#endif
+}
+
+#ifdef MS_GEOS_PREPARED
+typedef char (*msGEOSPreparedPredicateFunc)(GEOSContextHandle_t, const GEOSPreparedGeometry*, const GEOSGeometry*);
+
+/*
+** Evaluates predicate(shape1, shape2) with shape1's prepared geometry, or
+** converse(shape2, shape1) with shape2's. Returns -2 if neither is prepared.
+*/
+static int msGEOSPreparedPredicate(GEOSContextHandle_t handle,
+                                   shapeObj *shape1, GEOSGeom g1,
+                                   shapeObj *shape2, GEOSGeom g2,
+                                   msGEOSPreparedPredicateFunc predicate,
+                                   msGEOSPreparedPredicateFunc converse)
+{
+  char result;
+
+  if(shape1->preparedgeometry)
+    result = predicate(handle, (const GEOSPreparedGeometry*) shape1->preparedgeometry, g2);
+  else if(shape2->preparedgeometry)
+    result = converse(handle, (const GEOSPreparedGeometry*) shape2->preparedgeometry, g1);
+  else
+    return -2;
+  return ((result==2) ? -1 : result);
+}
+#endif
+
 /*
 ** Does shape1 contain shape2, returns MS_TRUE/MS_FALSE or -1 for an error.
 */
@@ -1112,6 +1177,11 @@ int msGEOSContains(shapeObj *shape1, shapeObj *shape2)
   g2 = shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedContains_r, &GEOSPreparedWithin_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSContains_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1120,6 +1190,45 @@ int msGEOSContains(shapeObj *shape1, shapeObj *shape2)
 #endif
 }
 
+/*
+** Does the interior of shape1 contain shape2, that is shape2 has no point
+** on the boundary or exterior of shape1, returns MS_TRUE/MS_FALSE or -1
+** for an error.
+*/
+int msGEOSContainsProperly(shapeObj *shape1, shapeObj *shape2)
+{
+#ifdef USE_GEOS
+  GEOSGeom g1, g2;
+  int result;
+  GEOSContextHandle_t handle = msGetGeosContextHandle();
+
+  if(!shape1 || !shape2)
+    return -1;
+
+  if(!shape1->geometry) /* if no geometry for shape1 then build one */
+    shape1->geometry = (GEOSGeom) msGEOSShape2Geometry(shape1);
+  g1 = shape1->geometry;
+  if(!g1) return -1;
+
+  if(!shape2->geometry) /* if no geometry for shape2 then build one */
+    shape2->geometry = (GEOSGeom) msGEOSShape2Geometry(shape2);
+  g2 = shape2->geometry;
+  if(!g2) return -1;
+
+#ifdef MS_GEOS_PREPARED
+  if(shape1->preparedgeometry) {
+    result = GEOSPreparedContainsProperly_r(handle, (const GEOSPreparedGeometry*) shape1->preparedgeometry, g2);
+    return ((result==2) ? -1 : result);
+  }
+#endif
+  result = GEOSRelatePattern_r(handle, g1, g2, "T**FF*FF*");
+  return ((result==2) ? -1 : result);
+#else
+  msSetError(MS_GEOSERR, "GEOS support is not available.", "msGEOSContainsProperly()");
+  return -1;
+#endif
+}
+
 /*
 ** Does shape1 overlap shape2, returns MS_TRUE/MS_FALSE or -1 for an error.
 */
@@ -1143,6 +1252,11 @@ int msGEOSOverlaps(shapeObj *shape1, shapeObj *shape2)
   g2 = shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedOverlaps_r, &GEOSPreparedOverlaps_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSOverlaps_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1174,6 +1288,11 @@ int msGEOSWithin(shapeObj *shape1, shapeObj *shape2)
   g2 = shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedWithin_r, &GEOSPreparedContains_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSWithin_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1205,6 +1324,11 @@ int msGEOSCrosses(shapeObj *shape1, shapeObj *shape2)
   g2 = shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedCrosses_r, &GEOSPreparedCrosses_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSCrosses_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1236,6 +1360,11 @@ int msGEOSIntersects(shapeObj *shape1, shapeObj *shape2)
   g2 = (GEOSGeom) shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedIntersects_r, &GEOSPreparedIntersects_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSIntersects_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1288,6 +1417,11 @@ int msGEOSTouches(shapeObj *shape1, shapeObj *shape2)
   g2 = (GEOSGeom) shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedTouches_r, &GEOSPreparedTouches_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSTouches_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -1350,6 +1484,11 @@ int msGEOSDisjoint(shapeObj *shape1, shapeObj *shape2)
   g2 = (GEOSGeom) shape2->geometry;
   if(!g2) return -1;
 
+#ifdef MS_GEOS_PREPARED
+  result = msGEOSPreparedPredicate(handle, shape1, g1, shape2, g2, &GEOSPreparedDisjoint_r, &GEOSPreparedDisjoint_r);
+  if(result != -2)
+    return result;
+#endif
   result = GEOSDisjoint_r(handle,g1, g2);
   return ((result==2) ? -1 : result);
 #else
@@ -40,6 +40,100 @@
 
 static int msGMLGeometryLookup(gmlGeometryListObj *geometryList, const char *type);
 
+/*
+** Functions that write coordinate lists. Vertices are formatted into a
+** local buffer that is handed to msIO in large chunks, rather than with
+** one msIO_fprintf() call per vertex.
+*/
+
+#define GML_COORD_BUFFER_SIZE 16384
+#define GML_COORD_MAX_LEN     320 /* "%f" of DBL_MAX is 317 characters */
+
+/*
+** Formats value exactly like printf("%f"), returns the number of characters
+** written. Most coordinates take a fast path that only uses integer
+** arithmetic, values near a rounding tie or out of range go through snprintf().
+*/
+static int gmlFormatCoordinate(char *buf, double value)
+{
+  char digits[24];
+  double absvalue, intpart, scaled, frac;
+  unsigned long long ipart, fpart;
+  int n = 0, ndigits = 0, i;
+
+  absvalue = fabs(value);
+  if(msIsNan(value) || absvalue >= 1e15)
+    return snprintf(buf, GML_COORD_MAX_LEN, "%f", value);
+
+  intpart = floor(absvalue);
+  scaled = (absvalue - intpart) * 1e6; /* exact subtraction, rounded product */
+  frac = scaled - floor(scaled);
+  if(fabs(frac - 0.5) < 1e-6) /* too close to a tie to trust the product */
+    return snprintf(buf, GML_COORD_MAX_LEN, "%f", value);
+
+  ipart = (unsigned long long) intpart;
+  fpart = (unsigned long long) (scaled + 0.5);
+  if(fpart >= 1000000) {
+    ipart++;
+    fpart -= 1000000;
+  }
+
+  if(signbit(value))
+    buf[n++] = '-';
+
+  do {
+    digits[ndigits++] = (char)('0' + ipart % 10);
+    ipart /= 10;
+  } while(ipart);
+  while(ndigits)
+    buf[n++] = digits[--ndigits];
+
+  buf[n++] = '.';
+  for(i=5; i>=0; i--) {
+    buf[n+i] = (char)('0' + fpart % 10);
+    fpart /= 10;
+  }
+  n += 6;
+  buf[n] = '\0';
+
+  return n;
+}
+
+/*
+** Writes the vertices of a line as "x<sep>y[<sep>z] " tuples, the format of
+** the GML 2 coordinates (sep = ',') and GML 3 posList (sep = ' ') elements.
+*/
+static void gmlWriteCoordinates(FILE *stream, lineObj *line, int nSRSDimension,
+                                char sep)
+{
+  char buffer[GML_COORD_BUFFER_SIZE];
+  size_t len = 0;
+  int j;
+
+  (void)nSRSDimension;
+
+  for(j=0; j<line->numpoints; j++) {
+    if(len + 3 * (GML_COORD_MAX_LEN + 1) > sizeof(buffer)) {
+      msIO_fwrite(buffer, 1, len, stream);
+      len = 0;
+    }
+
+    len += gmlFormatCoordinate(buffer + len, line->point[j].x);
+    buffer[len++] = sep;
+    len += gmlFormatCoordinate(buffer + len, line->point[j].y);
+#ifdef USE_POINT_Z_M
+    if( nSRSDimension == 3 ) {
+      buffer[len++] = sep;
+      len += gmlFormatCoordinate(buffer + len, line->point[j].z);
+    }
+#endif
+    buffer[len++] = ' ';
+  }
+
+  if(len > 0)
+    msIO_fwrite(buffer, 1, len, stream);
+}
+
 /*
 ** Functions that write the feature boundary geometry (i.e. a rectObj).
 */
@@ -238,17 +332,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
             msIO_fprintf(stream, "%s<gml:LineString>\n", tab);
 
           msIO_fprintf(stream, "%s  <gml:coordinates>", tab);
-          for(j=0; j<shape->line[i].numpoints; j++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f,%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y,
-                           shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-            msIO_fprintf(stream, "%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ',');
           msIO_fprintf(stream, "</gml:coordinates>\n");
 
           msIO_fprintf(stream, "%s</gml:LineString>\n", tab);
@@ -269,17 +353,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
           msIO_fprintf(stream, "%s    <gml:LineString>\n", tab); /* no srsname at this point */
 
           msIO_fprintf(stream, "%s      <gml:coordinates>", tab);
-          for(i=0; i<shape->line[j].numpoints; i++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f,%f,%f ", shape->line[j].point[i].x, shape->line[j].point[i].y,
-                           shape->line[j].point[i].z);
-            else
-                /* fall-through */
-#endif
-            msIO_fprintf(stream, "%f,%f ", shape->line[j].point[i].x, shape->line[j].point[i].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[j]), nSRSDimension, ',');
           msIO_fprintf(stream, "</gml:coordinates>\n");
           msIO_fprintf(stream, "%s    </gml:LineString>\n", tab);
           msIO_fprintf(stream, "%s  </gml:lineStringMember>\n", tab);
@@ -327,17 +401,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
           msIO_fprintf(stream, "%s    <gml:LinearRing>\n", tab);
 
           msIO_fprintf(stream, "%s      <gml:coordinates>", tab);
-          for(j=0; j<shape->line[i].numpoints; j++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f,%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y,
-                           shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-            msIO_fprintf(stream, "%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ',');
           msIO_fprintf(stream, "</gml:coordinates>\n");
 
           msIO_fprintf(stream, "%s    </gml:LinearRing>\n", tab);
@@ -349,17 +413,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
               msIO_fprintf(stream, "%s    <gml:LinearRing>\n", tab);
 
               msIO_fprintf(stream, "%s      <gml:coordinates>", tab);
-              for(j=0; j<shape->line[k].numpoints; j++)
-              {
-#ifdef USE_POINT_Z_M
-                if( nSRSDimension == 3 )
-                  msIO_fprintf(stream, "%f,%f,%f ", shape->line[k].point[j].x, shape->line[k].point[j].y,
-                           shape->line[k].point[j].z);
-                else
-                  /* fall-through */
-#endif
-                msIO_fprintf(stream, "%f,%f ", shape->line[k].point[j].x, shape->line[k].point[j].y);
-              }
+              gmlWriteCoordinates(stream, &(shape->line[k]), nSRSDimension, ',');
               msIO_fprintf(stream, "</gml:coordinates>\n");
 
               msIO_fprintf(stream, "%s    </gml:LinearRing>\n", tab);
@@ -394,17 +448,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
             msIO_fprintf(stream, "%s      <gml:LinearRing>\n", tab);
 
             msIO_fprintf(stream, "%s        <gml:coordinates>", tab);
-            for(j=0; j<shape->line[i].numpoints; j++)
-            {
-#ifdef USE_POINT_Z_M
-              if( nSRSDimension == 3 )
-                msIO_fprintf(stream, "%f,%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y,
-                             shape->line[i].point[j].z);
-              else
-                /* fall-through */
-#endif
-              msIO_fprintf(stream, "%f,%f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-            }
+            gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ',');
             msIO_fprintf(stream, "</gml:coordinates>\n");
 
             msIO_fprintf(stream, "%s      </gml:LinearRing>\n", tab);
@@ -416,17 +460,7 @@ static int gmlWriteGeometry_GML2(FILE *stream, gmlGeometryListObj *geometryList,
                 msIO_fprintf(stream, "%s      <gml:LinearRing>\n", tab);
 
                 msIO_fprintf(stream, "%s        <gml:coordinates>", tab);
-                for(j=0; j<shape->line[k].numpoints; j++)
-                {
-#ifdef USE_POINT_Z_M
-                  if( nSRSDimension == 3 )
-                    msIO_fprintf(stream, "%f,%f,%f ", shape->line[k].point[j].x, shape->line[k].point[j].y,
-                                shape->line[k].point[j].z);
-                  else
-                    /* fall-through */
-#endif
-                  msIO_fprintf(stream, "%f,%f ", shape->line[k].point[j].x, shape->line[k].point[j].y);
-                }
+                gmlWriteCoordinates(stream, &(shape->line[k]), nSRSDimension, ',');
                 msIO_fprintf(stream, "</gml:coordinates>\n");
 
                 msIO_fprintf(stream, "%s      </gml:LinearRing>\n", tab);
@@ -596,16 +630,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
           msFree(pszGMLId);
 
           msIO_fprintf(stream, "%s    <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-          for(j=0; j<shape->line[i].numpoints; j++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f %f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y, shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-              msIO_fprintf(stream, "%f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ' ');
           msIO_fprintf(stream, "</gml:posList>\n");
 
           msIO_fprintf(stream, "%s  </gml:LineString>\n", tab);
@@ -630,16 +655,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
           msFree(pszGMLId);
 
           msIO_fprintf(stream, "%s        <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-          for(j=0; j<shape->line[i].numpoints; j++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f %f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y, shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-              msIO_fprintf(stream, "%f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ' ');
 
           msIO_fprintf(stream, "</gml:posList>\n");
           msIO_fprintf(stream, "%s      </gml:LineString>\n", tab);
@@ -691,16 +707,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
           msIO_fprintf(stream, "%s      <gml:LinearRing>\n", tab);
 
           msIO_fprintf(stream, "%s        <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-          for(j=0; j<shape->line[i].numpoints; j++)
-          {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f %f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y, shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-              msIO_fprintf(stream, "%f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-          }
+          gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ' ');
 
           msIO_fprintf(stream, "</gml:posList>\n");
 
@@ -713,16 +720,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
               msIO_fprintf(stream, "%s      <gml:LinearRing>\n", tab);
 
               msIO_fprintf(stream, "%s        <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-              for(j=0; j<shape->line[k].numpoints; j++)
-              {
-#ifdef USE_POINT_Z_M
-                if( nSRSDimension == 3 )
-                    msIO_fprintf(stream, "%f %f %f ", shape->line[k].point[j].x, shape->line[k].point[j].y, shape->line[k].point[j].z);
-                else
-                        /* fall-through */
-#endif
-                msIO_fprintf(stream, "%f %f ", shape->line[k].point[j].x, shape->line[k].point[j].y);
-              }
+              gmlWriteCoordinates(stream, &(shape->line[k]), nSRSDimension, ' ');
 
               msIO_fprintf(stream, "</gml:posList>\n");
 
@@ -766,16 +764,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
             msIO_fprintf(stream, "%s          <gml:LinearRing>\n", tab);
 
             msIO_fprintf(stream, "%s            <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-            for(j=0; j<shape->line[i].numpoints; j++)
-            {
-#ifdef USE_POINT_Z_M
-            if( nSRSDimension == 3 )
-              msIO_fprintf(stream, "%f %f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y, shape->line[i].point[j].z);
-            else
-                /* fall-through */
-#endif
-              msIO_fprintf(stream, "%f %f ", shape->line[i].point[j].x, shape->line[i].point[j].y);
-            }
+            gmlWriteCoordinates(stream, &(shape->line[i]), nSRSDimension, ' ');
 
             msIO_fprintf(stream, "</gml:posList>\n");
 
@@ -788,16 +777,7 @@ static int gmlWriteGeometry_GML3(FILE *stream, gmlGeometryListObj *geometryList,
                 msIO_fprintf(stream, "%s          <gml:LinearRing>\n", tab);
 
                 msIO_fprintf(stream, "%s            <gml:posList srsDimension=\"%d\">", tab, nSRSDimension);
-                for(j=0; j<shape->line[k].numpoints; j++)
-                {
-#ifdef USE_POINT_Z_M
-                  if( nSRSDimension == 3 )
-                    msIO_fprintf(stream, "%f %f %f ", shape->line[k].point[j].x, shape->line[k].point[j].y, shape->line[k].point[j].z);
-                  else
-                        /* fall-through */
-#endif
-                  msIO_fprintf(stream, "%f %f ", shape->line[k].point[j].x, shape->line[k].point[j].y);
-                }
+                gmlWriteCoordinates(stream, &(shape->line[k]), nSRSDimension, ' ');
                 msIO_fprintf(stream, "</gml:posList>\n");
 
                 msIO_fprintf(stream, "%s          </gml:LinearRing>\n", tab);
@@ -1636,6 +1616,356 @@ void msGMLWriteWFSBounds(mapObj *map, FILE *stream, const char *tab,
   }
 }
 
+/*
+** State needed to serialize the features of one layer in a WFS response.
+*/
+typedef struct {
+  layerObj *lp;
+  char *layerName;
+  const char *namespace_prefix;
+  int featureIdIndex; /* -1 means no feature id */
+  char *srs;
+  int bOutputGMLIdOnly;
+  int nSRSDimension;
+  gmlGroupListObj *groupList;
+  gmlItemListObj *itemList;
+  gmlConstantListObj *constantList;
+  gmlGeometryListObj *geometryList;
+  reprojectionObj *reprojector;
+} gmlWFSLayerWriterObj;
+
+static void msGMLFreeWFSLayerWriter(gmlWFSLayerWriterObj *writer)
+{
+  msProjectDestroyReprojector(writer->reprojector);
+  msFree(writer->srs);
+  msFree(writer->layerName);
+  msGMLFreeGroups(writer->groupList);
+  msGMLFreeConstants(writer->constantList);
+  msGMLFreeItems(writer->itemList);
+  msGMLFreeGeometries(writer->geometryList);
+  memset(writer, 0, sizeof(gmlWFSLayerWriterObj));
+}
+
+/*
+** Prepares the writer for a layer. If bProject is set, shapes handed to
+** msGMLWriteWFSFeature() are expected in the layer projection and are
+** reprojected to the map projection.
+*/
+static int msGMLInitWFSLayerWriter(gmlWFSLayerWriterObj *writer, mapObj *map, layerObj *lp,
+                                   FILE *stream, const char *default_namespace_prefix,
+                                   OWSGMLVersion outputformat, int bUseURN,
+                                   int bGetPropertyValueRequest, int bProject)
+{
+  const char *value;
+  const char *geomtype;
+  int j;
+
+  memset(writer, 0, sizeof(gmlWFSLayerWriterObj));
+  writer->lp = lp;
+  writer->featureIdIndex = -1;
+  writer->nSRSDimension = 2;
+
+  /* setup namespace, a layer can override the default */
+  writer->namespace_prefix = msOWSLookupMetadata(&(lp->metadata), "OFG", "namespace_prefix");
+  if(!writer->namespace_prefix) writer->namespace_prefix = default_namespace_prefix;
+
+  geomtype = msOWSLookupMetadata(&(lp->metadata), "OFG", "geomtype");
+  if( geomtype != NULL && (strstr(geomtype, "25d") != NULL || strstr(geomtype, "25D") != NULL) )
+  {
+#ifdef USE_POINT_Z_M
+      writer->nSRSDimension = 3;
+#else
+      msIO_fprintf(stream, "<!-- WARNING: 25d requested forn typename '%s' but MapServer compiled without USE_POINT_Z_M support. -->\n", lp->name);
+#endif
+  }
+
+  value = msOWSLookupMetadata(&(lp->metadata), "OFG", "featureid");
+  if(value) { /* find the featureid amongst the items for this layer */
+    for(j=0; j<lp->numitems; j++) {
+      if(strcasecmp(lp->items[j], value) == 0) { /* found it */
+        writer->featureIdIndex = j;
+        break;
+      }
+    }
+
+    /* Produce a warning if a featureid was set but the corresponding item is not found. */
+    if (writer->featureIdIndex == -1)
+      msIO_fprintf(stream, "<!-- WARNING: FeatureId item '%s' not found in typename '%s'. -->\n", value, lp->name);
+  }
+  else if( outputformat == OWS_GML32 )
+      msIO_fprintf(stream, "<!-- WARNING: No featureid defined for typename '%s'. Output will not validate. -->\n", lp->name);
+
+  /* populate item and group metadata structures */
+  writer->itemList = msGMLGetItems(lp, "G");
+  writer->constantList = msGMLGetConstants(lp, "G");
+  writer->groupList = msGMLGetGroups(lp, "G");
+  writer->geometryList = msGMLGetGeometries(lp, "GFO", MS_FALSE);
+  if (writer->itemList == NULL || writer->constantList == NULL ||
+      writer->groupList == NULL || writer->geometryList == NULL) {
+    msSetError(MS_MISCERR, "Unable to populate item and group metadata structures", "msGMLWriteWFSQuery()");
+    msGMLFreeWFSLayerWriter(writer);
+    return MS_FAILURE;
+  }
+
+  if( bGetPropertyValueRequest )
+  {
+    value = msOWSLookupMetadata(&(lp->metadata), "G", "include_items");
+    if( value != NULL && strcmp(value, "@gml:id") == 0 )
+        writer->bOutputGMLIdOnly = MS_TRUE;
+  }
+
+  if (writer->namespace_prefix) {
+    writer->layerName = (char *) msSmallMalloc(strlen(writer->namespace_prefix)+strlen(lp->name)+2);
+    sprintf(writer->layerName, "%s:%s", writer->namespace_prefix, lp->name);
+  } else {
+    writer->layerName = msStrdup(lp->name);
+  }
+
+  if( bUseURN )
+  {
+      writer->srs = msOWSGetProjURN(&(map->projection), NULL, "FGO", MS_TRUE);
+      if (!writer->srs)
+        writer->srs = msOWSGetProjURN(&(map->projection), &(map->web.metadata), "FGO", MS_TRUE);
+      if (!writer->srs)
+        writer->srs = msOWSGetProjURN(&(lp->projection), &(lp->metadata), "FGO", MS_TRUE);
+  }
+  else
+  {
+      msOWSGetEPSGProj(&(map->projection), NULL, "FGO", MS_TRUE, &writer->srs);
+      if (!writer->srs)
+        msOWSGetEPSGProj(&(map->projection), &(map->web.metadata), "FGO", MS_TRUE, &writer->srs);
+      if (!writer->srs)
+        msOWSGetEPSGProj(&(lp->projection), &(lp->metadata), "FGO", MS_TRUE, &writer->srs);
+  }
+
+  if(bProject && msProjectionsDiffer(&(lp->projection), &(map->projection))) {
+    writer->reprojector = msProjectCreateReprojector(&(lp->projection), &(map->projection));
+    if( writer->reprojector == NULL ) {
+       msGMLFreeWFSLayerWriter(writer);
+       return MS_FAILURE;
+    }
+  }
+
+  return MS_SUCCESS;
+}
+
+/*
+** Writes one feature. The shape is modified (reprojected and axis swapped
+** if needed).
+*/
+static void msGMLWriteWFSFeature(gmlWFSLayerWriterObj *writer, FILE *stream,
+                                 shapeObj *shape, OWSGMLVersion outputformat,
+                                 int nWFSVersion, int bSwapAxis,
+                                 int bGetPropertyValueRequest)
+{
+  const char *layerName = writer->layerName;
+  const char *namespace_prefix = writer->namespace_prefix;
+  gmlItemListObj *itemList = writer->itemList;
+  gmlConstantListObj *constantList = writer->constantList;
+  gmlGroupListObj *groupList = writer->groupList;
+  gmlGeometryListObj *geometryList = writer->geometryList;
+  gmlItemObj *item=NULL;
+  gmlConstantObj *constant=NULL;
+  char* pszFID;
+  int k;
+
+  /* project the shape into the map projection (if necessary), note that this projects the bounds as well */
+  if(writer->reprojector)
+    msProjectShapeEx(writer->reprojector, shape);
+
+  if(writer->featureIdIndex != -1) {
+      pszFID = (char*) msSmallMalloc( strlen(writer->lp->name) + 1 + strlen(shape->values[writer->featureIdIndex]) + 1 );
+      sprintf(pszFID, "%s.%s", writer->lp->name, shape->values[writer->featureIdIndex]);
+  }
+  else
+      pszFID = msStrdup("");
+
+
+  if( writer->bOutputGMLIdOnly )
+  {
+      msIO_fprintf(stream, "    <wfs:member>%s</wfs:member>\n", pszFID);
+      msFree(pszFID);
+      return;
+  }
+
+  /*
+  ** start this feature
+  */
+  if( nWFSVersion == OWS_2_0_0 )
+      msIO_fprintf(stream, "    <wfs:member>\n");
+  else
+      msIO_fprintf(stream, "    <gml:featureMember>\n");
+  if(msIsXMLTagValid(layerName) == MS_FALSE)
+      msIO_fprintf(stream, "<!-- WARNING: The value '%s' is not valid in a XML tag context. -->\n", layerName);
+  if(writer->featureIdIndex != -1) {
+      if( !bGetPropertyValueRequest )
+      {
+          if(outputformat == OWS_GML2)
+              msIO_fprintf(stream, "      <%s fid=\"%s\">\n", layerName, pszFID);
+          else  /* OWS_GML3 or OWS_GML32 */
+              msIO_fprintf(stream, "      <%s gml:id=\"%s\">\n", layerName, pszFID);
+      }
+  } else {
+      if( !bGetPropertyValueRequest )
+          msIO_fprintf(stream, "      <%s>\n", layerName);
+  }
+
+  if (bSwapAxis)
+    msAxisSwapShape(shape);
+
+  /* write the feature geometry and bounding box */
+  if(!(geometryList && geometryList->numgeometries == 1 &&
+      strcasecmp(geometryList->geometries[0].name, "none") == 0)) {
+    if( !bGetPropertyValueRequest )
+      gmlWriteBounds(stream, outputformat, &(shape->bounds), writer->srs, "        ", "gml");
+    gmlWriteGeometry(stream, geometryList, outputformat, shape, writer->srs,
+                     namespace_prefix, "        ", pszFID, writer->nSRSDimension);
+  }
+
+  /* write any item/values */
+  for(k=0; k<itemList->numitems; k++) {
+    item = &(itemList->items[k]);
+    if(msItemInGroups(item->name, groupList) == MS_FALSE)
+      msGMLWriteItem(stream, item, shape->values[k], namespace_prefix,
+                     "        ", outputformat, pszFID);
+  }
+
+  /* write any constants */
+  for(k=0; k<constantList->numconstants; k++) {
+    constant = &(constantList->constants[k]);
+    if(msItemInGroups(constant->name, groupList) == MS_FALSE)
+      msGMLWriteConstant(stream, constant, namespace_prefix, "        ");
+  }
+
+  /* write any groups */
+  for(k=0; k<groupList->numgroups; k++)
+    msGMLWriteGroup(stream, &(groupList->groups[k]), shape, itemList,
+                    constantList, namespace_prefix, "        ", outputformat, pszFID);
+
+  if( !bGetPropertyValueRequest )
+      /* end this feature */
+      msIO_fprintf(stream, "      </%s>\n", layerName);
+
+  if( nWFSVersion == OWS_2_0_0 )
+    msIO_fprintf(stream, "    </wfs:member>\n");
+  else
+    msIO_fprintf(stream, "    </gml:featureMember>\n");
+
+  msFree(pszFID);
+}
+
+/*
+** Streaming counterpart of msGMLWriteWFSQuery(): features are written as the
+** query reads them (see queryObj.shape_callback) instead of being fetched
+** again from the result cache.
+*/
+struct gmlWFSQueryStreamObj {
+  mapObj *map;
+  FILE *stream;
+  const char *default_namespace_prefix;
+  OWSGMLVersion outputformat;
+  int nWFSVersion;
+  int bUseURN;
+  int bSwapAxis;
+  gmlWFSLayerWriterObj writer;
+  int status;
+};
+
+/*
+** msGMLStartWFSQueryStream()
+**
+** Must be called before the query is run with msGMLWriteWFSQueryStreamShape()
+** as the shape callback. If bKnownBounds is set, the result bounds of the
+** query are known (from a previous counting pass) and are written as the
+** bounds of the collection. Otherwise they can only be reported as unknown.
+*/
+gmlWFSQueryStreamObj *msGMLStartWFSQueryStream(mapObj *map, FILE *stream,
+                                              const char *default_namespace_prefix,
+                                              OWSGMLVersion outputformat,
+                                              int nWFSVersion, int bUseURN,
+                                              int bKnownBounds)
+{
+  gmlWFSQueryStreamObj *wfsstream;
+
+  wfsstream = (gmlWFSQueryStreamObj *) msSmallCalloc(1, sizeof(gmlWFSQueryStreamObj));
+  wfsstream->map = map;
+  wfsstream->stream = stream;
+  wfsstream->default_namespace_prefix = default_namespace_prefix;
+  wfsstream->outputformat = outputformat;
+  wfsstream->nWFSVersion = nWFSVersion;
+  wfsstream->bUseURN = bUseURN;
+  wfsstream->bSwapAxis = msIsAxisInvertedProj(&(map->projection));
+  wfsstream->status = MS_SUCCESS;
+
+  /* Need to start with BBOX of the whole resultset */
+  if( bKnownBounds )
+    msGMLWriteWFSBounds(map, stream, "      ", outputformat, nWFSVersion, bUseURN);
+  else if( nWFSVersion < OWS_2_0_0 ) {
+    /* the collection bounds are mandatory before WFS 2.0 */
+    msIO_fprintf(stream, "      <gml:boundedBy>\n");
+    if(outputformat == OWS_GML3 || outputformat == OWS_GML32)
+      msIO_fprintf(stream, "        <gml:Null>unknown</gml:Null>\n");
+    else
+      msIO_fprintf(stream, "        <gml:null>unknown</gml:null>\n");
+    msIO_fprintf(stream, "      </gml:boundedBy>\n");
+  }
+
+  return wfsstream;
+}
+
+/*
+** msGMLWriteWFSQueryStreamShape()
+**
+** Shape callback writing the shape (already in the map projection) as a
+** feature of the response.
+*/
+int msGMLWriteWFSQueryStreamShape(void *user_data, layerObj *lp, shapeObj *shape)
+{
+  gmlWFSQueryStreamObj *wfsstream = (gmlWFSQueryStreamObj *) user_data;
+
+  if(wfsstream->status != MS_SUCCESS)
+    return MS_FAILURE;
+
+  if(wfsstream->writer.lp != lp) {
+    if(wfsstream->writer.lp)
+      msGMLFreeWFSLayerWriter(&wfsstream->writer);
+    if(msGMLInitWFSLayerWriter(&wfsstream->writer, wfsstream->map, lp,
+                               wfsstream->stream,
+                               wfsstream->default_namespace_prefix,
+                               wfsstream->outputformat, wfsstream->bUseURN,
+                               MS_FALSE, MS_FALSE) != MS_SUCCESS) {
+      wfsstream->status = MS_FAILURE;
+      return MS_FAILURE;
+    }
+  }
+
+  msGMLWriteWFSFeature(&wfsstream->writer, wfsstream->stream, shape,
+                       wfsstream->outputformat, wfsstream->nWFSVersion,
+                       wfsstream->bSwapAxis, MS_FALSE);
+
+  return MS_SUCCESS;
+}
+
+/*
+** msGMLEndWFSQueryStream()
+**
+** Releases the stream, returns MS_FAILURE if writing failed at some point.
+*/
+int msGMLEndWFSQueryStream(gmlWFSQueryStreamObj *wfsstream)
+{
+  int status;
+
+  if(!wfsstream)
+    return MS_FAILURE;
+
+  status = wfsstream->status;
+  if(wfsstream->writer.lp)
+    msGMLFreeWFSLayerWriter(&wfsstream->writer);
+  msFree(wfsstream);
+
+  return status;
+}
+
 #endif
 
 /*
@@ -1649,18 +1979,9 @@ int msGMLWriteWFSQuery(mapObj *map, FILE *stream, const char *default_namespace_
 {
 #ifdef USE_WFS_SVR
   int status;
-  int i,j,k;
+  int i,j;
   layerObj *lp=NULL;
   shapeObj shape;
-
-  gmlGroupListObj *groupList=NULL;
-  gmlItemListObj *itemList=NULL;
-  gmlConstantListObj *constantList=NULL;
-  gmlGeometryListObj *geometryList=NULL;
-  gmlItemObj *item=NULL;
-  gmlConstantObj *constant=NULL;
-
-  const char *namespace_prefix=NULL;
   int bSwapAxis;
 
   msInitShape(&shape);
@@ -1678,101 +1999,14 @@ int msGMLWriteWFSQuery(mapObj *map, FILE *stream, const char *default_namespace_
     lp = GET_LAYER(map, map->layerorder[i]);
 
     if(lp->resultcache && lp->resultcache->numresults > 0)  { /* found results */
-      char *layerName;
-      const char *value;
-      int featureIdIndex=-1; /* no feature id */
-      char* srs = NULL;
-      int bOutputGMLIdOnly = MS_FALSE;
-      int nSRSDimension = 2;
-      const char* geomtype;
-      reprojectionObj* reprojector = NULL;
-
-      /* setup namespace, a layer can override the default */
-      namespace_prefix = msOWSLookupMetadata(&(lp->metadata), "OFG", "namespace_prefix");
-      if(!namespace_prefix) namespace_prefix = default_namespace_prefix;
-      
-      geomtype = msOWSLookupMetadata(&(lp->metadata), "OFG", "geomtype");
-      if( geomtype != NULL && (strstr(geomtype, "25d") != NULL || strstr(geomtype, "25D") != NULL) )
-      {
-#ifdef USE_POINT_Z_M
-          nSRSDimension = 3;
-#else
-          msIO_fprintf(stream, "<!-- WARNING: 25d requested forn typename '%s' but MapServer compiled without USE_POINT_Z_M support. -->\n", lp->name);
-#endif
-      }
+      gmlWFSLayerWriterObj writer;
 
-      value = msOWSLookupMetadata(&(lp->metadata), "OFG", "featureid");
-      if(value) { /* find the featureid amongst the items for this layer */
-        for(j=0; j<lp->numitems; j++) {
-          if(strcasecmp(lp->items[j], value) == 0) { /* found it */
-            featureIdIndex = j;
-            break;
-          }
-        }
-
-        /* Produce a warning if a featureid was set but the corresponding item is not found. */
-        if (featureIdIndex == -1)
-          msIO_fprintf(stream, "<!-- WARNING: FeatureId item '%s' not found in typename '%s'. -->\n", value, lp->name);
-      }
-      else if( outputformat == OWS_GML32 )
-          msIO_fprintf(stream, "<!-- WARNING: No featureid defined for typename '%s'. Output will not validate. -->\n", lp->name);
-
-      /* populate item and group metadata structures */
-      itemList = msGMLGetItems(lp, "G");
-      constantList = msGMLGetConstants(lp, "G");
-      groupList = msGMLGetGroups(lp, "G");
-      geometryList = msGMLGetGeometries(lp, "GFO", MS_FALSE);
-      if (itemList == NULL || constantList == NULL || groupList == NULL || geometryList == NULL) {
-        msSetError(MS_MISCERR, "Unable to populate item and group metadata structures", "msGMLWriteWFSQuery()");
+      if(msGMLInitWFSLayerWriter(&writer, map, lp, stream, default_namespace_prefix,
+                                 outputformat, bUseURN, bGetPropertyValueRequest,
+                                 MS_TRUE) != MS_SUCCESS)
         return MS_FAILURE;
-      }
-      
-      if( bGetPropertyValueRequest )
-      {
-        const char* value = msOWSLookupMetadata(&(lp->metadata), "G", "include_items");
-        if( value != NULL && strcmp(value, "@gml:id") == 0 )
-            bOutputGMLIdOnly = MS_TRUE;
-      }
-
-      if (namespace_prefix) {
-        layerName = (char *) msSmallMalloc(strlen(namespace_prefix)+strlen(lp->name)+2);
-        sprintf(layerName, "%s:%s", namespace_prefix, lp->name);
-      } else {
-        layerName = msStrdup(lp->name);
-      }
-
-      if( bUseURN )
-      {
-          srs = msOWSGetProjURN(&(map->projection), NULL, "FGO", MS_TRUE);
-          if (!srs)
-            srs = msOWSGetProjURN(&(map->projection), &(map->web.metadata), "FGO", MS_TRUE);
-          if (!srs)
-            srs = msOWSGetProjURN(&(lp->projection), &(lp->metadata), "FGO", MS_TRUE);
-      }
-      else
-      {
-          msOWSGetEPSGProj(&(map->projection), NULL, "FGO", MS_TRUE, &srs);
-          if (!srs)
-            msOWSGetEPSGProj(&(map->projection), &(map->web.metadata), "FGO", MS_TRUE, &srs);
-          if (!srs)
-            msOWSGetEPSGProj(&(lp->projection), &(lp->metadata), "FGO", MS_TRUE, &srs);
-      }
-
-      if(msProjectionsDiffer(&(lp->projection), &(map->projection))) {
-        reprojector = msProjectCreateReprojector(&(lp->projection), &(map->projection));
-        if( reprojector == NULL ) {
-           msGMLFreeGroups(groupList);
-           msGMLFreeConstants(constantList);
-           msGMLFreeItems(itemList);
-           msGMLFreeGeometries(geometryList);
-           msFree(layerName);
-           return MS_FAILURE;
-        }
-      }
 
       for(j=0; j<lp->resultcache->numresults; j++) {
-        char* pszFID;
-
         if( lp->resultcache->results[j].shape )
         {
             /* msDebug("Using cached shape %ld\n", lp->resultcache->results[j].shapeindex); */
@@ -1782,116 +2016,19 @@ int msGMLWriteWFSQuery(mapObj *map, FILE *stream, const char *default_namespace_
         {
             status = msLayerGetShape(lp, &shape, &(lp->resultcache->results[j]));
             if(status != MS_SUCCESS) {
-                msGMLFreeGroups(groupList);
-                msGMLFreeConstants(constantList);
-                msGMLFreeItems(itemList);
-                msGMLFreeGeometries(geometryList);
-                msFree(layerName);
-                msProjectDestroyReprojector(reprojector);
+                msGMLFreeWFSLayerWriter(&writer);
                 return(status);
             }
         }
 
-        /* project the shape into the map projection (if necessary), note that this projects the bounds as well */
-        if(reprojector)
-          msProjectShapeEx(reprojector, &shape);
+        msGMLWriteWFSFeature(&writer, stream, &shape, outputformat, nWFSVersion,
+                             bSwapAxis, bGetPropertyValueRequest);
 
-        if(featureIdIndex != -1) {
-            pszFID = (char*) msSmallMalloc( strlen(lp->name) + 1 + strlen(shape.values[featureIdIndex]) + 1 );
-            sprintf(pszFID, "%s.%s", lp->name, shape.values[featureIdIndex]);
-        }
-        else
-            pszFID = msStrdup("");
-
-
-        if( bOutputGMLIdOnly )
-        {
-            msIO_fprintf(stream, "    <wfs:member>%s</wfs:member>\n", pszFID);
-            msFree(pszFID);
-            msFreeShape(&shape); /* init too */
-            continue;
-        }
-
-        /*
-        ** start this feature
-        */
-        if( nWFSVersion == OWS_2_0_0 )
-            msIO_fprintf(stream, "    <wfs:member>\n");
-        else
-            msIO_fprintf(stream, "    <gml:featureMember>\n");
-        if(msIsXMLTagValid(layerName) == MS_FALSE)
-            msIO_fprintf(stream, "<!-- WARNING: The value '%s' is not valid in a XML tag context. -->\n", layerName);
-        if(featureIdIndex != -1) {
-            if( !bGetPropertyValueRequest )
-            {
-                if(outputformat == OWS_GML2)
-                    msIO_fprintf(stream, "      <%s fid=\"%s\">\n", layerName, pszFID);
-                else  /* OWS_GML3 or OWS_GML32 */
-                    msIO_fprintf(stream, "      <%s gml:id=\"%s\">\n", layerName, pszFID);
-            }
-        } else {
-            if( !bGetPropertyValueRequest )
-                msIO_fprintf(stream, "      <%s>\n", layerName);
-        }
-
-        if (bSwapAxis)
-          msAxisSwapShape(&shape);
-
-        /* write the feature geometry and bounding box */
-        if(!(geometryList && geometryList->numgeometries == 1 &&
-            strcasecmp(geometryList->geometries[0].name, "none") == 0)) {
-          if( !bGetPropertyValueRequest )
-            gmlWriteBounds(stream, outputformat, &(shape.bounds), srs, "        ", "gml");
-          gmlWriteGeometry(stream, geometryList, outputformat, &(shape), srs,
-                           namespace_prefix, "        ", pszFID, nSRSDimension);
-        }
-
-        /* write any item/values */
-        for(k=0; k<itemList->numitems; k++) {
-          item = &(itemList->items[k]);
-          if(msItemInGroups(item->name, groupList) == MS_FALSE)
-            msGMLWriteItem(stream, item, shape.values[k], namespace_prefix,
-                           "        ", outputformat, pszFID);
-        }
-
-        /* write any constants */
-        for(k=0; k<constantList->numconstants; k++) {
-          constant = &(constantList->constants[k]);
-          if(msItemInGroups(constant->name, groupList) == MS_FALSE)
-            msGMLWriteConstant(stream, constant, namespace_prefix, "        ");
-        }
-
-        /* write any groups */
-        for(k=0; k<groupList->numgroups; k++)
-          msGMLWriteGroup(stream, &(groupList->groups[k]), &shape, itemList,
-                          constantList, namespace_prefix, "        ", outputformat, pszFID);
-
-        if( !bGetPropertyValueRequest )
-            /* end this feature */
-            msIO_fprintf(stream, "      </%s>\n", layerName);
-
-        if( nWFSVersion == OWS_2_0_0 )
-          msIO_fprintf(stream, "    </wfs:member>\n");
-        else
-          msIO_fprintf(stream, "    </gml:featureMember>\n");
-
-
-        msFree(pszFID);
-        pszFID = NULL;
         msFreeShape(&shape); /* init too */
       }
 
-      msProjectDestroyReprojector(reprojector);
-
-      msFree(srs);
-
       /* done with this layer, do a little clean-up */
-      msFree(layerName);
-
-      msGMLFreeGroups(groupList);
-      msGMLFreeConstants(constantList);
-      msGMLFreeItems(itemList);
-      msGMLFreeGeometries(geometryList);
+      msGMLFreeWFSLayerWriter(&writer);
 
       /* msLayerClose(lp); */
     }
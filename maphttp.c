@@ -55,6 +55,168 @@
  */
 #include <curl/curl.h>
 
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+/**********************************************************************
+ *                     Connection and handle pool
+ *
+ * Easy handles are kept in a process wide pool once their transfer is
+ * complete, and all of them are attached to a single share handle
+ * holding the DNS cache and the TLS session cache. In builds without
+ * thread support (and with libcurl >= 7.57) the share handle also holds
+ * the connection cache, so that connections to upstream servers stay
+ * alive across msHTTPExecuteRequests() calls, and across the requests of
+ * a FastCGI process, instead of being torn down with each multi handle.
+ * libcurl does not support using a shared connection cache from several
+ * threads at once, so threaded builds only keep the name resolution and
+ * TLS handshakes.
+ *
+ * Config options:
+ *  - MS_HTTP_CONNECTION_POOL=NO disables the pool and the share handle,
+ *  - MS_HTTP_CONNECTION_POOL_SIZE (default 16) bounds the number of idle
+ *    easy handles kept,
+ *  - MS_HTTP_MAX_HOST_CONNECTIONS (default unlimited) bounds the number
+ *    of connections opened in parallel to a single host by one
+ *    msHTTPExecuteRequests() call. The limit applies to each multi handle,
+ *    concurrent calls (e.g. from other threads) are not accounted for.
+ **********************************************************************/
+#define MS_HTTP_POOL_DEFAULT_SIZE 16
+#define MS_HTTP_POOL_MAX_SIZE 256
+
+static CURLSH *gpsCurlShare = NULL;
+static CURL *gapsCurlPool[MS_HTTP_POOL_MAX_SIZE];
+static int gnCurlPoolSize = 0;
+
+static int msHTTPPoolEnabled()
+{
+  return CSLTestBoolean(CPLGetConfigOption("MS_HTTP_CONNECTION_POOL", "YES"));
+}
+
+static int msHTTPShareLockId(curl_lock_data data)
+{
+  switch(data) {
+    case CURL_LOCK_DATA_DNS:
+      return TLOCK_HTTPSHARE + 1;
+    case CURL_LOCK_DATA_SSL_SESSION:
+      return TLOCK_HTTPSHARE + 2;
+#if LIBCURL_VERSION_NUM >= 0x073900 && !defined(USE_THREAD)
+    case CURL_LOCK_DATA_CONNECT:
+      return TLOCK_HTTPSHARE + 3;
+#endif
+    default:
+      return TLOCK_HTTPSHARE;
+  }
+}
+
+static void msHTTPShareLock(CURL *handle, curl_lock_data data,
+                            curl_lock_access access, void *userptr)
+{
+  (void)handle;
+  (void)access;
+  (void)userptr;
+  msAcquireLock(msHTTPShareLockId(data));
+}
+
+static void msHTTPShareUnlock(CURL *handle, curl_lock_data data, void *userptr)
+{
+  (void)handle;
+  (void)userptr;
+  msReleaseLock(msHTTPShareLockId(data));
+}
+
+/**********************************************************************
+ *                          msHTTPAcquireHandle()
+ *
+ * Returns an easy handle with default options, taken from the pool if
+ * one is available. NULL on failure.
+ **********************************************************************/
+static CURL *msHTTPAcquireHandle()
+{
+  CURL *http_handle = NULL;
+
+  if (!msHTTPPoolEnabled())
+    return curl_easy_init();
+
+  msAcquireLock(TLOCK_HTTPPOOL);
+  if (gpsCurlShare == NULL) {
+    gpsCurlShare = curl_share_init();
+    if (gpsCurlShare) {
+      curl_share_setopt(gpsCurlShare, CURLSHOPT_LOCKFUNC, msHTTPShareLock);
+      curl_share_setopt(gpsCurlShare, CURLSHOPT_UNLOCKFUNC, msHTTPShareUnlock);
+      curl_share_setopt(gpsCurlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(gpsCurlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 && !defined(USE_THREAD)
+      /* not thread safe in libcurl, see above */
+      curl_share_setopt(gpsCurlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+    }
+  }
+  if (gnCurlPoolSize > 0)
+    http_handle = gapsCurlPool[--gnCurlPoolSize];
+  msReleaseLock(TLOCK_HTTPPOOL);
+
+  if (http_handle == NULL) {
+    http_handle = curl_easy_init();
+    if (http_handle && gpsCurlShare)
+      curl_easy_setopt(http_handle, CURLOPT_SHARE, gpsCurlShare);
+  }
+
+  return http_handle;
+}
+
+/**********************************************************************
+ *                          msHTTPReleaseHandle()
+ *
+ * Gives an easy handle back to the pool, or destroys it if the pool is
+ * full or disabled. Its options are reset right away so that it does
+ * not keep pointers to the buffers of the request it served, its
+ * connections and caches are kept.
+ **********************************************************************/
+static void msHTTPReleaseHandle(CURL *http_handle)
+{
+  const char *pszPoolSize;
+  int nPoolSize = MS_HTTP_POOL_DEFAULT_SIZE;
+
+  if (!msHTTPPoolEnabled()) {
+    curl_easy_cleanup(http_handle);
+    return;
+  }
+
+  pszPoolSize = CPLGetConfigOption("MS_HTTP_CONNECTION_POOL_SIZE", NULL);
+  if (pszPoolSize)
+    nPoolSize = MS_MAX(0, MS_MIN(MS_HTTP_POOL_MAX_SIZE, atoi(pszPoolSize)));
+
+  curl_easy_reset(http_handle);
+
+  msAcquireLock(TLOCK_HTTPPOOL);
+  if (gnCurlPoolSize < nPoolSize) {
+    gapsCurlPool[gnCurlPoolSize++] = http_handle;
+    http_handle = NULL;
+  }
+  msReleaseLock(TLOCK_HTTPPOOL);
+
+  if (http_handle)
+    curl_easy_cleanup(http_handle);
+}
+
+/**********************************************************************
+ *                          msHTTPPoolCleanup()
+ *
+ * Destroys the pooled handles and the share handle, called from
+ * msHTTPCleanup() before libcurl is deinitialized.
+ **********************************************************************/
+static void msHTTPPoolCleanup()
+{
+  msAcquireLock(TLOCK_HTTPPOOL);
+  while (gnCurlPoolSize > 0)
+    curl_easy_cleanup(gapsCurlPool[--gnCurlPoolSize]);
+  if (gpsCurlShare)
+    curl_share_cleanup(gpsCurlShare);
+  gpsCurlShare = NULL;
+  msReleaseLock(TLOCK_HTTPPOOL);
+}
+
 /**********************************************************************
  *                          msHTTPInit()
  *
@@ -98,6 +260,9 @@ int msHTTPInit()
  **********************************************************************/
 void msHTTPCleanup()
 {
+  msHTTPCacheCleanup();
+  msHTTPPoolCleanup();
+
   msAcquireLock(TLOCK_OWS);
   if (gbCurlInitialized)
     curl_global_cleanup();
@@ -144,6 +309,7 @@ void msHTTPInitRequestObj(httpRequestObj *pasReqInfo, int numRequests)
     pasReqInfo[i].result_data = NULL;
     pasReqInfo[i].result_size = 0;
     pasReqInfo[i].result_buf_size = 0;
+    pasReqInfo[i].cache_state = NULL;
   }
 }
 
@@ -190,6 +356,8 @@ void msHTTPFreeRequestObj(httpRequestObj *pasReqInfo, int numRequests)
 
     pasReqInfo[i].curl_handle = NULL;
 
+    msHTTPCacheFreeRequest(&(pasReqInfo[i]));
+
     free( pasReqInfo[i].result_data );
     pasReqInfo[i].result_data = NULL;
     pasReqInfo[i].result_size = 0;
@@ -431,6 +599,9 @@ int msHTTPAuthProxySetup(hashTableObj *mapmd, hashTableObj *lyrmd,
  * If bCheckLocalCache==MS_TRUE then if the pszOutputfile already exists
  * then is is not downloaded again, and status 242 is returned.
  *
+ * If the MS_HTTP_CACHE config option is set, GET requests are served from
+ * or stored in the HTTP response cache (see maphttpcache.c).
+ *
  * Return value:
  * MS_SUCCESS if all requests completed succesfully.
  * MS_FAILURE if a fatal error happened
@@ -444,6 +615,7 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
   CURLMsg *curl_msg;
   char     debug = MS_FALSE;
   const char *pszCurlCABundle = NULL;
+  const char *pszMaxHostConnections = NULL;
 
   if (numRequests == 0)
     return MS_SUCCESS;  /* Nothing to do */
@@ -479,6 +651,20 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
       msDebug("Using CURL_CA_BUNDLE=%s\n", pszCurlCABundle);
   }
 
+  /* Serve what we can from the HTTP cache before starting any transfer:
+   * waiting for identical transfers of other threads to complete is only
+   * safe while none of ours is registered as in flight.
+   */
+  for (i=0; i<numRequests; i++) {
+    /* Reset some members */
+    pasReqInfo[i].nStatus = 0;
+    if (pasReqInfo[i].pszContentType)
+      free(pasReqInfo[i].pszContentType);
+    pasReqInfo[i].pszContentType = NULL;
+
+    msHTTPCacheLookup(&(pasReqInfo[i]), MS_TRUE);
+  }
+
   /* Alloc a curl-multi handle, and add a curl-easy handle to it for each
    * file to download.
    */
@@ -489,6 +675,18 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
     return(MS_FAILURE);
   }
 
+#if LIBCURL_VERSION_NUM >= 0x071e00
+  /* Limit parallel connections per host for this call only, the limit is
+   * kept by the multi handle. CURLMOPT_MAX_HOST_CONNECTIONS requires
+   * libcurl 7.30.0 */
+  if ((pszMaxHostConnections =
+         CPLGetConfigOption("MS_HTTP_MAX_HOST_CONNECTIONS", NULL)) != NULL &&
+      atol(pszMaxHostConnections) > 0) {
+    curl_multi_setopt(multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS,
+                      atol(pszMaxHostConnections));
+  }
+#endif
+
   for (i=0; i<numRequests; i++) {
     CURL *http_handle;
     FILE *fp;
@@ -499,17 +697,14 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
       return(MS_FAILURE);
     }
 
+    if (pasReqInfo[i].nStatus != 0)
+      continue;  /* Served from the HTTP cache */
+
     if (pasReqInfo[i].debug) {
       msDebug("HTTP request: id=%d, %s\n",
               pasReqInfo[i].nLayerId, pasReqInfo[i].pszGetUrl);
     }
 
-    /* Reset some members */
-    pasReqInfo[i].nStatus = 0;
-    if (pasReqInfo[i].pszContentType)
-      free(pasReqInfo[i].pszContentType);
-    pasReqInfo[i].pszContentType = NULL;
-
     /* Check local cache if requested */
     if (bCheckLocalCache && pasReqInfo[i].pszOutputFile != NULL ) {
       fp = fopen(pasReqInfo[i].pszOutputFile, "r");
@@ -525,8 +720,8 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
       }
     }
 
-    /* Alloc curl handle */
-    http_handle = curl_easy_init();
+    /* Alloc curl handle, or reuse one of a previous request */
+    http_handle = msHTTPAcquireHandle();
     if (http_handle == NULL) {
       msSetError(MS_HTTPERR, "curl_easy_init() failed.",
                  "msHTTPExecuteRequests()");
@@ -648,6 +843,11 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
     curl_easy_setopt(http_handle, CURLOPT_NOSIGNAL, 1 );
 #endif
 
+    /* Keep idle pooled connections alive, requires libcurl 7.25.0 */
+#if LIBCURL_VERSION_NUM >= 0x071900
+    curl_easy_setopt(http_handle, CURLOPT_TCP_KEEPALIVE, 1L );
+#endif
+
     /* If we are writing file to disk, open the file now. */
     if( pasReqInfo[i].pszOutputFile != NULL ) {
       if ( (fp = fopen(pasReqInfo[i].pszOutputFile, "wb")) == NULL) {
@@ -710,6 +910,8 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
                        pasReqInfo[i].pszHTTPCookieData);
     }
 
+    msHTTPCacheBeginFetch(&(pasReqInfo[i]), http_handle);
+
     /* Add to multi handle */
     curl_multi_add_handle(multi_handle, http_handle);
 
@@ -810,7 +1012,7 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
 
     psReq = &(pasReqInfo[i]);
 
-    if (psReq->nStatus == 242)
+    if (psReq->curl_handle == NULL)
       continue;  /* Nothing to do here, this file was in cache already */
 
     if (psReq->fp)
@@ -835,6 +1037,8 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
       }
     }
 
+    msHTTPCacheEndFetch(psReq);
+
     if (!MS_HTTP_SUCCESS(psReq->nStatus)) {
       /* Set status to MS_DONE to indicate that transfers were  */
       /* completed but may not be succesfull */
@@ -893,6 +1097,7 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
     /* Report download times foreach handle, in debug mode */
     if (psReq->debug) {
       double dConnectTime=0.0, dTotalTime=0.0, dStartTfrTime=0.0;
+      long nNewConnections=0;
 
       curl_easy_getinfo(http_handle,
                         CURLINFO_CONNECT_TIME, &dConnectTime);
@@ -900,20 +1105,24 @@ int msHTTPExecuteRequests(httpRequestObj *pasReqInfo, int numRequests,
                         CURLINFO_STARTTRANSFER_TIME, &dStartTfrTime);
       curl_easy_getinfo(http_handle,
                         CURLINFO_TOTAL_TIME, &dTotalTime);
+      curl_easy_getinfo(http_handle,
+                        CURLINFO_NUM_CONNECTS, &nNewConnections);
       /* STARTTRANSFER_TIME includes CONNECT_TIME, but TOTAL_TIME
        * doesn't, so we need to add it.
        */
       dTotalTime += dConnectTime;
 
-      msDebug("Layer %d: %.3f + %.3f + %.3f = %.3fs\n", psReq->nLayerId,
+      msDebug("Layer %d: %.3f + %.3f + %.3f = %.3fs (%s connection)\n",
+              psReq->nLayerId,
               dConnectTime, dStartTfrTime-dConnectTime,
-              dTotalTime-dStartTfrTime, dTotalTime);
+              dTotalTime-dStartTfrTime, dTotalTime,
+              nNewConnections > 0 ? "new" : "reused");
     }
 
-    /* Cleanup this handle */
+    /* Cleanup this handle, keeping its connection alive for later requests */
     curl_easy_setopt(http_handle, CURLOPT_URL, "" );
     curl_multi_remove_handle(multi_handle, http_handle);
-    curl_easy_cleanup(http_handle);
+    msHTTPReleaseHandle(http_handle);
     psReq->curl_handle = NULL;
 
   }
@@ -94,6 +94,8 @@ extern "C" {
     int       result_size;
     int       result_buf_size;
 
+    void      * cache_state;   /* HTTP cache bookkeeping, see maphttpcache.c */
+
   } httpRequestObj;
 
 #ifdef USE_CURL
@@ -112,6 +114,14 @@ extern "C" {
   int msHTTPAuthProxySetup(hashTableObj *mapmd, hashTableObj *lyrmd,
                            httpRequestObj *pasReqInfo, int numRequests,
                            mapObj *map, const char* namespaces);
+
+  /* maphttpcache.c */
+  int  msHTTPCacheEnabled(void);
+  int  msHTTPCacheLookup(httpRequestObj *psReq, int bWaitInFlight);
+  void msHTTPCacheBeginFetch(httpRequestObj *psReq, void *curl_handle);
+  void msHTTPCacheEndFetch(httpRequestObj *psReq);
+  void msHTTPCacheFreeRequest(httpRequestObj *psReq);
+  void msHTTPCacheCleanup(void);
 #endif /*USE_CURL*/
 
 #ifdef __cplusplus
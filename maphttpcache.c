@@ -0,0 +1,887 @@
+/**********************************************************************
+ * $Id$
+ *
+ * Project:  MapServer
+ * Purpose:  Response cache for HTTP requests issued by the WMS/WFS client
+ *           layers (requires libcurl)
+ * Author:   agent, agent@local
+ *
+ **********************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies of this Software or works derived from this Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+/*
+ * The cache is enabled with the MS_HTTP_CACHE=YES config option (usually
+ * set through the map CONFIG section). Only successful GET responses are
+ * kept, according to their Cache-Control, Expires, ETag and Last-Modified
+ * headers:
+ *
+ *  - fresh entries are served without contacting the remote server,
+ *  - stale entries carrying a validator are revalidated with a conditional
+ *    request (If-None-Match / If-Modified-Since), a 304 answer serves the
+ *    cached body,
+ *  - concurrent identical requests from other threads wait for the
+ *    transfer in progress instead of issuing their own.
+ *
+ * Entries live in an in-process LRU bounded by MS_HTTP_CACHE_SIZE
+ * (megabytes, 64 by default), and in MS_HTTP_CACHE_DIR when set so that
+ * they are shared with other processes and survive restarts. Files there
+ * are only readable by their owner and identify entries by a hash of the
+ * request, never by its URL. Responses without any caching header are kept
+ * for MS_HTTP_CACHE_DEFAULT_TTL seconds (0 by default, i.e. not cached).
+ *
+ * Responses to requests carrying HTTP or proxy credentials are only stored
+ * when they are explicitly marked shareable (Cache-Control public or
+ * s-maxage).
+ */
+
+#include "mapserver-config.h"
+#if defined(USE_CURL)
+
+#include "mapserver.h"
+#include "maphttp.h"
+#include "mapthread.h"
+#include "maptime.h"
+#include "uthash.h"
+
+#include "cpl_conv.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+
+#include <time.h>
+#include <fcntl.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <curl/curl.h>
+
+#define MS_HTTP_CACHE_DEFAULT_SIZE (64*1024*1024)
+#define MS_HTTP_CACHE_FILE_SIGNATURE "MSHTTPCACHE 2"
+
+typedef struct httpCacheEntryObj {
+  char *key;
+  char *content_type;
+  char *etag;
+  char *last_modified;
+  time_t expires;        /* fresh until then, revalidated afterwards */
+  long lifetime;         /* freshness lifetime given by the last response */
+  char *data;
+  int size;
+  int refcount;          /* entry is freed once evicted and unreferenced */
+  int in_cache;
+  UT_hash_handle hh;
+} httpCacheEntryObj;
+
+typedef struct {
+  char *key;
+  void *owner;           /* thread fetching the resource */
+  UT_hash_handle hh;
+} httpCacheInFlightObj;
+
+/* per request state, hung on httpRequestObj.cache_state */
+typedef struct {
+  char *key;
+  httpCacheEntryObj *stale;   /* entry being revalidated */
+  struct curl_slist *headers; /* conditional request headers */
+  int owns_inflight;
+  /* response headers of the last response received */
+  char *cache_control;
+  char *expires;
+  char *date;
+  char *age;
+  char *etag;
+  char *last_modified;
+  char *vary;
+  int authenticated;          /* request sends HTTP or proxy credentials */
+} httpCacheStateObj;
+
+static httpCacheEntryObj *http_cache = NULL; /* in least recently used order */
+static httpCacheInFlightObj *http_cache_inflight = NULL;
+static size_t http_cache_bytes = 0;
+
+/**********************************************************************
+ *                          msHTTPCacheEnabled()
+ **********************************************************************/
+int msHTTPCacheEnabled()
+{
+  return CSLTestBoolean(CPLGetConfigOption("MS_HTTP_CACHE", "NO"));
+}
+
+static size_t msHTTPCacheMaxBytes()
+{
+  const char *size = CPLGetConfigOption("MS_HTTP_CACHE_SIZE", NULL);
+  if(size && atoi(size) >= 0)
+    return (size_t)atoi(size) * 1024 * 1024;
+  return MS_HTTP_CACHE_DEFAULT_SIZE;
+}
+
+/**********************************************************************
+ *                          msHTTPCacheKey()
+ *
+ * Normalize the request URL so that equivalent requests share an entry:
+ * the scheme and host are lower cased, default ports and the fragment
+ * are dropped, and the query parameters are sorted by (case insensitive)
+ * name. The HTTP user is appended as responses may depend on it.
+ **********************************************************************/
+typedef struct {
+  char *param;
+  int index;
+} httpCacheParamObj;
+
+static int msHTTPCacheCompareParams(const void *a, const void *b)
+{
+  const httpCacheParamObj *pa = a, *pb = b;
+  size_t la = strcspn(pa->param, "="), lb = strcspn(pb->param, "=");
+  int cmp = strncasecmp(pa->param, pb->param, MS_MIN(la, lb));
+  if(cmp == 0 && la != lb)
+    cmp = (la < lb) ? -1 : 1;
+  if(cmp == 0)
+    cmp = pa->index - pb->index; /* keep repeated parameters in order */
+  return cmp;
+}
+
+static char *msHTTPCacheKey(httpRequestObj *psReq)
+{
+  char *url, *query, *fragment, *authority, *path, *key;
+  char **tokens;
+  int numtokens = 0, numparams = 0, i;
+  httpCacheParamObj *params;
+
+  url = msStrdup(psReq->pszGetUrl);
+  if((fragment = strchr(url, '#')) != NULL)
+    *fragment = '\0';
+
+  query = strchr(url, '?');
+  if(query)
+    *query++ = '\0';
+
+  /* lower case scheme and host, drop default ports */
+  authority = strstr(url, "://");
+  if(authority) {
+    char *p, *port;
+    for(p = url; p < authority; p++)
+      *p = tolower(*p);
+    authority += 3;
+    path = strchr(authority, '/');
+    if(path == NULL)
+      path = authority + strlen(authority);
+    p = strchr(authority, '@');
+    if(p == NULL || p > path)
+      p = authority;
+    for(; p < path; p++)
+      *p = tolower(*p);
+    port = strchr(authority, ':');
+    if(port && port < path &&
+        ((strncmp(url, "http:", 5) == 0 && path - port == 3 && strncmp(port, ":80", 3) == 0) ||
+         (strncmp(url, "https:", 6) == 0 && path - port == 4 && strncmp(port, ":443", 4) == 0)))
+      memmove(port, path, strlen(path) + 1);
+  }
+
+  key = msStrdup(url);
+  if(query && *query) {
+    tokens = msStringSplit(query, '&', &numtokens);
+    params = msSmallMalloc(sizeof(httpCacheParamObj) * MS_MAX(numtokens, 1));
+    for(i = 0; i < numtokens; i++) {
+      if(tokens[i][0] == '\0')
+        continue;
+      params[numparams].param = tokens[i];
+      params[numparams].index = i;
+      numparams++;
+    }
+    qsort(params, numparams, sizeof(httpCacheParamObj), msHTTPCacheCompareParams);
+    for(i = 0; i < numparams; i++) {
+      key = msStringConcatenate(key, i == 0 ? "?" : "&");
+      key = msStringConcatenate(key, params[i].param);
+    }
+    free(params);
+    msFreeCharArray(tokens, numtokens);
+  }
+
+  if(psReq->pszHttpUsername && psReq->pszHttpUsername[0]) {
+    key = msStringConcatenate(key, "\tuser=");
+    key = msStringConcatenate(key, psReq->pszHttpUsername);
+  }
+
+  free(url);
+  return key;
+}
+
+/**********************************************************************
+ *                     Cache entries (TLOCK_HTTPCACHE held)
+ **********************************************************************/
+static void msHTTPCacheReleaseEntry(httpCacheEntryObj *entry)
+{
+  if(--entry->refcount > 0 || entry->in_cache)
+    return;
+  free(entry->key);
+  free(entry->content_type);
+  free(entry->etag);
+  free(entry->last_modified);
+  free(entry->data);
+  free(entry);
+}
+
+static void msHTTPCacheRemoveEntry(httpCacheEntryObj *entry)
+{
+  UT_HASH_DEL(http_cache, entry);
+  http_cache_bytes -= entry->size;
+  entry->in_cache = MS_FALSE;
+  entry->refcount++;
+  msHTTPCacheReleaseEntry(entry);
+}
+
+static void msHTTPCacheInsertEntry(httpCacheEntryObj *entry)
+{
+  httpCacheEntryObj *old;
+  size_t max_bytes = msHTTPCacheMaxBytes();
+
+  UT_HASH_FIND_STR(http_cache, entry->key, old);
+  if(old)
+    msHTTPCacheRemoveEntry(old);
+
+  /* keep single responses from flushing the whole cache */
+  if((size_t)entry->size > max_bytes / 4)
+    return;
+
+  while(http_cache && http_cache_bytes + entry->size > max_bytes)
+    msHTTPCacheRemoveEntry(http_cache); /* least recently used */
+
+  entry->in_cache = MS_TRUE;
+  http_cache_bytes += entry->size;
+  UT_HASH_ADD_KEYPTR(hh, http_cache, entry->key, strlen(entry->key), entry);
+}
+
+/**********************************************************************
+ *                     On disk entries (MS_HTTP_CACHE_DIR)
+ **********************************************************************/
+/* hex encoded SHA-256 of the key, keys hold request URLs (and user names)
+ * that must not end up on disk */
+static void msHTTPCacheDigest(const char *key, char digest[2*CPL_SHA256_HASH_SIZE+1])
+{
+  GByte hash[CPL_SHA256_HASH_SIZE];
+  int i;
+
+  CPL_SHA256(key, strlen(key), hash);
+  for(i = 0; i < CPL_SHA256_HASH_SIZE; i++)
+    snprintf(digest + 2*i, 3, "%02x", hash[i]);
+}
+
+static char *msHTTPCacheFilename(const char *digest)
+{
+  const char *dir = CPLGetConfigOption("MS_HTTP_CACHE_DIR", NULL);
+  char filename[2*CPL_SHA256_HASH_SIZE+8], path[MS_MAXPATHLEN];
+
+  if(dir == NULL || dir[0] == '\0')
+    return NULL;
+  snprintf(filename, sizeof(filename), "%s.http", digest);
+  if(msBuildPath(path, dir, filename) == NULL)
+    return NULL;
+  return msStrdup(path);
+}
+
+static char *msHTTPCacheReadLine(FILE *fp)
+{
+  char chunk[1024], *line = NULL;
+  size_t len = 0, chunklen;
+
+  /* header values have no fixed bound */
+  while(fgets(chunk, sizeof(chunk), fp) != NULL) {
+    chunklen = strlen(chunk);
+    line = msSmallRealloc(line, len + chunklen + 1);
+    memcpy(line + len, chunk, chunklen + 1);
+    len += chunklen;
+    if(len > 0 && line[len-1] == '\n') {
+      line[len-1] = '\0';
+      break;
+    }
+  }
+  return line;
+}
+
+static httpCacheEntryObj *msHTTPCacheReadFile(const char *key)
+{
+  char digest[2*CPL_SHA256_HASH_SIZE+1], *filename, *line = NULL, *file_digest = NULL;
+  httpCacheEntryObj *entry = NULL;
+  FILE *fp;
+  int ok = MS_FALSE;
+
+  msHTTPCacheDigest(key, digest);
+  filename = msHTTPCacheFilename(digest);
+  if(filename == NULL)
+    return NULL;
+  fp = fopen(filename, "rb");
+  if(fp == NULL) {
+    free(filename);
+    return NULL;
+  }
+
+  entry = msSmallCalloc(1, sizeof(httpCacheEntryObj));
+  line = msHTTPCacheReadLine(fp);
+  if(line && strcmp(line, MS_HTTP_CACHE_FILE_SIGNATURE) == 0) {
+    msFree(line);
+    file_digest = msHTTPCacheReadLine(fp);
+    entry->content_type = msHTTPCacheReadLine(fp);
+    entry->etag = msHTTPCacheReadLine(fp);
+    entry->last_modified = msHTTPCacheReadLine(fp);
+    line = msHTTPCacheReadLine(fp);
+    if(line && file_digest && strcmp(file_digest, digest) == 0) {
+      long long expires = 0;
+      if(sscanf(line, "%lld %ld %d", &expires, &entry->lifetime, &entry->size) == 3 && entry->size >= 0) {
+        entry->expires = (time_t)expires;
+        entry->data = msSmallMalloc(entry->size + 1);
+        ok = (fread(entry->data, 1, entry->size, fp) == (size_t)entry->size);
+        entry->data[entry->size] = '\0';
+      }
+    }
+  }
+  msFree(line);
+  msFree(file_digest);
+  fclose(fp);
+  free(filename);
+
+  if(!ok) {
+    entry->refcount = 1;
+    msHTTPCacheReleaseEntry(entry);
+    return NULL;
+  }
+  entry->key = msStrdup(key);
+  /* empty lines stand for absent headers */
+  if(entry->content_type[0] == '\0') msFree(entry->content_type), entry->content_type = NULL;
+  if(entry->etag[0] == '\0') msFree(entry->etag), entry->etag = NULL;
+  if(entry->last_modified[0] == '\0') msFree(entry->last_modified), entry->last_modified = NULL;
+  return entry;
+}
+
+static void msHTTPCacheWriteFile(httpCacheEntryObj *entry)
+{
+  char digest[2*CPL_SHA256_HASH_SIZE+1], *filename, *tmpfilename;
+  FILE *fp;
+  int ok;
+
+  msHTTPCacheDigest(entry->key, digest);
+  filename = msHTTPCacheFilename(digest);
+  if(filename == NULL)
+    return;
+
+  /* write to a private file and rename it so that readers never see a
+   * partial entry */
+  tmpfilename = msSmallMalloc(strlen(filename) + 64);
+  sprintf(tmpfilename, "%s.%ld.%p.tmp", filename,
+#ifndef _WIN32
+          (long)getpid(),
+#else
+          0L,
+#endif
+          msGetThreadId());
+#ifndef _WIN32
+  {
+    /* cached responses may be restricted, keep them private to the owner */
+    int fd = open(tmpfilename, O_WRONLY | O_CREAT | O_EXCL, 0600);
+    fp = (fd >= 0) ? fdopen(fd, "wb") : NULL;
+    if(fp == NULL && fd >= 0) {
+      close(fd);
+      unlink(tmpfilename);
+    }
+  }
+#else
+  fp = fopen(tmpfilename, "wb");
+#endif
+  if(fp == NULL) {
+    free(tmpfilename);
+    free(filename);
+    return;
+  }
+  ok = fprintf(fp, "%s\n%s\n%s\n%s\n%s\n%lld %ld %d\n", MS_HTTP_CACHE_FILE_SIGNATURE,
+               digest,
+               entry->content_type ? entry->content_type : "",
+               entry->etag ? entry->etag : "",
+               entry->last_modified ? entry->last_modified : "",
+               (long long)entry->expires, entry->lifetime, entry->size) > 0;
+  ok = ok && fwrite(entry->data, 1, entry->size, fp) == (size_t)entry->size;
+  ok = (fclose(fp) == 0) && ok;
+
+#ifdef _WIN32
+  if(ok)
+    unlink(filename);
+#endif
+  if(!ok || rename(tmpfilename, filename) != 0)
+    unlink(tmpfilename);
+  free(tmpfilename);
+  free(filename);
+}
+
+/**********************************************************************
+ *                          msHTTPCacheServe()
+ *
+ * Hand the body of a cached entry to the request as if it had just been
+ * downloaded.
+ **********************************************************************/
+static int msHTTPCacheServe(httpRequestObj *psReq, httpCacheEntryObj *entry)
+{
+  if(psReq->pszOutputFile != NULL) {
+    FILE *fp = fopen(psReq->pszOutputFile, "wb");
+    if(fp == NULL)
+      return MS_FAILURE;
+    if(fwrite(entry->data, 1, entry->size, fp) != (size_t)entry->size) {
+      fclose(fp);
+      return MS_FAILURE;
+    }
+    fclose(fp);
+  } else {
+    free(psReq->result_data);
+    psReq->result_data = msSmallMalloc(entry->size + 1);
+    memcpy(psReq->result_data, entry->data, entry->size);
+    psReq->result_data[entry->size] = '\0';
+    psReq->result_buf_size = entry->size + 1;
+  }
+  psReq->result_size = entry->size;
+
+  psReq->nStatus = 200;
+  msFree(psReq->pszContentType);
+  psReq->pszContentType = entry->content_type ? msStrdup(entry->content_type) : NULL;
+  return MS_SUCCESS;
+}
+
+static int msHTTPCacheElapsed(struct mstimeval *start)
+{
+  struct mstimeval now;
+  msGettimeofday(&now, NULL);
+  return (int)((now.tv_sec - start->tv_sec) * 1000
+               + (now.tv_usec - start->tv_usec) / 1000);
+}
+
+/**********************************************************************
+ *                          msHTTPCacheLookup()
+ *
+ * Look the request up in the cache. If another thread is already
+ * fetching the same resource and bWaitInFlight is set, wait (for at most
+ * the request timeout) for it to complete first.
+ *
+ * Returns MS_TRUE if the request was served from the cache. Otherwise
+ * the request has to be fetched, conditionally if a stale entry with
+ * validators was found.
+ **********************************************************************/
+int msHTTPCacheLookup(httpRequestObj *psReq, int bWaitInFlight)
+{
+  httpCacheStateObj *state;
+  httpCacheEntryObj *entry = NULL, *disk_entry;
+  httpCacheInFlightObj *inflight;
+  struct mstimeval wait_start;
+  int waited, timeout, served = MS_FALSE;
+
+  if(psReq->pszGetUrl == NULL || psReq->pszPostRequest != NULL ||
+      psReq->pszHTTPCookieData != NULL || !msHTTPCacheEnabled())
+    return MS_FALSE;
+
+  state = (httpCacheStateObj*)psReq->cache_state;
+  if(state == NULL) {
+    state = msSmallCalloc(1, sizeof(httpCacheStateObj));
+    state->key = msHTTPCacheKey(psReq);
+    state->authenticated =
+      (psReq->pszHttpUsername && psReq->pszHttpUsername[0]) ||
+      (psReq->pszProxyUsername && psReq->pszProxyUsername[0]);
+    psReq->cache_state = state;
+  }
+  timeout = 1000 * (psReq->nTimeout > 0 ? psReq->nTimeout : 30);
+
+  msAcquireLock(TLOCK_HTTPCACHE);
+  msGettimeofday(&wait_start, NULL);
+  for(;;) {
+    UT_HASH_FIND_STR(http_cache_inflight, state->key, inflight);
+    if(!bWaitInFlight || inflight == NULL || inflight->owner == msGetThreadId() ||
+        (waited = msHTTPCacheElapsed(&wait_start)) >= timeout)
+      break;
+    /* woken up by msHTTPCacheReleaseInFlight() */
+    if(!msWaitLock(TLOCK_HTTPCACHE, timeout - waited))
+      break;
+  }
+
+  UT_HASH_FIND_STR(http_cache, state->key, entry);
+  if(entry == NULL) {
+    msReleaseLock(TLOCK_HTTPCACHE);
+    disk_entry = msHTTPCacheReadFile(state->key);
+    msAcquireLock(TLOCK_HTTPCACHE);
+    UT_HASH_FIND_STR(http_cache, state->key, entry);
+    if(entry == NULL && disk_entry != NULL) {
+      entry = disk_entry;
+      msHTTPCacheInsertEntry(entry); /* freed below if it did not fit in memory */
+    } else if(disk_entry) {
+      disk_entry->refcount = 1;
+      msHTTPCacheReleaseEntry(disk_entry);
+    }
+  } else {
+    /* re-add to move it to the most recently used end */
+    UT_HASH_DEL(http_cache, entry);
+    UT_HASH_ADD_KEYPTR(hh, http_cache, entry->key, strlen(entry->key), entry);
+  }
+  if(entry)
+    entry->refcount++;
+
+  if(entry && time(NULL) < entry->expires) {
+    msReleaseLock(TLOCK_HTTPCACHE);
+    served = (msHTTPCacheServe(psReq, entry) == MS_SUCCESS);
+    msAcquireLock(TLOCK_HTTPCACHE);
+    msHTTPCacheReleaseEntry(entry);
+  } else if(entry && (entry->etag || entry->last_modified)) {
+    state->stale = entry; /* keep our reference until revalidated */
+  } else if(entry) {
+    if(entry->in_cache)
+      msHTTPCacheRemoveEntry(entry);
+    msHTTPCacheReleaseEntry(entry);
+  }
+  msReleaseLock(TLOCK_HTTPCACHE);
+
+  if(served && psReq->debug)
+    msDebug("HTTP request: id=%d, served from HTTP cache.\n", psReq->nLayerId);
+  return served;
+}
+
+/**********************************************************************
+ *                          msHTTPCacheHeaderFct()
+ *
+ * CURLOPT_HEADERFUNCTION, records the response headers that drive the
+ * caching of the response.
+ **********************************************************************/
+static size_t msHTTPCacheHeaderFct(char *buffer, size_t size, size_t nitems,
+                                   void *reqInfo)
+{
+  httpRequestObj *psReq = (httpRequestObj *)reqInfo;
+  httpCacheStateObj *state = (httpCacheStateObj*)psReq->cache_state;
+  size_t len = size * nitems, namelen;
+  char **target = NULL;
+  const char *value;
+
+  if(len >= 5 && strncmp(buffer, "HTTP/", 5) == 0) {
+    /* new response, e.g. after a redirect: forget previous headers */
+    msFree(state->cache_control);
+    msFree(state->expires);
+    msFree(state->date);
+    msFree(state->age);
+    msFree(state->etag);
+    msFree(state->last_modified);
+    msFree(state->vary);
+    state->cache_control = state->expires = state->date = state->age = NULL;
+    state->etag = state->last_modified = state->vary = NULL;
+    return len;
+  }
+
+  value = memchr(buffer, ':', len);
+  if(value == NULL)
+    return len;
+  namelen = value - buffer;
+#define MS_HTTP_CACHE_HEADER(name, field) \
+  if(namelen == strlen(name) && strncasecmp(buffer, name, namelen) == 0) target = &state->field
+  MS_HTTP_CACHE_HEADER("Cache-Control", cache_control);
+  else MS_HTTP_CACHE_HEADER("Expires", expires);
+  else MS_HTTP_CACHE_HEADER("Date", date);
+  else MS_HTTP_CACHE_HEADER("Age", age);
+  else MS_HTTP_CACHE_HEADER("ETag", etag);
+  else MS_HTTP_CACHE_HEADER("Last-Modified", last_modified);
+  else MS_HTTP_CACHE_HEADER("Vary", vary);
+#undef MS_HTTP_CACHE_HEADER
+
+  if(target) {
+    size_t valuelen;
+    value++;
+    while(value < buffer + len && (*value == ' ' || *value == '\t'))
+      value++;
+    valuelen = buffer + len - value;
+    while(valuelen > 0 && (value[valuelen-1] == '\r' || value[valuelen-1] == '\n' ||
+                           value[valuelen-1] == ' '))
+      valuelen--;
+    if(*target) {
+      /* repeated header, e.g. several Cache-Control lines */
+      *target = msStringConcatenate(*target, ", ");
+      *target = msSmallRealloc(*target, strlen(*target) + valuelen + 1);
+      strncat(*target, value, valuelen);
+    } else {
+      *target = msSmallMalloc(valuelen + 1);
+      memcpy(*target, value, valuelen);
+      (*target)[valuelen] = '\0';
+    }
+  }
+  return len;
+}
+
+/**********************************************************************
+ *                          msHTTPCacheBeginFetch()
+ *
+ * Called on the curl handle of a request that was not served from the
+ * cache: registers the transfer as in flight, captures the response
+ * headers and adds the conditional headers for stale entries.
+ **********************************************************************/
+void msHTTPCacheBeginFetch(httpRequestObj *psReq, void *curl_handle)
+{
+  httpCacheStateObj *state = (httpCacheStateObj*)psReq->cache_state;
+  httpCacheInFlightObj *inflight;
+  CURL *http_handle = (CURL*)curl_handle;
+
+  if(state == NULL)
+    return;
+
+  msAcquireLock(TLOCK_HTTPCACHE);
+  UT_HASH_FIND_STR(http_cache_inflight, state->key, inflight);
+  if(inflight == NULL) {
+    inflight = msSmallCalloc(1, sizeof(httpCacheInFlightObj));
+    inflight->key = msStrdup(state->key);
+    inflight->owner = msGetThreadId();
+    UT_HASH_ADD_KEYPTR(hh, http_cache_inflight, inflight->key, strlen(inflight->key), inflight);
+    state->owns_inflight = MS_TRUE;
+  }
+  msReleaseLock(TLOCK_HTTPCACHE);
+
+  curl_easy_setopt(http_handle, CURLOPT_HEADERFUNCTION, msHTTPCacheHeaderFct);
+  curl_easy_setopt(http_handle, CURLOPT_HEADERDATA, psReq);
+
+  if(state->stale) {
+    char *header;
+    if(state->stale->etag) {
+      header = msStringConcatenate(msStrdup("If-None-Match: "), state->stale->etag);
+      state->headers = curl_slist_append(state->headers, header);
+      free(header);
+    }
+    if(state->stale->last_modified) {
+      header = msStringConcatenate(msStrdup("If-Modified-Since: "), state->stale->last_modified);
+      state->headers = curl_slist_append(state->headers, header);
+      free(header);
+    }
+    curl_easy_setopt(http_handle, CURLOPT_HTTPHEADER, state->headers);
+  }
+}
+
+/**********************************************************************
+ *                          msHTTPCacheLifetime()
+ *
+ * Freshness lifetime in seconds of the response described by the
+ * recorded headers, fallback if none is given. Returns -1 if the response
+ * must not be stored, which includes responses to authenticated requests
+ * that are not explicitly shareable.
+ **********************************************************************/
+static long msHTTPCacheLifetime(httpCacheStateObj *state, time_t now, long fallback)
+{
+  long lifetime = -2, max_age = -1, s_maxage = -1;
+  int is_public = MS_FALSE;
+
+  if(state->vary && strchr(state->vary, '*'))
+    return -1;
+
+  if(state->cache_control) {
+    char **tokens;
+    int numtokens = 0, i;
+    tokens = msStringSplit(state->cache_control, ',', &numtokens);
+    for(i = 0; i < numtokens; i++) {
+      char *token = tokens[i];
+      msStringTrim(token);
+      if(strcasecmp(token, "no-store") == 0 || strcasecmp(token, "private") == 0) {
+        msFreeCharArray(tokens, numtokens);
+        return -1;
+      } else if(strcasecmp(token, "no-cache") == 0) {
+        lifetime = 0;
+      } else if(strcasecmp(token, "public") == 0) {
+        is_public = MS_TRUE;
+      } else if(strncasecmp(token, "max-age=", 8) == 0) {
+        max_age = atol(token + 8);
+      } else if(strncasecmp(token, "s-maxage=", 9) == 0) {
+        s_maxage = atol(token + 9);
+      }
+    }
+    msFreeCharArray(tokens, numtokens);
+  }
+
+  if(state->authenticated && !is_public && s_maxage < 0)
+    return -1;
+  if(lifetime == 0)
+    return 0;
+  if(s_maxage >= 0)
+    lifetime = s_maxage;
+  else if(max_age >= 0)
+    lifetime = max_age;
+  else if(state->expires) {
+    time_t expires = curl_getdate(state->expires, NULL);
+    time_t date = state->date ? curl_getdate(state->date, NULL) : -1;
+    if(date == -1)
+      date = now;
+    lifetime = (expires == -1) ? 0 : MS_MAX(0, (long)(expires - date));
+  } else
+    lifetime = fallback;
+
+  if(state->age && lifetime > 0)
+    lifetime = MS_MAX(0, lifetime - atol(state->age));
+  return lifetime;
+}
+
+static void msHTTPCacheReleaseInFlight(httpCacheStateObj *state)
+{
+  httpCacheInFlightObj *inflight;
+
+  if(!state->owns_inflight)
+    return;
+  msAcquireLock(TLOCK_HTTPCACHE);
+  UT_HASH_FIND_STR(http_cache_inflight, state->key, inflight);
+  if(inflight) {
+    UT_HASH_DEL(http_cache_inflight, inflight);
+    free(inflight->key);
+    free(inflight);
+    msSignalLock(TLOCK_HTTPCACHE);
+  }
+  msReleaseLock(TLOCK_HTTPCACHE);
+  state->owns_inflight = MS_FALSE;
+}
+
+/**********************************************************************
+ *                          msHTTPCacheEndFetch()
+ *
+ * Called once the transfer of a request set up by msHTTPCacheBeginFetch()
+ * is complete and its status known (and its output file closed). Stores
+ * cacheable responses, and turns a 304 answer to a conditional request
+ * into the cached response.
+ **********************************************************************/
+void msHTTPCacheEndFetch(httpRequestObj *psReq)
+{
+  httpCacheStateObj *state = (httpCacheStateObj*)psReq->cache_state;
+  time_t now = time(NULL);
+  const char *default_ttl;
+  long fallback = 0, lifetime;
+
+  if(state == NULL)
+    return;
+
+  default_ttl = CPLGetConfigOption("MS_HTTP_CACHE_DEFAULT_TTL", NULL);
+  if(default_ttl)
+    fallback = MS_MAX(0, atol(default_ttl));
+
+  if(psReq->nStatus == 304 && state->stale) {
+    httpCacheEntryObj *entry = state->stale;
+
+    /* freshness headers of a 304 response update the stored ones, the
+     * validators are those we sent */
+    msAcquireLock(TLOCK_HTTPCACHE);
+    lifetime = msHTTPCacheLifetime(state, now, entry->lifetime);
+    if(lifetime >= 0)
+      entry->lifetime = lifetime;
+    entry->expires = now + entry->lifetime;
+    msReleaseLock(TLOCK_HTTPCACHE);
+
+    if(msHTTPCacheServe(psReq, entry) == MS_SUCCESS) {
+      if(psReq->debug)
+        msDebug("HTTP request: id=%d, revalidated HTTP cache entry.\n", psReq->nLayerId);
+      msHTTPCacheWriteFile(entry);
+    } else {
+      psReq->nStatus = -(CURLE_WRITE_ERROR);
+    }
+  } else if(psReq->nStatus == 200 &&
+            (lifetime = msHTTPCacheLifetime(state, now, fallback)) >= 0 &&
+            (lifetime > 0 || state->etag || state->last_modified)) {
+    httpCacheEntryObj *entry = msSmallCalloc(1, sizeof(httpCacheEntryObj));
+    int ok = MS_TRUE;
+
+    if(psReq->pszOutputFile != NULL) {
+      FILE *fp = fopen(psReq->pszOutputFile, "rb");
+      entry->size = psReq->result_size;
+      entry->data = msSmallMalloc(entry->size + 1);
+      ok = fp && fread(entry->data, 1, entry->size, fp) == (size_t)entry->size;
+      if(fp)
+        fclose(fp);
+    } else {
+      entry->size = psReq->result_size;
+      entry->data = msSmallMalloc(entry->size + 1);
+      if(entry->size > 0)
+        memcpy(entry->data, psReq->result_data, entry->size);
+    }
+    entry->data[entry->size] = '\0';
+    entry->key = msStrdup(state->key);
+    entry->content_type = psReq->pszContentType ? msStrdup(psReq->pszContentType) : NULL;
+    entry->etag = state->etag ? msStrdup(state->etag) : NULL;
+    entry->last_modified = state->last_modified ? msStrdup(state->last_modified) : NULL;
+    entry->lifetime = lifetime;
+    entry->expires = now + lifetime;
+    entry->refcount = 1;
+
+    if(ok) {
+      msHTTPCacheWriteFile(entry);
+      msAcquireLock(TLOCK_HTTPCACHE);
+      msHTTPCacheInsertEntry(entry);
+      msHTTPCacheReleaseEntry(entry);
+      msReleaseLock(TLOCK_HTTPCACHE);
+    } else {
+      msHTTPCacheReleaseEntry(entry);
+    }
+  }
+
+  msHTTPCacheReleaseInFlight(state);
+  if(state->headers) {
+    curl_slist_free_all(state->headers);
+    state->headers = NULL;
+  }
+}
+
+/**********************************************************************
+ *                          msHTTPCacheFreeRequest()
+ *
+ * Releases the cache state of a request, called by
+ * msHTTPFreeRequestObj().
+ **********************************************************************/
+void msHTTPCacheFreeRequest(httpRequestObj *psReq)
+{
+  httpCacheStateObj *state = (httpCacheStateObj*)psReq->cache_state;
+
+  if(state == NULL)
+    return;
+
+  /* requests abandoned before completion must not leave other threads waiting */
+  msHTTPCacheReleaseInFlight(state);
+  if(state->stale) {
+    msAcquireLock(TLOCK_HTTPCACHE);
+    msHTTPCacheReleaseEntry(state->stale);
+    msReleaseLock(TLOCK_HTTPCACHE);
+  }
+  if(state->headers)
+    curl_slist_free_all(state->headers);
+  msFree(state->key);
+  msFree(state->cache_control);
+  msFree(state->expires);
+  msFree(state->date);
+  msFree(state->age);
+  msFree(state->etag);
+  msFree(state->last_modified);
+  msFree(state->vary);
+  free(state);
+  psReq->cache_state = NULL;
+}
+
+/**********************************************************************
+ *                          msHTTPCacheCleanup()
+ *
+ * Frees the in memory cache, called from msHTTPCleanup().
+ **********************************************************************/
+void msHTTPCacheCleanup()
+{
+  httpCacheEntryObj *entry, *tmp;
+
+  msAcquireLock(TLOCK_HTTPCACHE);
+  UT_HASH_ITER(hh, http_cache, entry, tmp) {
+    msHTTPCacheRemoveEntry(entry);
+  }
+  msReleaseLock(TLOCK_HTTPCACHE);
+}
+
+#endif /* defined(USE_CURL) */
@@ -345,6 +345,9 @@ int msLayerNextShape(layerObj *layer, shapeObj *shape)
       if(rv != MS_SUCCESS)
         return rv;
     }
+
+    /* providers may have recycled the values of the previous shape */
+    msShapeInvalidateValueCache(shape);
     
     // if(layer->numitems > 0 && layer->iteminfo) {
       filter_passed = msEvalExpression(layer, shape, &(layer->filter), layer->filteritemindex);
@@ -415,6 +418,8 @@ int msLayerGetShape(layerObj *layer, shapeObj *shape, resultObj *record)
       return rv;
   }
 
+  msShapeInvalidateValueCache(shape);
+
   return rv;
 }
 
@@ -737,6 +742,11 @@ int msTokenizeExpression(expressionObj *expression, char **list, int *listsize)
           goto parse_error;
         }
 
+#ifdef USE_GEOS
+        /* the shape is tested against every feature the expression is evaluated for */
+        msGEOSPrepareShape(node->tokenval.shpval);
+#endif
+
         /* todo: perhaps process optional args (e.g. projection) */
 
         if((token = msyylex()) != 41) { /* ) */
@@ -388,8 +388,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 352
-#define YY_END_OF_BUFFER 353
+#define YY_NUM_RULES 353
+#define YY_END_OF_BUFFER 354
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -397,232 +397,234 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[2038] =
+static yyconst flex_int16_t yy_accept[2061] =
     {   0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  353,  350,    1,  348,  341,    2,
-      350,  350,  334,  347,  334,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  350,
-      350,  350,  349,  349,    8,  350,  350,  350,  350,  350,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,  350,
-        1,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  351,    1,    1,   11,  346,  351,  346,  351,
-
-      335,  335,   15,   12,   14,  351,  351,  351,  351,  351,
+        0,    0,    0,    0,  354,  351,    1,  349,  342,    2,
+      342,  351,  351,  335,  348,  335,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      351,  351,  351,  350,  350,    8,  351,  351,  351,  351,
       351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  351,  351,  349,   18,  349,  352,    1,  352,
-      352,  344,  342,  342,  343,    5,    7,    6,    1,    2,
-        0,  339,  334,  334,  347,  334,  347,    0,    3,  347,
-        2,  334,    0,  347,  347,  347,  347,  347,  347,  347,
-      347,  252,  347,  347,  347,  256,  347,  257,  347,  347,
-      262,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  275,  347,
-
-      347,  278,  347,  279,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  290,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  230,  347,  347,  316,  317,  347,  318,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,    0,  327,
-        0,  340,    0,    0,    0,    0,    0,    0,    0,    0,
+      351,    8,    1,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  352,    1,    1,   11,  347,  352,
+
+      347,  352,  336,  336,   15,   12,   14,  352,  352,  352,
+      352,  352,  352,  352,  352,  352,  352,  352,  352,  352,
+      352,  352,  352,  352,  352,  352,  350,   18,  350,  353,
+        1,  353,  353,  345,  343,  343,  344,    5,    7,    6,
+        1,    2,    0,  340,  335,  335,  348,  335,  348,    0,
+        3,  348,    2,  335,  335,    0,  348,  348,  348,  348,
+      348,  348,  348,  348,  253,  348,  348,  348,  257,  348,
+      258,  348,  348,  263,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  276,  348,  348,  279,  348,  280,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  291,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  231,  348,  348,  317,  318,  348,
+      319,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,    0,  328,    0,  341,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  326,  347,  347,  256,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  290,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,   13,    0,   10,    0,  335,  335,  335,    0,  335,
-        0,   17,   19,   12,   16,    0,    0,    0,    0,    0,
-        0,    0,    0,   12,    0,    0,    0,   16,   14,   21,
-        0,   17,    0,   15,    0,    9,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  331,    0,
-        0,  336,   20,    0,  345,    0,  344,  342,  342,  343,
-        5,    4,  334,    0,    0,  347,  334,    0,  338,  347,
-      338,    2,    2,    2,  334,    0,    0,  334,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      258,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-       83,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   98,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      139,  140,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  288,  289,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  310,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  242,  323,  347,  244,  324,  347,   61,
-        0,    0,    0,    0,    0,    0,    0,    0,  140,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  242,    0,
-      325,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  288,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,    0,    0,    0,
-
-        0,    0,  335,  335,    0,    0,  335,    0,    0,    0,
+        0,    0,    0,    0,    0,  327,  348,  348,  257,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  291,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,   13,    0,   10,    0,  336,  336,
+      336,    0,  336,  336,    0,   17,   19,   12,   16,    0,
+        0,    0,    0,    0,    0,    0,    0,   12,    0,    0,
+        0,   16,   14,   21,    0,   17,    0,   15,   13,    0,
+        9,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  332,    0,    0,  337,    9,   20,    0,
+      346,    0,  346,  345,  343,  343,  344,  344,  344,    5,
+        4,  335,    0,    0,  348,  335,    0,  339,  348,  339,
+
+        2,    2,    2,  335,    0,    0,  335,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  259,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,   83,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,   98,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  139,
+      140,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  289,  290,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  311,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  243,  324,  348,  245,  325,  348,   61,    0,
+        0,    0,    0,    0,    0,    0,    0,  140,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  243,    0,  326,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  289,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,    0,    0,    0,    0,
+        0,  336,  336,    0,    0,  336,   10,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,   11,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  334,  337,  337,    2,    2,    2,    0,  334,  347,
-      347,  347,  347,  347,  247,  347,  347,  347,  347,  347,
-      347,  347,  251,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   76,  347,  347,  347,  347,   80,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  266,  347,
-      347,  347,   93,  347,  347,  347,   97,  347,  347,  347,
-
-      100,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  118,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  276,  347,  277,  347,  143,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  174,  347,  286,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  213,  347,
-
-      347,  347,  347,  347,  347,  347,  225,  347,  312,  347,
-      347,  347,  347,  314,  236,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  245,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  213,    0,
-        0,    0,  347,  347,  347,   76,  347,   93,  347,  347,
-      347,  347,  347,  347,  347,  213,  347,  347,  314,  332,
-        0,  335,   22,    0,    0,    0,    0,    0,    0,    0,
+        0,  335,  335,  338,  338,    2,    2,    2,    0,  335,
+      335,  348,  348,  348,  348,  348,  248,  348,  348,  348,
+      348,  348,  348,  348,  252,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,   76,  348,  348,  348,  348,
+       80,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      267,  348,  348,  348,   93,  348,  348,  348,   97,  348,
+      348,  348,  100,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  118,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  277,  348,  278,  348,  143,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  174,  348,
+      287,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      214,  348,  348,  348,  348,  348,  348,  348,  226,  348,
+      313,  348,  348,  348,  348,  315,  237,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  246,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   49,    0,    0,
-        0,    0,    0,  333,    2,   54,  347,   56,  347,  347,
-
-      248,  347,  347,  249,  347,  347,  347,  347,  347,  347,
-      254,  347,   65,  347,   69,  347,  347,  347,  347,  347,
-      347,  347,   78,  347,  347,  347,  347,  264,   81,  347,
-       84,  347,  347,  265,  347,  347,  347,  347,  347,  347,
-       95,  347,  347,  268,  347,  347,  103,  269,  347,  347,
-      105,  347,  347,  114,  347,  347,  192,  347,  347,  347,
-      347,  347,  122,  274,  347,  132,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  283,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  284,  347,  260,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      297,  347,  347,  347,  347,  347,  347,  347,  347,  301,
-      347,  347,  347,  347,  347,  347,  347,  347,  303,  304,
-      206,  347,  347,  347,  347,  347,  347,  308,  347,  347,
-      216,  347,  222,  347,  347,  347,  347,  229,  347,  347,
-      347,  347,  319,  237,  347,  347,  347,  347,  347,  347,
-      243,   56,   65,    0,    0,    0,  122,  132,    0,    0,
-        0,    0,    0,    0,  216,    0,  237,  347,   69,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,   50,    0,    0,
-        0,    0,    0,    0,    0,   28,    0,   26,    0,    0,
-        0,    0,   27,    0,    0,    0,    0,  347,  347,  347,
-      347,  347,  347,  250,  347,   63,  253,  347,  255,  347,
-      347,  347,  347,  347,   72,  347,   73,  347,  347,  347,
-      347,  347,  347,   79,  347,  347,  347,  347,   86,  347,
-       89,   90,  267,  347,   92,  347,  347,  347,  347,  104,
-      271,  347,  347,  347,  347,  347,  347,  272,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  131,  133,  134,  347,  347,  141,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  280,  347,  281,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  287,
-      175,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  296,  295,  300,  191,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  302,  347,  201,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      306,  307,  347,  309,  215,  347,  218,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  241,  322,    0,   86,    0,    0,  134,    0,    0,
-
-        0,    0,    0,    0,  347,  347,  218,  347,   46,   31,
+      214,    0,    0,    0,  348,  348,  348,   76,  348,   93,
+      348,  348,  348,  348,  348,  348,  348,  214,  348,  348,
+      315,  333,  333,  336,    0,  336,  336,   22,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,   49,    0,    0,    0,    0,    0,  334,  335,
+        2,  335,   54,  348,   56,  348,  348,  249,  348,  348,
+      250,  348,  348,  348,  348,  348,  348,  255,  348,   65,
+      348,   69,  348,  348,  348,  348,  348,  348,  348,   78,
+      348,  348,  348,  348,  265,   81,  348,   84,  348,  348,
+      266,  348,  348,  348,  348,  348,  348,   95,  348,  348,
+      269,  348,  348,  103,  270,  348,  348,  105,  348,  348,
+      114,  348,  348,  193,  348,  348,  348,  348,  348,  122,
+      275,  348,  132,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  284,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  285,  348,
+      261,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  298,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  302,  348,  348,
+      348,  348,  348,  348,  348,  348,  304,  305,  207,  348,
+      348,  348,  348,  348,  348,  309,  348,  348,  217,  348,
+      223,  348,  348,  348,  348,  230,  348,  348,  348,  348,
+      320,  238,  348,  348,  348,  348,  348,  348,  244,   56,
+       65,    0,    0,    0,  122,  132,    0,    0,    0,    0,
+
+        0,    0,  217,    0,  238,  348,   69,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  336,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   50,    0,    0,    0,
+        0,    0,    0,    0,   28,    0,   26,    0,    0,    0,
+        0,   27,    0,    0,    0,    0,  348,  348,  348,  348,
+      348,  348,  251,  348,   63,  254,  348,  256,  348,  348,
+      348,  348,  348,   72,  348,   73,  348,  348,  348,  348,
+      348,  348,   79,  348,  348,  348,  348,   86,  348,   89,
+       90,  268,  348,   92,  348,  348,  348,  348,  104,  272,
+      348,  348,  348,  348,  348,  348,  273,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  131,  133,  134,  348,  348,  141,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      281,  348,  282,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  288,  175,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      297,  296,  301,  191,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  303,  348,  202,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      307,  308,  348,  310,  216,  348,  219,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  242,  323,    0,   86,    0,    0,  134,    0,    0,
+        0,    0,    0,    0,  348,  348,  219,  348,   46,   31,
         0,    0,    0,    0,    0,    0,   45,    0,    0,    0,
         0,    0,    0,   23,    0,    0,    0,    0,    0,   43,
-        0,    0,    0,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   68,  347,  347,  347,  347,  321,  347,
-      347,  261,  347,  263,  347,  347,  347,   88,  347,   94,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      113,  347,  347,  347,  347,  347,  120,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  136,  347,  347,  144,
-      347,  347,  347,  347,  347,  347,  347,  347,  153,  347,
-
-      347,  347,  347,  347,  159,  347,  347,  347,  347,  347,
-      347,  347,  170,  347,  347,  347,  347,  347,  176,  347,
-      177,  347,  347,  347,  347,  347,  190,  347,  347,  298,
-      347,  299,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  228,
-      347,  347,  347,  347,  347,  238,  239,  347,  347,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  347,  347,
-      347,   25,    0,   42,    0,    0,   47,    0,    0,    0,
-       29,    0,    0,    0,    0,    0,    0,   40,    0,    0,
-
-      328,  347,  347,  347,  347,  347,   60,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,   82,  347,
-      347,  347,  347,  347,  347,  101,  347,  347,  347,  347,
-      347,  112,  347,  347,  347,  347,  119,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  137,  347,  347,  347,
-      347,  347,  347,  347,  347,  149,  347,  347,  156,  157,
-      158,  347,  347,  347,  347,  347,  347,  166,  347,  347,
-      173,  285,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  189,  347,  347,  193,  347,  347,
-      195,  347,  347,  347,  199,  347,  347,  347,  347,  203,
-
-      347,  208,  347,  347,  305,  347,  347,  347,  347,  347,
-      347,  347,  223,  111,  347,  227,  347,  347,  347,  313,
-      315,  320,  347,    0,    0,    0,    0,  199,    0,    0,
-      208,    0,  347,  223,   44,    0,   39,   30,   48,    0,
-        0,    0,   41,   33,    0,   24,    0,    0,  347,  347,
-       57,  347,   59,  347,   64,  347,   66,  347,  347,   71,
-      347,  347,   52,  347,  347,   87,  347,  347,  347,  102,
-      347,  109,  110,  347,  107,  347,  116,  117,  347,  347,
-      347,  347,  347,  125,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  152,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  169,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-       53,  200,  347,  347,  347,  347,  347,  347,  347,  212,
-      214,  217,  347,  221,  347,  226,  231,  235,  347,  347,
-        0,    0,  107,    0,  200,    0,    0,  347,    0,    0,
-        0,    0,    0,   36,    0,    0,  347,  246,  347,  347,
-       67,   51,   70,   74,  347,  347,   85,   91,  347,  347,
-      106,  347,  115,  347,  121,  273,  123,  347,  347,  347,
-      347,  347,  347,  142,  145,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  160,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  291,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  259,  347,  196,
-      197,  347,  202,  347,  204,  207,  209,  347,  211,  347,
-      347,  347,  347,  240,    0,  106,  197,  204,    0,   74,
-       32,   35,   38,   37,   34,    0,    0,   55,  347,  347,
-      347,  347,   77,  347,  347,  347,  347,  347,  124,  347,
-      347,  347,  347,  347,  146,  147,  151,  148,  347,  347,
-      347,  155,  161,  347,  168,  165,  347,  347,  172,  347,
-      292,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      187,  347,  294,  311,  347,  198,  347,  210,  219,  347,
-      347,  347,  234,    0,  234,    0,    0,  347,   62,  347,
-      347,  347,   96,  347,  108,  347,  347,  347,  347,  135,
-      347,  347,  347,  154,  347,  347,  171,  347,  347,  179,
-      180,  181,  347,  183,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  233,    0,    0,    0,  347,  347,  347,
-      205,   99,  270,  126,  128,  130,  347,  347,  150,  347,
-      167,  282,  293,  347,  347,  347,  347,  188,  347,  347,
-      347,  347,  347,  205,    0,    0,  347,  347,   75,  347,
-      347,  347,  347,  164,  347,  184,  185,  347,  194,  162,
-
-      347,  347,  232,    0,  329,   58,  347,  347,  347,  138,
-      163,  347,  347,  347,  224,  330,  347,  347,  347,  347,
-      347,  220,  178,  347,  347,  347,  347,  127,  129,  347,
-      347,  347,  186,  347,  347,  182,    0
+        0,    0,    0,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,   68,  348,  348,  348,  348,  322,  348,
+      348,  262,  348,  264,  348,  348,  348,   88,  348,   94,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      113,  348,  348,  348,  348,  348,  120,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  136,  348,  348,  144,
+      348,  348,  348,  348,  348,  348,  348,  348,  153,  348,
+      348,  348,  348,  348,  159,  348,  348,  348,  348,  348,
+      348,  348,  170,  348,  348,  348,  348,  348,  176,  348,
+      177,  348,  348,  348,  348,  348,  190,  348,  348,  299,
+      348,  348,  300,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      229,  348,  348,  348,  348,  348,  239,  240,  348,  348,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  348,
+
+      348,  348,   25,    0,   42,    0,    0,   47,    0,    0,
+        0,   29,    0,    0,    0,    0,    0,    0,   40,    0,
+        0,  329,  348,  348,  348,  348,  348,   60,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,   82,
+      348,  348,  348,  348,  348,  348,  101,  348,  348,  348,
+      348,  348,  112,  348,  348,  348,  348,  119,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  137,  348,  348,
+      348,  348,  348,  348,  348,  348,  149,  348,  348,  156,
+      157,  158,  348,  348,  348,  348,  348,  348,  166,  348,
+      348,  173,  286,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  189,  348,  348,  348,  194,
+      348,  348,  196,  348,  348,  348,  200,  348,  348,  348,
+      348,  204,  348,  209,  348,  348,  306,  348,  348,  348,
+      348,  348,  348,  348,  224,  111,  348,  228,  348,  348,
+      348,  314,  316,  321,  348,    0,    0,    0,    0,  200,
+        0,    0,  209,    0,  348,  224,   44,    0,   39,   30,
+       48,    0,    0,    0,   41,   33,    0,   24,    0,    0,
+      348,  348,   57,  348,   59,  348,   64,  348,   66,  348,
+      348,   71,  348,  348,   52,  348,  348,   87,  348,  348,
+      348,  102,  348,  109,  110,  348,  107,  348,  116,  117,
+
+      348,  348,  348,  348,  348,  125,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  152,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  169,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  192,  348,  348,
+      348,  348,  348,   53,  201,  348,  348,  348,  348,  348,
+      348,  348,  213,  215,  218,  348,  222,  348,  227,  232,
+      236,  348,  348,    0,    0,  107,    0,  201,    0,    0,
+      348,    0,    0,    0,    0,    0,   36,    0,    0,  348,
+      247,  348,  348,   67,   51,   70,   74,  348,  348,   85,
+
+       91,  348,  348,  106,  348,  115,  348,  121,  274,  123,
+      348,  348,  348,  348,  348,  348,  142,  145,  348,  348,
+      348,  348,  348,  348,  348,  348,  160,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  292,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      260,  348,  197,  198,  348,  203,  348,  205,  208,  210,
+      348,  212,  348,  348,  348,  348,  241,    0,  106,  198,
+      205,    0,   74,   32,   35,   38,   37,   34,    0,    0,
+       55,  348,  348,  348,  348,   77,  348,  348,  348,  348,
+      348,  124,  348,  348,  348,  348,  348,  146,  147,  151,
+
+      148,  348,  348,  348,  155,  161,  348,  168,  165,  348,
+      348,  172,  348,  293,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  187,  348,  295,  312,  348,  199,  348,
+      211,  220,  348,  348,  348,  235,    0,  235,    0,    0,
+      348,   62,  348,  348,  348,   96,  348,  108,  348,  348,
+      348,  348,  135,  348,  348,  348,  154,  348,  348,  171,
+      348,  348,  179,  180,  181,  348,  183,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  234,    0,    0,    0,
+      348,  348,  348,  206,   99,  271,  126,  128,  130,  348,
+      348,  150,  348,  167,  283,  294,  348,  348,  348,  348,
+
+      188,  348,  348,  348,  348,  348,  206,    0,    0,  348,
+      348,   75,  348,  348,  348,  348,  164,  348,  184,  185,
+      348,  195,  162,  348,  348,  233,    0,  330,   58,  348,
+      348,  348,  138,  163,  348,  348,  348,  225,  331,  348,
+      348,  348,  348,  348,  221,  178,  348,  348,  348,  348,
+      127,  129,  348,  348,  348,  186,  348,  348,  182,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -636,1052 +638,902 @@ static yyconst flex_int32_t yy_ec[256] =
        22,   23,    1,    1,   24,   25,   26,   27,   28,   29,
        30,   31,   32,   33,   34,   35,   36,   37,   38,   39,
        40,   41,   42,   43,   44,   45,   46,   47,   48,   49,
-       50,   51,   52,    1,   53,   54,   55,   56,   57,   58,
+       50,   51,   52,    1,   53,   54,   24,   25,   26,   27,
 
-       59,   60,   61,   62,   63,   64,   65,   66,   67,   68,
-       69,   70,   71,   72,   73,   74,   75,   76,   77,   78,
-       79,   80,   81,   82,   83,   84,    1,    1,    1,    1,
+       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+       38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+       48,   49,   55,   56,   57,   58,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,   85,    1,    1,    1,
-       86,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,   59,    1,    1,    1,
+       60,    1,    1,    1,    1,    1,    1,    1,    1,    1,
 
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   87,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,   61,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[89] =
+static yyconst flex_int32_t yy_meta[63] =
     {   0,
-        1,    1,    2,    1,    3,    1,    4,    1,    1,    5,
-        1,    1,    6,    1,    7,    8,    8,    8,    8,    3,
-        1,    7,    1,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    1,
-        9,   10,    7,    1,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        1,    1,    1,    1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[2065] =
+static yyconst flex_int16_t yy_base[2061] =
     {   0,
-        0,    0,   86,  172,  260,    0,  348,    0,   89,   93,
-       97,   99,   98,  102, 1126, 4871,  115, 4871, 4871,    0,
-     1088,  115,  119,  436,  151,  127,  430,  499,  162,  428,
-      504,  511,  173,  424,   54,  114,  560,  561,  428,  612,
-      620,   80,  444,  667,  622,  676,  449,  725,    0, 1002,
-      965,  892, 4871, 4871, 4871,   98,  116,  126,  145,  173,
-      456,  195,  183,  182,  442,  564,  437,  442,  453,  528,
-      179,  797,  562,  502,  786,  576,  669,  676,  509,  501,
-      719,  516,  791,  559,  514,  793,  801,  580,  843,  860,
-      791,  613, 4871,  254,  549,  944,  913,  919,  866,  595,
-
-      704,  754,  892,  646,  881,  723,  721,  849,  794,  554,
-      870,  834,  565,  641,  861,  838,  855,  628,  877,  874,
-      670,  688,  909,  137,  762,  822, 4871, 4871,  723,  824,
-      784,    0,  726,  809,  927,    0, 4871,  766,  772,    0,
-      769,  763,  920,  931,    0,  934,  950,  752, 4871,  993,
-     1081,  952,  969,  863,  989,  867,  955,  879,  917,  920,
-      979,    0,  949,  985,  977,  997,  992,    0,  975,  981,
-        0, 1005,  993,  995,  998, 1071, 1009,  996,  999, 1062,
-     1075, 1070, 1071, 1069, 1072, 1075, 1090, 1091, 1073, 1093,
-     1083, 1095, 1129, 1092, 1089, 1129, 1087, 1132,    0, 1152,
-
-     1121,    0, 1129,    0, 1152, 1152, 1180, 1136, 1132, 1183,
-     1177, 1149, 1156, 1170, 1176, 1196, 1178, 1204, 1192, 1193,
-     1189, 1193, 1227, 1223, 1211, 1234, 1243, 1213, 1200, 1229,
-     1221, 1233, 1259, 1236, 1235, 1257, 1250, 1253, 1269, 1270,
-     1286, 1262, 1298, 1262,    0,    0, 1283,    0, 1289, 1278,
-     1289, 1305, 1308, 1292, 1308, 1295, 1298, 1317,  666, 4871,
-      607,  591,  585, 1313, 1320, 1316, 1304, 1327, 1331, 1327,
-     1319, 1321, 1335, 1338, 1344, 1321, 1329, 1357, 1351, 1359,
-      617, 1367, 4871, 1363, 1365, 1368, 1360, 1353, 1373, 1378,
-     1377, 1366, 1372, 1383, 1375, 1392, 1413, 1369, 1404, 1401,
-
-     1389, 1406, 1398, 1414,    0, 1403, 1422, 1410, 1407, 1423,
-     1419, 1418, 1435, 1413, 1440, 1430, 1431, 1436, 1433, 1425,
-     1443, 4871,  615, 4871,  558, 1464, 1485, 1489, 1497, 1500,
-     1506, 4871, 4871, 4871, 4871, 1464, 1477, 1466, 1497, 1493,
-     1489, 1504, 1499, 1488, 1499, 1494, 1499, 1501, 4871, 1507,
-     1495, 1504, 1496, 4871, 1500, 4871, 1519, 1505, 1515, 1514,
-     1511, 1510, 1517, 1524,  530, 1551, 1552, 1548, 4871,  501,
-      199, 4871, 4871,  542, 4871,  445,    0, 4871, 4871, 4871,
-        0, 4871, 1571, 1577,  559,  749,  760,  434, 1556, 1630,
-     1561,  177, 1718, 1806, 1590, 1597,  938,  954, 1564, 1566,
-
-     1579, 1579, 1589, 1585, 1592, 1600, 1601, 1619, 1619, 1610,
-     1630, 1618, 1619, 1622, 1638, 1623, 1624, 1629, 1629, 1705,
-        0, 1645, 1626, 1709, 1626, 1633, 1641, 1646, 1632, 1638,
-        0, 1640, 1638, 1708, 1698, 1700, 1701, 1710, 1711, 1704,
-     1706, 1725, 1716,    0, 1718, 1718, 1713, 1730, 1714, 1733,
-     1733, 1730, 1733, 1793, 1738, 1766, 1793, 1786, 1786, 1793,
-     1799, 1794, 1805, 1804, 1800, 1808, 1810, 1796, 1814, 1815,
-        0,    0, 1810, 1811, 1871, 1814, 1823, 1820, 1821, 1925,
-     1822, 1828, 1844, 1857, 1854, 1871, 1868, 1863,    0,  237,
-     1881, 1882, 1907, 1869, 1869, 1877, 1896, 1897, 1917, 1921,
-
-     1939, 1927, 1923, 1936, 1924, 1936, 1929, 1946, 1943, 1952,
-     1951, 1938, 1946, 1964, 1967, 1973, 1981, 1984, 1973, 1984,
-     1988, 1982, 1995, 1977, 1986,    0, 1997, 1989, 1986, 1984,
-     2000, 1981, 1995, 2003, 1995, 2009, 2006, 2008, 2003, 2017,
-     2013, 2025, 2023,    0,    0, 2027,    0,    0, 2032, 4871,
-     2038, 2032, 2035, 2050, 2049, 2053, 2054, 2055, 4871, 2051,
-     2044, 2058, 2049, 2054, 2062, 2056, 2055, 2050, 4871,  196,
-     4871, 2052, 2057, 2059, 2074, 2075, 2075, 2063, 2065, 2081,
-     2088, 2100, 2099, 2104, 2105, 2093, 2101, 2097, 2112, 2106,
-     2112, 2118, 2118, 2122, 2109, 2121, 2108,  189,  764,  181,
-
-     1186,  956, 1052, 2137, 2139, 1106, 1165, 2128, 2122, 2132,
-     2132, 2127, 2131, 2152, 2151, 2142, 2162, 2145, 2146, 2153,
-     2162, 2150, 2166, 2171, 2167, 2170, 4871, 2159, 2165, 2164,
-     2167, 2163, 2181, 2180, 2181, 2179, 2170, 2175, 2199,  462,
-      610, 1222, 4871,    0, 2179, 2254,    0, 1280, 1583, 2210,
-     2210, 2221, 2207, 2228,  153, 2223, 2215, 2234, 2225, 2247,
-     2230, 2248,    0, 2254, 2269, 2250, 2244, 2244, 2248, 2261,
-     2259, 2264, 2256, 2256, 2266, 2254, 2286, 2287,    0, 2280,
-     2304, 2284, 2306, 2293, 2316, 2310, 2320, 2305,    0, 2323,
-     2324, 2315, 2312, 2327, 2328, 2333,    0, 2315, 2316, 2328,
-
-     2319, 2327, 2336, 2340, 2326, 2342, 2343, 2328, 2326, 2342,
-     2335, 2335,    0, 2353, 2357, 2374, 2358, 2360, 2368, 2371,
-     2369, 2383,    0, 2377, 2389, 2388,    0, 2376, 2380, 2387,
-     2392, 2393, 2386, 2400, 2384, 2429, 2403, 2400, 2389, 2407,
-     2394, 2394, 2395, 2398, 2405, 2424, 2429, 2430, 2431, 2443,
-     2446, 2447, 2444, 2436, 2447, 2445,    0, 2449,    0, 2458,
-     2463, 2440, 2452, 2450, 2461, 2450, 2461, 2465, 2470, 2472,
-     2466, 2481, 2485, 2475, 2478, 2490, 2480, 2500, 2492, 2506,
-     2509, 2490, 2511, 2512, 2500, 2504, 2500, 2520, 2513, 2511,
-     2504, 2525, 2525, 2529, 2518, 2529, 2523, 2524, 2516, 2527,
-
-     2522, 2523, 2551, 2542, 2553, 2557,    0, 2553,    0, 2554,
-     2556, 2557, 2563, 2558,    0, 2565, 2561, 2580, 2562, 2564,
-     2580, 2580, 2571, 2583,    0, 2587, 2575, 2590, 2582, 2592,
-     2586, 2581, 2587, 2597, 2581, 2600, 2607, 2615, 4871, 2616,
-     2605, 2612, 2615, 2617, 2631,    0, 2624,    0, 2634, 2622,
-     2632, 2630, 2638, 2632, 2625,    0, 2631, 2635,    0, 4871,
-     1670, 1777, 4871, 2634, 2648, 2645, 2655, 2638, 2653, 2644,
-     2652, 2649, 2658, 2644, 2648, 2662, 2678, 2664, 2664, 2666,
-     2675, 2684, 2693, 2686, 2680, 2683, 2694, 4871, 2685, 2695,
-     2707, 1866, 2690, 4871,    0,    0, 2689,    0, 2708, 2698,
-
-        0, 2697, 2707,    0, 2717, 2704, 2716, 2704, 2705, 2722,
-        0, 2721, 2735, 2725, 2725, 2736, 2739, 2741, 2747, 2738,
-     2759, 2761,    0, 2751, 2745, 2747, 2747,    0,    0, 2758,
-        0, 2749, 2750,    0, 2753, 2768, 2759, 2755, 2775, 2764,
-        0, 2763, 2766,    0, 2782, 2767,    0,    0, 2770, 2787,
-     2804, 2785, 2801,    0, 2805, 2800,    0, 2798, 2825, 2801,
-     2827, 2824, 2836,    0, 2816,    0, 2813, 2828, 2832, 2819,
-     2822, 2841, 2822, 2828, 2849, 2851, 2847, 2854, 2864, 2871,
-     2848, 2877, 2869, 2879, 2871, 2885, 2868,    0, 2863, 2886,
-     2866, 2872, 2891, 2878, 2874, 2881, 2895, 2875, 2900, 2891,
-
-     2902,    0, 2891,    0, 2905, 2897, 2891, 2892, 2901, 2908,
-     2924, 2916, 2911, 2933, 2935, 2923, 2930, 2926, 2930, 2934,
-     2930, 2935, 2936, 2943, 2945, 2952, 2946, 2937, 2954, 2958,
-     2949, 2948, 2963, 2955, 2961, 2953, 2956, 2957,    0,    0,
-     2988, 2971, 2970, 2980, 2993, 2998, 2992,    0, 3002, 2991,
-     3002, 3000,    0, 3012, 3013, 3005, 2997,    0, 3015, 3012,
-     3010, 2995,    0,    0, 3006, 3025, 3011, 3031, 3014, 3017,
-        0, 4871, 4871, 3017, 3020, 3049, 4871, 4871, 3049, 3051,
-     3042, 3053, 3039, 3063, 4871, 3052, 4871, 3063,    0, 3070,
-     3054, 3072, 3054, 3069, 3076, 3060, 3068, 3080, 3078, 3070,
-
-     3084, 3083, 3088, 3076, 3086, 3088, 3079, 4871, 3099, 3109,
-     3114, 3115, 3098, 3117, 3114, 4871, 3126, 4871, 3121, 3123,
-     3123, 3129, 4871, 3121, 1871, 3135, 3131, 3121, 3119, 3131,
-     3126, 3122, 3131,    0, 3138,    0,    0, 3129,    0, 3132,
-     3132, 3136, 3154, 3144,    0, 3148,    0, 3139, 3158, 3157,
-     3164, 3159, 3167,    0, 3179, 3175, 3172, 3183,    0, 3188,
-        0, 3185,    0, 3175,    0, 3181, 3196, 3177, 3194,    0,
-        0, 3185, 3186, 3201, 3182, 3179, 3187,    0, 3201, 3199,
-     3211, 3213, 3212, 3210, 3213, 3216, 3201, 3237, 3224, 3220,
-     3245, 3236,    0,    0, 3238, 3235, 3244, 3236, 3237, 3238,
-
-     3238, 3239, 3237, 3256, 3255, 3245, 3252, 3260, 3262, 3251,
-     3248,    0, 3253,    0, 3258, 3257, 3259, 3259, 3260, 3258,
-     3278, 3293, 3289, 3297, 3299, 3290, 3288, 3301, 3314,    0,
-        0, 3311,  150, 3292, 3299, 3314, 3314, 3296, 3310, 3309,
-     3304,    0,    0,    0,    0, 3319, 3312, 3312, 3309, 3324,
-     3328, 3315, 3317, 3318, 3325, 3340, 3322,    0, 3329,    0,
-     3323, 3358, 3358, 3344, 3364, 3363, 3355, 3370, 3378, 3376,
-        0,    0, 3369,    0,    0, 3359, 3361, 3362, 3363, 3380,
-     3380, 3367, 3373, 3373, 3388, 3378, 3375, 3391, 3385, 3395,
-     3382,    0,    0, 3388, 4871, 3389, 3380, 4871, 3387, 3423,
-
-     3411, 3406, 3426, 3429, 3412, 3412,    0, 3419, 4871, 4871,
-     3415, 3427, 3423, 3438, 3430, 3431, 4871, 3445, 3423, 3436,
-     3433, 3445, 3433, 4871, 3436, 3447, 3435, 3445, 3441, 4871,
-     3459, 3460,   88, 3449, 3457, 3466, 3448, 3481, 3468, 3477,
-     3489, 3484, 3496,    0, 3488, 3483, 3484, 3496,    0, 3486,
-     3500,    0, 3496,    0, 3502, 3501, 3496,    0, 3492,    0,
-     3497, 3500, 3503, 3500, 3507, 3516, 3501, 3521, 3508, 3514,
-        0, 3520, 3525, 3517, 3526, 3543,    0, 3540, 3549, 3553,
-     3543, 3558, 3540, 3551, 3549, 3552,    0, 3554, 3560,    0,
-     3561, 3570, 3551, 3564, 3556, 3555, 3564, 3572,    0, 3569,
-
-     3569, 3574, 3582, 3579,    0, 3577, 3587, 3568, 3581, 3573,
-     3573, 3605,    0, 3602, 3604, 3610, 3618, 3613,    0, 3613,
-        0, 3611, 3627, 3614, 3633, 3612,    0, 3631, 3627,    0,
-     3620,    0, 3618, 3633, 3614, 3631, 3634, 3626, 3629, 3646,
-     3650, 3650, 3663, 3654, 3669, 3662, 3671, 3676, 3684, 3674,
-     3681, 3671, 3672, 3688, 3691, 3690, 3689, 3693, 3686,    0,
-     3697, 3683, 3684, 3700, 3701,    0,    0, 3689, 3699, 3698,
-     3700, 3697, 3705, 3699, 3714, 3725, 3717, 3722, 3733, 3748,
-     3742, 4871, 3730, 4871, 3738, 3733, 4871, 3738, 3735, 3747,
-     4871, 3754, 3749, 3740, 3735, 3752, 3755, 4871, 3767, 3783,
-
-     4871, 3759, 3754, 3751, 3760, 3762,    0, 3758, 3759, 3758,
-     3784, 3795, 3799, 3804, 3796, 3808, 3809, 3794,    0, 3801,
-     3803, 3813, 3799, 3801, 3816,    0, 3807, 3818, 3816, 3813,
-     3822,    0, 3828, 3825, 3812, 3818,    0, 3820, 3818, 3829,
-     3825, 3826, 3822, 3824, 3836, 3841, 3851, 3840, 3845, 3859,
-     3857, 3872, 3855, 3870, 3878, 3876, 3859, 3881,    0,    0,
-        0, 3857, 3870, 3867, 3882, 3865, 3881, 3887, 3870, 3892,
-        0,    0, 3881, 3895, 3884, 3898, 3885, 3892, 3885, 3904,
-     3904, 3932, 3900, 3917,    0, 3921, 3916,    0, 3920, 3926,
-        0, 3925, 3925, 3930,    0, 3931, 3940, 3926, 3928,    0,
-
-     3933,    0, 3934, 3946,    0, 3941, 3928, 3947, 3937, 3945,
-     3959, 3941, 3946,    0, 3939,    0, 3960, 3954, 3976,    0,
-        0,    0, 3968, 3967, 3975, 3990, 3982, 4871, 3994, 3985,
-     4871, 3996, 3987,    0, 4871, 4000, 4871, 4871, 4871, 3978,
-     3985, 3990, 4871, 3991, 4007, 4871, 3998, 4011, 3997, 3999,
-        0, 4011,    0, 4003,    0, 4001,    0, 4013, 4002,    0,
-     4008, 4006,    0, 4005, 4015,    0, 4030, 4036, 4044,    0,
-     4034,    0,    0, 4048,    0, 4042,    0,    0, 4040, 4054,
-     4043, 4058, 4063,    0, 4062, 4063, 4058, 4055, 4068, 4065,
-     4066, 4069, 4068, 4055, 4076,    0, 4062, 4074, 4071, 4062,
-
-     4079, 4082, 4081, 4067, 4090,    0, 4100, 4098, 4092, 4105,
-     4105, 4115, 4101, 4111, 4120, 4112, 4123, 4115, 4104, 4115,
-     4110, 4105, 4119, 4128, 4129, 4123, 4134, 4132, 4126, 4140,
-        0,    0, 4127, 4124, 4132, 4134, 4134, 4134, 4148,    0,
-        0,    0, 4155,    0, 4168,    0, 4153,    0, 4162, 4167,
-     4162, 4165, 4871, 4171, 4871, 4172, 4173, 4174, 4184, 4185,
-     4172, 4172, 4173, 4871, 4182, 4177, 4175,    0, 4194, 4198,
-        0,    0,    0, 4188, 4187, 4193,    0,    0, 4189, 4194,
-        0, 4190,    0, 4206,    0,    0,    0, 4209, 4230, 4235,
-     4219, 4237, 4218,    0,    0, 4238, 4225, 4237, 4235, 4247,
-
-     4235, 4246, 4246,    0, 4247, 4234, 4246, 4243, 4242, 4253,
-     4253, 4247, 4236,    0, 4254, 4249, 4245, 4265, 4259, 4256,
-     4253, 4258, 4279, 4288, 4296, 4280, 4280,    0, 4303,    0,
-        0, 4285,    0, 4305,    0,    0,    0, 4289,    0, 4304,
-     4290, 4297, 4312,    0, 4303, 4871, 4871, 4871, 4293, 4294,
-     4871, 4871, 4871, 4871, 4871, 4297, 4310,    0, 4302, 4298,
-     4304, 4296,    0, 4308, 4311, 4309, 4303, 4313,    0, 4322,
-     4341, 4350, 4337, 4341,    0,    0,    0,    0, 4347, 4347,
-     4361,    0,    0, 4358,    0,    0, 4353, 4364,    0, 4365,
-        0, 4370, 4354, 4365, 4354, 4368, 4358, 4368, 4369, 4370,
-
-        0, 4365,    0,    0, 4378,    0, 4368,    0, 4379, 4365,
-     4378, 4364,    0, 4375, 4871, 4386, 4393, 4382,    0, 4376,
-     4401, 4409,    0, 4411,    0, 4403, 4424, 4425, 4412,    0,
-     4423, 4426, 4421,    0, 4409, 4423,    0, 4418, 4426,    0,
-        0,    0, 4421,    0, 4414, 4415, 4428, 4431, 4436, 4442,
-     4441, 4442, 4429,    0, 4437, 4427, 4452, 4437, 4449, 4474,
-        0,    0,    0, 4481, 4482,    0, 4461, 4478,    0, 4486,
-        0,    0,    0, 4477, 4488, 4489, 4490,    0, 4491, 4492,
-     4484, 4481, 4481, 4871, 4503,   64, 4484, 4488,    0, 4499,
-     4500, 4501, 4502,    0, 4488,    0,    0, 4508,    0,    0,
-
-     4497, 4499,    0,   56, 4871,    0, 4500, 4501, 4505,    0,
-        0, 4506, 4526, 4534,    0, 4871, 4529, 4534, 4537, 4549,
-     4542,    0,    0, 4542, 4543, 4554, 4543,    0,    0, 4544,
-     4542, 4549,    0, 4547, 4545,    0, 4871, 4617, 4627, 4637,
-     4647, 4657, 4667, 4671, 4679, 4689, 4699, 4702, 4712, 4722,
-     4732, 4742, 4752, 4762, 4772, 4782, 4792, 4800, 4810, 4820,
-     4830, 4840, 4850, 4860
+        1,    0,   62,    0,  117,    0,  179,    0,  241,    0,
+      303,    0,  365,    0,    0,   68,   80,    0,    0,  427,
+        0,  489,  110,  537,  590,  637,  639,  645,  653,  669,
+      667,  688,  693,  695,   95,  642,  140,  707,  719,   89,
+      720,  734,   78,  746,  745,  759,  768,  142,  786,   33,
+      827,  889,   15,    0,    0,    0,   38,   41,   55,   67,
+       83,  109,  111,   95,   96,  137,  666,  128,  134,  147,
+      936,    0,    0,  649,  139,  153,  764,  797,  950,  748,
+      658,  154,  521,  402,  966,  690,  468,  962,  971,  696,
+      979,  964,  701,  555,    0,    0,    0,  538,  538,  645,
+
+      609,  940,  687,  997,  646,  665,  653,  715,  754,  763,
+      708,  650,  976,  725,  663,  683,  986,  788,  778,  692,
+      957,  980,  702,  728, 1029, 1091,  723,  779,    0,    0,
+        0, 1153, 1215, 1277,  776,  778, 1277, 1339,    0,  800,
+        0,    0,    0,    0, 1384,    0,    0,    0, 1390, 1412,
+        0, 1460, 1510, 1555,    0, 1392,  860, 1549,  914, 1550,
+      974,  983,  985, 1548,    0,  991, 1318, 1311, 1554, 1545,
+        0, 1435, 1438,    0, 1559, 1451, 1474, 1550, 1564, 1567,
+     1549, 1556, 1561, 1573, 1565, 1567, 1568, 1568, 1571, 1586,
+     1587, 1569, 1589, 1579, 1591, 1590, 1590, 1588, 1580, 1588,
+
+     1599,    0, 1602, 1590,    0, 1599,    0, 1596, 1603, 1613,
+     1599, 1594, 1608, 1604, 1610, 1610, 1625, 1630, 1631, 1614,
+     1630, 1618, 1619, 1615, 1619, 1632, 1633, 1638, 1631, 1640,
+     1642, 1632, 1653, 1643, 1657, 1647, 1661, 1642, 1663, 1658,
+     1653, 1665, 1655, 1657, 1658, 1671, 1658,    0,    0, 1666,
+        0, 1670, 1660, 1669, 1679, 1681, 1665, 1681, 1666, 1668,
+     1688,    0,    0,    0,    0, 1653, 1684, 1692, 1688, 1675,
+     1695, 1695, 1691, 1683, 1685, 1696, 1696, 1702, 1678, 1680,
+     1705, 1698, 1706, 1729, 1761,    0, 1706, 1707, 1711, 1702,
+     1693, 1711, 1716, 1715, 1707, 1717, 1746, 1746, 1761, 1760,
+
+     1740, 1764, 1761, 1748, 1758, 1750, 1766,    0, 1753, 1769,
+     1755, 1752, 1768, 1763, 1762, 1780, 1756, 1782, 1771, 1772,
+     1772,    0, 1767, 1780,    0, 1813,    0, 1875,    0,    0,
+        0, 1924, 1922,    0, 1930,    0,    0,    0,    0, 1793,
+     1857, 1898, 1918, 1915, 1915, 1925, 1923, 1912, 1922, 1917,
+     1921, 1923,    0, 1929, 1917, 1926, 1918,    0,    0, 1922,
+        0, 1938, 1924, 1933, 1932, 1929, 1930, 1936, 1933, 1950,
+     1954, 1955, 1949,    0, 1931, 1992,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1969, 1971, 2037, 2039,    0, 1950,    0, 1953,
+
+     2044,    0, 2083,    0, 2119, 2046, 2076, 1961, 2015, 2032,
+     2058, 2071, 2066, 2072, 2108, 2111, 2113, 2105, 2096, 2114,
+     2101, 2102, 2105, 2121, 2106, 2107, 2112, 2112, 2123,    0,
+     2129, 2110, 2131, 2111, 2118, 2126, 2131, 2118, 2124,    0,
+     2125, 2123, 2137, 2125, 2125, 2126, 2135, 2136, 2130, 2131,
+     2149, 2140,    0, 2141, 2142, 2137, 2154, 2138, 2157, 2157,
+     2154, 2157, 2157, 2161, 2147, 2163, 2157, 2157, 2158, 2164,
+     2159, 2170, 2169, 2165, 2173, 2175, 2160, 2176, 2177,    0,
+        0, 2173, 2174, 2185, 2179, 2194, 2185, 2188, 2205, 2191,
+     2178, 2184, 2197, 2183, 2205, 2200, 2196,    0, 2224, 2215,
+
+     2216, 2210, 2202, 2201, 2203, 2224, 2224, 2223, 2217, 2231,
+     2224, 2219, 2232, 2218, 2231, 2219, 2235, 2232, 2242, 2240,
+     2225, 2232, 2240, 2235, 2238, 2246, 2248, 2237, 2247, 2250,
+     2245, 2257, 2239, 2248,    0, 2259, 2250, 2247, 2245, 2261,
+     2242, 2256, 2264, 2256, 2270, 2267, 2268, 2259, 2271, 2275,
+     2268, 2258,    0,    0, 2261,    0,    0, 2266,    0, 2271,
+     2265, 2267, 2281, 2280, 2283, 2285, 2286,    0, 2282, 2275,
+     2289, 2280, 2284, 2292, 2286, 2285, 2280,    0,    0,    0,
+     2282, 2287, 2289, 2303, 2304, 2301, 2287, 2288, 2302, 2302,
+     2306, 2293, 2308, 2309, 2296, 2304, 2299, 2313, 2305, 2311,
+
+     2317, 2317, 2321, 2308, 2320, 2306,    0, 2343,    0, 2341,
+     2334, 2336,    0, 2342, 2340, 2344,    0, 2340, 2327, 2337,
+     2331, 2325, 2327, 2341, 2338, 2329, 2349, 2332, 2333, 2340,
+     2349, 2335, 2351, 2356, 2351, 2354,    0, 2342, 2347, 2346,
+     2348, 2344, 2362, 2361, 2362, 2360, 2349, 2354, 2370,    0,
+     2341, 2378,    0,    0,    0, 2366, 2367,    0, 2382, 2384,
+        0, 2367, 2367, 2378, 2364, 2384, 2390, 2380, 2369, 2377,
+     2368, 2390, 2373, 2388,    0, 2389, 2394, 2384, 2378, 2378,
+     2381, 2394, 2392, 2397, 2388, 2388, 2398, 2386, 2403, 2405,
+        0, 2395, 2408, 2388, 2411, 2398, 2412, 2404, 2414, 2399,
+
+        0, 2416, 2417, 2408, 2405, 2420, 2421, 2426,    0, 2408,
+     2409, 2421, 2412, 2416, 2425, 2429, 2415, 2431, 2432, 2417,
+     2415, 2431, 2423, 2423,    0, 2438, 2431, 2436, 2433, 2435,
+     2443, 2434, 2432, 2446,    0, 2439, 2451, 2450,    0, 2438,
+     2442, 2449, 2454, 2455, 2448, 2458, 2442, 2462, 2461, 2458,
+     2447, 2465, 2452, 2453, 2453, 2456, 2460, 2467, 2472, 2473,
+     2465, 2475, 2478, 2477, 2475, 2467, 2477, 2476,    0, 2480,
+        0, 2489, 2486, 2472, 2484, 2482, 2487, 2476, 2486, 2491,
+     2496, 2497, 2491, 2503, 2496, 2486, 2489, 2501, 2489, 2503,
+     2493, 2507, 2509, 2491, 2512, 2513, 2501, 2505, 2501, 2521,
+
+     2514, 2512, 2505, 2522, 2522, 2525, 2514, 2525, 2519, 2520,
+     2512, 2522, 2517, 2515, 2532, 2523, 2534, 2528,    0, 2532,
+        0, 2537, 2525, 2526, 2532, 2527,    0, 2534, 2530, 2549,
+     2532, 2534, 2550, 2550, 2541, 2549,    0, 2553, 2540, 2555,
+     2547, 2557, 2551, 2546, 2551, 2561, 2542, 2550, 2557, 2565,
+        0, 2566, 2553, 2554, 2555, 2557, 2571,    0, 2563,    0,
+     2573, 2561, 2571, 2569, 2577, 2571, 2564,    0, 2570, 2574,
+        0,    0,    0,    0, 2592, 2594,    0,    0, 2577, 2587,
+     2584, 2593, 2576, 2591, 2582, 2590, 2587, 2595, 2581, 2582,
+     2585, 2601, 2587, 2587, 2587, 2590, 2597, 2606, 2599, 2592,
+
+     2595, 2606,    0, 2597, 2607, 2616, 2588, 2603,    0,    0,
+        0,    0,    0, 2602,    0, 2620, 2610,    0, 2605, 2615,
+        0, 2624, 2610, 2622, 2610, 2611, 2627,    0, 2626, 2625,
+     2628, 2617, 2627, 2621, 2631, 2636, 2620, 2641, 2642,    0,
+     2632, 2626, 2628, 2628,    0,    0, 2639,    0, 2630, 2631,
+        0, 2634, 2649, 2636, 2632, 2651, 2639,    0, 2638, 2641,
+        0, 2657, 2641,    0,    0, 2644, 2658, 2661, 2646, 2662,
+        0, 2666, 2657,    0, 2656, 2669, 2645, 2671, 2668, 2677,
+        0, 2661,    0, 2658, 2680, 2684, 2672, 2670, 2686, 2667,
+     2673, 2692, 2679, 2676, 2683, 2693, 2698, 2674, 2699, 2689,
+
+     2699, 2691, 2704, 2687,    0, 2682, 2705, 2685, 2691, 2710,
+     2697, 2693, 2700, 2714, 2690, 2715, 2705, 2715,    0, 2704,
+        0, 2718, 2710, 2703, 2704, 2710, 2706, 2722, 2714, 2709,
+     2729, 2730, 2714, 2719, 2715, 2719, 2722, 2718, 2723, 2724,
+     2739, 2732, 2733, 2742, 2735, 2726, 2743, 2741, 2739, 2731,
+     2745, 2738, 2744, 2735, 2738, 2736,    0,    0, 2756, 2739,
+     2738, 2746, 2758, 2759, 2751,    0, 2761, 2748, 2759, 2757,
+        0, 2769, 2770, 2758, 2755,    0, 2773, 2769, 2770, 2754,
+        0,    0, 2760, 2776, 2762, 2782, 2765, 2768,    0,    0,
+        0, 2768, 2768, 2786,    0,    0, 2786, 2788, 2779, 2788,
+
+     2773, 2793,    0, 2780,    0,    0,    0, 2794, 2778, 2796,
+     2778, 2792, 2801,    0, 2791, 2803,    0, 2801, 2789, 2802,
+     2800, 2806, 2794, 2804, 2805, 2796,    0, 2813, 2812, 2817,
+     2818, 2801, 2818, 2814,    0, 2822,    0, 2815, 2817, 2817,
+     2822,    0, 2814, 2799, 2827, 2826, 2816, 2813, 2825, 2820,
+     2816, 2825,    0, 2832,    0,    0, 2819,    0, 2822, 2821,
+     2824, 2842, 2832,    0, 2836,    0, 2826, 2829, 2828, 2835,
+     2830, 2836,    0, 2847, 2839, 2835, 2846,    0, 2851,    0,
+     2848,    0, 2838,    0, 2844, 2859, 2840, 2857,    0,    0,
+     2848, 2849, 2864, 2845, 2842, 2850,    0, 2864, 2858, 2870,
+
+     2871, 2869, 2867, 2870, 2873, 2857, 2877, 2864, 2860, 2880,
+     2877,    0,    0, 2877, 2868, 2876, 2867, 2868, 2869, 2870,
+     2871, 2869, 2888, 2887, 2877, 2884, 2892, 2894, 2883, 2880,
+        0, 2881,    0, 2886, 2884, 2885, 2885, 2886, 2884, 2903,
+     2902, 2898, 2906, 2908, 2897, 2894, 2903, 2915,    0,    0,
+     2912, 2926, 2894, 2901, 2916, 2916, 2898, 2912, 2911, 2906,
+        0,    0,    0,    0, 2921, 2914, 2927, 2915, 2912, 2927,
+     2931, 2914, 2916, 2916, 2922, 2937, 2919,    0, 2926,    0,
+     2919, 2938, 2938, 2924, 2944, 2941, 2932, 2943, 2946, 2949,
+        0,    0, 2942,    0,    0, 2932, 2934, 2934, 2935, 2952,
+
+     2952, 2939, 2945, 2945, 2960, 2950, 2947, 2963, 2953, 2962,
+     2948,    0,    0, 2954,    0, 2955, 2946,    0, 2952, 2972,
+     2960, 2955, 2975, 2976, 2958, 2954,    0, 2960,    0,    0,
+     2956, 2968, 2964, 2979, 2971, 2972,    0, 2986, 2964, 2977,
+     2974, 2986, 2974,    0, 2977, 2988, 2976, 2982, 2978,    0,
+     2995, 2994, 2971, 2986, 2993, 3002, 2983, 3000, 2987, 2992,
+     3003, 2994, 3005,    0, 2997, 2992, 2993, 3005,    0, 2995,
+     3009,    0, 3005,    0, 3011, 3010, 3005,    0, 3001,    0,
+     3006, 3009, 3012, 3009, 3014, 3023, 3008, 3028, 3014, 3019,
+        0, 3025, 3030, 3022, 3030, 3031,    0, 3028, 3033, 3036,
+
+     3022, 3036, 3018, 3029, 3027, 3030,    0, 3032, 3038,    0,
+     3039, 3048, 3029, 3042, 3034, 3033, 3042, 3050,    0, 3047,
+     3045, 3050, 3058, 3055,    0, 3052, 3061, 3042, 3055, 3047,
+     3046, 3062,    0, 3059, 3057, 3062, 3066, 3060,    0, 3060,
+        0, 3058, 3073, 3062, 3076, 3061,    0, 3080, 3076,    0,
+     3078, 3070,    0, 3066, 3081, 3062, 3079, 3081, 3074, 3077,
+     3089, 3094, 3093, 3090, 3081, 3092, 3084, 3089, 3093, 3101,
+     3091, 3098, 3088, 3089, 3105, 3108, 3107, 3106, 3110, 3103,
+        0, 3114, 3100, 3101, 3115, 3116,    0,    0, 3104, 3114,
+     3112, 3113, 3110, 3118, 3112, 3126, 3121, 3113, 3114, 3124,
+
+     3121, 3130,    0, 3117,    0, 3123, 3118,    0, 3123, 3120,
+     3132,    0, 3139, 3134, 3125, 3120, 3137, 3140,    0, 3143,
+     3137,    0, 3141, 3136, 3133, 3139, 3141,    0, 3137, 3138,
+     3136, 3145, 3152, 3155, 3156, 3147, 3158, 3159, 3144,    0,
+     3151, 3153, 3163, 3149, 3151, 3166,    0, 3157, 3168, 3166,
+     3163, 3171,    0, 3176, 3173, 3160, 3166,    0, 3167, 3164,
+     3175, 3171, 3172, 3167, 3168, 3167, 3171, 3177, 3165, 3166,
+     3179, 3176, 3191, 3174, 3189, 3197, 3195, 3178, 3200,    0,
+        0,    0, 3176, 3189, 3186, 3201, 3184, 3199, 3204, 3187,
+     3209,    0,    0, 3198, 3211, 3199, 3213, 3200, 3207, 3199,
+
+     3217, 3204, 3219, 3200, 3213,    0, 3216, 3205, 3213,    0,
+     3209, 3215,    0, 3215, 3215, 3218,    0, 3219, 3228, 3214,
+     3216,    0, 3221,    0, 3222, 3234,    0, 3228, 3215, 3234,
+     3224, 3231, 3244, 3226, 3231,    0, 3224,    0, 3244, 3237,
+     3246,    0,    0,    0, 3237, 3232, 3239, 3250, 3241,    0,
+     3252, 3243,    0, 3254, 3245,    0,    0, 3258,    0,    0,
+        0, 3236, 3243, 3248,    0, 3249, 3265,    0, 3255, 3256,
+     3255, 3256,    0, 3267,    0, 3259,    0, 3257,    0, 3269,
+     3257,    0, 3262, 3259,    0, 3258, 3265,    0, 3267, 3272,
+     3276,    0, 3265,    0,    0, 3275,    0, 3269,    0,    0,
+
+     3267, 3280, 3269, 3284, 3289,    0, 3288, 3289, 3284, 3281,
+     3294, 3291, 3292, 3295, 3294, 3280, 3300,    0, 3286, 3298,
+     3295, 3285, 3301, 3304, 3303, 3289, 3309,    0, 3306, 3303,
+     3293, 3305, 3301, 3311, 3297, 3306, 3315, 3307, 3318, 3310,
+     3299, 3310, 3305, 3300, 3314, 3323, 3324,    0, 3318, 3328,
+     3325, 3319, 3333,    0,    0, 3320, 3316, 3323, 3325, 3325,
+     3325, 3336,    0,    0,    0, 3330,    0, 3342,    0, 3323,
+        0, 3331, 3332, 3327, 3330,    0, 3335,    0, 3336, 3337,
+     3338, 3348, 3349, 3336, 3336, 3337,    0, 3346, 3340, 3340,
+        0, 3358, 3361,    0,    0,    0, 3348, 3350, 3356,    0,
+
+        0, 3351, 3352,    0, 3349,    0, 3361,    0,    0,    0,
+     3351, 3371, 3372, 3356, 3374, 3352,    0,    0, 3372, 3359,
+     3371, 3368, 3380, 3368, 3379, 3379,    0, 3380, 3367, 3379,
+     3376, 3375, 3386, 3386, 3380, 3368,    0, 3385, 3380, 3376,
+     3396, 3387, 3384, 3381, 3382, 3390, 3398, 3402, 3386, 3386,
+        0, 3406,    0,    0, 3388,    0, 3408,    0,    0,    0,
+     3392,    0, 3406, 3392, 3399, 3411,    0, 3406,    0,    0,
+        0, 3396, 3397,    0,    0,    0,    0,    0, 3399, 3410,
+        0, 3405, 3401, 3406, 3398,    0, 3409, 3411, 3408, 3402,
+     3408,    0, 3417, 3418, 3427, 3413, 3415,    0,    0,    0,
+
+        0, 3421, 3421, 3432,    0,    0, 3429,    0,    0, 3424,
+     3435,    0, 3436,    0, 3441, 3425, 3436, 3425, 3439, 3429,
+     3439, 3440, 3441,    0, 3436,    0,    0, 3449,    0, 3439,
+        0, 3450, 3435, 3447, 3432,    0, 3443,    0, 3450, 3434,
+     3449,    0, 3442, 3447, 3450,    0, 3452,    0, 3441, 3462,
+     3463, 3450,    0, 3461, 3464, 3459,    0, 3447, 3461,    0,
+     3456, 3464,    0,    0,    0, 3459,    0, 3452, 3453, 3466,
+     3469, 3474, 3480, 3479, 3480, 3466,    0, 3473, 3462, 3484,
+     3475, 3482, 3487,    0,    0,    0, 3489, 3490,    0, 3469,
+     3484,    0, 3492,    0,    0,    0, 3483, 3494, 3495, 3496,
+
+        0, 3497, 3498, 3490, 3487, 3487,    0, 3502, 3479, 3491,
+     3495,    0, 3506, 3507, 3508, 3509,    0, 3494,    0,    0,
+     3513,    0,    0, 3502, 3504,    0, 3490,    0,    0, 3506,
+     3507, 3508,    0,    0, 3509, 3509, 3512,    0,    0, 3507,
+     3512, 3513, 3525, 3518,    0,    0, 3518, 3519, 3530, 3519,
+        0,    0, 3520, 3518, 3525,    0, 3523, 3521,    0, 3563
     } ;
 
-static yyconst flex_int16_t yy_def[2065] =
+static yyconst flex_int16_t yy_def[2061] =
     {   0,
-     2037,    1, 2038, 2038, 2037,    5, 2037,    7, 2039, 2039,
-     2040, 2040, 2041, 2041, 2037, 2037, 2037, 2037, 2037, 2042,
-     2043, 2037, 2044, 2045, 2037, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2046,
-     2047, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2048,
-     2037, 2045, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044,   37, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-       46, 2044, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2049, 2050, 2037, 2037, 2037, 2037, 2037, 2051,
-     2052, 2053, 2037, 2037, 2037, 2054, 2037, 2037, 2037, 2042,
-     2043, 2043, 2037, 2037, 2044, 2044, 2044, 2055, 2037, 2056,
-     2057, 2037, 2037, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2046, 2037,
-     2047, 2047, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2058, 2037, 2037, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2037, 2059, 2037, 2060, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2049, 2049, 2049, 2049, 2037, 2050,
-     2061, 2037, 2037, 2051, 2037, 2052, 2053, 2037, 2037, 2037,
-     2054, 2037, 2037, 2037, 2037, 2044, 2044, 2055, 2037, 2056,
-     2044, 2062, 2057, 2063, 2037, 2037, 2037, 2037, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2058,
-     2037, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2059, 2059, 2060,
-
-     2060, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2049, 2049, 2049, 2061,
-     2061, 2037, 2037, 2044, 2064, 2063,  646, 2037, 2037, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2049, 2049, 2049, 2037, 2064, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2037, 2037,
-
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2049, 2049, 2049, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-
-     2037, 2037, 2037, 2037, 2044, 2044, 2044, 2044, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2049, 2049, 2049, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2044, 2044,
-     2044, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2049, 2049,
-
-     2037, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2044, 2044, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2049, 2049, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2044, 2037, 2037,
-     2037, 2037, 2037, 2037, 2049, 2049, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2037, 2037, 2037, 2037, 2037, 2044,
-     2037, 2037, 2037, 2037, 2037, 2049, 2049, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2037, 2037, 2049, 2049, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2037, 2049, 2049, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2037, 2049, 2049, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-
-     2044, 2044, 2044, 2049, 2037, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2037, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044, 2044,
-     2044, 2044, 2044, 2044, 2044, 2044,    0, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037
+     2060,    1,    1,    3,    1,    5,    3,    7,    1,    9,
+        1,   11,    1,   13, 2060, 2060,   16,   16,   16,   16,
+       16,   16,   16,   16,    1,   16,   24,   24,   24,   28,
+       27,   28,   28,   33,   27,   24,   34,   32,   34,   36,
+       27,   32,   36,   34,   37,   32,   27,   34,   37,   36,
+        1,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   17,   25,   27,   50,   29,   48,   50,   32,
+       50,   50,   35,   37,   38,   37,   50,   43,   36,   37,
+       50,   36,   47,   50,   16,   17,   17,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,    1,    1,   16,   16,   16,   16,
+       17,    1,    1,   16,   16,   16,   16,   16,   16,   16,
+       17,   20,   22,   22,   16,   26,   50,   24,   50,    1,
+       16,  150,  150,   16,   26,   16,   50,   50,   50,   50,
+       50,   50,   36,   50,   50,   50,   50,   50,   43,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   48,   50,   36,   36,   50,   36,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   35,
+       50,   50,   43,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   43,   50,   36,   50,   50,   50,
+       50,   43,   50,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   43,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   51,   16,   52,   52,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,  158,   50,   50,   50,
+       50,   50,   50,   50,  182,   50,  186,   36,   50,   50,
+
+       50,   50,   50,   50,   50,   43,   50,   50,   50,   50,
+       50,   50,   50,   36,   50,   50,   50,   50,   50,  243,
+      244,  245,   43,   50,   16,   16,   16,   16,  103,  104,
+      103,   16,   16,  104,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,  125,
+      370,  370,  370,   16,  126,  126,   16,   16,   16,  132,
+       16,  133,   16,  134,   16,   16,   16,   16,   16,  138,
+       16,  145,   16,   16,   50,   50,  150,   16,  152,   50,
+
+      153,  153,   20,  154,   16,   16,   16,   50,   50,   50,
+       36,   50,   36,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   43,   50,   50,   50,   50,   50,   50,   36,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   36,   50,   48,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       43,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+       43,   50,   50,   50,   50,   50,   50,   50,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,  284,   16,
+       50,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,  470,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,  326,  326,  328,  328,
+       16,   16,  333,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,  370,  370,  370,  376,
+      376,   16,  396,   16,   50,   20,  403,  657,   16,   16,
+      407,   50,   36,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   36,   50,   50,   36,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   43,
+
+       50,   50,   50,   36,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   43,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       36,   50,   50,   50,   50,   50,   50,   43,   50,   50,
+       43,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   50,   43,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   37,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       43,   50,   50,   43,   50,   36,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   36,   50,   50,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   36,   50,
+       50,   16,   16,  612,   16,   16,  616,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,  370,  370,  370,   16,  652,
+       20,  660,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   43,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   50,   36,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   36,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   36,   36,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   43,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,  930,   50,   50,   50,   50,
+       50,   50,   50, 1038,   50,   50,  876,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,  370,  370,  370,   50,   50,   50,   36,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   36,   50,   43,   50,   50,   50,
+       36,   36,   50,   43,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+       50,   50,   50,   50,   36,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   36,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   50,   50,   50,   50,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+      370,  370,  370,   36,   50,   50,   43,   50,   50,   36,
+       50,   36,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   36,   50,   50,   50,   50,
+       50,   50,   43,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   36,
+       50,   50,   50,   36,   36,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   50,
+
+     1445,   50,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,  370,
+      370,   16,   50,   36,   50,   50,   50,   50,   50,   50,
+       43,   50,   50,   50,   50,   36,   50,   50,   43,   50,
+       36,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   43,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   36,   50,   50,
+
+       50,   36,   50,   43,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   36,   50,   50,   50,   50,   50,
+       50,   50,   36,   50,   36,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   36,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   36,   50,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,  370,  370,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   36,   50,   50,   50,   50,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   43,
+       50,   50,   50,   16,   16,   16,   16,   16,   16,   16,
+       50,   16,   16,   16,   16,   16,   16,  370,  370,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+
+       50,   36,   36,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   36,   50,
+       50,   50,   36,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   16,   16,   16,
+       16,   16,   50,   16,   16,   16,   16,   16,  370,  370,
+       50,   36,   50,   50,   50,   50,   36,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   36,   50,   50,   50,   50,   50,   50,   36,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   36,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   16,   16,  370,  370,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   16,  370,  370,
+       36,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   36,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   16,  370,  370,   50,
+       36,   50,   50,   50,   50,   50,   50,   43,   50,   50,
+       50,   50,   50,   36,   50,   50,  370,   16,   50,   50,
+       50,   50,   50,   50,   50,   36,   50,   50,   16,   50,
+       36,   36,   50,   50,   50,   50,   50,   50,   50,   36,
+       50,   50,   36,   50,   50,   50,   36,   50,   50,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[4960] =
+static yyconst flex_int16_t yy_nxt[3626] =
     {   0,
-       16,   17,   18,   17,   17,   16,   19,   20,   16,   19,
-       21,   16,   16,   16,   22,   23,   24,   25,   25,   16,
-       16,   16,   16,   26,   27,   28,   29,   30,   31,   32,
+       15,   16,   17,   18,   17,   17,   16,   19,   20,   16,
+       21,   22,   16,   16,   16,   23,   24,   25,   26,   26,
+       16,   16,   16,   16,   27,   28,   29,   30,   31,   32,
        33,   34,   35,   36,   37,   38,   39,   40,   41,   42,
-       43,   44,   45,   46,   47,   48,   49,   49,   49,   50,
-       16,   16,   16,   16,   26,   27,   28,   29,   30,   31,
-       32,   33,   34,   35,   36,   37,   38,   39,   40,   41,
-       42,   43,   44,   45,   46,   47,   48,   49,   49,   49,
-       51,   16,   16,   16,   16,   16,   52,   16,   53,   54,
-      129,  195,  129,  129,  129,  130,  129,  129,  131,  130,
-
-      137,   55,  131,  133,  137,  133,  134, 2016,  134,   56,
-      138,   57,   58,   59,  138, 2005,  139,   60,  139,  139,
-       61,   62,  195,  225,   63,   64,   65,   66,   67,   68,
-      143,   69,  144,  144,  264,   70,  146,  146,   55, 1501,
-       56,  196,   57,   58,   59,  197,  147,  135,   60,  135,
-      265,   61,   62,  266,  225,   63,   64,   65,   66,   67,
-       68,  154,   69,  155, 1420,  264,  152,   54,  144,  144,
-      156,  901,  196,   54,   53,   54,  197,  147,  153,  388,
-      139,  265,  139,  139,  266,  170,  371,   55,  171,  172,
-      372,  267,  154,  645,  155,   56,  189,   57,   58,   59,
-
-      190,  156,  173,   60,  191,  174,   61,   62,  268,  153,
-       63,   64,   65,   66,   67,   68,  170,   69,  271,  171,
-      172,   70,  267,  272,   55,  273,   56,  189,   57,   58,
-       59,  190,  601,  173,   60,  191,  174,   61,   62,  268,
-      599,   63,   64,   65,   66,   67,   68,  571,   69,  271,
-      641,  762,  372,   54,  272,  139,  273,  139,  139,   54,
-       16,   17,   53,   71,   17,   16,   19,   16,   16,   19,
-       21,   16,   16,   16,   22,   23,   72,   25,   25,   16,
-       16,   16,   16,   73,   74,   75,   76,   77,   78,   79,
-       80,   81,   49,   82,   83,   84,   85,   86,   87,   49,
-
-       88,   89,   90,   91,   49,   92,   49,   49,   49,   16,
-       16,   16,   16,   16,   73,   74,   75,   76,   77,   78,
-       79,   80,   81,   49,   82,   83,   84,   85,   86,   87,
-       49,   88,   89,   90,   91,   49,   92,   49,   49,   49,
-       51,   54,   16,   16,   16,   16,   16,   54,   93,   94,
-       53,   95,   94,   96,   97,   93,   98,   99,   93,   93,
-       93,   93,  100,  101,   93,  102,  102,   93,  103,  104,
-      105,  106,  107,  108,  109,  110,  111,  112,   93,  113,
-      114,   93,  115,   93,  116,  117,   93,   93,  118,  119,
-      120,  121,   93,  122,   93,   93,   93,  123,   93,   93,
-
-       93,  124,  106,  107,  108,  109,  110,  111,  112,   93,
-      113,  114,   93,  115,   93,  116,  117,   93,   93,  118,
-      119,  120,  121,   93,  122,   93,   93,   93,   93,  125,
-       93,  126,   93,   93,   93,  127,  148,  148,  148,  148,
-      148,  148,  148,  148,  148,  148,  148,  148,  149,  148,
-      389,  210,  151,  157,  375,  148,  148,  158,  148,  192,
-      193,  159,  175,  176,  177,  211,  194,  226,  178,  274,
-      160,  227,  251,  161,  179,  228,  252,  278,  279,  269,
-      280,  229,  210,  270,  157,  148,  148,  148,  158,  148,
-      192,  193,  159,  175,  176,  177,  211,  194,  226,  178,
-
-      274,  160,  227,  251,  161,  179,  228,  252,  278,  279,
-      269,  280,  229,  641,  270,  372,  148,  148,  148,  148,
-      148,  148,  148,  148,  162,  285,  163,  180,  190,  164,
-      165,  181,  185,  166,  185,  182,  167,  303,  186,  168,
-      169,  183,  187,  298,  184,  282,  282,  197,  375,  295,
-      139,  188,  139,  139,  372,  162,  285,  163,  180,  190,
-      164,  165,  181,  185,  166,  185,  182,  167,  303,  186,
-      168,  169,  183,  187,  298,  184,  642,  642,  197,  283,
-      295,  369,  188,  198,  205,  199,  301,  200,  206,  275,
-      302,  201,  207,  344,  202,  276,  154,  203,  284,  288,
-
-      204,  350,  171,  289,  208,  156,  277,  312,  209,  601,
-      326,  228,  327,  327,  198,  205,  199,  301,  200,  206,
-      275,  302,  201,  207,  344,  202,  276,  154,  203,  284,
-      288,  204,  350,  171,  289,  208,  156,  277,  312,  209,
-      212,  213,  228,  219,  255,  239,  256,  220,  214,  240,
-      215,  221,  216,  241,  222,  217,  218,  223,  333,  242,
-      224,  641,  243,  894,  351,  358,  599,  334,  571,  244,
-      550,  212,  213,  262,  219,  255,  239,  256,  220,  214,
-      240,  215,  221,  216,  241,  222,  217,  218,  223,  262,
-      242,  224,  230,  243,  231,  351,  358,  232,  233,  180,
-
-      244,  245,  234,  181,  290,  291,  235,  293,  363,  236,
-      246,  237,  247,  294,  238,  292,  248,  260,  249,  364,
-      250,  328,  328,  230,  139,  231,  139,  139,  232,  233,
-      180,  329,  245,  234,  181,  290,  291,  235,  293,  363,
-      236,  246,  237,  247,  294,  238,  292,  248,  338,  249,
-      364,  250,  253,  254,  296,  297,  255,  378,  256,  336,
-      257,  194,  329,  337,  339,  258,  387,  387,  389,  330,
-      860,  327,  327,  139,  142,  139,  139,  387,  387,  338,
-      142,  331,  382,  253,  254,  296,  297,  255,  378,  256,
-      336,  257,  194,  375,  337,  339,  258,  148,  148,  148,
-
-      148,  148,  148,  148,  148,  148,  148,  148,  148, 2037,
-      148,  162,  331,  163,  299,  599,  148,  148,  300,  148,
-      286,  304,  145,  287,  308,  342,  168,  321,  145,  305,
-      375,  215,  309,  145,  373,  145,  306,  307,  310,  343,
-      379,  311,  162,  356,  163,  299,  148,  148,  148,  300,
-      148,  286,  304,  145,  287,  308,  342,  168,  321,  145,
-      305,  348,  215,  309,  145,  322,  145,  306,  307,  310,
-      343,  379,  311,  313,  314,  355,  349,  148,  148,  148,
-      148,  148,  148,  148,  148,  315,  340,  317,  352,  341,
-      316,  318,  348,  345,  399,  356,  322,  319,  353,  357,
-
-      320,  346,  335,  354,  313,  314,  355,  349,  359,  404,
-      347,  361,  360,  332,  362,  325,  315,  340,  317,  352,
-      341,  316,  318,  407,  345,  399,  356,  324,  319,  353,
-      357,  320,  346,  380,  354,  366,  380,  383,  383,  359,
-      404,  347,  361,  360,  367,  362,  152,  384,  144,  144,
-      368,  146,  146,  408,  407,  398,  398,  410,  153,  409,
-      369,  147,  323,  385,  386,  322,  366,  387,  387,  395,
-      395,  398,  398,  603,  603,  367,  263,  380,  384,  396,
-      405,  368,  397,  397,  408,  413,  398,  398,  410,  153,
-      409,  406,  147,  388,  388,  388,  388,  388,  388,  388,
-
-      388,  388,  388,  388,  388,  388,  388,  411,  414,  391,
-      396,  405,  388,  388,  400,  388,  413,  415,  401,  421,
-      416,  412,  406,  422,  425,  402,  418,  419,  420,  423,
-      426,  403,  427,  424,  430,  431,  432,  433,  411,  414,
-      417,  434,  388,  388,  388,  400,  388,  262,  415,  401,
-      421,  416,  412,  260,  422,  425,  402,  418,  419,  420,
-      423,  426,  403,  427,  424,  430,  431,  432,  433,  603,
-      603,  417,  434,  388,  388,  388,  388,  388,  388,  388,
-      388,  392,  392,  388,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  428,  435,  394,  436,  142,
-
-      392,  392,  437,  392,  438,  439,  443,  440,  441,  429,
-      444,  442,  445,  446,  447,  450,  451,  452,  453,  458,
-      459,  462,  448,  607,  607, 2037,  428,  435,  449,  436,
-      392,  392,  392,  437,  392,  438,  439,  443,  440,  441,
-      429,  444,  442,  445,  446,  447,  450,  451,  452,  453,
-      458,  459,  462,  448,  454,  455,  463,  470,  471,  449,
-      456,  392,  392,  392,  392,  392,  392,  392,  392,  460,
-      482,  457,  464,  483,  465,  467,  461,  488,  476,  466,
-      468,  469,  607,  607, 2037,  454,  455,  463,  470,  471,
-      472,  456,  473,  474,  477,  860,  489,  490,  475,  491,
-
-      460,  482,  457,  464,  483,  465,  467,  461,  488,  476,
-      466,  468,  469,  486,  478,  479,  480,  487,  484,  492,
-      493,  472,  481,  473,  474,  477,  485,  489,  490,  475,
-      491,  494,  495,  497,  496,  498,  499,  601,  505,  642,
-      642, 2037,  514,  515,  486,  478,  479,  480,  487,  484,
-      492,  493,  516,  481,  503,  517,  518,  485,  500,  522,
-      504,  501,  494,  495,  497,  496,  498,  499,  502,  505,
-      506,  508,  509,  514,  515,  507, 2037,  510,  523,  526,
-      524,  511,  512,  516,  513,  503,  517,  518,  527,  500,
-      522,  504,  501,  528,  519,  520,  534,  649,  649,  502,
-
-      538,  506,  508,  509,  525,  529,  507,  521,  510,  523,
-      526,  524,  511,  512,  539,  513,  530,  540,  541,  527,
-      531,  535,  532,  542,  528,  519,  520,  534,  533,  536,
-      543,  538,  544,  545,  546,  525,  529,  547,  521,  548,
-      549,  537,  551,  552,  553,  539,  554,  530,  540,  541,
-      555,  531,  535,  532,  542,  556,  558,  559,  560,  533,
-      536,  543,  561,  544,  545,  546,  562,  564,  547,  565,
-      548,  549,  537,  551,  552,  553,  566,  554,  557,  563,
-      567,  555,  568,  569,  282,  282,  556,  558,  559,  560,
-      405,  572,  401,  561,  573,  575,  574,  562,  564,  402,
-
-      565,  576,  428,  431,  433,  403,  578,  566,  577,  557,
-      563,  567,  449,  568,  569,  580,  583,  439,  283,  579,
-      441,  405,  572,  401, 2037,  573,  575,  574,  584,  468,
-      402,  585,  576,  428,  431,  433,  403,  578,  581,  577,
-      478,  485,  586,  449,  456,  587,  580,  583,  439,  588,
-      579,  441,  496,  589,  590,  582,  504,  512,  592,  584,
-      468,  593,  585,  524,  591,  594,  595,  534,  596,  581,
-      531,  478,  485,  586,  597,  456,  587,  530,  533, 2037,
-      588,  328,  328,  496,  589,  590,  582,  504,  512,  592,
-      324,  329,  593, 2037,  524,  591,  594,  595,  534,  596,
-
-      330,  531,  327,  327,  608,  597,  328,  328,  530,  533,
-      602,  602,  331,  609,  603,  603,  329,  604,  604,  606,
-      606,  324,  329,  607,  607,  610,  613,  605,  611,  612,
-      616,  617,  614,  618,  619,  608,  620,  621,  622,  624,
-      625,  626,  627,  331,  609,  615,  628,  329,  629,  623,
-      630,  631,  632,  634,  633,  635,  610,  613,  605,  611,
-      612,  616,  617,  614,  618,  619,  636,  620,  621,  622,
-      624,  625,  626,  627,  637,  638,  615,  628,  639,  629,
-      623,  630,  631,  632,  634,  633,  635,  643,  383,  383,
-      385,  385,  644,  650,  642,  642,  651,  636,  384,  369,
-
-      649,  649,  369,  369, 2037,  637,  638,  395,  395,  639,
-      648,  648, 2037,  652,  649,  649,  653,  396,  643, 2037,
-      654, 2037,  655,  644,  650,  656,  657,  651,  658,  384,
-      388,  388,  388,  388,  388,  388,  388,  388,  388,  388,
-      388,  388,  388,  388,  652,  659,  391,  653,  396,  388,
-      388,  654,  388,  655,  660,  661,  656,  657,  662,  658,
-      663,  664,  665,  666,  667,  668,  669,  670,  674,  675,
-      678,  679,  680,  681,  682,  683,  659,  684,  685,  388,
-      388,  388, 2037,  388, 2037,  660,  661,  862,  862,  662,
-     2037,  663,  664,  665,  666,  667,  668,  669,  670,  674,
-
-      675,  678,  679,  680,  681,  682,  683, 2037,  684,  685,
-      388,  388,  388,  388,  388,  388,  388,  388,  392,  392,
-      388,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  676,  671,  394,  686, 2037,  392,  392,  687,
-      392,  672,  688,  689,  690,  692,  693,  673,  694,  677,
-      695,  697,  691,  698,  699,  700,  701,  702,  703,  704,
-      696,  705,  706,  676,  671,  709,  686,  392,  392,  392,
-      687,  392,  672,  688,  689,  690,  692,  693,  673,  694,
-      677,  695,  697,  691,  698,  699,  700,  701,  702,  703,
-      704,  696,  705,  706,  862,  862,  709, 2037,  392,  392,
-
-      392,  392,  392,  392,  392,  392,  140,  140,  710,  140,
-      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
-      711,  712,  713,  707, 2037,  140,  140,  708,  140,  714,
-      715,  717,  718,  719,  720,  721,  722,  647,  723,  710,
-      716,  724,  725,  726,  727,  739,  740,  742,  743,  754,
-      741,  711,  712,  713,  707,  140,  140,  140,  708,  140,
-      714,  715,  717,  718,  719,  720,  721,  722,  647,  723,
-      755,  716,  724,  725,  726,  727,  739,  740,  742,  743,
-      754,  741, 2037,  756,  757, 2037,  140,  140,  140,  140,
-      140,  140,  140,  140,  728,  729,  758,  730,  759,  731,
-
-      732,  755,  733,  760,  761,  734,  763,  764,  735,  767,
-     2037,  768,  736,  737,  756,  757,  738,  369, 1126,  769,
-     2037,  770,  369, 1331,  771,  728,  729,  758,  730,  759,
-      731,  732,  772,  733,  760,  761,  734,  763,  764,  735,
-      767,  765,  768,  736,  737,  766,  773,  738,  744,  745,
-      769,  746,  770,  747,  748,  771,  749,  774,  777,  750,
-      779,  780,  775,  772,  782,  783,  751,  752,  781,  778,
-      753,  784,  765,  785,  786,  787,  766,  773,  788,  744,
-      745,  789,  746,  790,  747,  748,  776,  749,  774,  777,
-      750,  779,  780,  775,  791,  782,  783,  751,  752,  781,
-
-      778,  753,  784,  792,  785,  786,  787,  793,  794,  788,
-      795,  797,  789,  798,  790,  799,  800,  776,  801,  802,
-      803,  804,  796,  805,  806,  791,  807,  808,  809,  810,
-      811,  812,  813,  814,  792,  815,  820, 2037,  793,  794,
-      816,  795,  797,  818,  798,  817,  799,  800,  819,  801,
-      802,  803,  804,  796,  805,  806,  821,  807,  808,  809,
-      810,  811,  812,  813,  814,  823,  815,  820,  822,  824,
-      825,  816,  826,  827,  818,  828,  817,  829,  830,  819,
-      831,  832,  833,  834,  835,  836,  837,  821,  838,  839,
-      840,  841,  842,  843,  844,  845,  823,  846,  676,  822,
-
-      824,  825,  847,  826,  827,  691,  828,  848,  829,  830,
-      849,  831,  832,  833,  834,  835,  836,  837,  707,  838,
-      839,  840,  841,  842,  843,  844,  845,  850,  846,  676,
-      715,  852,  741,  847,  853,  765,  691,  854,  848,  771,
-      851,  849,  855,  777,  795,  856,  857,  858,  859,  707,
-      817,  863,  861,  861,  604,  604,  862,  862,  850,  864,
-      865,  715,  852,  741,  605,  853,  765,  866,  854,  867,
-      771,  851,  868,  855,  777,  795,  856,  857,  858,  859,
-      869,  817,  863,  870,  871,  872,  873,  874,  875,  876,
-      864,  865,  877,  878,  879,  605,  880,  881,  866,  882,
-
-      867,  883,  884,  868,  885,  886,  887,  888,  889,  890,
-      895,  869,  891,  892,  870,  871,  872,  873,  874,  875,
-      876,  369,  893,  877,  878,  879,  369,  880,  881, 2037,
-      882, 2037,  883,  884, 2037,  885,  886,  887,  888,  889,
-      890,  895, 2037,  891,  892, 2037,  896,  897,  898,  899,
-      369,  900,  902,  893,  140,  140,  903,  140,  140,  140,
-      140,  140,  140,  140,  140,  140,  140,  140,  904,  905,
-      906,  907, 2037,  140,  140,  908,  140,  896,  897,  898,
-      899,  909,  900,  902,  912,  913,  914,  903,  915,  916,
-      918,  919,  910,  920,  921,  923,  922,  924,  917,  904,
-
-      905,  906,  907,  140,  140,  140,  908,  140, 2037, 2037,
-     2037,  911,  909,  925,  926,  912,  913,  914,  927,  915,
-      916,  918,  919,  910,  920,  921,  923,  922,  924,  917,
-      928,  929,  930,  931,  140,  140,  140,  140,  140,  140,
-      140,  140,  911,  932,  925,  926,  933,  934,  935,  927,
-      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
-      946,  928,  929,  930,  931,  947,  948,  949,  950,  951,
-      952,  953,  954,  955,  932,  956,  957,  933,  934,  935,
-      958,  936,  937,  938,  939,  940,  941,  942,  943,  944,
-      945,  946,  959,  962,  963,  964,  947,  948,  949,  950,
-
-      951,  952,  953,  954,  955,  960,  956,  957,  965,  966,
-      967,  958,  961,  968,  969,  971,  972,  973,  974,  975,
-      976,  970,  977,  959,  962,  963,  964,  978,  979, 2037,
-      983,  984,  985,  986,  987,  988,  960,  989,  990,  965,
-      966,  967,  991,  961,  968,  969,  971,  972,  973,  974,
-      975,  976,  970,  977,  980,  992,  993,  994,  978,  979,
-      981,  983,  984,  985,  986,  987,  988,  995,  989,  990,
-      996,  997,  982,  991, 1000, 1001, 1002,  998, 1003, 1004,
-     1005, 1006, 1009, 1010, 1011,  980,  992,  993,  994,  999,
-     1007,  981, 1012, 1013, 1008, 1014, 1015, 1016,  995, 1017,
-
-     1018,  996,  997,  982, 1019, 1000, 1001, 1002,  998, 1003,
-     1004, 1005, 1006, 1009, 1010, 1011, 1020, 1021, 1022, 1023,
-      999, 1007, 1024, 1012, 1013, 1008, 1014, 1015, 1016, 1025,
-     1017, 1018, 1027, 1028, 1026, 1019, 1029, 1030, 1031, 1032,
-     1033, 1034, 1035, 1036, 1037, 1038, 1039, 1020, 1021, 1022,
-     1023, 1040, 1041, 1024, 1042, 1043, 1044, 1045, 1046, 1047,
-     1025, 1048, 1049, 1027, 1028, 1026, 1050, 1029, 1030, 1031,
-     1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1051, 1052,
-     1053, 1058, 1040, 1041, 1056, 1042, 1043, 1044, 1045, 1046,
-     1047, 1054, 1048, 1049, 1057, 1055, 1059, 1050, 1060, 1061,
-
-     1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1051,
-     1052, 1053, 1058, 1071, 1072, 1056, 1073, 1074, 1075, 1076,
-     1077, 1078, 1054, 1079, 1080, 1057, 1055, 1059, 1081, 1060,
-     1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
-     1082, 1083, 1084, 1085, 1071, 1072, 1086, 1073, 1074, 1075,
-     1076, 1077, 1078, 1087, 1079, 1080, 1088, 1089, 1090, 1081,
-     1091, 1092, 1093,  960, 1094, 1007, 1095, 1096, 1097, 1098,
-     1099, 1082, 1083, 1084, 1085, 1100, 1101, 1086, 1102, 1103,
-     1104, 1105, 1106, 1107, 1087, 1108, 1109, 1088, 1089, 1090,
-     1110, 1091, 1092, 1093,  960, 1094, 1007, 1095, 1096, 1097,
-
-     1098, 1099, 1111, 1112, 1113, 1114, 1100, 1101, 1115, 1102,
-     1103, 1104, 1105, 1106, 1107, 1116, 1108, 1109, 1117, 1118,
-     1119, 1110, 1120, 1121, 1122, 1123, 1124, 2037, 1127, 1128,
-     1125, 1129, 1130, 1111, 1112, 1113, 1114, 1131, 1132, 1115,
-     1133,  369, 1134, 1135, 1136, 1137, 1116, 1138, 1139, 1117,
-     1118, 1119, 1142, 1120, 1121, 1122, 1123, 1124,  369, 1127,
-     1128, 1125, 1129, 1130, 1140, 1143, 1141, 1144, 1131, 1132,
-     1147, 1133, 1148, 1134, 1135, 1136, 1137, 1145, 1138, 1139,
-     1146, 1149, 1150, 1142, 1151, 1152, 1153, 1154, 1155, 1156,
-     1157, 1158, 1159, 1160, 1161, 1140, 1143, 1141, 1144, 1162,
-
-     1163, 1147, 1164, 1148, 1165, 1166, 1167, 1168, 1145, 1169,
-     1170, 1146, 1149, 1150, 1171, 1151, 1152, 1153, 1154, 1155,
-     1156, 1157, 1158, 1159, 1160, 1161, 1178, 1179, 1180, 1172,
-     1162, 1163, 1183, 1164, 1181, 1165, 1166, 1167, 1168, 1173,
-     1169, 1170, 1174, 1175, 1182, 1171, 1176, 1177, 1184, 1185,
-     1186, 1187, 1193, 1194, 1195, 1196, 1197, 1178, 1179, 1180,
-     1172, 1188, 1198, 1183, 1189, 1181, 1199, 1190, 1200, 1201,
-     1173, 1191, 1202, 1174, 1175, 1182, 1192, 1176, 1177, 1184,
-     1185, 1186, 1187, 1193, 1194, 1195, 1196, 1197, 1203, 1204,
-     1205, 1206, 1188, 1198, 1207, 1189, 1208, 1199, 1190, 1200,
-
-     1201, 1209, 1191, 1202, 1210, 1211, 1212, 1192, 1213, 1214,
-     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1203,
-     1204, 1205, 1206, 1224, 1225, 1207, 1226, 1208, 1227, 1228,
-     1229, 1230, 1209, 1231, 1232, 1210, 1211, 1212, 1233, 1213,
-     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1234, 1235, 1236, 1237, 1224, 1225, 1238, 1226, 1239, 1227,
-     1228, 1229, 1230, 1240, 1231, 1232, 1241, 1242, 1243, 1233,
-     1244, 1245, 1246, 1247, 1248, 1251, 1249, 1252, 1253, 1254,
-     1257, 1234, 1235, 1236, 1237, 1250, 1255, 1238, 1258, 1239,
-     1259, 1260, 1261, 1256, 1240, 1262, 1263, 1241, 1242, 1243,
-
-     1264, 1244, 1245, 1246, 1247, 1248, 1251, 1249, 1252, 1253,
-     1254, 1257, 1265, 1268, 1266, 1269, 1250, 1255, 1270, 1258,
-     1271, 1259, 1260, 1261, 1256, 1272, 1262, 1263, 1273, 1274,
-     1267, 1264, 1275, 1276, 1277, 1278, 1279, 1282, 1283, 1286,
-     1284, 1280, 1287, 1265, 1268, 1266, 1269, 1281, 1288, 1270,
-     1285, 1271, 1289, 1290, 1291, 1292, 1272, 1293, 1294, 1273,
-     1274, 1267, 1295, 1275, 1276, 1277, 1278, 1279, 1282, 1283,
-     1286, 1284, 1280, 1287, 1296, 1298, 1299, 1300, 1281, 1288,
-     1301, 1285, 1302, 1289, 1290, 1291, 1292, 1303, 1293, 1294,
-     1304, 1297, 1140, 1295, 1141, 1305, 1159, 1172, 1182, 1306,
-
-     1190, 1245, 1307, 1308, 1309, 1296, 1298, 1299, 1300, 1192,
-     1310, 1301, 1311, 1302, 1312, 1313, 1314, 1315, 1303, 1316,
-     1317, 1304, 1297, 1140, 1318, 1141, 1305, 1159, 1172, 1182,
-     1306, 1190, 1245, 1307, 1308, 1309, 1319, 1320, 1321, 1322,
-     1192, 1310, 1323, 1311, 1324, 1312, 1313, 1314, 1315, 1325,
-     1316, 1317, 1326, 1327, 1328, 1318, 1329, 1330, 1333, 1334,
-     1332, 1335, 1336, 1337, 1338, 1339, 1340, 1319, 1320, 1321,
-     1322, 1341, 1342, 1323, 1343, 1324, 1344, 1345, 1346, 1347,
-     1325, 1348,  369, 1326, 1327, 1328,  369, 1329, 1330, 1333,
-     1334, 1332, 1335, 1336, 1337, 1338, 1339, 1340, 1349, 1350,
-
-     1351, 1352, 1341, 1342, 1353, 1343, 1354, 1344, 1345, 1346,
-     1347, 1355, 1348, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
-     1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1349,
-     1350, 1351, 1352, 1372, 1373, 1353, 1374, 1354, 1375, 1376,
-     1377, 1378, 1355, 1379, 1356, 1357, 1358, 1359, 1360, 1361,
-     1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
-     1380, 1381, 1382, 1385, 1372, 1373, 1386, 1374, 1383, 1375,
-     1376, 1377, 1378, 1387, 1379, 1388, 1384, 1389, 1390, 1391,
-     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
-     1402, 1380, 1381, 1382, 1385, 1403, 1404, 1386, 1405, 1383,
-
-     1406, 1407, 1408, 1409, 1387, 1410, 1388, 1384, 1389, 1390,
-     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
-     1401, 1402, 1411, 1412, 1413, 1414, 1403, 1404, 1415, 1405,
-     1416, 1406, 1407, 1408, 1409, 1417, 1410, 1418, 1419, 1421,
-     1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
-     1432, 1433, 1434, 1411, 1412, 1413, 1414, 1435, 1436, 1415,
-     1437, 1416, 1438, 1439, 1440, 1441, 1417, 1442, 1418, 1419,
-     1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
-     1431, 1432, 1433, 1434, 1443, 1444, 1445, 1446, 1435, 1436,
-     1447, 1437, 1448, 1438, 1439, 1440, 1441, 1449, 1442, 1452,
-
-     1453, 1454, 1455, 1450, 1456, 1457, 1458, 1459, 1460, 1461,
-     1462, 1463, 1464, 1465, 1466, 1443, 1444, 1445, 1446, 1451,
-     1467, 1447, 1468, 1448, 1469, 1470, 1471, 1472, 1449, 1473,
-     1452, 1453, 1454, 1455, 1450, 1456, 1457, 1458, 1459, 1460,
-     1461, 1462, 1463, 1464, 1465, 1466, 1474, 1475, 1476, 1477,
-     1451, 1467, 1478, 1468, 1479, 1469, 1470, 1471, 1472, 1480,
-     1473, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
-     1490, 1491, 1492, 1493, 1494, 1495, 1496, 1474, 1475, 1476,
-     1477, 1497, 1498, 1478, 1499, 1479, 1502, 1500, 1503, 1504,
-     1480, 1505, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
-
-     1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1506, 1507,
-      369,  369, 1497, 1498, 1508, 1499, 1509, 1502, 1500, 1503,
-     1504, 1510, 1505, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
-     1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1506,
-     1507, 1527, 1528, 1529, 1530, 1508, 1531, 1509, 1532, 1533,
-     1534, 1535, 1510, 1536, 1511, 1512, 1513, 1514, 1515, 1516,
-     1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
-     1537, 1538, 1527, 1528, 1529, 1530, 1539, 1531, 1540, 1532,
-     1533, 1534, 1535, 1541, 1536, 1542, 1543, 1544, 1545, 1546,
-     1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
-
-     1557, 1537, 1538, 1558, 1559, 1560, 1561, 1539, 1562, 1540,
-     1563, 1564, 1565, 1566, 1541, 1567, 1542, 1543, 1544, 1545,
-     1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555,
-     1556, 1557, 1568, 1569, 1558, 1559, 1560, 1561, 1570, 1562,
-     1571, 1563, 1564, 1565, 1566, 1572, 1567, 1573, 1574, 1576,
-     1575, 1579, 1577, 1585, 1586, 1587, 1588, 1580, 1581, 1589,
-     1590, 1591, 1592, 1568, 1569, 1593, 1594, 1595, 1582, 1570,
-     1583, 1571, 1578, 1596, 1584, 1597, 1572, 1598, 1573, 1574,
-     1576, 1575, 1579, 1577, 1585, 1586, 1587, 1588, 1580, 1581,
-     1589, 1590, 1591, 1592, 1599, 1600, 1593, 1594, 1595, 1582,
-
-     1601, 1583, 1602, 1578, 1596, 1584, 1597, 1603, 1598, 1604,
-     1605, 1606, 1607, 1608, 1609, 1610, 1611, 1613, 1612, 1614,
-     1615, 1616, 1617, 1618, 1619, 1599, 1600, 1620, 1621, 1622,
-     1623, 1601, 1624, 1602, 1625, 1626, 1627, 1628, 1603, 1629,
-     1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1613, 1612,
-     1614, 1615, 1616, 1617, 1618, 1619, 1630, 1631, 1620, 1621,
-     1622, 1623, 1632, 1624, 1633, 1625, 1626, 1627, 1628, 1634,
-     1629, 1635, 1580, 1581, 1636, 1637, 1638, 1639, 1640, 1641,
-     1642, 1643, 1644, 1645, 1646, 1583, 2037, 1630, 1631, 1584,
-     1649, 1650, 1651, 1632, 1647, 1633, 1652, 1653, 1654, 1655,
-
-     1634, 1656, 1635, 1580, 1581, 1636, 1637, 1638, 1639, 1640,
-     1641, 1642, 1643, 1644, 1645, 1646, 1583, 1648,  369, 1657,
-     1584, 1649, 1650, 1651, 1658, 1647, 1659, 1652, 1653, 1654,
-     1655, 1660, 1656, 1661,  369, 1662, 1663, 1664, 1665, 1666,
-     1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1648, 1675,
-     1657, 1676, 1677, 1678, 1679, 1658, 1680, 1659, 1681, 1682,
-     1683, 1684, 1660, 1685, 1661, 1686, 1662, 1663, 1664, 1665,
-     1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1687,
-     1675, 1688, 1676, 1677, 1678, 1679, 1689, 1680, 1690, 1681,
-     1682, 1683, 1684, 1691, 1685, 1692, 1686, 1693, 1694, 1695,
-
-     1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705,
-     1687, 1706, 1688, 1707, 1708, 1709, 1710, 1689, 1711, 1690,
-     1712, 1713, 1714, 1715, 1691, 1716, 1692, 1717, 1693, 1694,
-     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
-     1705, 1718, 1706, 1721, 1707, 1708, 1709, 1710, 1722, 1711,
-     1724, 1712, 1713, 1714, 1715, 1719, 1716, 1725, 1717, 1726,
-     1727, 1728, 1729, 1720, 1723, 1730, 1731, 1732, 1733, 1734,
-     1735, 1736, 1718, 1737, 1721, 1738, 1739, 1740, 1741, 1722,
-     1742, 1724, 1743, 1744, 1745, 1746, 1719, 1747, 1725, 1748,
-     1726, 1727, 1728, 1729, 1720, 1723, 1730, 1731, 1732, 1733,
-
-     1734, 1735, 1736, 1749, 1737, 1750, 1738, 1739, 1740, 1741,
-     1751, 1742, 1752, 1743, 1744, 1745, 1746, 1753, 1747, 1754,
-     1748, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
-     1764, 2037, 1765, 1767, 1749, 1768, 1750, 1769, 1770, 1771,
-     1772, 1751, 1773, 1752, 1774, 1766, 1775, 1776, 1753,  369,
-     1754, 1777, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762,
-     1763, 1764,  369, 1765, 1767, 1778, 1768, 1779, 1769, 1770,
-     1771, 1772, 1780, 1773, 1781, 1774, 1766, 1775, 1776, 1782,
-     1783, 1784, 1777, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
-     1792, 1793, 1794, 1795, 1796, 1797, 1778, 1798, 1779, 1799,
-
-     1800, 1801, 1802, 1780, 1803, 1781, 1804, 1805, 1806, 1807,
-     1782, 1783, 1784, 1808, 1785, 1786, 1787, 1788, 1789, 1790,
-     1791, 1792, 1793, 1794, 1795, 1796, 1797, 1809, 1798, 1810,
-     1799, 1800, 1801, 1802, 1811, 1803, 1812, 1804, 1805, 1806,
-     1807, 1813, 1814, 1815, 1808, 1816, 1817, 1818, 1819, 1820,
-     1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1809, 1829,
-     1810, 1830, 1831, 1832, 1833, 1811, 1834, 1812, 1835, 1836,
-     1837, 1838, 1813, 1814, 1815, 1839, 1816, 1817, 1818, 1819,
-     1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1840,
-     1829, 1841, 1830, 1831, 1832, 1833, 1842, 1834, 1843, 1835,
-
-     1836, 1837, 1838, 1844, 1845, 1846, 1839, 1847, 1848, 1849,
-     1850, 1851, 1852, 1853, 1854, 1855, 1856, 1858, 1857, 1859,
-     1840, 1860, 1841, 1863, 1864, 1861, 1865, 1842,  369, 1843,
-     1862, 1866, 1867,  369, 1844, 1845, 1846, 1868, 1847, 1848,
-     1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1858, 1857,
-     1859, 1869, 1860, 1870, 1863, 1864, 1861, 1865, 1871, 1872,
-     1873, 1862, 1866, 1867, 1874, 1875, 1876, 1877, 1868, 1878,
-     1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888,
-     1889, 1890, 1869, 1891, 1870, 1892, 1893, 1894, 1895, 1871,
-     1872, 1873, 1896, 1897, 1898, 1874, 1875, 1876, 1877, 1899,
-
-     1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
-     1888, 1889, 1890, 1900, 1891, 1901, 1892, 1893, 1894, 1895,
-     1902, 1903, 1904, 1896, 1897, 1898, 1905, 1906, 1907, 1908,
-     1899, 1909, 1910, 1911, 1914, 1915, 1862, 1912, 1916, 1918,
-     1919, 1917, 1920, 1921, 1900, 1922, 1901, 1923,  369, 1924,
-     1925, 1902, 1903, 1904, 1913, 1926, 1927, 1905, 1906, 1907,
-     1908,  369, 1909, 1910, 1911, 1914, 1915, 1862, 1912, 1916,
-     1918, 1919, 1917, 1920, 1921, 1928, 1922, 1929, 1923, 1930,
-     1924, 1925, 1931, 1932, 1933, 1913, 1926, 1927, 1934, 1935,
-     1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
-
-     1946, 1947, 1948, 1949, 1950, 1951, 1928, 1952, 1929, 1953,
-     1930, 1954, 1955, 1931, 1932, 1933, 1958, 1956, 1959, 1934,
-     1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
-     1945, 1946, 1947, 1948, 1949, 1950, 1951,  369, 1952, 1960,
-     1953, 1957, 1954, 1955,  369, 1961, 1962, 1958, 1956, 1959,
-     1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972,
-     1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
-     1960, 1983, 1957, 1984, 1987, 1985, 1961, 1962,  369, 1986,
-     1988, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971,
-     1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
-
-     1982, 1989, 1983,  369, 1984, 1987, 1985, 1990, 1991, 1992,
-     1986, 1988, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000,
-     2001, 2002, 2003, 2037, 2006, 2007, 2008, 2009, 2010, 2011,
-     2004, 2012, 1989, 2013, 2014, 2015, 2017, 2018, 1990, 1991,
-     1992, 2019, 2020, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
-     2000, 2001, 2002, 2003,  369, 2006, 2007, 2008, 2009, 2010,
-     2011, 2004, 2012, 2021, 2013, 2014, 2015, 2017, 2018, 2022,
-     2023, 2024, 2019, 2020, 2025, 2026, 2027, 2028, 2029, 2030,
-     2031, 2032, 2033, 2034, 2035, 2036, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2021, 2037, 2037, 2037, 2037, 2037,
-
-     2022, 2023, 2024, 2037, 2037, 2025, 2026, 2027, 2028, 2029,
-     2030, 2031, 2032, 2033, 2034, 2035, 2036,   16,   16,   16,
-       16,   16,   16,   16,   16,   16,   16,  128,  128,  128,
-      128,  128,  128,  128,  128,  128,  128,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,  132,  136,  136,  136,
-      136,  136,  136,  136,  136,  136,  136,  140, 2037,  140,
-      140,  140,  140,  140,  140,  140,  140,  141, 2037,  141,
-      141,  141,  141,  141,  141,  141,  141,  145,  145,  150,
-      150,  150,  150,  150,  150,  150,  150,  150,  150,  259,
-      259,  259,  259,  259,  259,  259,  259,  259,  259,  261,
-
-     2037,  261,  261,  261,  261,  261,  261,  261,  261,  281,
-     2037,  281,  365,  365,  365,  365,  365,  365,  365,  365,
-      365,  365,  370,  370,  370,  370,  370,  370,  370,  370,
-      370,  370,  374,  374,  374,  374,  374,  374,  374,  374,
-      374,  374,  376,  376,  376,  376,  376,  376,  376,  376,
-      376,  376,  377,  377,  377, 2037, 2037,  377,  377,  377,
-     2037,  377,  381, 2037,  381,  381,  381, 2037,  381,  381,
-      381,  381,  388,  388,  388,  388,  388,  388,  388,  388,
-      388,  388,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  393,  393,  393,  393,  393,  393,  393,  393,
-
-      393,  393,  570, 2037, 2037, 2037,  570,  570, 2037,  570,
-      598,  598,  598, 2037,  598,  598,  598,  598,  598,  598,
-      600,  600,  600,  600, 2037,  600,  600,  600,  600,  600,
-      640,  640,  640,  640,  640,  640,  640,  640,  640,  640,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      646, 2037,  646,  646,  646,  646,  646,  646,  646,  646,
-      140, 2037,  140,  140,  140,  140,  140,  140,  140,  140,
-       15, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037
+       43,   44,   45,   46,   47,   48,   49,   50,   50,   50,
+       51,   16,   16,   16,   16,   52,   16,   16,   16,   16,
+       16,   53,   16,   16,   54,   55,   16,   15,   16,   16,
+      147,   16,   16,  266,  267,  268,   16,   56,   16,   16,
+       16,  141,  269,  141,  141,   57,   16,   58,   59,   60,
+       16,   16,   16,   61,   16,   16,   62,   63,   16,   16,
+
+       64,   65,   66,   67,   68,   69,   16,   70,   16,   16,
+       16,   71,  213,  270,   72,  147,   16,   55,  271,   54,
+       73,  228,   16,   55,   16,  145,  214,  146,  146,  147,
+      195,  196,  272,   74,  274,  275,  273,  197,  147,  276,
+       75,   76,   77,   78,   79,   80,   81,   82,   83,   50,
+       84,   85,   86,   87,   88,   89,   50,   90,   91,   92,
+       93,   50,   94,  147,  277,  254,   16,  199,  281,  255,
+      282,  200,   55,  147,  283,  287,  288,   16,   55,   95,
+       96,  193,   97,   96,   98,   99,   95,  100,  101,   95,
+       95,   95,   95,  102,  103,   95,  104,  104,   95,  105,
+
+      106,  107,  108,  109,  110,  111,  112,  113,  114,   95,
+      115,  116,   95,  117,   95,  118,  119,   95,   95,  120,
+      121,  122,  123,   95,  124,   95,   95,   95,  125,   95,
+       95,   95,  126,   95,  127,   95,  128,   95,   95,   95,
+      129,  130,  131,  130,  131,  131,  130,  132,  130,  130,
+      133,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+
+      130,  130,  130,  134,  134,  134,  134,  134,  134,  135,
+      134,  134,  136,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  137,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  138,  138,  139,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  140,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  142,  142,  301,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  143,
+      143,  306,  143,  143,  143,  143,  143,  143,  143,  143,
+
+      144,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  147,  147,  147,  148,  148,  299,  300,  147,  325,
+      147,  147,  147,  147,  149,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  258,  326,  259,  147,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+
+      150,  150,  151,  150,  152,  152,  153,  152,  152,  150,
+      150,  152,  150,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  150,
+      150,  150,  152,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  154,  327,  155,  155,  147,  147,  328,  147,
+      147, 2060,  147,  147,  156,  152,  147,  336,  160,  147,
+      147,  147,  161,  157,  339,  158,  162,  337,  165,  198,
+      166,  188,  159,  167,  168,  163,  338,  169,  164,  348,
+      170,  278,  173,  171,  172,  174,  175,  279,  298,  354,
+
+      147,  178,  179,  180,  331,  331,  355,  181,  280,  176,
+      147,  183,  177,  182,  332,  184,  188,  304,  192,  185,
+      189,  305,  193,  315,  190,  186,  194,  231,  187,  363,
+      201,  147,  202,  191,  203,  147,  147,  324,  204,  346,
+      368,  205,  208,  147,  206,  147,  209,  207,  215,  216,
+      210,  340,  352,  347,  147,  341,  217,  222,  218,  369,
+      219,  223,  211,  220,  221,  224,  212,  353,  225,  229,
+      233,  226,  234,  230,  227,  235,  236,  231,  378,  296,
+      237,  342,  242,  232,  238,  297,  243,  239,  147,  240,
+      244,  379,  241,  248,  147,  147,  245,  343,  289,  246,
+
+      344,  290,  249,  345,  250,  147,  247,  385,  251,  386,
+      252,  147,  253,  256,  257,  359,  391,  258,  361,  259,
+      291,  260,  362,  174,  292,  360,  261,  262,  262,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  263,  262,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,  264,
+      264,  408,  264,  264,  264,  264,  264,  264,  264,  264,
+
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  265,  264,  264,  264,  264,
+      264,  284,  284,  285,  285,  329,  413,  330,  330,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  293,  294,  286,  364,  302,
+      307,  320,  365,  303,  311,  321,  295,  147,  308,  349,
+
+      218,  322,  312,  147,  323,  309,  310,  350,  313,  316,
+      317,  314,  333,  356,  334,  334,  351,  366,  416,  417,
+      367,  318,  419,  357,  335,  418,  319,  422,  358,  370,
+      370,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+      370,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+      370,  370,  370,  370,  370,  371,  370,  370,  370,  370,
+      370,  370,  370,  370,  372,  370,  370,  370,  370,  370,
+      373,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+      374,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+      370,  375,  375,  375,  375,  375,  375,  375,  375,  375,
+
+      375,  375,  375,  375,  375,  375,  375,  375,  375,  375,
+      375,  375,  375,  375,  375,  375,  375,  375,  375,  375,
+      375,  375,  375,  375,  375,  375,  375,  375,  375,  375,
+      375,  375,  375,  375,  375,  375,  375,  375,  375,  375,
+      376,  375,  375,  375,  377,  375,  375,  375,  375,  375,
+      375,  375,  375,  380,  380,  380,  380,  380,  380,  381,
+      380,  380,  380,  380,  380,  380,  380,  380,  380,  380,
+      380,  380,  380,  380,  380,  380,  380,  380,  380,  380,
+      380,  380,  380,  380,  380,  380,  380,  380,  380,  380,
+      380,  380,  380,  380,  380,  380,  380,  380,  380,  380,
+
+      380,  380,  380,  380,  380,  380,  380,  380,  380,  380,
+      380,  380,  380,  380,  380,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  383,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  382,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  382,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  382,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  382,  382,  382,  382,  382,  382,
+      382,  382,  382,  382,  382,  382,  382,  384,  384,  384,
+      384,  384,  384,  387,  384,  384,  388,  384,  384,  384,
+      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
+
+      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
+      384,  384,  384,  384,  384,  384,  384,  384,  384,  384,
+      384,  384,  384,  384,  384,  384,  384,  389,  384,  384,
+      384,  384,  384,  384,  384,  384,  384,  384,  384,  390,
+      390,  423,  390,  390,  390,  390,  390,  390,  390,  390,
+      390,  424,  390,  390,  390,  390,  390,  390,  390,  390,
+      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
+      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
+      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
+      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
+
+      390,  392,  392,  394,  395,  406,  406,  396,  396,  407,
+      407,  393,  397,  397,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  397,  397,  397,  397,  397,  398,  397,
+      397,  397,  397,  397,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  397,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  397,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  397,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  397,  399,  399,  400,  399,  399,  430,
+      431,  399,  434,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  435,
+      401,  401,  399,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  401,  401,  402,  402,  403,  402,  402,  401,
+      401,  402,  401,  402,  402,  402,  402,  402,  402,  402,
+      402,  402,  402,  402,  402,  402,  402,  402,  402,  402,
+      402,  402,  402,  402,  402,  402,  402,  402,  402,  401,
+      401,  401,  402,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  404,  404,  409,  414,  420,  425,  410,  427,
+      428,  429,  405,  432,  436,  411,  415,  433,  437,  441,
+      421,  412,  439,  440,  442,  444,  445,  426,  443,  447,
+
+      446,  448,  438,  449,  450,  452,  453,  451,  454,  455,
+      456,  459,  460,  461,  462,  463,  464,  467,  457,  468,
+      469,  465,  471,  472,  458,  476,  479,  470,  480,  485,
+      477,  478,  466,  491,  481,  492,  482,  483,  497,  473,
+      495,  474,  484,  493,  496,  486,  475,  487,  488,  489,
+      498,  494,  499,  500,  501,  490,  502,  503,  504,  506,
+      505,  507,  508,  509,  512,  514,  510,  515,  517,  518,
+      513,  523,  516,  511,  519,  524,  525,  526,  520,  521,
+      527,  522,  528,  529,  531,  532,  533,  535,  536,  537,
+      538,  540,  543,  541,  544,  530,  547,  548,  549,  542,
+
+      550,  539,  545,  551,  552,  553,  554,  555,  556,  557,
+      534,  558,  559,  560,  546,  561,  562,  563,  564,  565,
+      567,  568,  569,  570,  571,  573,  574,  575,  576,  577,
+      578,  147,  414,  579,  581,  584,  582,  572,  583,  585,
+      437,  440,  566,  579,  579,  579,  579,  579,  579,  586,
+      579,  587,  579,  579,  579,  579,  579,  579,  579,  579,
+      579,  579,  579,  579,  579,  579,  579,  579,  579,  579,
+      579,  579,  579,  579,  579,  579,  579,  579,  285,  285,
+      580,  579,  588,  458,  589,  590,  147,  592,  593,  477,
+      594,  465,  487,  494,  595,  596,  597,  505,  598,  599,
+
+      513,  521,  591,  601,  602,  533,  603,  604,  147,  600,
+      605,  606,  286,  607,  607,  607,  607,  607,  607,  617,
+      607,  607,  607,  607,  607,  607,  607,  607,  607,  607,
+      607,  607,  607,  607,  607,  607,  607,  607,  607,  607,
+      607,  607,  607,  607,  607,  607,  607,  607,  607,  607,
+      607,  607,  607,  607,  607,  607,  607,  607,  607,  607,
+      607,  607,  607,  607,  608,  607,  607,  607,  607,  607,
+      607,  607,  607,  607,  607,  609,  609,  609,  609,  609,
+      609,  609,  609,  609,  618,  609,  609,  609,  609,  609,
+      609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+
+      609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+      609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+      609,  609,  609,  609,  609,  609,  610,  609,  609,  609,
+      609,  609,  609,  609,  609,  609,  609,  611,  611,  613,
+      613,  612,  612,  615,  615,  619,  620,  616,  616,  614,
+      621,  622,  623,  624,  626,  627,  628,  629,  630,  631,
+      632,  634,  635,  636,  637,  638,  625,  639,  640,  641,
+      642,  633,  643,  644,  645,  646,  370,  647,  648,  649,
+      375,  654,  394,  394,  655,  370,  652,  652,  652,  652,
+      662,  370,  650,  650,  650,  650,  650,  650,  650,  650,
+
+      650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+      650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+      650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+      650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+      650,  650,  650,  651,  650,  663,  650,  650,  650,  650,
+      650,  650,  650,  650,  396,  396,  653,  653,  401,  401,
+      656,  401,  401,  407,  407,  401,  664,  401,  401,  401,
+      401,  401,  401,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  401,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  401,  661,  661,  665,  401,  657,  657,  657,
+
+      657,  657,  666,  667,  657,  668,  657,  657,  657,  657,
+      657,  657,  657,  657,  658,  657,  657,  657,  657,  657,
+      657,  657,  657,  657,  657,  657,  657,  657,  657,  657,
+      657,  657,  659,  659,  669,  657,  660,  660,  670,  671,
+      672,  673,  674,  675,  676,  677,  678,  679,  680,  681,
+      682,  683,  686,  687,  688,  690,  691,  692,  693,  684,
+      694,  695,  696,  697,  698,  685,  699,  700,  701,  702,
+      704,  689,  705,  706,  707,  709,  710,  703,  711,  712,
+      713,  714,  715,  716,  708,  717,  718,  719,  721,  722,
+      723,  720,  724,  725,  726,  727,  729,  730,  731,  732,
+
+      733,  734,  735,  736,  737,  728,  738,  739,  740,  741,
+      751,  742,  754,  743,  744,  755,  745,  752,  766,  746,
+      767,  753,  747,  768,  769,  770,  748,  749,  756,  757,
+      750,  758,  771,  759,  760,  772,  761,  773,  774,  762,
+      775,  776,  779,  780,  777,  781,  763,  764,  778,  782,
+      765,  783,  785,  786,  787,  789,  791,  792,  794,  784,
+      795,  796,  797,  798,  793,  799,  790,  800,  801,  802,
+      803,  804,  805,  806,  807,  809,  810,  811,  788,  812,
+      813,  814,  815,  816,  817,  818,  808,  819,  820,  821,
+      822,  823,  824,  825,  826,  827,  828,  830,  832,  833,
+
+      835,  829,  831,  836,  837,  838,  839,  840,  841,  842,
+      843,  834,  844,  845,  846,  847,  848,  849,  850,  851,
+      852,  853,  854,  855,  856,  857,  858,  688,  859,  703,
+      860,  861,  719,  862,  863,  864,  753,  865,  777,  866,
+      783,  867,  789,  807,  868,  869,  870,  871,  829,  872,
+      873,  612,  612,  874,  874,  875,  875,  616,  616,  876,
+      876,  877,  877,  878,  879,  880,  881,  882,  883,  884,
+      885,  886,  887,  888,  889,  890,  891,  892,  893,  894,
+      895,  896,  897,  898,  899,  900,  901,  902,  903,  904,
+      905,  906,  907,  908,  909,  910,  910,  911,  657,  660,
+
+      660,  912,  912,  913,  914,  915,  916,  917,  918,  919,
+      920,  921,  922,  923,  924,  925,  926,  927,  929,  930,
+      931,  932,  933,  935,  936,  937,  938,  940,  939,  941,
+      942,  934,  943,  944,  945,  946,  928,  947,  948,  949,
+      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
+      960,  961,  962,  963,  964,  965,  966,  967,  968,  969,
+      970,  971,  972,  973,  974,  975,  976,  977,  979,  980,
+      981,  982,  983,  984,  978,  985,  986,  988,  989,  990,
+      991,  992,  993,  987,  994,  995,  996,  997, 1000, 1001,
+     1002, 1003, 1004,  998, 1005, 1006, 1007, 1008, 1009, 1010,
+
+     1011, 1012, 1013, 1014, 1017,  999, 1018, 1019, 1020, 1015,
+     1021, 1022, 1023, 1024, 1026, 1027, 1028, 1025, 1029, 1030,
+     1031, 1016, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+     1040, 1042, 1043, 1045, 1046, 1041, 1047, 1044, 1048, 1049,
+     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+     1070, 1071, 1072, 1074, 1076, 1077, 1073, 1078, 1079, 1080,
+     1081, 1082, 1083, 1075, 1084, 1085, 1086, 1087, 1088, 1089,
+     1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+     1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+
+     1110, 1111,  977, 1112, 1024, 1113, 1114, 1115, 1116,  876,
+      876, 1117, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
+     1155, 1156, 1157, 1158, 1159, 1161, 1160, 1162, 1163, 1164,
+     1166, 1167, 1165, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
+     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1197, 1198, 1199,
+     1202, 1200, 1203, 1204, 1205, 1206, 1192, 1212, 1213, 1193,
+
+     1194, 1201, 1207, 1195, 1196, 1208, 1214, 1215, 1209, 1216,
+     1217, 1218, 1210, 1219, 1220, 1221, 1222, 1211, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
+     1265, 1266, 1267, 1268, 1269, 1271, 1272, 1273, 1274, 1275,
+     1277, 1278, 1279, 1270, 1280, 1281, 1276, 1282, 1283, 1284,
+     1285, 1288, 1286, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+     1296, 1297, 1298, 1299, 1300, 1302, 1303, 1304, 1287, 1306,
+
+     1301, 1307, 1308, 1309, 1310, 1311, 1312, 1305, 1313, 1314,
+     1315, 1316, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+     1178, 1191, 1201, 1209, 1326, 1327, 1328, 1329, 1317, 1330,
+     1331, 1332, 1211, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+     1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+     1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+     1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+     1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+
+     1400, 1401, 1402, 1403, 1405, 1406, 1407, 1408, 1409, 1410,
+     1411, 1404, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+     1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+     1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+     1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+     1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
+     1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+     1470, 1471, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
+     1481, 1482, 1483, 1484, 1485, 1486, 1487, 1472, 1488, 1489,
+     1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499,
+
+     1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509,
+     1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+     1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529,
+     1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
+     1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+     1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559,
+     1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569,
+     1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579,
+     1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+     1590, 1591, 1592, 1593, 1594, 1595, 1597, 1596, 1598, 1600,
+
+     1601, 1602, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,
+     1614, 1603, 1615, 1604, 1616, 1617, 1618, 1605, 1599, 1619,
+     1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629,
+     1630, 1631, 1632, 1633, 1635, 1634, 1636, 1637, 1638, 1639,
+     1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649,
+     1650, 1651, 1652, 1653, 1654, 1655,  147, 1656, 1657, 1658,
+     1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668,
+     1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678,
+     1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+     1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698,
+
+     1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708,
+     1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+     1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,
+     1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738,
+     1739, 1740, 1741, 1743, 1744, 1746, 1747, 1748, 1749, 1750,
+     1742, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+     1745, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+     1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+     1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788,
+     1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798,
+
+     1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808,
+     1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818,
+     1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828,
+     1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838,
+     1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+     1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858,
+     1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868,
+     1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+     1879, 1880, 1881, 1882, 1883, 1884, 1886, 1887, 1888, 1889,
+     1885, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898,
+
+     1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+     1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+     1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928,
+     1929, 1930, 1931, 1932, 1933, 1934, 1935, 1937, 1938, 1885,
+     1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948,
+     1949, 1950, 1951, 1936, 1952, 1953, 1954, 1955, 1956, 1957,
+     1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+     1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+     1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987,
+     1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997,
+
+     1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,
+     2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
+     2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027,
+     2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+     2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+     2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057,
+     2058, 2059, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060
     } ;
 
-static yyconst flex_int16_t yy_chk[4960] =
+static yyconst flex_int16_t yy_chk[3626] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1689,545 +1541,399 @@ static yyconst flex_int16_t yy_chk[4960] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    3,    3,
-        9,   35,    9,    9,   10,    9,   10,   10,    9,   10,
-
-       13,    3,   10,   11,   14,   12,   11, 2004,   12,    3,
-       13,    3,    3,    3,   14, 1986,   17,    3,   17,   17,
-        3,    3,   35,   42,    3,    3,    3,    3,    3,    3,
-       22,    3,   22,   22,   56,    3,   23,   23,    3, 1333,
-        3,   36,    3,    3,    3,   36,   23,   11,    3,   12,
-       57,    3,    3,   58,   42,    3,    3,    3,    3,    3,
-        3,   26,    3,   26, 1233,   56,   25,    3,   25,   25,
-       26,  655,   36,    3,    4,    4,   36,   23,   25,  392,
-       71,   57,   71,   71,   58,   29,  124,    4,   29,   29,
-      124,   59,   26,  392,   26,    4,   33,    4,    4,    4,
-
-       33,   26,   29,    4,   33,   29,    4,    4,   60,   25,
-        4,    4,    4,    4,    4,    4,   29,    4,   62,   29,
-       29,    4,   59,   63,    4,   64,    4,   33,    4,    4,
-        4,   33,  600,   29,    4,   33,   29,    4,    4,   60,
-      598,    4,    4,    4,    4,    4,    4,  570,    4,   62,
-      371,  490,  371,    4,   63,   94,   64,   94,   94,    4,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        1,    1,    1,    3,    3,    3,    3,   16,    3,    3,
+       50,    3,    3,   53,   57,   58,    3,    3,    3,    3,
+        3,   17,   59,   17,   17,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,   40,   60,    3,   43,    3,    3,   61,    5,
+        5,   43,    3,    3,    5,   23,   40,   23,   23,   35,
+       35,   35,   62,    5,   63,   64,   62,   35,   35,   65,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        5,    5,    5,   37,   66,   48,    5,   37,   68,   48,
+       69,   37,    5,   48,   70,   75,   76,    5,    5,    7,
+        7,   82,    7,    7,    7,    7,    7,    7,    7,    7,
         7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
 
         7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
         7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
         7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,   24,   24,   24,   24,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   20,   20,   84,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   22,
+       22,   87,   22,   22,   22,   22,   22,   22,   22,   22,
+
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   24,   24,   24,   24,   24,   83,   83,   24,   98,
        24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-      388,   39,   24,   27,  376,   24,   24,   27,   24,   34,
-       34,   27,   30,   30,   30,   39,   34,   43,   30,   65,
-       27,   43,   47,   27,   30,   43,   47,   67,   68,   61,
-       69,   43,   39,   61,   27,   24,   24,   24,   27,   24,
-       34,   34,   27,   30,   30,   30,   39,   34,   43,   30,
-
-       65,   27,   43,   47,   27,   30,   43,   47,   67,   68,
-       61,   69,   43,  640,   61,  640,   24,   24,   24,   24,
-       24,   24,   24,   24,   28,   74,   28,   31,   80,   28,
-       28,   31,   79,   28,   32,   31,   28,   85,   32,   28,
-       28,   31,   32,   82,   31,   70,   70,   82,  374,   79,
-       95,   32,   95,   95,  370,   28,   74,   28,   31,   80,
-       28,   28,   31,   79,   28,   32,   31,   28,   85,   32,
-       28,   28,   31,   32,   82,   31,  385,  385,   82,   70,
-       79,  365,   32,   37,   38,   37,   84,   37,   38,   66,
-       84,   37,   38,  110,   37,   66,   73,   37,   73,   76,
-
-       37,  113,   76,   76,   38,   73,   66,   88,   38,  325,
-      100,   88,  100,  100,   37,   38,   37,   84,   37,   38,
-       66,   84,   37,   38,  110,   37,   66,   73,   37,   73,
-       76,   37,  113,   76,   76,   38,   73,   66,   88,   38,
-       40,   40,   88,   41,   92,   45,   92,   41,   40,   45,
-       40,   41,   40,   45,   41,   40,   40,   41,  104,   45,
-       41,  641,   45,  641,  114,  118,  323,  104,  281,   45,
-      263,   40,   40,  262,   41,   92,   45,   92,   41,   40,
-       45,   40,   41,   40,   45,   41,   40,   40,   41,  261,
-       45,   41,   44,   45,   44,  114,  118,   44,   44,   78,
-
-       45,   46,   44,   78,   77,   77,   44,   78,  121,   44,
-       46,   44,   46,   78,   44,   77,   46,  259,   46,  122,
-       46,  101,  101,   44,  129,   44,  129,  129,   44,   44,
-       78,  101,   46,   44,   78,   77,   77,   44,   78,  121,
-       44,   46,   44,   46,   78,   44,   77,   46,  107,   46,
-      122,   46,   48,   48,   81,   81,   48,  133,   48,  106,
-       48,   81,  101,  106,  107,   48,  386,  386,  148,  102,
-      599,  102,  102,  139,  142,  139,  139,  387,  387,  107,
-      141,  102,  138,   48,   48,   81,   81,   48,  133,   48,
-      106,   48,   81,  131,  106,  107,   48,   72,   72,   72,
-
-       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
-       72,   75,  102,   75,   83,  599,   72,   72,   83,   72,
-       75,   86,   83,   75,   87,  109,   75,   91,   83,   86,
-      130,   86,   87,   91,  126,   91,   86,   86,   87,  109,
-      134,   87,   75,  125,   75,   83,   72,   72,   72,   83,
-       72,   75,   86,   83,   75,   87,  109,   75,   91,   83,
-       86,  112,   86,   87,   91,  116,   91,   86,   86,   87,
-      109,  134,   87,   89,   89,  116,  112,   72,   72,   72,
-       72,   72,   72,   72,   72,   89,  108,   90,  115,  108,
-       89,   90,  112,  111,  154,  117,  116,   90,  115,  117,
-
-       90,  111,  105,  115,   89,   89,  116,  112,  119,  156,
-      111,  120,  119,  103,  120,   99,   89,  108,   90,  115,
-      108,   89,   90,  158,  111,  154,  117,   98,   90,  115,
-      117,   90,  111,  135,  115,  123,  135,  143,  143,  119,
-      156,  111,  120,  119,  123,  120,  144,  143,  144,  144,
-      123,  146,  146,  159,  158,  397,  397,  160,  144,  159,
-      123,  146,   97,  147,  147,   96,  123,  147,  147,  152,
-      152,  398,  398,  602,  602,  123,   52,  135,  143,  152,
-      157,  123,  153,  153,  159,  163,  153,  153,  160,  144,
-      159,  157,  146,  150,  150,  150,  150,  150,  150,  150,
-
-      150,  150,  150,  150,  150,  150,  150,  161,  164,  150,
-      152,  157,  150,  150,  155,  150,  163,  165,  155,  169,
-      166,  161,  157,  170,  173,  155,  167,  167,  167,  172,
-      174,  155,  175,  172,  177,  177,  178,  179,  161,  164,
-      166,  179,  150,  150,  150,  155,  150,   51,  165,  155,
-      169,  166,  161,   50,  170,  173,  155,  167,  167,  167,
-      172,  174,  155,  175,  172,  177,  177,  178,  179,  603,
-      603,  166,  179,  150,  150,  150,  150,  150,  150,  150,
-      150,  151,  151,  151,  151,  151,  151,  151,  151,  151,
-      151,  151,  151,  151,  151,  176,  180,  151,  181,   21,
-
-      151,  151,  181,  151,  182,  183,  184,  183,  183,  176,
-      185,  183,  186,  187,  188,  189,  190,  191,  192,  194,
-      195,  197,  188,  606,  606,   15,  176,  180,  188,  181,
-      151,  151,  151,  181,  151,  182,  183,  184,  183,  183,
-      176,  185,  183,  186,  187,  188,  189,  190,  191,  192,
-      194,  195,  197,  188,  193,  193,  198,  201,  203,  188,
-      193,  151,  151,  151,  151,  151,  151,  151,  151,  196,
-      208,  193,  198,  209,  198,  200,  196,  212,  206,  198,
-      200,  200,  607,  607,    0,  193,  193,  198,  201,  203,
-      205,  193,  205,  205,  206,  601,  213,  214,  205,  215,
-
-      196,  208,  193,  198,  209,  198,  200,  196,  212,  206,
-      198,  200,  200,  211,  207,  207,  207,  211,  210,  216,
-      217,  205,  207,  205,  205,  206,  210,  213,  214,  205,
-      215,  218,  219,  220,  219,  221,  222,  601,  225,  642,
-      642,    0,  228,  229,  211,  207,  207,  207,  211,  210,
-      216,  217,  230,  207,  224,  231,  232,  210,  223,  234,
-      224,  223,  218,  219,  220,  219,  221,  222,  223,  225,
-      226,  227,  227,  228,  229,  226,    0,  227,  235,  237,
-      236,  227,  227,  230,  227,  224,  231,  232,  238,  223,
-      234,  224,  223,  239,  233,  233,  242,  648,  648,  223,
-
-      244,  226,  227,  227,  236,  240,  226,  233,  227,  235,
-      237,  236,  227,  227,  247,  227,  240,  249,  250,  238,
-      241,  243,  241,  251,  239,  233,  233,  242,  241,  243,
-      252,  244,  253,  254,  255,  236,  240,  256,  233,  257,
-      258,  243,  264,  265,  266,  247,  267,  240,  249,  250,
-      268,  241,  243,  241,  251,  269,  270,  271,  272,  241,
-      243,  252,  273,  253,  254,  255,  274,  275,  256,  276,
-      257,  258,  243,  264,  265,  266,  277,  267,  269,  274,
-      278,  268,  279,  280,  282,  282,  269,  270,  271,  272,
-      285,  286,  284,  273,  287,  288,  287,  274,  275,  284,
-
-      276,  289,  290,  291,  292,  284,  293,  277,  292,  269,
-      274,  278,  295,  279,  280,  296,  298,  294,  282,  294,
-      294,  285,  286,  284,    0,  287,  288,  287,  299,  300,
-      284,  301,  289,  290,  291,  292,  284,  293,  297,  292,
-      302,  303,  304,  295,  297,  306,  296,  298,  294,  307,
-      294,  294,  308,  309,  310,  297,  311,  312,  313,  299,
-      300,  314,  301,  315,  310,  316,  317,  319,  320,  297,
-      318,  302,  303,  304,  321,  297,  306,  317,  318,    0,
-      307,  326,  326,  308,  309,  310,  297,  311,  312,  313,
-      336,  326,  314,    0,  315,  310,  316,  317,  319,  320,
-
-      327,  318,  327,  327,  337,  321,  328,  328,  317,  318,
-      329,  329,  327,  338,  329,  329,  328,  330,  330,  331,
-      331,  336,  326,  331,  331,  339,  341,  330,  340,  340,
-      343,  344,  342,  345,  346,  337,  347,  348,  350,  351,
-      352,  353,  355,  327,  338,  342,  357,  328,  358,  350,
-      359,  360,  361,  362,  361,  363,  339,  341,  330,  340,
-      340,  343,  344,  342,  345,  346,  364,  347,  348,  350,
-      351,  352,  353,  355,  366,  367,  342,  357,  368,  358,
-      350,  359,  360,  361,  362,  361,  363,  389,  383,  383,
-      384,  384,  391,  399,  384,  384,  400,  364,  383,  368,
-
-      649,  649,  366,  367,    0,  366,  367,  395,  395,  368,
-      396,  396,    0,  401,  396,  396,  402,  395,  389,    0,
-      403,    0,  404,  391,  399,  405,  406,  400,  407,  383,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  401,  408,  390,  402,  395,  390,
-      390,  403,  390,  404,  409,  410,  405,  406,  411,  407,
-      412,  413,  414,  415,  416,  417,  418,  419,  422,  423,
-      425,  426,  427,  428,  429,  430,  408,  432,  433,  390,
-      390,  390,    0,  390,    0,  409,  410,  861,  861,  411,
-        0,  412,  413,  414,  415,  416,  417,  418,  419,  422,
-
-      423,  425,  426,  427,  428,  429,  430,    0,  432,  433,
-      390,  390,  390,  390,  390,  390,  390,  390,  393,  393,
-      393,  393,  393,  393,  393,  393,  393,  393,  393,  393,
-      393,  393,  424,  420,  393,  434,    0,  393,  393,  435,
-      393,  420,  436,  437,  438,  439,  440,  420,  441,  424,
-      442,  443,  438,  445,  446,  447,  448,  449,  450,  451,
-      442,  452,  453,  424,  420,  455,  434,  393,  393,  393,
-      435,  393,  420,  436,  437,  438,  439,  440,  420,  441,
-      424,  442,  443,  438,  445,  446,  447,  448,  449,  450,
-      451,  442,  452,  453,  862,  862,  455,    0,  393,  393,
-
-      393,  393,  393,  393,  393,  393,  394,  394,  456,  394,
-      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
-      457,  458,  459,  454,    0,  394,  394,  454,  394,  460,
-      461,  462,  463,  464,  465,  466,  467,  394,  468,  456,
-      461,  469,  470,  473,  474,  476,  477,  478,  479,  481,
-      477,  457,  458,  459,  454,  394,  394,  394,  454,  394,
-      460,  461,  462,  463,  464,  465,  466,  467,  394,  468,
-      482,  461,  469,  470,  473,  474,  476,  477,  478,  479,
-      481,  477,    0,  483,  484,    0,  394,  394,  394,  394,
-      394,  394,  394,  394,  475,  475,  485,  475,  486,  475,
-
-      475,  482,  475,  487,  488,  475,  491,  492,  475,  494,
-        0,  495,  475,  475,  483,  484,  475,  892,  892,  496,
-        0,  497, 1125, 1125,  498,  475,  475,  485,  475,  486,
-      475,  475,  498,  475,  487,  488,  475,  491,  492,  475,
-      494,  493,  495,  475,  475,  493,  499,  475,  480,  480,
-      496,  480,  497,  480,  480,  498,  480,  500,  502,  480,
-      503,  504,  501,  498,  505,  506,  480,  480,  504,  502,
-      480,  507,  493,  508,  509,  510,  493,  499,  511,  480,
-      480,  512,  480,  513,  480,  480,  501,  480,  500,  502,
-      480,  503,  504,  501,  514,  505,  506,  480,  480,  504,
-
-      502,  480,  507,  515,  508,  509,  510,  516,  517,  511,
-      518,  519,  512,  520,  513,  521,  522,  501,  523,  524,
-      525,  527,  518,  528,  529,  514,  530,  531,  532,  533,
-      534,  535,  536,  537,  515,  538,  541,    0,  516,  517,
-      539,  518,  519,  540,  520,  539,  521,  522,  540,  523,
-      524,  525,  527,  518,  528,  529,  542,  530,  531,  532,
-      533,  534,  535,  536,  537,  543,  538,  541,  542,  546,
-      549,  539,  551,  552,  540,  553,  539,  554,  555,  540,
-      556,  557,  558,  560,  561,  562,  563,  542,  564,  565,
-      566,  567,  568,  572,  573,  574,  543,  575,  576,  542,
-
-      546,  549,  577,  551,  552,  578,  553,  579,  554,  555,
-      580,  556,  557,  558,  560,  561,  562,  563,  581,  564,
-      565,  566,  567,  568,  572,  573,  574,  582,  575,  576,
-      583,  584,  585,  577,  586,  587,  578,  588,  579,  589,
-      583,  580,  590,  591,  592,  593,  594,  595,  596,  581,
-      597,  608,  605,  605,  604,  604,  605,  605,  582,  609,
-      610,  583,  584,  585,  604,  586,  587,  611,  588,  612,
-      589,  583,  613,  590,  591,  592,  593,  594,  595,  596,
-      614,  597,  608,  615,  616,  617,  618,  619,  620,  621,
-      609,  610,  622,  623,  624,  604,  625,  626,  611,  628,
-
-      612,  629,  630,  613,  631,  632,  633,  634,  635,  636,
-      645,  614,  637,  638,  615,  616,  617,  618,  619,  620,
-      621,  637,  639,  622,  623,  624,  638,  625,  626,    0,
-      628,    0,  629,  630,    0,  631,  632,  633,  634,  635,
-      636,  645,    0,  637,  638,    0,  650,  651,  652,  653,
-      639,  654,  656,  639,  646,  646,  657,  646,  646,  646,
-      646,  646,  646,  646,  646,  646,  646,  646,  658,  659,
-      660,  661,    0,  646,  646,  662,  646,  650,  651,  652,
-      653,  664,  654,  656,  666,  667,  668,  657,  669,  670,
-      671,  672,  665,  673,  674,  675,  674,  676,  670,  658,
-
-      659,  660,  661,  646,  646,  646,  662,  646,    0,    0,
-        0,  665,  664,  677,  678,  666,  667,  668,  680,  669,
-      670,  671,  672,  665,  673,  674,  675,  674,  676,  670,
-      681,  682,  683,  684,  646,  646,  646,  646,  646,  646,
-      646,  646,  665,  685,  677,  678,  686,  687,  688,  680,
-      690,  691,  692,  693,  694,  695,  696,  698,  699,  700,
-      701,  681,  682,  683,  684,  702,  703,  704,  705,  706,
-      707,  708,  709,  710,  685,  711,  712,  686,  687,  688,
-      714,  690,  691,  692,  693,  694,  695,  696,  698,  699,
-      700,  701,  715,  717,  718,  719,  702,  703,  704,  705,
-
-      706,  707,  708,  709,  710,  716,  711,  712,  720,  721,
-      722,  714,  716,  724,  725,  726,  728,  729,  730,  731,
-      732,  725,  733,  715,  717,  718,  719,  734,  735,    0,
-      737,  738,  739,  740,  741,  742,  716,  743,  744,  720,
-      721,  722,  745,  716,  724,  725,  726,  728,  729,  730,
-      731,  732,  725,  733,  736,  746,  747,  748,  734,  735,
-      736,  737,  738,  739,  740,  741,  742,  749,  743,  744,
-      750,  751,  736,  745,  752,  753,  754,  751,  755,  756,
-      758,  760,  762,  763,  764,  736,  746,  747,  748,  751,
-      761,  736,  765,  766,  761,  767,  768,  769,  749,  770,
-
-      771,  750,  751,  736,  772,  752,  753,  754,  751,  755,
-      756,  758,  760,  762,  763,  764,  773,  774,  775,  776,
-      751,  761,  777,  765,  766,  761,  767,  768,  769,  778,
-      770,  771,  779,  780,  778,  772,  781,  782,  783,  784,
-      785,  786,  787,  788,  789,  790,  791,  773,  774,  775,
-      776,  792,  793,  777,  794,  795,  796,  797,  798,  799,
-      778,  800,  801,  779,  780,  778,  802,  781,  782,  783,
-      784,  785,  786,  787,  788,  789,  790,  791,  803,  804,
-      805,  810,  792,  793,  808,  794,  795,  796,  797,  798,
-      799,  806,  800,  801,  808,  806,  811,  802,  812,  813,
-
-      814,  816,  817,  818,  819,  820,  821,  822,  823,  803,
-      804,  805,  810,  824,  826,  808,  827,  828,  829,  830,
-      831,  832,  806,  833,  834,  808,  806,  811,  835,  812,
-      813,  814,  816,  817,  818,  819,  820,  821,  822,  823,
-      836,  837,  838,  840,  824,  826,  841,  827,  828,  829,
-      830,  831,  832,  842,  833,  834,  843,  844,  845,  835,
-      847,  849,  850,  851,  852,  853,  854,  855,  857,  858,
-      864,  836,  837,  838,  840,  865,  866,  841,  867,  868,
-      869,  870,  871,  872,  842,  873,  874,  843,  844,  845,
-      875,  847,  849,  850,  851,  852,  853,  854,  855,  857,
-
-      858,  864,  876,  877,  878,  879,  865,  866,  880,  867,
-      868,  869,  870,  871,  872,  881,  873,  874,  882,  883,
-      884,  875,  885,  886,  887,  889,  890,    0,  893,  897,
-      891,  899,  900,  876,  877,  878,  879,  902,  903,  880,
-      905,  893,  906,  907,  908,  909,  881,  910,  912,  882,
-      883,  884,  914,  885,  886,  887,  889,  890,  891,  893,
-      897,  891,  899,  900,  913,  915,  913,  916,  902,  903,
-      918,  905,  919,  906,  907,  908,  909,  917,  910,  912,
-      917,  920,  921,  914,  922,  924,  925,  926,  927,  930,
-      932,  933,  933,  935,  936,  913,  915,  913,  916,  937,
-
-      938,  918,  939,  919,  940,  942,  943,  945,  917,  946,
-      949,  917,  920,  921,  950,  922,  924,  925,  926,  927,
-      930,  932,  933,  933,  935,  936,  952,  953,  955,  951,
-      937,  938,  958,  939,  956,  940,  942,  943,  945,  951,
-      946,  949,  951,  951,  956,  950,  951,  951,  959,  960,
-      961,  962,  965,  967,  968,  969,  970,  952,  953,  955,
-      951,  963,  971,  958,  963,  956,  972,  963,  973,  974,
-      951,  963,  975,  951,  951,  956,  963,  951,  951,  959,
-      960,  961,  962,  965,  967,  968,  969,  970,  976,  977,
-      978,  979,  963,  971,  980,  963,  981,  972,  963,  973,
-
-      974,  982,  963,  975,  983,  984,  985,  963,  986,  987,
-      989,  990,  991,  992,  993,  994,  995,  996,  997,  976,
-      977,  978,  979,  998,  999,  980, 1000,  981, 1001, 1003,
-     1005, 1006,  982, 1007, 1008,  983,  984,  985, 1009,  986,
-      987,  989,  990,  991,  992,  993,  994,  995,  996,  997,
-     1010, 1011, 1012, 1013,  998,  999, 1014, 1000, 1015, 1001,
-     1003, 1005, 1006, 1016, 1007, 1008, 1017, 1018, 1019, 1009,
-     1020, 1021, 1022, 1023, 1024, 1026, 1025, 1027, 1028, 1029,
-     1031, 1010, 1011, 1012, 1013, 1025, 1030, 1014, 1032, 1015,
-     1033, 1034, 1035, 1030, 1016, 1036, 1037, 1017, 1018, 1019,
-
-     1038, 1020, 1021, 1022, 1023, 1024, 1026, 1025, 1027, 1028,
-     1029, 1031, 1041, 1042, 1041, 1043, 1025, 1030, 1044, 1032,
-     1045, 1033, 1034, 1035, 1030, 1046, 1036, 1037, 1047, 1049,
-     1041, 1038, 1050, 1051, 1052, 1054, 1055, 1057, 1059, 1061,
-     1060, 1056, 1062, 1041, 1042, 1041, 1043, 1056, 1065, 1044,
-     1060, 1045, 1066, 1067, 1068, 1069, 1046, 1070, 1074, 1047,
-     1049, 1041, 1075, 1050, 1051, 1052, 1054, 1055, 1057, 1059,
-     1061, 1060, 1056, 1062, 1076, 1079, 1080, 1081, 1056, 1065,
-     1082, 1060, 1083, 1066, 1067, 1068, 1069, 1084, 1070, 1074,
-     1086, 1076, 1088, 1075, 1088, 1090, 1091, 1092, 1093, 1095,
-
-     1094, 1096, 1097, 1098, 1099, 1076, 1079, 1080, 1081, 1094,
-     1100, 1082, 1101, 1083, 1102, 1103, 1104, 1105, 1084, 1106,
-     1107, 1086, 1076, 1088, 1109, 1088, 1090, 1091, 1092, 1093,
-     1095, 1094, 1096, 1097, 1098, 1099, 1110, 1111, 1112, 1113,
-     1094, 1100, 1114, 1101, 1115, 1102, 1103, 1104, 1105, 1117,
-     1106, 1107, 1119, 1120, 1121, 1109, 1122, 1124, 1127, 1128,
-     1126, 1129, 1130, 1131, 1132, 1133, 1135, 1110, 1111, 1112,
-     1113, 1138, 1140, 1114, 1141, 1115, 1142, 1143, 1144, 1146,
-     1117, 1148, 1127, 1119, 1120, 1121, 1126, 1122, 1124, 1127,
-     1128, 1126, 1129, 1130, 1131, 1132, 1133, 1135, 1149, 1150,
-
-     1151, 1152, 1138, 1140, 1153, 1141, 1155, 1142, 1143, 1144,
-     1146, 1156, 1148, 1157, 1158, 1160, 1162, 1164, 1166, 1167,
-     1168, 1169, 1172, 1173, 1174, 1175, 1176, 1177, 1179, 1149,
-     1150, 1151, 1152, 1180, 1181, 1153, 1182, 1155, 1183, 1184,
-     1185, 1186, 1156, 1187, 1157, 1158, 1160, 1162, 1164, 1166,
-     1167, 1168, 1169, 1172, 1173, 1174, 1175, 1176, 1177, 1179,
-     1188, 1189, 1190, 1192, 1180, 1181, 1195, 1182, 1191, 1183,
-     1184, 1185, 1186, 1196, 1187, 1197, 1191, 1198, 1199, 1200,
-     1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
-     1211, 1188, 1189, 1190, 1192, 1213, 1215, 1195, 1216, 1191,
-
-     1217, 1218, 1219, 1220, 1196, 1221, 1197, 1191, 1198, 1199,
-     1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
-     1210, 1211, 1222, 1223, 1224, 1225, 1213, 1215, 1226, 1216,
-     1227, 1217, 1218, 1219, 1220, 1228, 1221, 1229, 1232, 1234,
-     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1246, 1247, 1248,
-     1249, 1250, 1251, 1222, 1223, 1224, 1225, 1252, 1253, 1226,
-     1254, 1227, 1255, 1256, 1257, 1259, 1228, 1261, 1229, 1232,
-     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1246, 1247,
-     1248, 1249, 1250, 1251, 1262, 1263, 1264, 1265, 1252, 1253,
-     1266, 1254, 1267, 1255, 1256, 1257, 1259, 1268, 1261, 1270,
-
-     1273, 1276, 1277, 1269, 1278, 1279, 1280, 1281, 1282, 1283,
-     1284, 1285, 1286, 1287, 1288, 1262, 1263, 1264, 1265, 1269,
-     1289, 1266, 1290, 1267, 1291, 1294, 1296, 1297, 1268, 1299,
-     1270, 1273, 1276, 1277, 1269, 1278, 1279, 1280, 1281, 1282,
-     1283, 1284, 1285, 1286, 1287, 1288, 1300, 1301, 1302, 1303,
-     1269, 1289, 1304, 1290, 1305, 1291, 1294, 1296, 1297, 1306,
-     1299, 1308, 1311, 1312, 1313, 1314, 1315, 1316, 1318, 1319,
-     1320, 1321, 1322, 1323, 1325, 1326, 1327, 1300, 1301, 1302,
-     1303, 1328, 1329, 1304, 1331, 1305, 1334, 1332, 1335, 1336,
-     1306, 1337, 1308, 1311, 1312, 1313, 1314, 1315, 1316, 1318,
-
-     1319, 1320, 1321, 1322, 1323, 1325, 1326, 1327, 1338, 1339,
-     1331, 1332, 1328, 1329, 1340, 1331, 1341, 1334, 1332, 1335,
-     1336, 1342, 1337, 1343, 1345, 1346, 1347, 1348, 1350, 1351,
-     1353, 1355, 1356, 1357, 1359, 1361, 1362, 1363, 1364, 1338,
-     1339, 1365, 1366, 1367, 1368, 1340, 1369, 1341, 1370, 1372,
-     1373, 1374, 1342, 1375, 1343, 1345, 1346, 1347, 1348, 1350,
-     1351, 1353, 1355, 1356, 1357, 1359, 1361, 1362, 1363, 1364,
-     1376, 1378, 1365, 1366, 1367, 1368, 1379, 1369, 1380, 1370,
-     1372, 1373, 1374, 1381, 1375, 1382, 1383, 1384, 1385, 1386,
-     1388, 1389, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398,
-
-     1400, 1376, 1378, 1401, 1402, 1403, 1404, 1379, 1406, 1380,
-     1407, 1408, 1409, 1410, 1381, 1411, 1382, 1383, 1384, 1385,
-     1386, 1388, 1389, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
-     1398, 1400, 1412, 1414, 1401, 1402, 1403, 1404, 1415, 1406,
-     1416, 1407, 1408, 1409, 1410, 1417, 1411, 1418, 1420, 1422,
-     1420, 1424, 1423, 1426, 1428, 1429, 1431, 1425, 1425, 1433,
-     1434, 1435, 1436, 1412, 1414, 1437, 1438, 1439, 1425, 1415,
-     1425, 1416, 1423, 1440, 1425, 1441, 1417, 1442, 1418, 1420,
-     1422, 1420, 1424, 1423, 1426, 1428, 1429, 1431, 1425, 1425,
-     1433, 1434, 1435, 1436, 1443, 1444, 1437, 1438, 1439, 1425,
-
-     1445, 1425, 1446, 1423, 1440, 1425, 1441, 1447, 1442, 1448,
-     1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1455, 1457,
-     1458, 1459, 1461, 1462, 1463, 1443, 1444, 1464, 1465, 1468,
-     1469, 1445, 1470, 1446, 1471, 1472, 1473, 1474, 1447, 1475,
-     1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1455,
-     1457, 1458, 1459, 1461, 1462, 1463, 1476, 1477, 1464, 1465,
-     1468, 1469, 1478, 1470, 1479, 1471, 1472, 1473, 1474, 1481,
-     1475, 1483, 1480, 1480, 1485, 1486, 1488, 1489, 1490, 1492,
-     1493, 1494, 1495, 1496, 1497, 1480,    0, 1476, 1477, 1480,
-     1502, 1503, 1504, 1478, 1499, 1479, 1505, 1506, 1508, 1509,
-
-     1481, 1510, 1483, 1480, 1480, 1485, 1486, 1488, 1489, 1490,
-     1492, 1493, 1494, 1495, 1496, 1497, 1480, 1500, 1499, 1511,
-     1480, 1502, 1503, 1504, 1512, 1499, 1513, 1505, 1506, 1508,
-     1509, 1514, 1510, 1515, 1500, 1516, 1517, 1518, 1520, 1521,
-     1522, 1523, 1524, 1525, 1527, 1528, 1529, 1530, 1500, 1531,
-     1511, 1533, 1534, 1535, 1536, 1512, 1538, 1513, 1539, 1540,
-     1541, 1542, 1514, 1543, 1515, 1544, 1516, 1517, 1518, 1520,
-     1521, 1522, 1523, 1524, 1525, 1527, 1528, 1529, 1530, 1545,
-     1531, 1546, 1533, 1534, 1535, 1536, 1547, 1538, 1548, 1539,
-     1540, 1541, 1542, 1549, 1543, 1550, 1544, 1551, 1552, 1553,
-
-     1554, 1555, 1556, 1557, 1558, 1562, 1563, 1564, 1565, 1566,
-     1545, 1567, 1546, 1568, 1569, 1570, 1573, 1547, 1574, 1548,
-     1575, 1576, 1577, 1578, 1549, 1579, 1550, 1580, 1551, 1552,
-     1553, 1554, 1555, 1556, 1557, 1558, 1562, 1563, 1564, 1565,
-     1566, 1581, 1567, 1583, 1568, 1569, 1570, 1573, 1584, 1574,
-     1586, 1575, 1576, 1577, 1578, 1582, 1579, 1587, 1580, 1589,
-     1590, 1592, 1593, 1582, 1584, 1594, 1596, 1597, 1598, 1599,
-     1601, 1603, 1581, 1604, 1583, 1606, 1607, 1608, 1609, 1584,
-     1610, 1586, 1611, 1612, 1613, 1615, 1582, 1617, 1587, 1618,
-     1589, 1590, 1592, 1593, 1582, 1584, 1594, 1596, 1597, 1598,
-
-     1599, 1601, 1603, 1619, 1604, 1623, 1606, 1607, 1608, 1609,
-     1624, 1610, 1625, 1611, 1612, 1613, 1615, 1626, 1617, 1627,
-     1618, 1629, 1630, 1632, 1633, 1636, 1640, 1641, 1642, 1644,
-     1645,    0, 1647, 1649, 1619, 1650, 1623, 1652, 1654, 1656,
-     1658, 1624, 1659, 1625, 1661, 1648, 1662, 1664, 1626, 1647,
-     1627, 1665, 1629, 1630, 1632, 1633, 1636, 1640, 1641, 1642,
-     1644, 1645, 1648, 1647, 1649, 1667, 1650, 1668, 1652, 1654,
-     1656, 1658, 1669, 1659, 1671, 1661, 1648, 1662, 1664, 1674,
-     1676, 1679, 1665, 1680, 1681, 1682, 1683, 1685, 1686, 1687,
-     1688, 1689, 1690, 1691, 1692, 1693, 1667, 1694, 1668, 1695,
-
-     1697, 1698, 1699, 1669, 1700, 1671, 1701, 1702, 1703, 1704,
-     1674, 1676, 1679, 1705, 1680, 1681, 1682, 1683, 1685, 1686,
-     1687, 1688, 1689, 1690, 1691, 1692, 1693, 1707, 1694, 1708,
-     1695, 1697, 1698, 1699, 1709, 1700, 1710, 1701, 1702, 1703,
-     1704, 1711, 1712, 1713, 1705, 1714, 1715, 1716, 1717, 1718,
-     1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1707, 1727,
-     1708, 1728, 1729, 1730, 1733, 1709, 1734, 1710, 1735, 1736,
-     1737, 1738, 1711, 1712, 1713, 1739, 1714, 1715, 1716, 1717,
-     1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1743,
-     1727, 1745, 1728, 1729, 1730, 1733, 1747, 1734, 1749, 1735,
-
-     1736, 1737, 1738, 1750, 1751, 1752, 1739, 1754, 1756, 1757,
-     1758, 1759, 1760, 1761, 1762, 1763, 1765, 1767, 1766, 1769,
-     1743, 1770, 1745, 1775, 1776, 1774, 1779, 1747, 1766, 1749,
-     1774, 1780, 1782, 1765, 1750, 1751, 1752, 1784, 1754, 1756,
-     1757, 1758, 1759, 1760, 1761, 1762, 1763, 1765, 1767, 1766,
-     1769, 1788, 1770, 1789, 1775, 1776, 1774, 1779, 1790, 1791,
-     1792, 1774, 1780, 1782, 1793, 1796, 1797, 1798, 1784, 1799,
-     1800, 1801, 1802, 1803, 1805, 1806, 1807, 1808, 1809, 1810,
-     1811, 1812, 1788, 1813, 1789, 1815, 1816, 1817, 1818, 1790,
-     1791, 1792, 1819, 1820, 1821, 1793, 1796, 1797, 1798, 1822,
-
-     1799, 1800, 1801, 1802, 1803, 1805, 1806, 1807, 1808, 1809,
-     1810, 1811, 1812, 1823, 1813, 1824, 1815, 1816, 1817, 1818,
-     1825, 1826, 1827, 1819, 1820, 1821, 1829, 1832, 1834, 1838,
-     1822, 1840, 1841, 1842, 1845, 1849, 1850, 1843, 1856, 1859,
-     1860, 1857, 1861, 1862, 1823, 1864, 1824, 1865, 1856, 1866,
-     1867, 1825, 1826, 1827, 1843, 1868, 1870, 1829, 1832, 1834,
-     1838, 1857, 1840, 1841, 1842, 1845, 1849, 1850, 1843, 1856,
-     1859, 1860, 1857, 1861, 1862, 1871, 1864, 1872, 1865, 1873,
-     1866, 1867, 1874, 1879, 1880, 1843, 1868, 1870, 1881, 1884,
-     1887, 1888, 1890, 1892, 1893, 1894, 1895, 1896, 1897, 1898,
-
-     1899, 1900, 1902, 1905, 1907, 1909, 1871, 1910, 1872, 1911,
-     1873, 1912, 1914, 1874, 1879, 1880, 1918, 1916, 1920, 1881,
-     1884, 1887, 1888, 1890, 1892, 1893, 1894, 1895, 1896, 1897,
-     1898, 1899, 1900, 1902, 1905, 1907, 1909, 1916, 1910, 1921,
-     1911, 1917, 1912, 1914, 1917, 1922, 1924, 1918, 1916, 1920,
-     1926, 1927, 1928, 1929, 1931, 1932, 1933, 1935, 1936, 1938,
-     1939, 1943, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952,
-     1921, 1953, 1917, 1955, 1958, 1956, 1922, 1924, 1956, 1957,
-     1959, 1926, 1927, 1928, 1929, 1931, 1932, 1933, 1935, 1936,
-     1938, 1939, 1943, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
-
-     1952, 1960, 1953, 1957, 1955, 1958, 1956, 1964, 1965, 1967,
-     1957, 1959, 1968, 1970, 1974, 1975, 1976, 1977, 1979, 1980,
-     1981, 1982, 1983,    0, 1987, 1988, 1990, 1991, 1992, 1993,
-     1985, 1995, 1960, 1998, 2001, 2002, 2007, 2008, 1964, 1965,
-     1967, 2009, 2012, 1968, 1970, 1974, 1975, 1976, 1977, 1979,
-     1980, 1981, 1982, 1983, 1985, 1987, 1988, 1990, 1991, 1992,
-     1993, 1985, 1995, 2013, 1998, 2001, 2002, 2007, 2008, 2014,
-     2017, 2018, 2009, 2012, 2019, 2020, 2021, 2024, 2025, 2026,
-     2027, 2030, 2031, 2032, 2034, 2035,    0,    0,    0,    0,
-        0,    0,    0,    0, 2013,    0,    0,    0,    0,    0,
-
-     2014, 2017, 2018,    0,    0, 2019, 2020, 2021, 2024, 2025,
-     2026, 2027, 2030, 2031, 2032, 2034, 2035, 2038, 2038, 2038,
-     2038, 2038, 2038, 2038, 2038, 2038, 2038, 2039, 2039, 2039,
-     2039, 2039, 2039, 2039, 2039, 2039, 2039, 2040, 2040, 2040,
-     2040, 2040, 2040, 2040, 2040, 2040, 2040, 2041, 2041, 2041,
-     2041, 2041, 2041, 2041, 2041, 2041, 2041, 2042,    0, 2042,
-     2042, 2042, 2042, 2042, 2042, 2042, 2042, 2043,    0, 2043,
-     2043, 2043, 2043, 2043, 2043, 2043, 2043, 2044, 2044, 2045,
-     2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2045, 2046,
-     2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2046, 2047,
-
-        0, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2047, 2048,
-        0, 2048, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
-     2049, 2049, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
-     2050, 2050, 2051, 2051, 2051, 2051, 2051, 2051, 2051, 2051,
-     2051, 2051, 2052, 2052, 2052, 2052, 2052, 2052, 2052, 2052,
-     2052, 2052, 2053, 2053, 2053,    0,    0, 2053, 2053, 2053,
-        0, 2053, 2054,    0, 2054, 2054, 2054,    0, 2054, 2054,
-     2054, 2054, 2055, 2055, 2055, 2055, 2055, 2055, 2055, 2055,
-     2055, 2055, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2057, 2057, 2057, 2057, 2057, 2057, 2057, 2057,
-
-     2057, 2057, 2058,    0,    0,    0, 2058, 2058,    0, 2058,
-     2059, 2059, 2059,    0, 2059, 2059, 2059, 2059, 2059, 2059,
-     2060, 2060, 2060, 2060,    0, 2060, 2060, 2060, 2060, 2060,
-     2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061, 2061,
-     2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,
-     2063,    0, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063,
-     2064,    0, 2064, 2064, 2064, 2064, 2064, 2064, 2064, 2064,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
-     2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   94,   99,   94,   24,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   26,  100,   26,   26,   27,   27,  101,   36,
+       36,   74,   28,   28,   26,   74,   27,  105,   28,   36,
+       29,   29,   28,   27,  107,   27,   28,  106,   29,   36,
+       29,   81,   27,   29,   29,   28,  106,   29,   28,  112,
+       29,   67,   30,   29,   29,   30,   30,   67,   81,  115,
+
+       30,   31,   31,   31,  103,  103,  116,   31,   67,   30,
+       31,   32,   30,   31,  103,   32,   33,   86,   34,   32,
+       33,   86,   34,   90,   33,   32,   34,   90,   32,  120,
+       38,   32,   38,   33,   38,   34,   33,   93,   38,  111,
+      123,   38,   39,   93,   38,   93,   39,   38,   41,   41,
+       39,  108,  114,  111,   41,  108,   41,   42,   41,  124,
+       41,   42,   39,   41,   41,   42,   39,  114,   42,   44,
+       45,   42,   45,   44,   42,   45,   45,   44,  127,   80,
+       45,  109,   46,   44,   45,   80,   46,   45,   80,   45,
+       46,  128,   45,   47,   77,   77,   46,  109,   77,   46,
+
+      110,   77,   47,  110,   47,   77,   46,  135,   47,  136,
+       47,   47,   47,   49,   49,  118,  140,   49,  119,   49,
+       78,   49,  119,   78,   78,  118,   49,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   52,
+       52,  157,   52,   52,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   71,   71,   71,   71,  102,  159,  102,  102,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   79,   79,   71,  121,   85,
+       88,   92,  121,   85,   89,   92,   79,   85,   88,  113,
+
+       88,   92,   89,   85,   92,   88,   88,  113,   89,   91,
+       91,   89,  104,  117,  104,  104,  113,  122,  161,  162,
+      122,   91,  163,  117,  104,  162,   91,  166,  117,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  134,  134,  134,
+      134,  134,  134,  137,  134,  134,  137,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  137,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  138,
+      138,  167,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  168,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+
+      138,  145,  145,  149,  149,  156,  156,  149,  149,  156,
+      156,  145,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  152,  152,  152,  152,  152,  172,
+      173,  152,  176,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  177,
+      153,  153,  152,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  154,  154,  158,  160,  164,  169,  158,  170,
+      170,  170,  154,  175,  178,  158,  160,  175,  179,  181,
+      164,  158,  180,  180,  182,  183,  184,  169,  182,  185,
+
+      184,  186,  179,  186,  186,  187,  188,  186,  189,  190,
+      191,  192,  193,  194,  195,  196,  196,  197,  191,  198,
+      199,  196,  200,  201,  191,  203,  204,  199,  206,  209,
+      203,  203,  196,  211,  208,  212,  208,  208,  215,  201,
+      214,  201,  208,  213,  214,  209,  201,  210,  210,  210,
+      216,  213,  217,  218,  219,  210,  220,  221,  222,  223,
+      222,  224,  225,  226,  227,  228,  226,  229,  230,  230,
+      227,  231,  229,  226,  230,  232,  233,  234,  230,  230,
+      235,  230,  236,  236,  237,  238,  239,  240,  241,  242,
+      243,  244,  245,  244,  246,  236,  247,  250,  252,  244,
+
+      253,  243,  246,  254,  255,  256,  257,  258,  259,  260,
+      239,  261,  266,  267,  246,  268,  269,  270,  271,  272,
+      273,  274,  275,  276,  277,  278,  279,  280,  281,  282,
+      283,  287,  288,  284,  289,  291,  290,  277,  290,  292,
+      293,  294,  272,  284,  284,  284,  284,  284,  284,  295,
+      284,  296,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  285,  285,
+      284,  284,  297,  298,  299,  300,  297,  301,  302,  303,
+      304,  300,  305,  306,  307,  309,  310,  311,  312,  313,
+
+      314,  315,  300,  316,  317,  318,  319,  320,  321,  313,
+      323,  324,  285,  326,  326,  326,  326,  326,  326,  340,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  328,  328,  328,  328,  328,
+      328,  328,  328,  328,  341,  328,  328,  328,  328,  328,
+      328,  328,  328,  328,  328,  328,  328,  328,  328,  328,
+
+      328,  328,  328,  328,  328,  328,  328,  328,  328,  328,
+      328,  328,  328,  328,  328,  328,  328,  328,  328,  328,
+      328,  328,  328,  328,  328,  328,  328,  328,  328,  328,
+      328,  328,  328,  328,  328,  328,  328,  332,  332,  333,
+      333,  332,  332,  335,  335,  342,  343,  335,  335,  333,
+      344,  344,  345,  346,  347,  348,  349,  350,  351,  352,
+      354,  355,  356,  357,  360,  362,  346,  363,  364,  365,
+      366,  354,  366,  367,  368,  369,  370,  371,  372,  373,
+      375,  398,  393,  393,  400,  370,  393,  393,  394,  394,
+      408,  370,  376,  376,  376,  376,  376,  376,  376,  376,
+
+      376,  376,  376,  376,  376,  376,  376,  376,  376,  376,
+      376,  376,  376,  376,  376,  376,  376,  376,  376,  376,
+      376,  376,  376,  376,  376,  376,  376,  376,  376,  376,
+      376,  376,  376,  376,  376,  376,  376,  376,  376,  376,
+      376,  376,  376,  376,  376,  409,  376,  376,  376,  376,
+      376,  376,  376,  376,  395,  395,  396,  396,  401,  401,
+      401,  401,  401,  406,  406,  401,  410,  401,  401,  401,
+      401,  401,  401,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  401,  401,  401,  401,  401,  401,  401,  401,
+      401,  401,  401,  407,  407,  411,  401,  403,  403,  403,
+
+      403,  403,  412,  413,  403,  414,  403,  403,  403,  403,
+      403,  403,  403,  403,  403,  403,  403,  403,  403,  403,
+      403,  403,  403,  403,  403,  403,  403,  403,  403,  403,
+      403,  403,  405,  405,  415,  403,  405,  405,  416,  417,
+      418,  419,  420,  421,  422,  423,  424,  425,  426,  427,
+      428,  429,  431,  432,  433,  434,  435,  436,  437,  429,
+      438,  439,  441,  442,  443,  429,  444,  445,  446,  447,
+      448,  433,  449,  450,  451,  452,  454,  447,  455,  456,
+      457,  458,  459,  460,  451,  461,  462,  463,  464,  465,
+      466,  463,  467,  468,  469,  470,  471,  472,  473,  474,
+
+      475,  476,  477,  478,  479,  470,  482,  483,  484,  484,
+      485,  484,  487,  484,  484,  488,  484,  486,  490,  484,
+      491,  486,  484,  492,  493,  494,  484,  484,  489,  489,
+      484,  489,  495,  489,  489,  496,  489,  497,  499,  489,
+      500,  501,  503,  504,  502,  505,  489,  489,  502,  506,
+      489,  507,  508,  509,  510,  511,  512,  513,  514,  507,
+      515,  516,  517,  518,  513,  519,  511,  520,  521,  522,
+      523,  524,  525,  526,  527,  528,  529,  530,  510,  531,
+      532,  533,  534,  536,  537,  538,  527,  539,  540,  541,
+      542,  543,  544,  545,  546,  547,  548,  549,  550,  551,
+
+      552,  548,  549,  555,  558,  560,  561,  562,  563,  564,
+      565,  551,  566,  567,  569,  570,  571,  572,  573,  574,
+      575,  576,  577,  581,  582,  583,  584,  585,  586,  587,
+      588,  589,  590,  591,  592,  593,  594,  595,  596,  597,
+      598,  599,  600,  601,  602,  603,  604,  605,  606,  608,
+      610,  611,  611,  612,  612,  614,  614,  615,  615,  614,
+      614,  616,  616,  618,  619,  620,  621,  622,  623,  624,
+      625,  626,  627,  628,  629,  630,  631,  632,  633,  634,
+      635,  636,  638,  639,  640,  641,  642,  643,  644,  645,
+      646,  647,  648,  649,  651,  652,  652,  656,  657,  659,
+
+      659,  660,  660,  662,  663,  664,  665,  666,  667,  668,
+      669,  670,  671,  672,  673,  674,  676,  677,  678,  679,
+      680,  681,  682,  683,  684,  685,  686,  687,  686,  688,
+      689,  682,  690,  692,  693,  694,  677,  695,  696,  697,
+      698,  699,  700,  702,  703,  704,  705,  706,  707,  708,
+      710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+      720,  721,  722,  723,  724,  726,  727,  728,  729,  730,
+      731,  732,  733,  734,  728,  736,  737,  738,  740,  741,
+      742,  743,  744,  737,  745,  746,  747,  748,  749,  750,
+      751,  752,  753,  748,  754,  755,  756,  757,  758,  759,
+
+      760,  761,  762,  763,  764,  748,  765,  766,  767,  763,
+      768,  770,  772,  773,  774,  775,  776,  773,  777,  778,
+      779,  763,  780,  781,  782,  783,  784,  785,  786,  787,
+      788,  789,  790,  791,  792,  788,  793,  790,  794,  795,
+      796,  797,  798,  799,  800,  801,  802,  803,  804,  805,
+      806,  807,  808,  809,  810,  811,  812,  813,  814,  815,
+      816,  817,  818,  820,  822,  823,  818,  824,  825,  826,
+      828,  829,  830,  820,  831,  832,  833,  834,  835,  836,
+      838,  839,  840,  841,  842,  843,  844,  845,  846,  847,
+      848,  849,  850,  852,  853,  854,  855,  856,  857,  859,
+
+      861,  862,  863,  864,  865,  866,  867,  869,  870,  875,
+      875,  876,  876,  879,  880,  881,  882,  883,  884,  885,
+      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
+      896,  897,  898,  899,  900,  901,  902,  904,  905,  906,
+      907,  908,  914,  916,  917,  919,  920,  922,  923,  924,
+      925,  926,  927,  929,  930,  931,  930,  932,  933,  934,
+      935,  936,  934,  937,  938,  939,  941,  942,  943,  944,
+      947,  949,  950,  950,  952,  953,  954,  955,  956,  957,
+      959,  960,  962,  963,  966,  967,  968,  969,  970,  972,
+      975,  973,  976,  977,  978,  979,  968,  982,  984,  968,
+
+      968,  973,  980,  968,  968,  980,  985,  986,  980,  987,
+      988,  989,  980,  990,  991,  992,  993,  980,  994,  995,
+      996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1006,
+     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1018, 1020, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+     1049, 1050, 1051, 1043, 1052, 1053, 1048, 1054, 1055, 1056,
+     1059, 1060, 1059, 1061, 1062, 1063, 1064, 1065, 1067, 1068,
+     1069, 1070, 1072, 1073, 1074, 1075, 1077, 1078, 1059, 1079,
+
+     1074, 1080, 1083, 1084, 1085, 1086, 1087, 1078, 1088, 1092,
+     1093, 1094, 1097, 1098, 1099, 1100, 1101, 1102, 1104, 1108,
+     1109, 1110, 1111, 1112, 1113, 1115, 1116, 1118, 1094, 1119,
+     1120, 1121, 1112, 1122, 1123, 1124, 1125, 1126, 1128, 1129,
+     1130, 1131, 1132, 1133, 1134, 1136, 1138, 1139, 1140, 1141,
+     1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
+     1154, 1157, 1159, 1160, 1161, 1162, 1163, 1165, 1167, 1168,
+     1169, 1170, 1171, 1172, 1174, 1175, 1176, 1177, 1179, 1181,
+     1183, 1185, 1186, 1187, 1188, 1191, 1192, 1193, 1194, 1195,
+     1196, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
+
+     1207, 1208, 1209, 1210, 1211, 1214, 1215, 1216, 1217, 1218,
+     1219, 1210, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+     1228, 1229, 1230, 1232, 1234, 1235, 1236, 1237, 1238, 1239,
+     1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1251,
+     1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1265,
+     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
+     1276, 1277, 1279, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+     1288, 1289, 1290, 1293, 1296, 1297, 1298, 1299, 1300, 1301,
+     1302, 1303, 1304, 1305, 1306, 1307, 1308, 1289, 1309, 1310,
+     1311, 1314, 1316, 1317, 1319, 1320, 1321, 1322, 1323, 1324,
+
+     1325, 1326, 1328, 1331, 1332, 1333, 1334, 1335, 1336, 1338,
+     1339, 1340, 1341, 1342, 1343, 1345, 1346, 1347, 1348, 1349,
+     1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+     1361, 1362, 1363, 1365, 1366, 1367, 1368, 1370, 1371, 1373,
+     1375, 1376, 1377, 1379, 1381, 1382, 1383, 1384, 1385, 1386,
+     1387, 1388, 1389, 1390, 1392, 1393, 1394, 1395, 1396, 1398,
+     1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1408, 1409,
+     1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1420, 1421,
+     1422, 1423, 1424, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
+     1434, 1435, 1436, 1437, 1438, 1440, 1442, 1440, 1443, 1444,
+
+     1445, 1445, 1446, 1448, 1449, 1451, 1452, 1454, 1455, 1456,
+     1457, 1445, 1458, 1445, 1459, 1460, 1461, 1445, 1443, 1462,
+     1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+     1473, 1474, 1475, 1476, 1477, 1476, 1478, 1479, 1480, 1482,
+     1483, 1484, 1485, 1486, 1489, 1490, 1491, 1492, 1493, 1494,
+     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1504, 1506,
+     1507, 1509, 1510, 1511, 1513, 1514, 1515, 1516, 1517, 1518,
+     1520, 1521, 1523, 1524, 1525, 1526, 1527, 1529, 1530, 1531,
+     1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1541, 1542,
+     1543, 1544, 1545, 1546, 1548, 1549, 1550, 1551, 1552, 1554,
+
+     1555, 1556, 1557, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
+     1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+     1576, 1577, 1578, 1579, 1583, 1584, 1585, 1586, 1587, 1588,
+     1589, 1590, 1591, 1594, 1595, 1596, 1597, 1598, 1599, 1600,
+     1601, 1602, 1603, 1604, 1605, 1607, 1608, 1609, 1611, 1612,
+     1603, 1614, 1615, 1616, 1618, 1619, 1620, 1621, 1623, 1625,
+     1605, 1626, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
+     1637, 1639, 1640, 1641, 1645, 1646, 1647, 1648, 1649, 1651,
+     1652, 1654, 1655, 1658, 1662, 1663, 1664, 1666, 1667, 1669,
+     1670, 1671, 1672, 1674, 1676, 1678, 1680, 1681, 1683, 1684,
+
+     1686, 1687, 1689, 1690, 1691, 1693, 1696, 1698, 1701, 1702,
+     1703, 1704, 1705, 1707, 1708, 1709, 1710, 1711, 1712, 1713,
+     1714, 1715, 1716, 1717, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1727, 1729, 1730, 1731, 1732, 1733, 1734, 1735,
+     1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+     1746, 1747, 1749, 1750, 1751, 1752, 1753, 1756, 1757, 1758,
+     1759, 1760, 1761, 1762, 1766, 1768, 1770, 1772, 1773, 1774,
+     1775, 1777, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786,
+     1788, 1789, 1790, 1792, 1793, 1797, 1798, 1799, 1802, 1803,
+     1797, 1805, 1807, 1811, 1812, 1813, 1814, 1815, 1816, 1819,
+
+     1820, 1821, 1822, 1823, 1824, 1825, 1826, 1828, 1829, 1830,
+     1831, 1832, 1833, 1834, 1835, 1836, 1838, 1839, 1840, 1841,
+     1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1852,
+     1855, 1857, 1861, 1863, 1864, 1865, 1866, 1868, 1872, 1873,
+     1879, 1880, 1882, 1883, 1884, 1885, 1887, 1888, 1889, 1890,
+     1891, 1893, 1894, 1866, 1895, 1896, 1897, 1902, 1903, 1904,
+     1907, 1910, 1911, 1913, 1915, 1916, 1917, 1918, 1919, 1920,
+     1921, 1922, 1923, 1925, 1928, 1930, 1932, 1933, 1934, 1935,
+     1937, 1939, 1940, 1941, 1943, 1944, 1945, 1947, 1949, 1950,
+     1951, 1952, 1954, 1955, 1956, 1958, 1959, 1961, 1962, 1966,
+
+     1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1978,
+     1979, 1980, 1981, 1982, 1983, 1987, 1988, 1990, 1991, 1993,
+     1997, 1998, 1999, 2000, 2002, 2003, 2004, 2005, 2006, 2008,
+     2009, 2010, 2011, 2013, 2014, 2015, 2016, 2018, 2021, 2024,
+     2025, 2027, 2030, 2031, 2032, 2035, 2036, 2037, 2040, 2041,
+     2042, 2043, 2044, 2047, 2048, 2049, 2050, 2053, 2054, 2055,
+     2057, 2058, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060, 2060,
+     2060, 2060, 2060, 2060, 2060
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2330,7 +2036,7 @@ char path[MS_MAXPATHLEN];
 
 
 
-#line 2334 "maplexer.c"
+#line 2040 "maplexer.c"
 
 #define INITIAL 0
 #define URL_VARIABLE 1
@@ -2591,7 +2297,7 @@ YY_DECL
          break;
        }
 
-#line 2595 "maplexer.c"
+#line 2301 "maplexer.c"
 
 	if ( !(yy_init) )
 		{
@@ -2644,13 +2350,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2038 )
+				if ( yy_current_state >= 2061 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 2037 );
+		while ( yy_current_state != 2060 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -3629,671 +3335,676 @@ YY_RULE_SETUP
 case 192:
 YY_RULE_SETUP
 #line 370 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(ITEMS); }
+{ MS_LEXER_RETURN_TOKEN(POLYLABEL); }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 371 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(POSITION); }
+{ MS_LEXER_RETURN_TOKEN(ITEMS); }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 372 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(POSTLABELCACHE); }
+{ MS_LEXER_RETURN_TOKEN(POSITION); }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 373 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(PRIORITY); }
+{ MS_LEXER_RETURN_TOKEN(POSTLABELCACHE); }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 374 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(PROCESSING); }
+{ MS_LEXER_RETURN_TOKEN(PRIORITY); }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 375 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(PROJECTION); }
+{ MS_LEXER_RETURN_TOKEN(PROCESSING); }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 376 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(QUERYFORMAT); }
+{ MS_LEXER_RETURN_TOKEN(PROJECTION); }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 377 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(QUERYMAP); }
+{ MS_LEXER_RETURN_TOKEN(QUERYFORMAT); }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 378 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(REFERENCE); }
+{ MS_LEXER_RETURN_TOKEN(QUERYMAP); }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 379 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(REGION); }
+{ MS_LEXER_RETURN_TOKEN(REFERENCE); }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 380 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(RELATIVETO); }
+{ MS_LEXER_RETURN_TOKEN(REGION); }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 381 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(REQUIRES); }
+{ MS_LEXER_RETURN_TOKEN(RELATIVETO); }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 382 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(RESOLUTION); }
+{ MS_LEXER_RETURN_TOKEN(REQUIRES); }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 383 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(DEFRESOLUTION); }
+{ MS_LEXER_RETURN_TOKEN(RESOLUTION); }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 384 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SCALE); }
+{ MS_LEXER_RETURN_TOKEN(DEFRESOLUTION); }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 385 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SCALEDENOM); }
+{ MS_LEXER_RETURN_TOKEN(SCALE); }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 386 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SCALEBAR); }
+{ MS_LEXER_RETURN_TOKEN(SCALEDENOM); }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 387 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SCALETOKEN); }
+{ MS_LEXER_RETURN_TOKEN(SCALEBAR); }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 388 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SHADOWCOLOR); }
+{ MS_LEXER_RETURN_TOKEN(SCALETOKEN); }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 389 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SHADOWSIZE); }
+{ MS_LEXER_RETURN_TOKEN(SHADOWCOLOR); }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 390 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SHAPEPATH); }
+{ MS_LEXER_RETURN_TOKEN(SHADOWSIZE); }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 391 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SIZE); }
+{ MS_LEXER_RETURN_TOKEN(SHAPEPATH); }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 392 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SIZEUNITS); }
+{ MS_LEXER_RETURN_TOKEN(SIZE); }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 393 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(STATUS); }
+{ MS_LEXER_RETURN_TOKEN(SIZEUNITS); }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 394 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(STYLE); }
+{ MS_LEXER_RETURN_TOKEN(STATUS); }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 395 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(STYLEITEM); }
+{ MS_LEXER_RETURN_TOKEN(STYLE); }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 396 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SYMBOL); }
+{ MS_LEXER_RETURN_TOKEN(STYLEITEM); }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 397 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SYMBOLSCALE); }
+{ MS_LEXER_RETURN_TOKEN(SYMBOL); }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 398 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SYMBOLSCALEDENOM); }
+{ MS_LEXER_RETURN_TOKEN(SYMBOLSCALE); }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 399 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(SYMBOLSET); }
+{ MS_LEXER_RETURN_TOKEN(SYMBOLSCALEDENOM); }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 400 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TABLE); }
+{ MS_LEXER_RETURN_TOKEN(SYMBOLSET); }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 401 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TEMPLATE); }
+{ MS_LEXER_RETURN_TOKEN(TABLE); }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 402 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TEMPLATEPATTERN); }
+{ MS_LEXER_RETURN_TOKEN(TEMPLATE); }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 403 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TEXT); }
+{ MS_LEXER_RETURN_TOKEN(TEMPLATEPATTERN); }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
 #line 404 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TILEINDEX); }
+{ MS_LEXER_RETURN_TOKEN(TEXT); }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
 #line 405 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TILEITEM); }
+{ MS_LEXER_RETURN_TOKEN(TILEINDEX); }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 406 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TILESRS); }
+{ MS_LEXER_RETURN_TOKEN(TILEITEM); }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 407 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TITLE); }
+{ MS_LEXER_RETURN_TOKEN(TILESRS); }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 408 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TO); }
+{ MS_LEXER_RETURN_TOKEN(TITLE); }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 409 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TOLERANCE); }
+{ MS_LEXER_RETURN_TOKEN(TO); }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 410 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TOLERANCEUNITS); }
+{ MS_LEXER_RETURN_TOKEN(TOLERANCE); }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 411 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TRANSPARENCY); }
+{ MS_LEXER_RETURN_TOKEN(TOLERANCEUNITS); }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 412 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TRANSPARENT); }
+{ MS_LEXER_RETURN_TOKEN(TRANSPARENCY); }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 413 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TRANSFORM); }
+{ MS_LEXER_RETURN_TOKEN(TRANSPARENT); }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 414 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(TYPE); }
+{ MS_LEXER_RETURN_TOKEN(TRANSFORM); }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 415 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(UNITS); }
+{ MS_LEXER_RETURN_TOKEN(TYPE); }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 416 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(UTFDATA); }
+{ MS_LEXER_RETURN_TOKEN(UNITS); }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 417 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(UTFITEM); }
+{ MS_LEXER_RETURN_TOKEN(UTFDATA); }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 418 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(VALIDATION); }
+{ MS_LEXER_RETURN_TOKEN(UTFITEM); }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
 #line 419 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(VALUES); }
+{ MS_LEXER_RETURN_TOKEN(VALIDATION); }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
 #line 420 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(WEB); }
+{ MS_LEXER_RETURN_TOKEN(VALUES); }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
 #line 421 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(WIDTH); }
+{ MS_LEXER_RETURN_TOKEN(WEB); }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
 #line 422 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(WKT); }
+{ MS_LEXER_RETURN_TOKEN(WIDTH); }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 423 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(WRAP); }
+{ MS_LEXER_RETURN_TOKEN(WKT); }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
-#line 425 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_ANNOTATION); }
+#line 424 "maplexer.l"
+{ MS_LEXER_RETURN_TOKEN(WRAP); }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
 #line 426 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_AUTO); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_ANNOTATION); }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
 #line 427 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_AUTO2); }
+{ MS_LEXER_RETURN_TOKEN(MS_AUTO); }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
 #line 428 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_BEVEL); }
+{ MS_LEXER_RETURN_TOKEN(MS_AUTO2); }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
 #line 429 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_BITMAP); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_BEVEL); }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
 #line 430 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_BUTT); }
+{ MS_LEXER_RETURN_TOKEN(MS_BITMAP); }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
 #line 431 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CC); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_BUTT); }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
 #line 432 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_CENTER); }
+{ MS_LEXER_RETURN_TOKEN(MS_CC); }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
 #line 433 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_CHART); }
+{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_CENTER); }
 	YY_BREAK
 case 255:
 YY_RULE_SETUP
 #line 434 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_CIRCLE); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_CHART); }
 	YY_BREAK
 case 256:
 YY_RULE_SETUP
 #line 435 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CL); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_CIRCLE); }
 	YY_BREAK
 case 257:
 YY_RULE_SETUP
 #line 436 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CR); }
+{ MS_LEXER_RETURN_TOKEN(MS_CL); }
 	YY_BREAK
 case 258:
 YY_RULE_SETUP
 #line 437 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_DB_CSV); }
+{ MS_LEXER_RETURN_TOKEN(MS_CR); }
 	YY_BREAK
 case 259:
 YY_RULE_SETUP
 #line 438 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_DB_POSTGRES); }
+{ MS_LEXER_RETURN_TOKEN(MS_DB_CSV); }
 	YY_BREAK
 case 260:
 YY_RULE_SETUP
 #line 439 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_DB_MYSQL); }
+{ MS_LEXER_RETURN_TOKEN(MS_DB_POSTGRES); }
 	YY_BREAK
 case 261:
 YY_RULE_SETUP
 #line 440 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_DEFAULT); }
+{ MS_LEXER_RETURN_TOKEN(MS_DB_MYSQL); }
 	YY_BREAK
 case 262:
 YY_RULE_SETUP
 #line 441 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_DD); }
+{ MS_LEXER_RETURN_TOKEN(MS_DEFAULT); }
 	YY_BREAK
 case 263:
 YY_RULE_SETUP
 #line 442 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_ELLIPSE); }
+{ MS_LEXER_RETURN_TOKEN(MS_DD); }
 	YY_BREAK
 case 264:
 YY_RULE_SETUP
 #line 443 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_EMBED); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_ELLIPSE); }
 	YY_BREAK
 case 265:
 YY_RULE_SETUP
 #line 444 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_FALSE); }
+{ MS_LEXER_RETURN_TOKEN(MS_EMBED); }
 	YY_BREAK
 case 266:
 YY_RULE_SETUP
 #line 445 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_FEET); }
+{ MS_LEXER_RETURN_TOKEN(MS_FALSE); }
 	YY_BREAK
 case 267:
 YY_RULE_SETUP
 #line 446 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_FOLLOW); }
+{ MS_LEXER_RETURN_TOKEN(MS_FEET); }
 	YY_BREAK
 case 268:
 YY_RULE_SETUP
 #line 447 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_GIANT); }
+{ MS_LEXER_RETURN_TOKEN(MS_FOLLOW); }
 	YY_BREAK
 case 269:
 YY_RULE_SETUP
 #line 448 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_HATCH); }
+{ MS_LEXER_RETURN_TOKEN(MS_GIANT); }
 	YY_BREAK
 case 270:
 YY_RULE_SETUP
 #line 449 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_KERNELDENSITY); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_HATCH); }
 	YY_BREAK
 case 271:
 YY_RULE_SETUP
 #line 450 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_HILITE); }
+{ MS_LEXER_RETURN_TOKEN(MS_KERNELDENSITY); }
 	YY_BREAK
 case 272:
 YY_RULE_SETUP
 #line 451 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_INCHES); }
+{ MS_LEXER_RETURN_TOKEN(MS_HILITE); }
 	YY_BREAK
 case 273:
 YY_RULE_SETUP
 #line 452 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_KILOMETERS); }
+{ MS_LEXER_RETURN_TOKEN(MS_INCHES); }
 	YY_BREAK
 case 274:
 YY_RULE_SETUP
 #line 453 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LARGE); }
+{ MS_LEXER_RETURN_TOKEN(MS_KILOMETERS); }
 	YY_BREAK
 case 275:
 YY_RULE_SETUP
 #line 454 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LC); }
+{ MS_LEXER_RETURN_TOKEN(MS_LARGE); }
 	YY_BREAK
 case 276:
 YY_RULE_SETUP
 #line 455 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_LEFT); }
+{ MS_LEXER_RETURN_TOKEN(MS_LC); }
 	YY_BREAK
 case 277:
 YY_RULE_SETUP
 #line 456 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_LINE); }
+{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_LEFT); }
 	YY_BREAK
 case 278:
 YY_RULE_SETUP
 #line 457 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LL); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_LINE); }
 	YY_BREAK
 case 279:
 YY_RULE_SETUP
 #line 458 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LR); }
+{ MS_LEXER_RETURN_TOKEN(MS_LL); }
 	YY_BREAK
 case 280:
 YY_RULE_SETUP
 #line 459 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_MEDIUM); }
+{ MS_LEXER_RETURN_TOKEN(MS_LR); }
 	YY_BREAK
 case 281:
 YY_RULE_SETUP
 #line 460 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_METERS); }
+{ MS_LEXER_RETURN_TOKEN(MS_MEDIUM); }
 	YY_BREAK
 case 282:
 YY_RULE_SETUP
 #line 461 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_NAUTICALMILES); }
+{ MS_LEXER_RETURN_TOKEN(MS_METERS); }
 	YY_BREAK
 case 283:
 YY_RULE_SETUP
 #line 462 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_MILES); }
+{ MS_LEXER_RETURN_TOKEN(MS_NAUTICALMILES); }
 	YY_BREAK
 case 284:
 YY_RULE_SETUP
 #line 463 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_MITER); }
+{ MS_LEXER_RETURN_TOKEN(MS_MILES); }
 	YY_BREAK
 case 285:
 YY_RULE_SETUP
 #line 464 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_MULTIPLE); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_MITER); }
 	YY_BREAK
 case 286:
 YY_RULE_SETUP
 #line 465 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_NONE); }
+{ MS_LEXER_RETURN_TOKEN(MS_MULTIPLE); }
 	YY_BREAK
 case 287:
 YY_RULE_SETUP
 #line 466 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_NORMAL); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_NONE); }
 	YY_BREAK
 case 288:
 YY_RULE_SETUP
 #line 467 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_OFF); }
+{ MS_LEXER_RETURN_TOKEN(MS_NORMAL); }
 	YY_BREAK
 case 289:
 YY_RULE_SETUP
 #line 468 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_OGR); }
+{ MS_LEXER_RETURN_TOKEN(MS_OFF); }
 	YY_BREAK
 case 290:
 YY_RULE_SETUP
 #line 469 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_ON); }
+{ MS_LEXER_RETURN_TOKEN(MS_OGR); }
 	YY_BREAK
 case 291:
 YY_RULE_SETUP
 #line 470 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_JOIN_ONE_TO_ONE); }
+{ MS_LEXER_RETURN_TOKEN(MS_ON); }
 	YY_BREAK
 case 292:
 YY_RULE_SETUP
 #line 471 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_JOIN_ONE_TO_MANY); }
+{ MS_LEXER_RETURN_TOKEN(MS_JOIN_ONE_TO_ONE); }
 	YY_BREAK
 case 293:
 YY_RULE_SETUP
 #line 472 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_ORACLESPATIAL); }
+{ MS_LEXER_RETURN_TOKEN(MS_JOIN_ONE_TO_MANY); }
 	YY_BREAK
 case 294:
 YY_RULE_SETUP
 #line 473 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_PERCENTAGES); }
+{ MS_LEXER_RETURN_TOKEN(MS_ORACLESPATIAL); }
 	YY_BREAK
 case 295:
 YY_RULE_SETUP
 #line 474 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_PIXMAP); }
+{ MS_LEXER_RETURN_TOKEN(MS_PERCENTAGES); }
 	YY_BREAK
 case 296:
 YY_RULE_SETUP
 #line 475 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_PIXELS); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_PIXMAP); }
 	YY_BREAK
 case 297:
 YY_RULE_SETUP
 #line 476 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_POINT); }
+{ MS_LEXER_RETURN_TOKEN(MS_PIXELS); }
 	YY_BREAK
 case 298:
 YY_RULE_SETUP
 #line 477 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_POLYGON); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_POINT); }
 	YY_BREAK
 case 299:
 YY_RULE_SETUP
 #line 478 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_POSTGIS); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_POLYGON); }
 	YY_BREAK
 case 300:
 YY_RULE_SETUP
 #line 479 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_PLUGIN); }
+{ MS_LEXER_RETURN_TOKEN(MS_POSTGIS); }
 	YY_BREAK
 case 301:
 YY_RULE_SETUP
 #line 480 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_QUERY); }
+{ MS_LEXER_RETURN_TOKEN(MS_PLUGIN); }
 	YY_BREAK
 case 302:
 YY_RULE_SETUP
 #line 481 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_LAYER_RASTER); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_QUERY); }
 	YY_BREAK
 case 303:
 YY_RULE_SETUP
 #line 482 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_RIGHT); }
+{ MS_LEXER_RETURN_TOKEN(MS_LAYER_RASTER); }
 	YY_BREAK
 case 304:
 YY_RULE_SETUP
 #line 483 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_ROUND); }
+{ MS_LEXER_RETURN_TOKEN(MS_ALIGN_RIGHT); }
 	YY_BREAK
 case 305:
 YY_RULE_SETUP
 #line 484 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SELECTED); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_ROUND); }
 	YY_BREAK
 case 306:
 YY_RULE_SETUP
 #line 485 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_SIMPLE); }
+{ MS_LEXER_RETURN_TOKEN(MS_SELECTED); }
 	YY_BREAK
 case 307:
 YY_RULE_SETUP
 #line 486 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SINGLE); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_SIMPLE); }
 	YY_BREAK
 case 308:
 YY_RULE_SETUP
 #line 487 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SMALL); }
+{ MS_LEXER_RETURN_TOKEN(MS_SINGLE); }
 	YY_BREAK
 case 309:
 YY_RULE_SETUP
 #line 488 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_SQUARE); }
+{ MS_LEXER_RETURN_TOKEN(MS_SMALL); }
 	YY_BREAK
 case 310:
 YY_RULE_SETUP
 #line 489 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_SVG); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_SQUARE); }
 	YY_BREAK
 case 311:
 YY_RULE_SETUP
 #line 490 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(POLAROFFSET); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_SVG); }
 	YY_BREAK
 case 312:
 YY_RULE_SETUP
 #line 491 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_TINY); }
+{ MS_LEXER_RETURN_TOKEN(POLAROFFSET); }
 	YY_BREAK
 case 313:
 YY_RULE_SETUP
 #line 492 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CJC_TRIANGLE); }
+{ MS_LEXER_RETURN_TOKEN(MS_TINY); }
 	YY_BREAK
 case 314:
 YY_RULE_SETUP
 #line 493 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_TRUE); }
+{ MS_LEXER_RETURN_TOKEN(MS_CJC_TRIANGLE); }
 	YY_BREAK
 case 315:
 YY_RULE_SETUP
 #line 494 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_TRUETYPE); }
+{ MS_LEXER_RETURN_TOKEN(MS_TRUE); }
 	YY_BREAK
 case 316:
 YY_RULE_SETUP
 #line 495 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_UC); }
+{ MS_LEXER_RETURN_TOKEN(MS_TRUETYPE); }
 	YY_BREAK
 case 317:
 YY_RULE_SETUP
 #line 496 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_UL); }
+{ MS_LEXER_RETURN_TOKEN(MS_UC); }
 	YY_BREAK
 case 318:
 YY_RULE_SETUP
 #line 497 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_UR); }
+{ MS_LEXER_RETURN_TOKEN(MS_UL); }
 	YY_BREAK
 case 319:
 YY_RULE_SETUP
 #line 498 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_UNION); }
+{ MS_LEXER_RETURN_TOKEN(MS_UR); }
 	YY_BREAK
 case 320:
 YY_RULE_SETUP
 #line 499 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_UVRASTER); }
+{ MS_LEXER_RETURN_TOKEN(MS_UNION); }
 	YY_BREAK
 case 321:
 YY_RULE_SETUP
 #line 500 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_CONTOUR); }
+{ MS_LEXER_RETURN_TOKEN(MS_UVRASTER); }
 	YY_BREAK
 case 322:
 YY_RULE_SETUP
 #line 501 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_VECTOR); }
+{ MS_LEXER_RETURN_TOKEN(MS_CONTOUR); }
 	YY_BREAK
 case 323:
 YY_RULE_SETUP
 #line 502 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_WFS); }
+{ MS_LEXER_RETURN_TOKEN(MS_SYMBOL_VECTOR); }
 	YY_BREAK
 case 324:
 YY_RULE_SETUP
 #line 503 "maplexer.l"
-{ MS_LEXER_RETURN_TOKEN(MS_WMS); }
+{ MS_LEXER_RETURN_TOKEN(MS_WFS); }
 	YY_BREAK
 case 325:
 YY_RULE_SETUP
-#line 505 "maplexer.l"
+#line 504 "maplexer.l"
+{ MS_LEXER_RETURN_TOKEN(MS_WMS); }
+	YY_BREAK
+case 326:
+YY_RULE_SETUP
+#line 506 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4303,9 +4014,9 @@ YY_RULE_SETUP
                                                  return(MS_STRING);
                                                }
 	YY_BREAK
-case 326:
+case 327:
 YY_RULE_SETUP
-#line 513 "maplexer.l"
+#line 514 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4316,10 +4027,10 @@ YY_RULE_SETUP
                                                  return(MS_NUMBER);
                                                }
 	YY_BREAK
-case 327:
-/* rule 327 can match eol */
+case 328:
+/* rule 328 can match eol */
 YY_RULE_SETUP
-#line 523 "maplexer.l"
+#line 524 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4329,34 +4040,34 @@ YY_RULE_SETUP
                                                  return(MS_BINDING);
                                                }
 	YY_BREAK
-case 328:
+case 329:
 YY_RULE_SETUP
-#line 532 "maplexer.l"
+#line 533 "maplexer.l"
 { 
   /* attribute binding - shape (fixed value) */
   return(MS_TOKEN_BINDING_SHAPE);
 }
 	YY_BREAK
-case 329:
+case 330:
 YY_RULE_SETUP
-#line 536 "maplexer.l"
+#line 537 "maplexer.l"
 { 
   /* attribute binding - map cellsize */
   return(MS_TOKEN_BINDING_MAP_CELLSIZE);
 }
 	YY_BREAK
-case 330:
+case 331:
 YY_RULE_SETUP
-#line 540 "maplexer.l"
+#line 541 "maplexer.l"
 { 
   /* attribute binding - data cellsize */
   return(MS_TOKEN_BINDING_DATA_CELLSIZE);
 }
 	YY_BREAK
-case 331:
-/* rule 331 can match eol */
+case 332:
+/* rule 332 can match eol */
 YY_RULE_SETUP
-#line 544 "maplexer.l"
+#line 545 "maplexer.l"
 {
   /* attribute binding - numeric (no quotes) */
   msyytext++;
@@ -4367,10 +4078,10 @@ YY_RULE_SETUP
   return(MS_TOKEN_BINDING_DOUBLE);
 }
 	YY_BREAK
-case 332:
-/* rule 332 can match eol */
+case 333:
+/* rule 333 can match eol */
 YY_RULE_SETUP
-#line 553 "maplexer.l"
+#line 554 "maplexer.l"
 {
   /* attribute binding - string (single or double quotes) */
   msyytext+=2;
@@ -4381,10 +4092,10 @@ YY_RULE_SETUP
   return(MS_TOKEN_BINDING_STRING);
 }
 	YY_BREAK
-case 333:
-/* rule 333 can match eol */
+case 334:
+/* rule 334 can match eol */
 YY_RULE_SETUP
-#line 562 "maplexer.l"
+#line 563 "maplexer.l"
 {
   /* attribute binding - time */
   msyytext+=2;
@@ -4395,9 +4106,9 @@ YY_RULE_SETUP
   return(MS_TOKEN_BINDING_TIME);
 }
 	YY_BREAK
-case 334:
+case 335:
 YY_RULE_SETUP
-#line 572 "maplexer.l"
+#line 573 "maplexer.l"
 {
   MS_LEXER_STRING_REALLOC(msyystring_buffer, strlen(msyytext), 
                           msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4406,9 +4117,9 @@ YY_RULE_SETUP
   return(MS_NUMBER); 
 }
 	YY_BREAK
-case 335:
+case 336:
 YY_RULE_SETUP
-#line 580 "maplexer.l"
+#line 581 "maplexer.l"
 {
   MS_LEXER_STRING_REALLOC(msyystring_buffer, strlen(msyytext), 
                           msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4417,10 +4128,10 @@ YY_RULE_SETUP
   return(MS_TOKEN_LITERAL_NUMBER);
 }
 	YY_BREAK
-case 336:
-/* rule 336 can match eol */
+case 337:
+/* rule 337 can match eol */
 YY_RULE_SETUP
-#line 588 "maplexer.l"
+#line 589 "maplexer.l"
 {
   msyytext++;
   msyytext[strlen(msyytext)-1] = '\0';
@@ -4430,10 +4141,10 @@ YY_RULE_SETUP
   return(MS_TOKEN_LITERAL_TIME);
 }
 	YY_BREAK
-case 337:
-/* rule 337 can match eol */
+case 338:
+/* rule 338 can match eol */
 YY_RULE_SETUP
-#line 597 "maplexer.l"
+#line 598 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-2] = '\0';
@@ -4443,10 +4154,10 @@ YY_RULE_SETUP
                                                  return(MS_IREGEX);
                                                }
 	YY_BREAK
-case 338:
-/* rule 338 can match eol */
+case 339:
+/* rule 339 can match eol */
 YY_RULE_SETUP
-#line 606 "maplexer.l"
+#line 607 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4456,9 +4167,9 @@ YY_RULE_SETUP
                                                  return(MS_REGEX);
                                                }
 	YY_BREAK
-case 339:
+case 340:
 YY_RULE_SETUP
-#line 615 "maplexer.l"
+#line 616 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4468,9 +4179,9 @@ YY_RULE_SETUP
                                                  return(MS_EXPRESSION);
                                                }
 	YY_BREAK
-case 340:
+case 341:
 YY_RULE_SETUP
-#line 624 "maplexer.l"
+#line 625 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4480,9 +4191,9 @@ YY_RULE_SETUP
                                                  return(MS_LIST);
                                                }
 	YY_BREAK
-case 341:
+case 342:
 YY_RULE_SETUP
-#line 633 "maplexer.l"
+#line 634 "maplexer.l"
 {
                                                  msyystring_return_state = MS_STRING;
                                                  msyystring_begin = msyytext[0]; 
@@ -4491,9 +4202,9 @@ YY_RULE_SETUP
                                                  BEGIN(MSSTRING);
                                               }
 	YY_BREAK
-case 342:
+case 343:
 YY_RULE_SETUP
-#line 641 "maplexer.l"
+#line 642 "maplexer.l"
 {
                                                 MS_LEXER_STRING_REALLOC(msyystring_buffer, msyystring_size, 
                                                                                            msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4524,9 +4235,9 @@ YY_RULE_SETUP
                                                 }
                                               }
 	YY_BREAK
-case 343:
+case 344:
 YY_RULE_SETUP
-#line 671 "maplexer.l"
+#line 672 "maplexer.l"
 { 
                                                 MS_LEXER_STRING_REALLOC(msyystring_buffer, msyystring_size, 
                                                                                            msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4538,10 +4249,10 @@ YY_RULE_SETUP
                                                     *msyystring_buffer_ptr++ = msyytext[0];
                                              }
 	YY_BREAK
-case 344:
-/* rule 344 can match eol */
+case 345:
+/* rule 345 can match eol */
 YY_RULE_SETUP
-#line 682 "maplexer.l"
+#line 683 "maplexer.l"
 {
                                                  char *yptr = msyytext;
                                                  while ( *yptr ) { 
@@ -4552,10 +4263,10 @@ YY_RULE_SETUP
                                                  }
                                              }
 	YY_BREAK
-case 345:
-/* rule 345 can match eol */
+case 346:
+/* rule 346 can match eol */
 YY_RULE_SETUP
-#line 692 "maplexer.l"
+#line 693 "maplexer.l"
 {
                                                  msyytext++;
                                                  msyytext[strlen(msyytext)-1] = '\0';
@@ -4582,9 +4293,9 @@ YY_RULE_SETUP
                                                  BEGIN(INITIAL);
                                                }
 	YY_BREAK
-case 346:
+case 347:
 YY_RULE_SETUP
-#line 718 "maplexer.l"
+#line 719 "maplexer.l"
 {
                                                  msyystring_return_state = MS_TOKEN_LITERAL_STRING;
                                                  msyystring_begin = msyytext[0]; 
@@ -4593,9 +4304,9 @@ YY_RULE_SETUP
                                                  BEGIN(MSSTRING);
                                               }
 	YY_BREAK
-case 347:
+case 348:
 YY_RULE_SETUP
-#line 726 "maplexer.l"
+#line 727 "maplexer.l"
 { 
                                                     MS_LEXER_STRING_REALLOC(msyystring_buffer, strlen(msyytext), 
                                                                             msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4603,14 +4314,14 @@ YY_RULE_SETUP
                                                     return(MS_STRING); 
                                                 }
 	YY_BREAK
-case 348:
-/* rule 348 can match eol */
+case 349:
+/* rule 349 can match eol */
 YY_RULE_SETUP
-#line 733 "maplexer.l"
+#line 734 "maplexer.l"
 { msyylineno++; }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 735 "maplexer.l"
+#line 736 "maplexer.l"
 {
                                                   if( --include_stack_ptr < 0 )
                                                     return(EOF); /* end of main file */
@@ -4622,17 +4333,17 @@ case YY_STATE_EOF(INITIAL):
                                                   }
                                                 }
 	YY_BREAK
-case 349:
-/* rule 349 can match eol */
+case 350:
+/* rule 350 can match eol */
 YY_RULE_SETUP
-#line 746 "maplexer.l"
+#line 747 "maplexer.l"
 {
   return(0); 
 }
 	YY_BREAK
-case 350:
+case 351:
 YY_RULE_SETUP
-#line 750 "maplexer.l"
+#line 751 "maplexer.l"
 { 
                                                   MS_LEXER_STRING_REALLOC(msyystring_buffer, strlen(msyytext), 
                                                                           msyystring_buffer_size, msyystring_buffer_ptr);
@@ -4640,17 +4351,17 @@ YY_RULE_SETUP
                                                   return(0); 
                                                 }
 	YY_BREAK
-case 351:
+case 352:
 YY_RULE_SETUP
-#line 756 "maplexer.l"
+#line 757 "maplexer.l"
 { return(msyytext[0]); }
 	YY_BREAK
-case 352:
+case 353:
 YY_RULE_SETUP
-#line 757 "maplexer.l"
+#line 758 "maplexer.l"
 ECHO;
 	YY_BREAK
-#line 4654 "maplexer.c"
+#line 4365 "maplexer.c"
 case YY_STATE_EOF(URL_VARIABLE):
 case YY_STATE_EOF(URL_STRING):
 case YY_STATE_EOF(EXPRESSION_STRING):
@@ -4939,7 +4650,7 @@ static int yy_get_next_buffer (void)
 
 	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
 		{
-		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 88);
+		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 62);
 		if ( yy_accept[yy_current_state] )
 			{
 			(yy_last_accepting_state) = yy_current_state;
@@ -4948,7 +4659,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2038 )
+			if ( yy_current_state >= 2061 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4967,7 +4678,7 @@ static int yy_get_next_buffer (void)
 	register int yy_is_jam;
     	register char *yy_cp = (yy_c_buf_p);
 
-	register YY_CHAR yy_c = 88;
+	register YY_CHAR yy_c = 62;
 	if ( yy_accept[yy_current_state] )
 		{
 		(yy_last_accepting_state) = yy_current_state;
@@ -4976,11 +4687,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2038 )
+		if ( yy_current_state >= 2061 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 2037);
+	yy_is_jam = (yy_current_state == 2060);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5650,7 +5361,7 @@ void msyyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 757 "maplexer.l"
+#line 758 "maplexer.l"
 
 
 
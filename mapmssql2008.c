@@ -970,6 +970,7 @@ int msMSSQL2008LayerOpen(layerObj *layer)
     /* Decrypt any encrypted token in connection and attempt to connect */
     conn_decrypted = msDecryptStringTokens(layer->map, layer->connection);
     if (conn_decrypted == NULL) {
+      msConnPoolCancel(layer);
       return(MS_FAILURE);  /* An error should already have been produced */
     }
 
@@ -1011,6 +1012,7 @@ int msMSSQL2008LayerOpen(layerObj *layer)
 
       msFree(maskeddata);
       msMSSQL2008CloseConnection(layerinfo->conn);
+      msConnPoolCancel(layer);
       msFree(layerinfo);
       return MS_FAILURE;
     }
@@ -634,6 +634,8 @@ int FLTApplyFilterToLayerCommonExpressionWithRect(mapObj *map, int iLayerIndex,
   const int save_cache_shapes = map->query.cache_shapes;
   const int save_max_cached_shape_count = map->query.max_cached_shape_count;
   const int save_max_cached_shape_ram_amount = map->query.max_cached_shape_ram_amount;
+  int (*save_shape_callback)(void *, layerObj *, shapeObj *) = map->query.shape_callback;
+  void* save_shape_callback_data = map->query.shape_callback_data;
   msInitQuery(&(map->query));
   map->query.startindex = save_startindex;
   map->query.maxfeatures = save_maxfeatures;
@@ -641,6 +643,8 @@ int FLTApplyFilterToLayerCommonExpressionWithRect(mapObj *map, int iLayerIndex,
   map->query.cache_shapes = save_cache_shapes;
   map->query.max_cached_shape_count = save_max_cached_shape_count;
   map->query.max_cached_shape_ram_amount = save_max_cached_shape_ram_amount;
+  map->query.shape_callback = save_shape_callback;
+  map->query.shape_callback_data = save_shape_callback_data;
 
   map->query.mode = MS_QUERY_MULTIPLE;
   map->query.layer = iLayerIndex;
@@ -47,6 +47,20 @@
 // GDAL 1.x API
 #include "ogr_api.h"
 
+// GDAL 3.6 exposes layers as Arrow C stream of record batches
+#if defined(GDAL_COMPUTE_VERSION) && GDAL_VERSION_NUM >= GDAL_COMPUTE_VERSION(3,6,0)
+#define MSOGR_USE_ARROW_STREAM
+#endif
+
+#ifdef MSOGR_USE_ARROW_STREAM
+typedef struct {
+  int   iChild;      /* index of the column in the record batch */
+  char  chFormat;    /* Arrow format character of the column */
+  int   nWidth;      /* OGR width/precision, for real fields */
+  int   nPrecision;
+} msOGRArrowColumn;
+#endif
+
 typedef struct ms_ogr_file_info_t {
   char        *pszFname;
   char        *pszLayerDef;
@@ -78,6 +92,18 @@ typedef struct ms_ogr_file_info_t {
 
   char* pszWHERE;
 
+#ifdef MSOGR_USE_ARROW_STREAM
+  bool  bArrowStreamChecked;    /* eligibility tested since last WhichShapes */
+  bool  bArrowStreamActive;
+  struct ArrowArrayStream sArrowStream;
+  struct ArrowSchema sArrowSchema;
+  struct ArrowArray sArrowBatch;
+  int64_t nArrowBatchRow;       /* next row to read in sArrowBatch */
+  int   nArrowGeomChild;
+  int   nArrowFIDChild;
+  msOGRArrowColumn *pasArrowColumns; /* one per layer item, iChild -1 for FID */
+#endif
+
 } msOGRFileInfo;
 
 static int msOGRLayerIsOpen(layerObj *layer);
@@ -85,6 +111,9 @@ static int msOGRLayerInitItemInfo(layerObj *layer);
 static int msOGRLayerGetAutoStyle(mapObj *map, layerObj *layer, classObj *c,
                                   shapeObj* shape);
 static void msOGRCloseConnection( void *conn_handle );
+#ifdef MSOGR_USE_ARROW_STREAM
+static void msOGRFileReleaseArrowStream(msOGRFileInfo *psInfo, bool bResume);
+#endif
 
 /* ==================================================================
  * Geometry conversion functions
@@ -1196,6 +1225,7 @@ msOGRFileOpen(layerObj *layer, const char *connection )
         msDebug("Open failed for OGR connection in layer `%s'.\n%s\n",
                    layer->name?layer->name:"(null)",
                    CPLGetLastErrorMsg() );
+      msConnPoolCancel( layer );
       CPLFree( pszDSName );
       CPLFree( pszLayerDef );
       return NULL;
@@ -1293,6 +1323,11 @@ msOGRFileOpen(layerObj *layer, const char *connection )
   psInfo->bPaging = false;
   psInfo->bHasSpatialIndex = false;
   psInfo->pszTablePrefix = NULL;
+#ifdef MSOGR_USE_ARROW_STREAM
+  psInfo->bArrowStreamChecked = false;
+  psInfo->bArrowStreamActive = false;
+  psInfo->pasArrowColumns = NULL;
+#endif
   psInfo->pszWHERE = NULL;
 
     // GDAL 1.x API
@@ -1687,6 +1722,9 @@ static int msOGRFileClose(layerObj *layer, msOGRFileInfo *psInfo )
   CPLFree(psInfo->pszLayerDef);
 
   ACQUIRE_OGR_LOCK;
+#ifdef MSOGR_USE_ARROW_STREAM
+  msOGRFileReleaseArrowStream( psInfo, false );
+#endif
   if (psInfo->hLastFeature)
     OGR_F_Destroy( psInfo->hLastFeature );
 
@@ -2160,6 +2198,16 @@ static int msOGRFileWhichShapes(layerObj *layer, rectObj rect, msOGRFileInfo *ps
         return(MS_FAILURE);
     }
 
+#ifdef MSOGR_USE_ARROW_STREAM
+    // A stream left over from a previous request must be released before
+    // the layer is filtered again (or the SQL result set freed).
+    if( psInfo->bArrowStreamActive ) {
+        ACQUIRE_OGR_LOCK;
+        msOGRFileReleaseArrowStream( psInfo, false );
+        RELEASE_OGR_LOCK;
+    }
+#endif
+
     char *select = (psInfo->pszSelect) ? msStrdup(psInfo->pszSelect) : NULL;
     const rectObj rectInvalid = MS_INIT_INVALID_RECT;
     bool bIsValidRect = memcmp(&rect, &rectInvalid, sizeof(rect)) != 0;
@@ -2603,6 +2651,9 @@ static int msOGRFileWhichShapes(layerObj *layer, rectObj rect, msOGRFileInfo *ps
      * ------------------------------------------------------------------ */
     OGR_L_ResetReading( psInfo->hLayer );
     psInfo->last_record_index_read = -1;
+#ifdef MSOGR_USE_ARROW_STREAM
+    psInfo->bArrowStreamChecked = false;
+#endif
     
     RELEASE_OGR_LOCK;
   
@@ -2771,6 +2822,457 @@ static char **msOGRFileGetItems(layerObj *layer, msOGRFileInfo *psInfo )
   return items;
 }
 
+#ifdef MSOGR_USE_ARROW_STREAM
+
+/* ==================================================================
+ * Arrow columnar reading
+ *
+ * Drivers that implement OLCFastGetArrowStream (GeoPackage, FlatGeobuf,
+ * (Geo)Parquet, Arrow IPC...) can hand out features as Arrow record
+ * batches.  When a layer only needs plain attribute columns, we read
+ * those batches instead of materializing an OGRFeature per row, and
+ * only convert the columns listed in layer->items.
+ * ================================================================== */
+
+/**********************************************************************
+ *                     msOGRArrowIsWKBColumn()
+ *
+ * Returns true if the schema child is a binary column tagged with the
+ * "ogc.wkb" extension, which is how OGR encodes geometry fields.
+ **********************************************************************/
+static bool msOGRArrowIsWKBColumn(const struct ArrowSchema *psChild)
+{
+  static const char szExtName[] = "ARROW:extension:name";
+  static const char szWKB[] = "ogc.wkb";
+  const char *pabyMD = psChild->metadata;
+  int32_t nKeys, nLen;
+
+  if( (strcmp(psChild->format, "z") != 0 && strcmp(psChild->format, "Z") != 0)
+      || pabyMD == NULL )
+    return false;
+
+  /* metadata is int32 count, then (int32 len, bytes) key/value pairs */
+  memcpy(&nKeys, pabyMD, sizeof(int32_t));
+  pabyMD += sizeof(int32_t);
+  for( int i = 0; i < nKeys; i++ ) {
+    bool bIsExtName;
+
+    memcpy(&nLen, pabyMD, sizeof(int32_t));
+    pabyMD += sizeof(int32_t);
+    bIsExtName = (nLen == (int32_t)strlen(szExtName) &&
+                  memcmp(pabyMD, szExtName, nLen) == 0);
+    pabyMD += nLen;
+
+    memcpy(&nLen, pabyMD, sizeof(int32_t));
+    pabyMD += sizeof(int32_t);
+    if( bIsExtName )
+      return nLen == (int32_t)strlen(szWKB) &&
+             memcmp(pabyMD, szWKB, nLen) == 0;
+    pabyMD += nLen;
+  }
+  return false;
+}
+
+/**********************************************************************
+ *                     msOGRArrowIsNull()
+ **********************************************************************/
+static bool msOGRArrowIsNull(const struct ArrowArray *psArray, int64_t nIdx)
+{
+  const GByte *pabyValidity = (const GByte *)psArray->buffers[0];
+
+  return psArray->null_count != 0 && pabyValidity != NULL &&
+         (pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+}
+
+/**********************************************************************
+ *                     msOGRArrowGetFID()
+ **********************************************************************/
+static GIntBig msOGRArrowGetFID(msOGRFileInfo *psInfo, int64_t nRow)
+{
+  const struct ArrowArray *psBatch = &(psInfo->sArrowBatch);
+  const struct ArrowArray *psArray = psBatch->children[psInfo->nArrowFIDChild];
+
+  return ((const int64_t *)psArray->buffers[1])[psBatch->offset + psArray->offset + nRow];
+}
+
+/**********************************************************************
+ *                     msOGRArrowStrndup()
+ **********************************************************************/
+static char *msOGRArrowStrndup(const char *pszStr, size_t nLen)
+{
+  char *pszCopy = (char *)msSmallMalloc(nLen + 1);
+
+  memcpy(pszCopy, pszStr, nLen);
+  pszCopy[nLen] = '\0';
+  return pszCopy;
+}
+
+/**********************************************************************
+ *                     msOGRArrowGetValue()
+ *
+ * Format one cell exactly like OGR_F_GetFieldAsString() does for the
+ * corresponding OGR field type, so expressions and outputs don't change
+ * depending on the reading path.  Null cells are returned as "".
+ **********************************************************************/
+static char *msOGRArrowGetValue(msOGRFileInfo *psInfo,
+                                const msOGRArrowColumn *psColumn, int64_t nRow)
+{
+  const struct ArrowArray *psBatch = &(psInfo->sArrowBatch);
+  const struct ArrowArray *psArray = psBatch->children[psColumn->iChild];
+  const int64_t nIdx = psBatch->offset + psArray->offset + nRow;
+  char szValue[80];
+
+  if( msOGRArrowIsNull(psArray, nIdx) )
+    return msStrdup("");
+
+  switch( psColumn->chFormat ) {
+    case 'b':
+      return msStrdup((((const GByte *)psArray->buffers[1])[nIdx / 8] &
+                       (1 << (nIdx % 8))) ? "1" : "0");
+    case 's':
+      snprintf(szValue, sizeof(szValue), "%d",
+               ((const int16_t *)psArray->buffers[1])[nIdx]);
+      return msStrdup(szValue);
+    case 'i':
+      snprintf(szValue, sizeof(szValue), "%d",
+               ((const int32_t *)psArray->buffers[1])[nIdx]);
+      return msStrdup(szValue);
+    case 'l':
+      snprintf(szValue, sizeof(szValue), CPL_FRMT_GIB,
+               (GIntBig)((const int64_t *)psArray->buffers[1])[nIdx]);
+      return msStrdup(szValue);
+    case 'g': {
+      const double dfValue = ((const double *)psArray->buffers[1])[nIdx];
+      if( psColumn->nWidth != 0 )
+        CPLsnprintf(szValue, sizeof(szValue), "%.*f",
+                    psColumn->nPrecision, dfValue);
+      else
+        CPLsnprintf(szValue, sizeof(szValue), "%.15g", dfValue);
+      return msStrdup(szValue);
+    }
+    case 'u': {
+      const int32_t *panOffsets = (const int32_t *)psArray->buffers[1];
+      return msOGRArrowStrndup((const char *)psArray->buffers[2] + panOffsets[nIdx],
+                               (size_t)(panOffsets[nIdx + 1] - panOffsets[nIdx]));
+    }
+    case 'U': {
+      const int64_t *panOffsets = (const int64_t *)psArray->buffers[1];
+      return msOGRArrowStrndup((const char *)psArray->buffers[2] + panOffsets[nIdx],
+                               (size_t)(panOffsets[nIdx + 1] - panOffsets[nIdx]));
+    }
+    default:
+      break;
+  }
+  return msStrdup(""); /* not reached, format checked when stream started */
+}
+
+/**********************************************************************
+ *                     msOGRFileReleaseArrowStream()
+ *
+ * Close the Arrow stream opened on the layer, if any, and restore the
+ * layer for feature based reading.  With bResume the sequential reading
+ * is positioned after the last record read through the stream so that
+ * msOGRFileNextShape() can carry on.
+ *
+ * Must be called with the OGR lock held.
+ **********************************************************************/
+static void msOGRFileReleaseArrowStream(msOGRFileInfo *psInfo, bool bResume)
+{
+  if( !psInfo->bArrowStreamActive )
+    return;
+
+  if( psInfo->sArrowBatch.release )
+    psInfo->sArrowBatch.release(&(psInfo->sArrowBatch));
+  if( psInfo->sArrowSchema.release )
+    psInfo->sArrowSchema.release(&(psInfo->sArrowSchema));
+  if( psInfo->sArrowStream.release )
+    psInfo->sArrowStream.release(&(psInfo->sArrowStream));
+  msFree(psInfo->pasArrowColumns);
+  psInfo->pasArrowColumns = NULL;
+  psInfo->bArrowStreamActive = false;
+
+  OGR_L_SetIgnoredFields(psInfo->hLayer, NULL);
+  OGR_L_ResetReading(psInfo->hLayer);
+
+  if( bResume ) {
+    for( int i = 0; i <= psInfo->last_record_index_read; i++ ) {
+      OGRFeatureH hFeature = OGR_L_GetNextFeature(psInfo->hLayer);
+      if( hFeature == NULL )
+        break;
+      OGR_F_Destroy(hFeature);
+    }
+  }
+}
+
+/**********************************************************************
+ *                     msOGRFileStartArrowStream()
+ *
+ * Open an Arrow stream on the layer if the driver supports it natively
+ * and everything the layer needs can be read from the record batches:
+ * no style string derived items, no STYLEITEM AUTO, and only columns
+ * whose string form we can reproduce.  Columns that are not in
+ * layer->items are not read at all.
+ *
+ * Can be disabled with PROCESSING "OGR_ARROW_STREAM=NO".
+ *
+ * Must be called with the OGR lock held.  Returns true if the stream is
+ * open, false if msOGRFileNextShape() should read features as usual.
+ **********************************************************************/
+static bool msOGRFileStartArrowStream(layerObj *layer, msOGRFileInfo *psInfo)
+{
+  OGRFeatureDefnH hDefn = OGR_L_GetLayerDefn(psInfo->hLayer);
+  const int *itemindexes = (const int *)layer->iteminfo;
+  const char *pszFIDColumn;
+  char **papszIgnored = NULL;
+  char **papszOptions = NULL;
+  int i;
+
+  if( msLayerGetProcessingKey(layer, "OGR_ARROW_STREAM") != NULL &&
+      !CSLTestBoolean(msLayerGetProcessingKey(layer, "OGR_ARROW_STREAM")) )
+    return false;
+
+  if( layer->styleitem && strcasecmp(layer->styleitem, "AUTO") == 0 )
+    return false;
+
+  if( layer->numitems > 0 && itemindexes == NULL )
+    return false;
+  for( i = 0; i < layer->numitems; i++ ) {
+    if( itemindexes[i] < 0 && itemindexes[i] != MSOGR_FID_INDEX )
+      return false;
+  }
+
+  if( OGR_FD_GetGeomFieldCount(hDefn) == 0 ||
+      !OGR_L_TestCapability(psInfo->hLayer, OLCFastGetArrowStream) )
+    return false;
+
+  /* ------------------------------------------------------------------
+   * Only fetch the columns we need, and the first geometry field.
+   * ------------------------------------------------------------------ */
+  for( i = 0; i < OGR_FD_GetFieldCount(hDefn); i++ ) {
+    int j;
+    for( j = 0; j < layer->numitems; j++ )
+      if( itemindexes[j] == i )
+        break;
+    if( j == layer->numitems )
+      papszIgnored = CSLAddString(papszIgnored,
+                       OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(hDefn, i)));
+  }
+  for( i = 1; i < OGR_FD_GetGeomFieldCount(hDefn); i++ )
+    papszIgnored = CSLAddString(papszIgnored,
+                     OGR_GFld_GetNameRef(OGR_FD_GetGeomFieldDefn(hDefn, i)));
+  papszIgnored = CSLAddString(papszIgnored, "OGR_STYLE");
+  OGR_L_SetIgnoredFields(psInfo->hLayer, (const char **)papszIgnored);
+  CSLDestroy(papszIgnored);
+
+  papszOptions = CSLSetNameValue(papszOptions, "INCLUDE_FID", "YES");
+  papszOptions = CSLSetNameValue(papszOptions, "GEOMETRY_ENCODING", "WKB");
+  if( layer->maxfeatures > 0 && layer->maxfeatures < 65536 )
+    papszOptions = CSLSetNameValue(papszOptions, "MAX_FEATURES_IN_BATCH",
+                                   CPLSPrintf("%d", layer->maxfeatures));
+
+  memset(&(psInfo->sArrowStream), 0, sizeof(psInfo->sArrowStream));
+  memset(&(psInfo->sArrowSchema), 0, sizeof(psInfo->sArrowSchema));
+  memset(&(psInfo->sArrowBatch), 0, sizeof(psInfo->sArrowBatch));
+  psInfo->bArrowStreamActive = true;
+  psInfo->nArrowBatchRow = 0;
+  psInfo->nArrowGeomChild = -1;
+  psInfo->nArrowFIDChild = -1;
+
+  const bool bOK = OGR_L_GetArrowStream(psInfo->hLayer, &(psInfo->sArrowStream),
+                                        papszOptions) != FALSE;
+  CSLDestroy(papszOptions);
+  if( !bOK ||
+      psInfo->sArrowStream.get_schema(&(psInfo->sArrowStream),
+                                      &(psInfo->sArrowSchema)) != 0 ||
+      strcmp(psInfo->sArrowSchema.format, "+s") != 0 ) {
+    if( layer->debug )
+      msDebug("msOGRFileStartArrowStream(): failed to open Arrow stream, "
+              "reading features instead.\n");
+    msOGRFileReleaseArrowStream(psInfo, false);
+    return false;
+  }
+
+  /* ------------------------------------------------------------------
+   * Locate the FID, geometry and item columns in the batch schema.
+   * ------------------------------------------------------------------ */
+  pszFIDColumn = OGR_L_GetFIDColumn(psInfo->hLayer);
+  if( pszFIDColumn == NULL || pszFIDColumn[0] == '\0' )
+    pszFIDColumn = "OGC_FID";
+
+  for( i = 0; i < psInfo->sArrowSchema.n_children; i++ ) {
+    const struct ArrowSchema *psChild = psInfo->sArrowSchema.children[i];
+    if( psInfo->nArrowFIDChild < 0 && strcmp(psChild->format, "l") == 0 &&
+        strcmp(psChild->name, pszFIDColumn) == 0 )
+      psInfo->nArrowFIDChild = i;
+    else if( psInfo->nArrowGeomChild < 0 && msOGRArrowIsWKBColumn(psChild) )
+      psInfo->nArrowGeomChild = i;
+  }
+
+  psInfo->pasArrowColumns = (msOGRArrowColumn *)
+      msSmallCalloc(MS_MAX(layer->numitems, 1), sizeof(msOGRArrowColumn));
+  bool bSupported = psInfo->nArrowFIDChild >= 0 && psInfo->nArrowGeomChild >= 0;
+  for( i = 0; bSupported && i < layer->numitems; i++ ) {
+    msOGRArrowColumn *psColumn = psInfo->pasArrowColumns + i;
+    OGRFieldDefnH hField;
+    const char *pszName;
+
+    psColumn->iChild = -1;
+    if( itemindexes[i] == MSOGR_FID_INDEX )
+      continue;
+
+    hField = OGR_FD_GetFieldDefn(hDefn, itemindexes[i]);
+    pszName = OGR_Fld_GetNameRef(hField);
+    for( int j = 0; j < psInfo->sArrowSchema.n_children; j++ ) {
+      if( strcmp(psInfo->sArrowSchema.children[j]->name, pszName) == 0 ) {
+        psColumn->iChild = j;
+        break;
+      }
+    }
+
+    bSupported = false;
+    if( psColumn->iChild >= 0 ) {
+      const char *pszFormat = psInfo->sArrowSchema.children[psColumn->iChild]->format;
+      psColumn->chFormat = pszFormat[0];
+      psColumn->nWidth = OGR_Fld_GetWidth(hField);
+      psColumn->nPrecision = OGR_Fld_GetPrecision(hField);
+      bSupported = pszFormat[1] == '\0' && strchr("bsilguU", pszFormat[0]) != NULL;
+    }
+  }
+
+  if( !bSupported ) {
+    if( layer->debug )
+      msDebug("msOGRFileStartArrowStream(): unsupported Arrow schema, "
+              "reading features instead.\n");
+    msOGRFileReleaseArrowStream(psInfo, false);
+    return false;
+  }
+
+  if( layer->debug >= MS_DEBUGLEVEL_VV )
+    msDebug("msOGRFileStartArrowStream(): reading layer %s through Arrow record batches.\n",
+            layer->name ? layer->name : "(null)");
+
+  return true;
+}
+
+/**********************************************************************
+ *                     msOGRFileNextArrowShape()
+ *
+ * Arrow counterpart of the msOGRFileNextShape() reading loop.
+ *
+ * Must be called with the OGR lock held.
+ **********************************************************************/
+static int msOGRFileNextArrowShape(layerObj *layer, shapeObj *shape,
+                                   msOGRFileInfo *psInfo)
+{
+  struct ArrowArray *psBatch = &(psInfo->sArrowBatch);
+
+  while (shape->type == MS_SHAPE_NULL) {
+    /* ------------------------------------------------------------------
+     * Fetch the next record batch when the current one is consumed.
+     * ------------------------------------------------------------------ */
+    if( psBatch->release == NULL || psInfo->nArrowBatchRow >= psBatch->length ) {
+      if( psBatch->release )
+        psBatch->release(psBatch);
+      psInfo->nArrowBatchRow = 0;
+
+      if( psInfo->sArrowStream.get_next(&(psInfo->sArrowStream), psBatch) != 0 ) {
+        const char *pszError = psInfo->sArrowStream.get_last_error(&(psInfo->sArrowStream));
+        psBatch->release = NULL;
+        psInfo->last_record_index_read = -1;
+        msSetError(MS_OGRERR, "OGR Arrow stream get_next() error'd. Check logs.",
+                   "msOGRFileNextShape()");
+        msDebug("msOGRFileNextShape(): %s\n", pszError ? pszError : CPLGetLastErrorMsg());
+        return MS_FAILURE;
+      }
+      if( psBatch->release == NULL ) {
+        psInfo->last_record_index_read = -1;
+        if (layer->debug >= MS_DEBUGLEVEL_VV)
+          msDebug("msOGRFileNextShape: Returning MS_DONE (no more shapes)\n" );
+        return MS_DONE;  // No more features to read
+      }
+      continue;
+    }
+
+    const int64_t nRow = psInfo->nArrowBatchRow++;
+    psInfo->last_record_index_read++;
+
+    /* ------------------------------------------------------------------
+     * Geometry first: rows of incompatible type are rejected without
+     * touching the attribute columns.
+     * ------------------------------------------------------------------ */
+    const struct ArrowArray *psGeom = psBatch->children[psInfo->nArrowGeomChild];
+    const int64_t nIdx = psBatch->offset + psGeom->offset + nRow;
+    if( !msOGRArrowIsNull(psGeom, nIdx) ) {
+      const GByte *pabyWKB;
+      size_t nWKBSize;
+      OGRGeometryH hGeom = NULL;
+
+      if( psInfo->sArrowSchema.children[psInfo->nArrowGeomChild]->format[0] == 'Z' ) {
+        const int64_t *panOffsets = (const int64_t *)psGeom->buffers[1];
+        pabyWKB = (const GByte *)psGeom->buffers[2] + panOffsets[nIdx];
+        nWKBSize = (size_t)(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+      } else {
+        const int32_t *panOffsets = (const int32_t *)psGeom->buffers[1];
+        pabyWKB = (const GByte *)psGeom->buffers[2] + panOffsets[nIdx];
+        nWKBSize = (size_t)(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+      }
+
+      if( nWKBSize > 0 &&
+          OGR_G_CreateFromWkb(pabyWKB, NULL, &hGeom, (int)nWKBSize) == OGRERR_NONE ) {
+        hGeom = OGR_G_ForceTo(hGeom, OGR_GT_GetLinear(OGR_G_GetGeometryType(hGeom)), NULL);
+        const int status = ogrConvertGeometry(hGeom, shape, layer->type);
+        OGR_G_DestroyGeometry(hGeom);
+        if( status != MS_SUCCESS ) {
+          msFreeShape(shape);
+          return MS_FAILURE; // Error message already produced.
+        }
+      }
+    }
+
+    if( shape->type == MS_SHAPE_NULL ) {
+      if (layer->debug >= MS_DEBUGLEVEL_VVV)
+        msDebug("msOGRFileNextShape: Rejecting feature (shapeid = " CPL_FRMT_GIB ", tileid=%d) of incompatible type for this layer (layer type %d)\n",
+                msOGRArrowGetFID(psInfo, nRow), psInfo->nTileId, layer->type);
+      msFreeShape(shape);
+      shape->type = MS_SHAPE_NULL;
+      continue;
+    }
+
+    if(layer->numitems > 0) {
+      if (shape->values) msFreeCharArray(shape->values, shape->numvalues);
+      shape->values = (char **)msSmallMalloc(sizeof(char *)*layer->numitems);
+      shape->numvalues = layer->numitems;
+      for( int i = 0; i < layer->numitems; i++ ) {
+        const msOGRArrowColumn *psColumn = psInfo->pasArrowColumns + i;
+        if( psColumn->iChild < 0 )
+          shape->values[i] = msStrdup(CPLSPrintf(CPL_FRMT_GIB,
+                                                 msOGRArrowGetFID(psInfo, nRow)));
+        else
+          shape->values[i] = msOGRArrowGetValue(psInfo, psColumn, nRow);
+      }
+    }
+
+    shape->index = (int)msOGRArrowGetFID(psInfo, nRow); // FIXME? 64bit FID
+  }
+
+  shape->resultindex = psInfo->last_record_index_read;
+  shape->tileindex = psInfo->nTileId;
+
+  if (layer->debug >= MS_DEBUGLEVEL_VVV)
+    msDebug("msOGRFileNextShape: Returning shape=%ld, tile=%d\n",
+            shape->index, shape->tileindex );
+
+  // No feature to keep around, AutoStyle is never read through a stream.
+  if (psInfo->hLastFeature) {
+    OGR_F_Destroy( psInfo->hLastFeature );
+    psInfo->hLastFeature = NULL;
+  }
+
+  return MS_SUCCESS;
+}
+
+#endif /* MSOGR_USE_ARROW_STREAM */
+
 /**********************************************************************
  *                     msOGRFileNextShape()
  *
@@ -2799,6 +3301,18 @@ msOGRFileNextShape(layerObj *layer, shapeObj *shape,
   shape->type = MS_SHAPE_NULL;
 
   ACQUIRE_OGR_LOCK;
+#ifdef MSOGR_USE_ARROW_STREAM
+  if( !psInfo->bArrowStreamChecked ) {
+    psInfo->bArrowStreamChecked = true;
+    if( psInfo->last_record_index_read == -1 )
+      msOGRFileStartArrowStream( layer, psInfo );
+  }
+  if( psInfo->bArrowStreamActive ) {
+    const int status = msOGRFileNextArrowShape( layer, shape, psInfo );
+    RELEASE_OGR_LOCK;
+    return status;
+  }
+#endif
   while (shape->type == MS_SHAPE_NULL) {
     if( hFeature )
       OGR_F_Destroy( hFeature );
@@ -2901,6 +3415,18 @@ msOGRFileGetShape(layerObj *layer, shapeObj *shape, long record,
   msFreeShape(shape);
   shape->type = MS_SHAPE_NULL;
 
+#ifdef MSOGR_USE_ARROW_STREAM
+  /* -------------------------------------------------------------------- */
+  /*      Random access isn't allowed while an Arrow stream is open on    */
+  /*      the layer: close it and go on with feature based reading.       */
+  /* -------------------------------------------------------------------- */
+  if( psInfo->bArrowStreamActive ) {
+    ACQUIRE_OGR_LOCK;
+    msOGRFileReleaseArrowStream( psInfo, true );
+    RELEASE_OGR_LOCK;
+  }
+
+#endif
   /* -------------------------------------------------------------------- */
   /*      Support reading feature by fid.                                 */
   /* -------------------------------------------------------------------- */
@@ -658,10 +658,44 @@ static char** msOGROutputGetAdditonalFiles( mapObj *map )
 }
 
 /************************************************************************/
-/*                        msOGRWriteFromQuery()                         */
+/*                            msOGROutputObj                            */
+/*                                                                      */
+/*      An output datasource being written, and the layer currently     */
+/*      receiving features.                                             */
 /************************************************************************/
 
-int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
+struct msOGROutputObj {
+  mapObj *map;
+  outputFormatObj *format;
+  int sendheaders;
+  OGRDataSourceH hDS;
+  const char *storage;
+  const char *form;
+  const char *fo_filename;
+  char datasource_name[MS_MAXPATHLEN];
+  char **layer_options;
+  int bDataSourceNameIsRequestDir;
+  int bUseFeatureId;
+  int *layersWritten; /* per map layer, whether its OGR layer exists */
+  int status;
+
+  /* current layer */
+  layerObj *layer;
+  OGRLayerH hOGRLayer;
+  gmlItemListObj *item_list;
+  int nFirstOGRFieldIndex;
+  const char *pszFeatureid;
+};
+
+/************************************************************************/
+/*                            msOGROutputOpen()                         */
+/*                                                                      */
+/*      Create the output datasource, and send the headers if the       */
+/*      result is streamed.                                             */
+/************************************************************************/
+
+static msOGROutputObj *msOGROutputOpen( mapObj *map, outputFormatObj *format,
+                                        int sendheaders )
 
 {
   /* -------------------------------------------------------------------- */
@@ -677,8 +711,8 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
   char *request_dir = NULL;
   char **ds_options = NULL;
   char **layer_options = NULL;
-  char **file_list = NULL;
-  int iLayer, i;
+  int i;
+  msOGROutputObj *out;
   int bDataSourceNameIsRequestDir = FALSE;
   int bUseFeatureId = MS_FALSE;
   const char* pszMatchingFeatures;
@@ -698,7 +732,7 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
   if( hDriver == NULL ) {
     msSetError( MS_MISCERR, "No OGR driver named `%s' available.",
                 "msOGRWriteFromQuery()", pszFormatName );
-    return MS_FAILURE;
+    return NULL;
   }
 
   /* -------------------------------------------------------------------- */
@@ -768,7 +802,7 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
                 storage );
     CSLDestroy(layer_options);
     CSLDestroy(ds_options);
-    return MS_FAILURE;
+    return NULL;
   }
 
   /* -------------------------------------------------------------------- */
@@ -800,7 +834,7 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
       msFree(request_dir);
       CSLDestroy(layer_options);
       CSLDestroy(ds_options);
-      return MS_FAILURE;
+      return NULL;
     }
   }
   /*  else handled later */
@@ -826,7 +860,7 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
     msFree(request_dir);
     CSLDestroy(layer_options);
     CSLDestroy(ds_options);
-    return MS_FAILURE;
+    return NULL;
   }
 
   if( !EQUAL(storage,"stream") )
@@ -887,308 +921,338 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
                 datasource_name,
                 format->driver+4 );
     CSLDestroy(layer_options);
-    return MS_FAILURE;
+    return NULL;
   }
 
-  /* ==================================================================== */
-  /*      Process each layer with a resultset.                            */
-  /* ==================================================================== */
-  for( iLayer = 0; iLayer < map->numlayers; iLayer++ ) {
-    int status = 0;
-    layerObj *layer = GET_LAYER(map, iLayer);
-    shapeObj resultshape;
-    OGRLayerH hOGRLayer;
-    OGRwkbGeometryType eGeomType;
-    OGRSpatialReferenceH srs = NULL;
-    gmlItemListObj *item_list = NULL;
-    const char *value;
-    char *pszWKT;
-    int  nFirstOGRFieldIndex = -1;
-    const char *pszFeatureid = NULL;
+  out = (msOGROutputObj *) msSmallCalloc(1, sizeof(msOGROutputObj));
+  out->map = map;
+  out->format = format;
+  out->sendheaders = sendheaders;
+  out->hDS = hDS;
+  out->storage = storage;
+  out->form = form;
+  out->fo_filename = fo_filename;
+  strlcpy( out->datasource_name, datasource_name, sizeof(out->datasource_name) );
+  out->layer_options = layer_options;
+  out->bDataSourceNameIsRequestDir = bDataSourceNameIsRequestDir;
+  out->bUseFeatureId = bUseFeatureId;
+  out->layersWritten = (int *) msSmallCalloc(map->numlayers > 0 ? map->numlayers : 1, sizeof(int));
+  out->status = MS_SUCCESS;
+
+  return out;
+}
 
-    if( !layer->resultcache )
-      continue;
+/************************************************************************/
+/*                         msOGROutputStartLayer()                      */
+/*                                                                      */
+/*      Create the OGR layer receiving the features of a map layer.     */
+/************************************************************************/
 
-    /* -------------------------------------------------------------------- */
-    /*      Will we need to reproject?                                      */
-    /* -------------------------------------------------------------------- */
-    if(layer->transform == MS_TRUE)
-        layer->project = msProjectionsDiffer(&(layer->projection),
-                               &(layer->map->projection));
+static int msOGROutputStartLayer( msOGROutputObj *out, layerObj *layer )
 
-    /* -------------------------------------------------------------------- */
-    /*      Establish the geometry type to use for the created layer.       */
-    /*      First we consult the wfs_geomtype field and fallback to         */
-    /*      deriving something from the type of the mapserver layer.        */
-    /* -------------------------------------------------------------------- */
-    value = msOWSLookupMetadata(&(layer->metadata), "FOG", "geomtype");
-    if( value == NULL ) {
-      if( layer->type == MS_LAYER_POINT )
-        value = "Point";
-      else if( layer->type == MS_LAYER_LINE )
-        value = "LineString";
-      else if( layer->type == MS_LAYER_POLYGON )
-        value = "Polygon";
-      else
-        value = "Geometry";
-    }
+{
+  mapObj *map = out->map;
+  int i, status;
+  OGRLayerH hOGRLayer;
+  OGRwkbGeometryType eGeomType;
+  OGRSpatialReferenceH srs = NULL;
+  gmlItemListObj *item_list = NULL;
+  const char *value;
+  char *pszWKT;
+  int  nFirstOGRFieldIndex = -1;
+  const char *pszFeatureid = NULL;
 
-    if(bUseFeatureId)
-      pszFeatureid = msOWSLookupMetadata(&(layer->metadata), "FOG", "featureid");
-
-    if( strcasecmp(value,"Point") == 0 )
-      eGeomType = wkbPoint;
-    else if( strcasecmp(value,"LineString") == 0 )
-      eGeomType = wkbLineString;
-    else if( strcasecmp(value,"Polygon") == 0 )
-      eGeomType = wkbPolygon;
-    else if( strcasecmp(value,"MultiPoint") == 0 )
-      eGeomType = wkbMultiPoint;
-    else if( strcasecmp(value,"MultiLineString") == 0 )
-      eGeomType = wkbMultiLineString;
-    else if( strcasecmp(value,"MultiPolygon") == 0 )
-      eGeomType = wkbMultiPolygon;
-    else if( strcasecmp(value,"GeometryCollection") == 0 )
-      eGeomType = wkbGeometryCollection;
-    else if( strcasecmp(value,"Point25D") == 0 )
-      eGeomType = wkbPoint25D;
-    else if( strcasecmp(value,"LineString25D") == 0 )
-      eGeomType = wkbLineString25D;
-    else if( strcasecmp(value,"Polygon25D") == 0 )
-      eGeomType = wkbPolygon25D;
-    else if( strcasecmp(value,"MultiPoint25D") == 0 )
-      eGeomType = wkbMultiPoint25D;
-    else if( strcasecmp(value,"MultiLineString25D") == 0 )
-      eGeomType = wkbMultiLineString25D;
-    else if( strcasecmp(value,"MultiPolygon25D") == 0 )
-      eGeomType = wkbMultiPolygon25D;
-    else if( strcasecmp(value,"GeometryCollection25D") == 0 )
-      eGeomType = wkbGeometryCollection25D;
-    else if( strcasecmp(value,"Unknown") == 0
-             || strcasecmp(value,"Geometry") == 0 )
-      eGeomType = wkbUnknown;
-    else if( strcasecmp(value,"None") == 0 )
-      eGeomType = wkbNone;
+  /* -------------------------------------------------------------------- */
+  /*      Will we need to reproject?                                      */
+  /* -------------------------------------------------------------------- */
+  if(layer->transform == MS_TRUE)
+      layer->project = msProjectionsDiffer(&(layer->projection),
+                             &(layer->map->projection));
+
+  /* -------------------------------------------------------------------- */
+  /*      Establish the geometry type to use for the created layer.       */
+  /*      First we consult the wfs_geomtype field and fallback to         */
+  /*      deriving something from the type of the mapserver layer.        */
+  /* -------------------------------------------------------------------- */
+  value = msOWSLookupMetadata(&(layer->metadata), "FOG", "geomtype");
+  if( value == NULL ) {
+    if( layer->type == MS_LAYER_POINT )
+      value = "Point";
+    else if( layer->type == MS_LAYER_LINE )
+      value = "LineString";
+    else if( layer->type == MS_LAYER_POLYGON )
+      value = "Polygon";
     else
-      eGeomType = wkbUnknown;
+      value = "Geometry";
+  }
 
-    /* -------------------------------------------------------------------- */
-    /*      Create a spatial reference.                                     */
-    /* -------------------------------------------------------------------- */
-    pszWKT = msProjectionObj2OGCWKT( &(map->projection) );
-    if( pszWKT != NULL ) {
-      srs = OSRNewSpatialReference( pszWKT );
-      msFree( pszWKT );
-    }
+  if(out->bUseFeatureId)
+    pszFeatureid = msOWSLookupMetadata(&(layer->metadata), "FOG", "featureid");
+
+  if( strcasecmp(value,"Point") == 0 )
+    eGeomType = wkbPoint;
+  else if( strcasecmp(value,"LineString") == 0 )
+    eGeomType = wkbLineString;
+  else if( strcasecmp(value,"Polygon") == 0 )
+    eGeomType = wkbPolygon;
+  else if( strcasecmp(value,"MultiPoint") == 0 )
+    eGeomType = wkbMultiPoint;
+  else if( strcasecmp(value,"MultiLineString") == 0 )
+    eGeomType = wkbMultiLineString;
+  else if( strcasecmp(value,"MultiPolygon") == 0 )
+    eGeomType = wkbMultiPolygon;
+  else if( strcasecmp(value,"GeometryCollection") == 0 )
+    eGeomType = wkbGeometryCollection;
+  else if( strcasecmp(value,"Point25D") == 0 )
+    eGeomType = wkbPoint25D;
+  else if( strcasecmp(value,"LineString25D") == 0 )
+    eGeomType = wkbLineString25D;
+  else if( strcasecmp(value,"Polygon25D") == 0 )
+    eGeomType = wkbPolygon25D;
+  else if( strcasecmp(value,"MultiPoint25D") == 0 )
+    eGeomType = wkbMultiPoint25D;
+  else if( strcasecmp(value,"MultiLineString25D") == 0 )
+    eGeomType = wkbMultiLineString25D;
+  else if( strcasecmp(value,"MultiPolygon25D") == 0 )
+    eGeomType = wkbMultiPolygon25D;
+  else if( strcasecmp(value,"GeometryCollection25D") == 0 )
+    eGeomType = wkbGeometryCollection25D;
+  else if( strcasecmp(value,"Unknown") == 0
+           || strcasecmp(value,"Geometry") == 0 )
+    eGeomType = wkbUnknown;
+  else if( strcasecmp(value,"None") == 0 )
+    eGeomType = wkbNone;
+  else
+    eGeomType = wkbUnknown;
 
-    /* -------------------------------------------------------------------- */
-    /*      Create the corresponding OGR Layer.                             */
-    /* -------------------------------------------------------------------- */
-    hOGRLayer = OGR_DS_CreateLayer( hDS, layer->name, srs, eGeomType,
-                                    layer_options );
-    if( hOGRLayer == NULL ) {
-      OGR_DS_Destroy( hDS );
-      msOGRCleanupDS( datasource_name );
-      msSetError( MS_MISCERR,
-                  "OGR OGR_DS_CreateLayer failed for layer '%s' with driver '%s'.",
-                  "msOGRWriteFromQuery()",
-                  layer->name,
-                  format->driver+4 );
-      CSLDestroy(layer_options);
-      return MS_FAILURE;
-    }
+  /* -------------------------------------------------------------------- */
+  /*      Create a spatial reference.                                     */
+  /* -------------------------------------------------------------------- */
+  pszWKT = msProjectionObj2OGCWKT( &(map->projection) );
+  if( pszWKT != NULL ) {
+    srs = OSRNewSpatialReference( pszWKT );
+    msFree( pszWKT );
+  }
 
-    if( srs != NULL )
-      OSRRelease( srs );
+  /* -------------------------------------------------------------------- */
+  /*      Create the corresponding OGR Layer.                             */
+  /* -------------------------------------------------------------------- */
+  hOGRLayer = OGR_DS_CreateLayer( out->hDS, layer->name, srs, eGeomType,
+                                  out->layer_options );
+  if( hOGRLayer == NULL ) {
+    msSetError( MS_MISCERR,
+                "OGR OGR_DS_CreateLayer failed for layer '%s' with driver '%s'.",
+                "msOGRWriteFromQuery()",
+                layer->name,
+                out->format->driver+4 );
+    return MS_FAILURE;
+  }
 
-    /* -------------------------------------------------------------------- */
-    /*      Create appropriate attributes on this layer.                    */
-    /* -------------------------------------------------------------------- */
-    item_list = msGMLGetItems( layer, "G" );
-    assert( item_list->numitems == layer->numitems );
+  if( srs != NULL )
+    OSRRelease( srs );
 
-    for( i = 0; i < layer->numitems; i++ ) {
-      OGRFieldDefnH hFldDefn;
-      OGRErr eErr;
-      const char *name;
-      gmlItemObj *item = item_list->items + i;
-      OGRFieldType eType;
+  /* -------------------------------------------------------------------- */
+  /*      Create appropriate attributes on this layer.                    */
+  /* -------------------------------------------------------------------- */
+  item_list = msGMLGetItems( layer, "G" );
+  assert( item_list->numitems == layer->numitems );
 
-      if( !item->visible )
-        continue;
+  for( i = 0; i < layer->numitems; i++ ) {
+    OGRFieldDefnH hFldDefn;
+    OGRErr eErr;
+    const char *name;
+    gmlItemObj *item = item_list->items + i;
+    OGRFieldType eType;
 
-      if( item->alias )
-        name = item->alias;
-      else
-        name = item->name;
-
-      if( item->type == NULL )
-        eType = OFTString;
-      else if( EQUAL(item->type,"Integer") )
-        eType = OFTInteger;
-      else if( EQUAL(item->type,"Long") )
-        eType = OFTInteger64;
-      else if( EQUAL(item->type,"Real") )
-        eType = OFTReal;
-      else if( EQUAL(item->type,"Character") )
-        eType = OFTString;
-      else if( EQUAL(item->type,"Date") )
-        eType = OFTDate;
-      else if( EQUAL(item->type,"Time") )
-        eType = OFTTime;
-      else if( EQUAL(item->type,"DateTime") )
-        eType = OFTDateTime;
-      else if( EQUAL(item->type,"Boolean") )
-        eType = OFTInteger;
-      else
-        eType = OFTString;
+    if( !item->visible )
+      continue;
 
-      hFldDefn = OGR_Fld_Create( name, eType );
+    if( item->alias )
+      name = item->alias;
+    else
+      name = item->name;
+
+    if( item->type == NULL )
+      eType = OFTString;
+    else if( EQUAL(item->type,"Integer") )
+      eType = OFTInteger;
+    else if( EQUAL(item->type,"Long") )
+      eType = OFTInteger64;
+    else if( EQUAL(item->type,"Real") )
+      eType = OFTReal;
+    else if( EQUAL(item->type,"Character") )
+      eType = OFTString;
+    else if( EQUAL(item->type,"Date") )
+      eType = OFTDate;
+    else if( EQUAL(item->type,"Time") )
+      eType = OFTTime;
+    else if( EQUAL(item->type,"DateTime") )
+      eType = OFTDateTime;
+    else if( EQUAL(item->type,"Boolean") )
+      eType = OFTInteger;
+    else
+      eType = OFTString;
 
-      if( item->width != 0 )
-        OGR_Fld_SetWidth( hFldDefn, item->width );
-      if( item->precision != 0 )
-        OGR_Fld_SetPrecision( hFldDefn, item->precision );
+    hFldDefn = OGR_Fld_Create( name, eType );
 
-      eErr = OGR_L_CreateField( hOGRLayer, hFldDefn, TRUE );
-      OGR_Fld_Destroy( hFldDefn );
+    if( item->width != 0 )
+      OGR_Fld_SetWidth( hFldDefn, item->width );
+    if( item->precision != 0 )
+      OGR_Fld_SetPrecision( hFldDefn, item->precision );
 
-      if( eErr != OGRERR_NONE ) {
-        msSetError( MS_OGRERR,
-                    "Failed to create field '%s' in output feature schema:\n%s",
-                    "msOGRWriteFromQuery()",
-                    layer->items[i],
-                    CPLGetLastErrorMsg() );
+    eErr = OGR_L_CreateField( hOGRLayer, hFldDefn, TRUE );
+    OGR_Fld_Destroy( hFldDefn );
 
-        OGR_DS_Destroy( hDS );
-        msOGRCleanupDS( datasource_name );
-        msGMLFreeItems(item_list);
-        CSLDestroy(layer_options);
-        return MS_FAILURE;
-      }
+    if( eErr != OGRERR_NONE ) {
+      msSetError( MS_OGRERR,
+                  "Failed to create field '%s' in output feature schema:\n%s",
+                  "msOGRWriteFromQuery()",
+                  layer->items[i],
+                  CPLGetLastErrorMsg() );
 
-      /* The index of the first field we create is not necessarily 0 */
-      if( nFirstOGRFieldIndex < 0 )
-          nFirstOGRFieldIndex = OGR_FD_GetFieldCount(
-                                        OGR_L_GetLayerDefn( hOGRLayer ) ) - 1;
+      msGMLFreeItems(item_list);
+      return MS_FAILURE;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Setup joins if needed.  This is likely untested.                */
-    /* -------------------------------------------------------------------- */
-    if(layer->numjoins > 0) {
-      int j;
-      for(j=0; j<layer->numjoins; j++) {
-        status = msJoinConnect(layer, &(layer->joins[j]));
-        if(status != MS_SUCCESS) {
-          OGR_DS_Destroy( hDS );
-          msOGRCleanupDS( datasource_name );
-          msGMLFreeItems(item_list);
-          CSLDestroy(layer_options);
-          return status;
-        }
+    /* The index of the first field we create is not necessarily 0 */
+    if( nFirstOGRFieldIndex < 0 )
+        nFirstOGRFieldIndex = OGR_FD_GetFieldCount(
+                                      OGR_L_GetLayerDefn( hOGRLayer ) ) - 1;
+  }
+
+  /* -------------------------------------------------------------------- */
+  /*      Setup joins if needed.  This is likely untested.                */
+  /* -------------------------------------------------------------------- */
+  if(layer->numjoins > 0) {
+    int j;
+    for(j=0; j<layer->numjoins; j++) {
+      status = msJoinConnect(layer, &(layer->joins[j]));
+      if(status != MS_SUCCESS) {
+        msGMLFreeItems(item_list);
+        return status;
       }
     }
+  }
 
-    msInitShape( &resultshape );
+  out->layer = layer;
+  out->hOGRLayer = hOGRLayer;
+  out->item_list = item_list;
+  out->nFirstOGRFieldIndex = nFirstOGRFieldIndex;
+  out->pszFeatureid = pszFeatureid;
+  if( layer->index >= 0 && layer->index < map->numlayers )
+    out->layersWritten[layer->index] = MS_TRUE;
 
-    /* -------------------------------------------------------------------- */
-    /*      Loop over all the shapes in the resultcache.                    */
-    /* -------------------------------------------------------------------- */
-    for(i=0; i < layer->resultcache->numresults; i++) {
+  return MS_SUCCESS;
+}
 
-      msFreeShape(&resultshape); /* init too */
+/************************************************************************/
+/*                          msOGROutputEndLayer()                       */
+/************************************************************************/
 
-      /*
-      ** Read the shape.
-      */
-      if( layer->resultcache->results[i].shape )
-      {
-          /* msDebug("Using cached shape %ld\n", layer->resultcache->results[i].shapeindex); */
-          status = msCopyShape(layer->resultcache->results[i].shape, &resultshape);
-      }
-      else
-      {
-          status = msLayerGetShape(layer, &resultshape, &(layer->resultcache->results[i]));
-      }
-      
-      if(status != MS_SUCCESS) {
-          OGR_DS_Destroy( hDS );
-          msOGRCleanupDS( datasource_name );
-          msGMLFreeItems(item_list);
-          msFreeShape(&resultshape);
-          CSLDestroy(layer_options);
-          return status;
-      }      
+static void msOGROutputEndLayer( msOGROutputObj *out )
 
-      /*
-      ** Perform classification, and some annotation related magic.
-      */
-      resultshape.classindex =
-        msShapeGetClass(layer, map, &resultshape, NULL, -1);
-
-      if( resultshape.classindex >= 0
-          && (layer->_class[resultshape.classindex]->text.string
-              || layer->labelitem)
-          && layer->_class[resultshape.classindex]->numlabels > 0
-          && layer->_class[resultshape.classindex]->labels[0]->size != -1 ) {
-        resultshape.text = msShapeGetLabelAnnotation(layer,&resultshape,layer->_class[resultshape.classindex]->labels[0]);
-      }
+{
+  msGMLFreeItems(out->item_list);
+  out->item_list = NULL;
+  out->hOGRLayer = NULL;
+  out->layer = NULL;
+}
 
-      /*
-      ** prepare any necessary JOINs here (one-to-one only)
-      */
-      if( layer->numjoins > 0) {
-        int j;
-
-        for(j=0; j < layer->numjoins; j++) {
-          if(layer->joins[j].type == MS_JOIN_ONE_TO_ONE) {
-            msJoinPrepare(&(layer->joins[j]), &resultshape);
-            msJoinNext(&(layer->joins[j])); /* fetch the first row */
-          }
-        }
-      }
+/************************************************************************/
+/*                         msOGROutputWriteShape()                      */
+/*                                                                      */
+/*      Write a shape of the current layer. If bProject is set, the     */
+/*      shape is in the layer projection and is reprojected to the map  */
+/*      projection. The shape is modified.                              */
+/************************************************************************/
 
-      if( layer->project ) {
-        if( layer->reprojectorLayerToMap == NULL )
-        {
-            layer->reprojectorLayerToMap = msProjectCreateReprojector(
-                &layer->projection, &layer->map->projection);
-        }
-        if( layer->reprojectorLayerToMap )
-            status = msProjectShapeEx(layer->reprojectorLayerToMap, &resultshape);
-        else
-            status = MS_FAILURE;
-      }
+static int msOGROutputWriteShape( msOGROutputObj *out, shapeObj *shape,
+                                  int bProject )
 
-      /*
-      ** Write out the feature to OGR.
-      */
+{
+  mapObj *map = out->map;
+  layerObj *layer = out->layer;
+  int status = MS_SUCCESS;
+
+  /*
+  ** Perform classification, and some annotation related magic.
+  */
+  shape->classindex =
+    msShapeGetClass(layer, map, shape, NULL, -1);
+
+  if( shape->classindex >= 0
+      && (layer->_class[shape->classindex]->text.string
+          || layer->labelitem)
+      && layer->_class[shape->classindex]->numlabels > 0
+      && layer->_class[shape->classindex]->labels[0]->size != -1 ) {
+    msFree(shape->text);
+    shape->text = msShapeGetLabelAnnotation(layer,shape,layer->_class[shape->classindex]->labels[0]);
+  }
 
-      if( status == MS_SUCCESS )
-        status = msOGRWriteShape( layer, hOGRLayer, &resultshape,
-                                  item_list, nFirstOGRFieldIndex, pszFeatureid );
+  /*
+  ** prepare any necessary JOINs here (one-to-one only)
+  */
+  if( layer->numjoins > 0) {
+    int j;
 
-      if(status != MS_SUCCESS) {
-        OGR_DS_Destroy( hDS );
-        msOGRCleanupDS( datasource_name );
-        msGMLFreeItems(item_list);
-        msFreeShape(&resultshape);
-        CSLDestroy(layer_options);
-        return status;
+    for(j=0; j < layer->numjoins; j++) {
+      if(layer->joins[j].type == MS_JOIN_ONE_TO_ONE) {
+        msJoinPrepare(&(layer->joins[j]), shape);
+        msJoinNext(&(layer->joins[j])); /* fetch the first row */
       }
     }
+  }
 
-    msGMLFreeItems(item_list);
-    msFreeShape(&resultshape); /* init too */
+  if( bProject && layer->project ) {
+    if( layer->reprojectorLayerToMap == NULL )
+    {
+        layer->reprojectorLayerToMap = msProjectCreateReprojector(
+            &layer->projection, &layer->map->projection);
+    }
+    if( layer->reprojectorLayerToMap )
+        status = msProjectShapeEx(layer->reprojectorLayerToMap, shape);
+    else
+        status = MS_FAILURE;
   }
 
+  /*
+  ** Write out the feature to OGR.
+  */
+
+  if( status == MS_SUCCESS )
+    status = msOGRWriteShape( layer, out->hOGRLayer, shape,
+                              out->item_list, out->nFirstOGRFieldIndex,
+                              out->pszFeatureid );
+
+  return status;
+}
+
+/************************************************************************/
+/*                           msOGROutputFinish()                        */
+/*                                                                      */
+/*      Close the datasource and send the result if it was not          */
+/*      streamed.                                                       */
+/************************************************************************/
+
+static int msOGROutputFinish( msOGROutputObj *out )
+
+{
+  mapObj *map = out->map;
+  outputFormatObj *format = out->format;
+  int sendheaders = out->sendheaders;
+  const char *storage = out->storage;
+  const char *form = out->form;
+  const char *fo_filename = out->fo_filename;
+  const char *datasource_name = out->datasource_name;
+  int bDataSourceNameIsRequestDir = out->bDataSourceNameIsRequestDir;
+  char **file_list = NULL;
+  int i;
+
   /* -------------------------------------------------------------------- */
   /*      Close the datasource.                                           */
   /* -------------------------------------------------------------------- */
-  OGR_DS_Destroy( hDS );
-
-  CSLDestroy( layer_options );
+  OGR_DS_Destroy( out->hDS );
+  out->hDS = NULL;
 
   /* -------------------------------------------------------------------- */
   /*      Get list of resulting files.                                    */
@@ -1389,6 +1453,203 @@ int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
   return MS_SUCCESS;
 }
 
+static void msOGROutputFree( msOGROutputObj *out )
+
+{
+  if( out->layer )
+    msOGROutputEndLayer( out );
+  CSLDestroy( out->layer_options );
+  msFree( out->layersWritten );
+  msFree( out );
+}
+
+static int msOGROutputClose( msOGROutputObj *out )
+
+{
+  int status;
+
+  if( out->layer )
+    msOGROutputEndLayer( out );
+  status = msOGROutputFinish( out );
+  msOGROutputFree( out );
+  return status;
+}
+
+/************************************************************************/
+/*                           msOGROutputAbort()                         */
+/*                                                                      */
+/*      Drop a datasource that could not be written completely.         */
+/************************************************************************/
+
+static void msOGROutputAbort( msOGROutputObj *out )
+
+{
+  if( out->layer )
+    msOGROutputEndLayer( out );
+  OGR_DS_Destroy( out->hDS );
+  msOGRCleanupDS( out->datasource_name );
+  msOGROutputFree( out );
+}
+
+/************************************************************************/
+/*                        msOGRWriteFromQuery()                         */
+/************************************************************************/
+
+int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format, int sendheaders )
+
+{
+  msOGROutputObj *out;
+  int iLayer, i;
+
+  out = msOGROutputOpen( map, format, sendheaders );
+  if( out == NULL )
+    return MS_FAILURE;
+
+  /* ==================================================================== */
+  /*      Process each layer with a resultset.                            */
+  /* ==================================================================== */
+  for( iLayer = 0; iLayer < map->numlayers; iLayer++ ) {
+    int status;
+    layerObj *layer = GET_LAYER(map, iLayer);
+    shapeObj resultshape;
+
+    if( !layer->resultcache )
+      continue;
+
+    status = msOGROutputStartLayer( out, layer );
+    if( status != MS_SUCCESS ) {
+      msOGROutputAbort( out );
+      return status;
+    }
+
+    msInitShape( &resultshape );
+
+    /* -------------------------------------------------------------------- */
+    /*      Loop over all the shapes in the resultcache.                    */
+    /* -------------------------------------------------------------------- */
+    for(i=0; i < layer->resultcache->numresults; i++) {
+
+      msFreeShape(&resultshape); /* init too */
+
+      /*
+      ** Read the shape.
+      */
+      if( layer->resultcache->results[i].shape )
+      {
+          /* msDebug("Using cached shape %ld\n", layer->resultcache->results[i].shapeindex); */
+          status = msCopyShape(layer->resultcache->results[i].shape, &resultshape);
+      }
+      else
+      {
+          status = msLayerGetShape(layer, &resultshape, &(layer->resultcache->results[i]));
+      }
+
+      if( status == MS_SUCCESS )
+        status = msOGROutputWriteShape( out, &resultshape, MS_TRUE );
+
+      if(status != MS_SUCCESS) {
+        msFreeShape(&resultshape);
+        msOGROutputAbort( out );
+        return status;
+      }
+    }
+
+    msFreeShape(&resultshape); /* init too */
+    msOGROutputEndLayer( out );
+  }
+
+  return msOGROutputClose( out );
+}
+
+/************************************************************************/
+/*                        msOGRStartQueryStream()                       */
+/*                                                                      */
+/*      Streaming counterpart of msOGRWriteFromQuery(): the query is    */
+/*      run with msOGRWriteQueryStreamShape() as the shape callback     */
+/*      (see queryObj.shape_callback) and each matching shape is        */
+/*      written as it is read, without going through the result cache.  */
+/************************************************************************/
+
+msOGROutputObj *msOGRStartQueryStream( mapObj *map, outputFormatObj *format,
+                                       int sendheaders )
+
+{
+  return msOGROutputOpen( map, format, sendheaders );
+}
+
+/************************************************************************/
+/*                      msOGRWriteQueryStreamShape()                    */
+/*                                                                      */
+/*      Shape callback, the shape is already in the map projection.     */
+/************************************************************************/
+
+int msOGRWriteQueryStreamShape( void *user_data, layerObj *layer,
+                                shapeObj *shape )
+
+{
+  msOGROutputObj *out = (msOGROutputObj *) user_data;
+
+  if( out->status != MS_SUCCESS )
+    return MS_FAILURE;
+
+  if( out->layer != layer ) {
+    if( out->layer )
+      msOGROutputEndLayer( out );
+    if( msOGROutputStartLayer( out, layer ) != MS_SUCCESS ) {
+      out->status = MS_FAILURE;
+      return MS_FAILURE;
+    }
+  }
+
+  out->status = msOGROutputWriteShape( out, shape, MS_FALSE );
+  return out->status;
+}
+
+/************************************************************************/
+/*                         msOGREndQueryStream()                        */
+/*                                                                      */
+/*      Complete the output once the query is done. Queried layers     */
+/*      without any feature still get their (empty) layer, as with     */
+/*      msOGRWriteFromQuery(). If bAbort is set, or if writing failed,  */
+/*      the output is dropped and MS_FAILURE is returned.               */
+/************************************************************************/
+
+int msOGREndQueryStream( msOGROutputObj *out, int bAbort )
+
+{
+  mapObj *map;
+  int iLayer;
+
+  if( out == NULL )
+    return MS_FAILURE;
+
+  if( bAbort || out->status != MS_SUCCESS ) {
+    msOGROutputAbort( out );
+    return MS_FAILURE;
+  }
+
+  if( out->layer )
+    msOGROutputEndLayer( out );
+
+  map = out->map;
+  for( iLayer = 0; iLayer < map->numlayers; iLayer++ ) {
+    layerObj *layer = GET_LAYER(map, iLayer);
+    int status;
+
+    if( !layer->resultcache || out->layersWritten[iLayer] )
+      continue;
+
+    status = msOGROutputStartLayer( out, layer );
+    if( status != MS_SUCCESS ) {
+      msOGROutputAbort( out );
+      return status;
+    }
+    msOGROutputEndLayer( out );
+  }
+
+  return msOGROutputClose( out );
+}
+
 /************************************************************************/
 /*                     msPopulateRenderVTableOGR()                      */
 /************************************************************************/
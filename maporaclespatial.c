@@ -1772,6 +1772,7 @@ int msOracleSpatialLayerOpen( layerObj *layer )
     hand = msOCISetHandlers( username, password, dblink );
 
     if (hand == NULL) {
+      msConnPoolCancel( layer );
       msOCICloseDataHandlers( dthand );
       msOCIFinishStatement( sthand );
       msOCIFinishStatement( sthand2 );
@@ -126,6 +126,13 @@ struct defaultOutputFormatEntry defaultoutputformats[] = {
   {NULL,NULL,NULL}
 };
 
+/* Formats only created when selected by name or mime type, and thus not */
+/* advertised in capabilities unless declared in the mapfile.            */
+static struct defaultOutputFormatEntry ondemandoutputformats[] = {
+  {"COG","GDAL/COG","image/tiff; application=geotiff; profile=cloud-optimized"},
+  {NULL,NULL,NULL}
+};
+
 /************************************************************************/
 /*                  msPostMapParseOutputFormatSetup()                   */
 /************************************************************************/
@@ -615,6 +622,12 @@ outputFormatObj *msSelectOutputFormat( mapObj *map,
       formatEntry++;
     }
 
+    for( formatEntry = ondemandoutputformats;
+         format == NULL && formatEntry->name; formatEntry++ ) {
+      if(!strcasecmp(imagetype,formatEntry->name) || !strcasecmp(imagetype,formatEntry->mimetype))
+        format = msCreateDefaultOutputFormat( map, formatEntry->driver, formatEntry->name );
+    }
+
   }
 
   if (format) {
@@ -1096,7 +1109,13 @@ int msInitializeRendererVTable(outputFormatObj *format)
 
   switch(format->renderer) {
     case MS_RENDER_WITH_AGG:
-      return msPopulateRendererVTableAGG(format->vtable);
+      if(msPopulateRendererVTableAGG(format->vtable) != MS_SUCCESS)
+        return MS_FAILURE;
+      /* with MARKER_CACHE=ON, unrotated vector and ellipse markers are rendered
+       * once per style and blitted on the nearest pixel, see msDrawMarkerSymbol() */
+      format->vtable->use_imagecache =
+        strcasecmp(msGetOutputFormatOption(format, "MARKER_CACHE", "OFF"), "ON") == 0;
+      return MS_SUCCESS;
     case MS_RENDER_WITH_UTFGRID:
       return msPopulateRendererVTableUTFGrid(format->vtable);
 #ifdef USE_PBF
@@ -438,6 +438,15 @@ void msGMLWriteWFSBounds(mapObj *map, FILE *stream, const char *tab,
 MS_DLL_EXPORT int msGMLWriteWFSQuery(mapObj *map, FILE *stream, const char *wfs_namespace,
                                      OWSGMLVersion outputformat, int nWFSVersion, int bUseURN,
                                      int bGetPropertyValueRequest);
+
+typedef struct gmlWFSQueryStreamObj gmlWFSQueryStreamObj;
+gmlWFSQueryStreamObj *msGMLStartWFSQueryStream(mapObj *map, FILE *stream,
+                                              const char *wfs_namespace,
+                                              OWSGMLVersion outputformat,
+                                              int nWFSVersion, int bUseURN,
+                                              int bKnownBounds);
+int msGMLWriteWFSQueryStreamShape(void *user_data, layerObj *lp, shapeObj *shape);
+int msGMLEndWFSQueryStream(gmlWFSQueryStreamObj *wfsstream);
 #endif
 
 
@@ -3019,7 +3019,7 @@ int yylex(YYSTYPE *lvalp, parseObj *p)
     else
     {
       token = NUMBER;
-      (*lvalp).dblval = atof(p->shape->values[p->expr->curtoken->tokenval.bindval.index]);
+      (*lvalp).dblval = msShapeGetValueAsDouble(p->shape, p->expr->curtoken->tokenval.bindval.index);
     }
     break;
   case MS_TOKEN_BINDING_STRING:
@@ -129,12 +129,42 @@ o The connection pooling API will let a connection be used/referenced multiple
   between different threads concurrently.  But if a connection is released
   by one thread, it is available for use by another thread.
 
+o Connections are kept in a hash table keyed by connection type and
+  (case insensitive) connection string.  The buckets are spread over
+  TLOCK_POOL_SHARD_COUNT mutexes, so that layers using different
+  connections do not contend for a single pool lock.
+
+o The following PROCESSING options of a layer control the connections
+  pooled for its connection type and string:
+
+    CONNECTION_POOL_MAX=n : at most n connections are opened.  Once
+      reached, a request waits for another thread to release one.  A
+      request that is told to open a new connection holds a slot till it
+      registers the connection, or gives the slot back with
+      msConnPoolCancel() if opening failed.  A request made with
+      MS_POOL_NO_WAIT returns MS_DONE instead of waiting, and
+      msConnPoolIdleAvailable() tells whether an idle connection, or
+      room for a new one, is there without waiting.
+    CONNECTION_POOL_MIN=n : up to n idle connections are kept open when
+      released, even with CLOSE_CONNECTION=NORMAL.
+    CONNECTION_POOL_WAIT=s : how long, in seconds, a request waits for a
+      connection when CONNECTION_POOL_MAX is reached (default 5).  After
+      that msConnPoolAcquire() fails.  msConnPoolRequest() returns NULL
+      in that case, and a connection then opened by the driver is closed
+      as soon as it is released, instead of being pooled.
+
+o A driver may register its connections with msConnPoolRegisterEx() and
+  a check callback, called before an idle connection is handed out.  A
+  connection failing the check is closed and another one is looked for.
+
+o msConnPoolGetStats() reports the number of pooled connections, as well
+  as the request, hit, miss and wait counts since startup.
+
  ****************************************************************************/
 
 #include "mapserver.h"
 #include "mapthread.h"
-
-
+#include "maptime.h"
 
 /* defines for lifetime.
    A positive number is a time-from-last use in seconds */
@@ -143,10 +173,13 @@ o The connection pooling API will let a connection be used/referenced multiple
 #define MS_LIFE_ZEROREF       -2
 #define MS_LIFE_SINGLE        -3
 
-typedef struct {
-  enum MS_CONNECTION_TYPE connectiontype;
-  char *connection;
+/* number of hash buckets, a multiple of TLOCK_POOL_SHARD_COUNT */
+#define MS_POOL_BUCKETS       64
+
+/* default CONNECTION_POOL_WAIT, in milliseconds */
+#define MS_POOL_DEFAULT_WAIT  5000
 
+typedef struct connectionObj {
   int   lifespan;
   int   ref_count;
   void*   thread_id;
@@ -157,29 +190,164 @@ typedef struct {
   void  *conn_handle;
 
   void  (*close)( void * );
+  int   (*check)( void * );
+
+  struct connectionObj *next;
 } connectionObj;
 
 /*
-** These static structures are protected by the TLOCK_POOL mutex.
+** A connection with a NULL conn_handle is a slot reserved by
+** msConnPoolAcquire() for a connection its thread is opening.
 */
+#define MS_POOL_IS_RESERVATION(conn)  ((conn)->conn_handle == NULL)
 
-static int connectionCount = 0;
-static int connectionMax = 0;
-static connectionObj *connections = NULL;
+/*
+** All the connections sharing a connection type and string.
+*/
+typedef struct connectionKeyObj {
+  enum MS_CONNECTION_TYPE connectiontype;
+  char *connection;
+  unsigned int hash;
+
+  int   count;
+  int   max_count;
+  int   min_idle;
+
+  connectionObj *connections;
+
+  struct connectionKeyObj *next;
+} connectionKeyObj;
+
+/*
+** The buckets, and the statistics of a shard, are protected by the
+** TLOCK_POOL_SHARD + (bucket % TLOCK_POOL_SHARD_COUNT) mutex.
+*/
+
+static connectionKeyObj *connectionBuckets[MS_POOL_BUCKETS];
+static connPoolStatsObj shardStats[TLOCK_POOL_SHARD_COUNT];
 
 /************************************************************************/
-/*                         msConnPoolRegister()                         */
+/*                          msConnPoolHash()                            */
+/************************************************************************/
+
+static unsigned int msConnPoolHash( enum MS_CONNECTION_TYPE connectiontype,
+                                    const char *connection )
+
+{
+  unsigned int hash = 2166136261U ^ (unsigned int) connectiontype;
+
+  /* FNV-1a, case insensitive as connection strings are compared so */
+  for( ; *connection != '\0'; connection++ ) {
+    hash ^= (unsigned char) tolower( (unsigned char) *connection );
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+#define MS_POOL_BUCKET(hash)    ((hash) % MS_POOL_BUCKETS)
+#define MS_POOL_SHARD(bucket)   ((bucket) % TLOCK_POOL_SHARD_COUNT)
+#define MS_POOL_LOCK(bucket)    (TLOCK_POOL_SHARD + MS_POOL_SHARD(bucket))
+
+/************************************************************************/
+/*                         msConnPoolFindKey()                          */
+/*                                                                      */
+/*      Find the connections of the layer in the bucket, optionally     */
+/*      creating the entry.  The shard lock must be held.               */
+/************************************************************************/
+
+static connectionKeyObj *msConnPoolFindKey( layerObj *layer,
+                                            unsigned int hash,
+                                            int bCreate )
+
+{
+  connectionKeyObj **bucket = connectionBuckets + MS_POOL_BUCKET(hash);
+  connectionKeyObj *key;
+
+  for( key = *bucket; key != NULL; key = key->next ) {
+    if( key->hash == hash
+        && key->connectiontype == layer->connectiontype
+        && strcasecmp( key->connection, layer->connection ) == 0 )
+      return key;
+  }
+
+  if( !bCreate )
+    return NULL;
+
+  key = (connectionKeyObj *) calloc( 1, sizeof(connectionKeyObj) );
+  if( key == NULL ) {
+    msSetError(MS_MEMERR, NULL, "msConnPoolFindKey()");
+    return NULL;
+  }
+  key->connectiontype = layer->connectiontype;
+  key->connection = msStrdup( layer->connection );
+  key->hash = hash;
+  key->next = *bucket;
+  *bucket = key;
+
+  return key;
+}
+
+/************************************************************************/
+/*                       msConnPoolGetSettings()                        */
+/*                                                                      */
+/*      Apply the CONNECTION_POOL_* processing options of the layer     */
+/*      to the connection entry, if any, and return the wait timeout.   */
+/************************************************************************/
+
+static int msConnPoolGetSettings( layerObj *layer, connectionKeyObj *key )
+
+{
+  const char *value;
+  int wait_ms = MS_POOL_DEFAULT_WAIT;
+
+  if( key != NULL ) {
+    if( (value = msLayerGetProcessingKey( layer, "CONNECTION_POOL_MAX" )) != NULL )
+      key->max_count = MS_MAX( 0, atoi(value) );
+    if( (value = msLayerGetProcessingKey( layer, "CONNECTION_POOL_MIN" )) != NULL )
+      key->min_idle = MS_MAX( 0, atoi(value) );
+  }
+  if( (value = msLayerGetProcessingKey( layer, "CONNECTION_POOL_WAIT" )) != NULL )
+    wait_ms = (int) MS_MAX( 0, atof(value) * 1000 );
+
+  return wait_ms;
+}
+
+/************************************************************************/
+/*                         msConnPoolElapsed()                          */
+/*                                                                      */
+/*      Milliseconds elapsed since the given time.                      */
+/************************************************************************/
+
+static int msConnPoolElapsed( struct mstimeval *start )
+
+{
+  struct mstimeval now;
+
+  msGettimeofday( &now, NULL );
+  return (int) ((now.tv_sec - start->tv_sec) * 1000
+                + (now.tv_usec - start->tv_usec) / 1000);
+}
+
+/************************************************************************/
+/*                        msConnPoolRegisterEx()                        */
 /*                                                                      */
 /*      Register a new connection with the connection pool tracker.     */
+/*      If provided, check_func() is called before handing out an       */
+/*      idle connection and returns MS_FALSE if it is no longer         */
+/*      usable.                                                         */
 /************************************************************************/
 
-void msConnPoolRegister( layerObj *layer,
-                         void *conn_handle,
-                         void (*close_func)( void * ) )
+void msConnPoolRegisterEx( layerObj *layer,
+                           void *conn_handle,
+                           void (*close_func)( void * ),
+                           int (*check_func)( void * ) )
 
 {
   const char *close_connection = NULL;
-  connectionObj *conn = NULL;
+  connectionKeyObj *key = NULL;
+  connectionObj *conn = NULL, *reservation;
+  unsigned int hash, bucket;
 
   if( layer->debug )
     msDebug( "msConnPoolRegister(%s,%s,%p)\n",
@@ -206,33 +374,17 @@ void msConnPoolRegister( layerObj *layer,
     return;
   }
 
-  /* -------------------------------------------------------------------- */
-  /*      Grow the array of connection information objects if needed.     */
-  /* -------------------------------------------------------------------- */
-  msAcquireLock( TLOCK_POOL );
-
-  if( connectionCount == connectionMax ) {
-    connectionMax += 10;
-    connections = (connectionObj *)
-                  realloc(connections,
-                          sizeof(connectionObj) * connectionMax );
-    if( connections == NULL ) {
-      msSetError(MS_MEMERR, NULL, "msConnPoolRegister()");
-      msReleaseLock( TLOCK_POOL );
-      return;
-    }
+  conn = (connectionObj *) calloc( 1, sizeof(connectionObj) );
+  if( conn == NULL ) {
+    msSetError(MS_MEMERR, NULL, "msConnPoolRegister()");
+    return;
   }
 
   /* -------------------------------------------------------------------- */
   /*      Set the new connection information.                             */
   /* -------------------------------------------------------------------- */
-  conn = connections + connectionCount;
-
-  connectionCount++;
-
-  conn->connectiontype = layer->connectiontype;
-  conn->connection = msStrdup( layer->connection );
   conn->close = close_func;
+  conn->check = check_func;
   conn->ref_count = 1;
   conn->thread_id = msGetThreadId();
   conn->last_used = time(NULL);
@@ -265,91 +417,198 @@ void msConnPoolRegister( layerObj *layer,
     conn->lifespan = MS_LIFE_ZEROREF;
   }
 
-  msReleaseLock( TLOCK_POOL );
+  /* -------------------------------------------------------------------- */
+  /*      Add it to the connections of its type and string.               */
+  /* -------------------------------------------------------------------- */
+  hash = msConnPoolHash( layer->connectiontype, layer->connection );
+  bucket = MS_POOL_BUCKET(hash);
+
+  msAcquireLock( MS_POOL_LOCK(bucket) );
+
+  key = msConnPoolFindKey( layer, hash, MS_TRUE );
+  if( key == NULL ) {
+    msReleaseLock( MS_POOL_LOCK(bucket) );
+    free( conn );
+    return;
+  }
+  msConnPoolGetSettings( layer, key );
+
+  /* the slot reserved by msConnPoolAcquire() in this thread, if any */
+  for( reservation = key->connections; reservation != NULL;
+       reservation = reservation->next ) {
+    if( MS_POOL_IS_RESERVATION(reservation)
+        && reservation->thread_id == conn->thread_id )
+      break;
+  }
+
+  if( reservation != NULL ) {
+    conn->next = reservation->next;
+    *reservation = *conn;
+    free( conn );
+  } else {
+    /* opened while the pool was full, don't keep it */
+    if( key->max_count > 0 && key->count >= key->max_count ) {
+      if( layer->debug )
+        msDebug( "msConnPoolRegister(%s,%s): over CONNECTION_POOL_MAX, "
+                 "%p will not be pooled.\n",
+                 layer->name, layer->connection, conn_handle );
+      conn->lifespan = MS_LIFE_SINGLE;
+    }
+
+    conn->next = key->connections;
+    key->connections = conn;
+    key->count++;
+  }
+
+  msReleaseLock( MS_POOL_LOCK(bucket) );
+}
+
+/************************************************************************/
+/*                         msConnPoolRegister()                         */
+/************************************************************************/
+
+void msConnPoolRegister( layerObj *layer,
+                         void *conn_handle,
+                         void (*close_func)( void * ) )
+
+{
+  msConnPoolRegisterEx( layer, conn_handle, close_func, NULL );
 }
 
 /************************************************************************/
 /*                          msConnPoolClose()                           */
 /*                                                                      */
-/*      Close the indicated connection.  The index in the connection    */
-/*      table is passed.  Remove the connection from the table as       */
-/*      well.                                                           */
+/*      Close the indicated connection and remove it from the table,    */
+/*      freeing the connection entry once empty.  The shard lock of     */
+/*      the bucket must be held.                                        */
 /************************************************************************/
 
-static void msConnPoolClose( int conn_index )
+static void msConnPoolClose( connectionKeyObj *key, connectionObj *conn )
 
 {
-  connectionObj *conn = connections + conn_index;
+  connectionObj **pconn;
 
   if( conn->ref_count > 0 ) {
     if( conn->debug )
       msDebug( "msConnPoolClose(): "
                "Closing connection %s even though ref_count=%d.\n",
-               conn->connection, conn->ref_count );
+               key->connection, conn->ref_count );
 
     msSetError( MS_MISCERR,
                 "Closing connection %s even though ref_count=%d.",
                 "msConnPoolClose()",
-                conn->connection,
+                key->connection,
                 conn->ref_count );
   }
 
   if( conn->debug )
     msDebug( "msConnPoolClose(%s,%p)\n",
-             conn->connection, conn->conn_handle );
+             key->connection, conn->conn_handle );
 
   if( conn->close != NULL )
     conn->close( conn->conn_handle );
 
-  /* free malloced() stuff in this connection */
-  free( conn->connection );
-
-  connectionCount--;
-  if( connectionCount == 0 ) {
-    /* if there are no connections left we will "cleanup".  */
-    connectionMax = 0;
-    free( connections );
-    connections = NULL;
-  } else {
-    /* move the last connection in place of our now closed one */
-    memcpy( connections + conn_index,
-            connections + connectionCount,
-            sizeof(connectionObj) );
+  for( pconn = &key->connections; *pconn != conn; pconn = &(*pconn)->next )
+    ;
+  *pconn = conn->next;
+  free( conn );
+  key->count--;
+
+  /* if there are no connections left we will "cleanup".  */
+  if( key->count == 0 ) {
+    connectionKeyObj **pkey = connectionBuckets + MS_POOL_BUCKET(key->hash);
+
+    for( ; *pkey != key; pkey = &(*pkey)->next )
+      ;
+    *pkey = key->next;
+    free( key->connection );
+    free( key );
   }
 }
 
 /************************************************************************/
-/*                         msConnPoolRequest()                          */
+/*                         msConnPoolAcquire()                          */
 /*                                                                      */
-/*      Ask for a connection from the connection pool for use with      */
-/*      the current layer.  If found (CONNECTION and CONNECTIONTYPE     */
-/*      match) then return it and up the ref count.  Otherwise          */
-/*      return NULL.                                                    */
+/*      Find a connection for the layer.  With MS_POOL_IDLE_ONLY, only  */
+/*      connections not referenced at all are considered, including     */
+/*      by the current thread.                                          */
+/*                                                                      */
+/*      On success *conn_handle is the pooled connection, or NULL if    */
+/*      the caller has to open a new one and register it.  With         */
+/*      CONNECTION_POOL_MAX a slot is then reserved for it, see         */
+/*      msConnPoolCancel().  MS_FAILURE is returned if all the          */
+/*      connections stay in use for CONNECTION_POOL_WAIT, or MS_DONE    */
+/*      right away with MS_POOL_NO_WAIT, without setting an error.      */
 /************************************************************************/
 
-void *msConnPoolRequest( layerObj *layer )
+int msConnPoolAcquire( layerObj *layer, int nFlags, void **conn_handle )
 
 {
-  int  i;
-  const char* close_connection;
+  const int bIdleOnly = (nFlags & MS_POOL_IDLE_ONLY) != 0;
+  const char* close_connection, *max_connections;
+  unsigned int hash, bucket;
+  connPoolStatsObj *stats;
+  struct mstimeval wait_start;
+  int bWaiting = MS_FALSE, bTimedOut = MS_FALSE, bLimited;
+
+  *conn_handle = NULL;
 
   if( layer->connection == NULL )
-    return NULL;
+    return MS_SUCCESS;
 
   /* check if we must always create a new connection */
   close_connection = msLayerGetProcessingKey( layer, "CLOSE_CONNECTION" );
   if( close_connection && strcasecmp(close_connection,"ALWAYS") == 0 )
-    return NULL;
-
-  msAcquireLock( TLOCK_POOL );
-  for( i = 0; i < connectionCount; i++ ) {
-    connectionObj *conn = connections + i;
+    return MS_SUCCESS;
+
+  /* the entry must exist to hold a reservation */
+  max_connections = msLayerGetProcessingKey( layer, "CONNECTION_POOL_MAX" );
+  bLimited = max_connections != NULL && atoi(max_connections) > 0;
+
+  hash = msConnPoolHash( layer->connectiontype, layer->connection );
+  bucket = MS_POOL_BUCKET(hash);
+  stats = shardStats + MS_POOL_SHARD(bucket);
+
+  msAcquireLock( MS_POOL_LOCK(bucket) );
+  stats->requests++;
+
+  while( MS_TRUE ) {
+    connectionKeyObj *key = msConnPoolFindKey( layer, hash, bLimited );
+    connectionObj *conn;
+    int wait_ms, remaining_ms, bDropped = MS_FALSE;
+
+    if( key == NULL )
+      break;
+
+    wait_ms = msConnPoolGetSettings( layer, key );
+
+    for( conn = key->connections; conn != NULL; conn = conn->next ) {
+      if( MS_POOL_IS_RESERVATION(conn) ) {
+        /* left over by a previous attempt of this thread, reuse it */
+        if( conn->thread_id == msGetThreadId() ) {
+          stats->misses++;
+          msReleaseLock( MS_POOL_LOCK(bucket) );
+          return MS_SUCCESS;
+        }
+        continue;
+      }
 
-    if( layer->connectiontype == conn->connectiontype
-        && strcasecmp( layer->connection, conn->connection ) == 0
-        && (conn->ref_count == 0 || conn->thread_id == msGetThreadId())
-        && conn->lifespan != MS_LIFE_SINGLE) {
-      void *conn_handle = NULL;
+      if( conn->lifespan == MS_LIFE_SINGLE
+          || !(conn->ref_count == 0
+               || (!bIdleOnly && conn->thread_id == msGetThreadId())) )
+        continue;
+
+      /* make sure an idle connection is still usable */
+      if( conn->ref_count == 0 && conn->check != NULL
+          && !conn->check( conn->conn_handle ) ) {
+        if( conn->debug )
+          msDebug( "msConnPoolRequest(%s,%s): dropping unusable %p\n",
+                   layer->name, layer->connection, conn->conn_handle );
+        stats->unhealthy++;
+        msConnPoolClose( key, conn );
+        bDropped = MS_TRUE;
+        break;
+      }
 
       conn->ref_count++;
       conn->thread_id = msGetThreadId();
@@ -361,16 +620,190 @@ void *msConnPoolRequest( layerObj *layer )
         conn->debug = layer->debug;
       }
 
-      conn_handle = conn->conn_handle;
+      *conn_handle = conn->conn_handle;
+      stats->hits++;
+
+      msReleaseLock( MS_POOL_LOCK(bucket) );
+      return MS_SUCCESS;
+    }
+
+    /* an unusable connection was dropped, look again */
+    if( bDropped )
+      continue;
+
+    if( key->max_count == 0 )
+      break;
+
+    /* reserve a slot for the connection the caller will open */
+    if( key->count < key->max_count ) {
+      conn = (connectionObj *) calloc( 1, sizeof(connectionObj) );
+      if( conn == NULL ) {
+        msReleaseLock( MS_POOL_LOCK(bucket) );
+        msSetError(MS_MEMERR, NULL, "msConnPoolRequest()");
+        return MS_FAILURE;
+      }
+      conn->lifespan = MS_LIFE_ZEROREF;
+      conn->ref_count = 1;
+      conn->thread_id = msGetThreadId();
+      conn->last_used = time(NULL);
+      conn->debug = layer->debug;
+      conn->next = key->connections;
+      key->connections = conn;
+      key->count++;
+      break;
+    }
+
+    /* at CONNECTION_POOL_MAX, wait for another thread to release one */
+    if( nFlags & MS_POOL_NO_WAIT ) {
+      msReleaseLock( MS_POOL_LOCK(bucket) );
+      return MS_DONE;
+    }
+    if( !bWaiting ) {
+      bWaiting = MS_TRUE;
+      msGettimeofday( &wait_start, NULL );
+      stats->waits++;
+    }
+    remaining_ms = wait_ms - msConnPoolElapsed( &wait_start );
+    if( remaining_ms <= 0 || bTimedOut ) {
+      int max_count = key->max_count;
+
+      stats->wait_timeouts++;
+      msReleaseLock( MS_POOL_LOCK(bucket) );
 
-      msReleaseLock( TLOCK_POOL );
-      return conn_handle;
+      if( layer->debug )
+        msDebug( "msConnPoolRequest(%s,%s): no connection released "
+                 "after %d ms.\n", layer->name, layer->connection, wait_ms );
+      msSetError( MS_MISCERR,
+                  "All %d connections of layer %s are in use.",
+                  "msConnPoolRequest()", max_count, layer->name );
+      return MS_FAILURE;
     }
+
+    /* look once more after a timeout, then give up */
+    if( !msWaitLock( MS_POOL_LOCK(bucket), remaining_ms ) )
+      bTimedOut = MS_TRUE;
   }
 
-  msReleaseLock( TLOCK_POOL );
+  stats->misses++;
+  msReleaseLock( MS_POOL_LOCK(bucket) );
+
+  return MS_SUCCESS;
+}
+
+/************************************************************************/
+/*                         msConnPoolRequest()                          */
+/*                                                                      */
+/*      Ask for a connection from the connection pool for use with      */
+/*      the current layer.  If found (CONNECTION and CONNECTIONTYPE     */
+/*      match) then return it and up the ref count.  Otherwise          */
+/*      return NULL.                                                    */
+/************************************************************************/
+
+void *msConnPoolRequest( layerObj *layer )
+
+{
+  void *conn_handle;
+
+  msConnPoolAcquire( layer, 0, &conn_handle );
+  return conn_handle;
+}
+
+/************************************************************************/
+/*                       msConnPoolRequestIdle()                        */
+/*                                                                      */
+/*      Like msConnPoolRequest(), but never returns a connection        */
+/*      already in use by the current thread.  This is for drivers      */
+/*      that need a connection of their own, for instance to keep       */
+/*      an asynchronous query running on it.                            */
+/************************************************************************/
+
+void *msConnPoolRequestIdle( layerObj *layer )
 
-  return NULL;
+{
+  void *conn_handle;
+
+  msConnPoolAcquire( layer, MS_POOL_IDLE_ONLY, &conn_handle );
+  return conn_handle;
+}
+
+/************************************************************************/
+/*                      msConnPoolIdleAvailable()                       */
+/*                                                                      */
+/*      Whether msConnPoolAcquire() with MS_POOL_IDLE_ONLY would now    */
+/*      find a connection for the layer without waiting: an idle one,   */
+/*      or room below CONNECTION_POOL_MAX to open another one.          */
+/************************************************************************/
+
+int msConnPoolIdleAvailable( layerObj *layer )
+
+{
+  unsigned int hash, bucket;
+  connectionKeyObj *key;
+  int bAvailable = MS_TRUE;
+
+  if( layer->connection == NULL )
+    return MS_TRUE;
+
+  hash = msConnPoolHash( layer->connectiontype, layer->connection );
+  bucket = MS_POOL_BUCKET(hash);
+
+  msAcquireLock( MS_POOL_LOCK(bucket) );
+  key = msConnPoolFindKey( layer, hash, MS_FALSE );
+  if( key != NULL ) {
+    connectionObj *conn;
+
+    msConnPoolGetSettings( layer, key );
+    if( key->max_count > 0 && key->count >= key->max_count ) {
+      bAvailable = MS_FALSE;
+      for( conn = key->connections; conn != NULL; conn = conn->next ) {
+        if( !MS_POOL_IS_RESERVATION(conn) && conn->ref_count == 0
+            && conn->lifespan != MS_LIFE_SINGLE ) {
+          bAvailable = MS_TRUE;
+          break;
+        }
+      }
+    }
+  }
+  msReleaseLock( MS_POOL_LOCK(bucket) );
+
+  return bAvailable;
+}
+
+/************************************************************************/
+/*                          msConnPoolCancel()                          */
+/*                                                                      */
+/*      Give back the slot reserved by msConnPoolAcquire() when the     */
+/*      driver could not open the connection.                           */
+/************************************************************************/
+
+void msConnPoolCancel( layerObj *layer )
+
+{
+  unsigned int hash, bucket;
+  connectionKeyObj *key;
+
+  if( layer->connection == NULL )
+    return;
+
+  hash = msConnPoolHash( layer->connectiontype, layer->connection );
+  bucket = MS_POOL_BUCKET(hash);
+
+  msAcquireLock( MS_POOL_LOCK(bucket) );
+  key = msConnPoolFindKey( layer, hash, MS_FALSE );
+  if( key != NULL ) {
+    connectionObj *conn;
+
+    for( conn = key->connections; conn != NULL; conn = conn->next ) {
+      if( MS_POOL_IS_RESERVATION(conn)
+          && conn->thread_id == msGetThreadId() ) {
+        conn->ref_count = 0;
+        msConnPoolClose( key, conn );
+        msSignalLock( MS_POOL_LOCK(bucket) );
+        break;
+      }
+    }
+  }
+  msReleaseLock( MS_POOL_LOCK(bucket) );
 }
 
 /************************************************************************/
@@ -378,14 +811,14 @@ void *msConnPoolRequest( layerObj *layer )
 /*                                                                      */
 /*      Release the passed connection for the given layer.              */
 /*      Internally the reference count is dropped, and the              */
-/*      connection may be closed.  We assume the caller has already     */
-/*      acquired the pool lock.                                         */
+/*      connection may be closed.                                       */
 /************************************************************************/
 
 void msConnPoolRelease( layerObj *layer, void *conn_handle )
 
 {
-  int  i;
+  unsigned int hash, bucket;
+  connectionKeyObj *key;
 
   if( layer->debug )
     msDebug( "msConnPoolRelease(%s,%s,%p)\n",
@@ -394,28 +827,55 @@ void msConnPoolRelease( layerObj *layer, void *conn_handle )
   if( layer->connection == NULL )
     return;
 
-  msAcquireLock( TLOCK_POOL );
-  for( i = 0; i < connectionCount; i++ ) {
-    connectionObj *conn = connections + i;
+  hash = msConnPoolHash( layer->connectiontype, layer->connection );
+  bucket = MS_POOL_BUCKET(hash);
+
+  msAcquireLock( MS_POOL_LOCK(bucket) );
+  key = msConnPoolFindKey( layer, hash, MS_FALSE );
+  if( key != NULL ) {
+    connectionObj *conn;
+
+    for( conn = key->connections; conn != NULL; conn = conn->next ) {
+      if( conn->conn_handle != conn_handle )
+        continue;
 
-    if( layer->connectiontype == conn->connectiontype
-        && strcasecmp( layer->connection, conn->connection ) == 0
-        && conn->conn_handle == conn_handle ) {
       conn->ref_count--;
       conn->last_used = time(NULL);
 
       if( conn->ref_count == 0 )
         conn->thread_id = 0;
 
-      if( conn->ref_count == 0 && (conn->lifespan == MS_LIFE_ZEROREF || conn->lifespan == MS_LIFE_SINGLE) )
-        msConnPoolClose( i );
+      if( conn->ref_count == 0 && conn->lifespan == MS_LIFE_ZEROREF
+          && key->min_idle > 0 ) {
+        /* keep up to CONNECTION_POOL_MIN idle connections open */
+        connectionObj *other;
+        int idle = 0;
+
+        for( other = key->connections; other != NULL; other = other->next ) {
+          if( other->ref_count == 0 && other->lifespan != MS_LIFE_SINGLE )
+            idle++;
+        }
+        if( idle <= key->min_idle ) {
+          msSignalLock( MS_POOL_LOCK(bucket) );
+          msReleaseLock( MS_POOL_LOCK(bucket) );
+          return;
+        }
+      }
+
+      if( conn->ref_count == 0 ) {
+        if( conn->lifespan == MS_LIFE_ZEROREF || conn->lifespan == MS_LIFE_SINGLE )
+          msConnPoolClose( key, conn );
 
-      msReleaseLock( TLOCK_POOL );
+        /* a connection, or a slot, is available to waiting requests */
+        msSignalLock( MS_POOL_LOCK(bucket) );
+      }
+
+      msReleaseLock( MS_POOL_LOCK(bucket) );
       return;
     }
   }
 
-  msReleaseLock( TLOCK_POOL );
+  msReleaseLock( MS_POOL_LOCK(bucket) );
 
   msDebug( "%s: Unable to find handle for layer '%s'.\n",
            "msConnPoolRelease()",
@@ -428,30 +888,55 @@ void msConnPoolRelease( layerObj *layer, void *conn_handle )
 }
 
 /************************************************************************/
-/*                   msConnPoolMapCloseUnreferenced()                   */
+/*                       msConnPoolCloseMatching()                      */
 /*                                                                      */
-/*      Close any unreferenced connections.                             */
+/*      Close the connections of all buckets, or only the               */
+/*      unreferenced ones.                                              */
 /************************************************************************/
 
-void msConnPoolCloseUnreferenced()
+static void msConnPoolCloseMatching( int bUnreferencedOnly )
 
 {
   int  i;
 
-  /* this really needs to be commented out before commiting.  */
-  /* msDebug( "msConnPoolCloseUnreferenced()\n" ); */
+  for( i = 0; i < MS_POOL_BUCKETS; i++ ) {
+    connectionKeyObj *key, *next_key;
+
+    msAcquireLock( MS_POOL_LOCK(i) );
+    for( key = connectionBuckets[i]; key != NULL; key = next_key ) {
+      connectionObj *conn, *next_conn;
 
-  msAcquireLock( TLOCK_POOL );
-  for( i = connectionCount - 1; i >= 0; i-- ) {
-    connectionObj *conn = connections + i;
+      /* the entry is freed along with its last connection */
+      next_key = key->next;
+      for( conn = key->connections; conn != NULL; conn = next_conn ) {
+        int bLast = (key->count == 1);
 
-    if( conn->ref_count == 0 ) {
-      /* for now we don't assume the locks are re-entrant, so release */
-      /* it so msConnPoolClose() can get it.  */
-      msConnPoolClose( i );
+        next_conn = conn->next;
+        if( !bUnreferencedOnly || conn->ref_count == 0 ) {
+          msConnPoolClose( key, conn );
+          if( bLast )
+            break;
+        }
+      }
     }
+    msSignalLock( MS_POOL_LOCK(i) );
+    msReleaseLock( MS_POOL_LOCK(i) );
   }
-  msReleaseLock( TLOCK_POOL );
+}
+
+/************************************************************************/
+/*                   msConnPoolMapCloseUnreferenced()                   */
+/*                                                                      */
+/*      Close any unreferenced connections.                             */
+/************************************************************************/
+
+void msConnPoolCloseUnreferenced()
+
+{
+  /* this really needs to be commented out before commiting.  */
+  /* msDebug( "msConnPoolCloseUnreferenced()\n" ); */
+
+  msConnPoolCloseMatching( MS_TRUE );
 }
 
 /************************************************************************/
@@ -467,8 +952,51 @@ void msConnPoolFinalCleanup()
   /* this really needs to be commented out before commiting.  */
   /* msDebug( "msConnPoolFinalCleanup()\n" ); */
 
-  msAcquireLock( TLOCK_POOL );
-  while( connectionCount > 0 )
-    msConnPoolClose( 0 );
-  msReleaseLock( TLOCK_POOL );
+  msConnPoolCloseMatching( MS_FALSE );
+}
+
+/************************************************************************/
+/*                         msConnPoolGetStats()                         */
+/*                                                                      */
+/*      Report the number of pooled connections and the pool usage      */
+/*      counters accumulated since startup.                             */
+/************************************************************************/
+
+void msConnPoolGetStats( connPoolStatsObj *stats )
+
+{
+  int  i;
+
+  memset( stats, 0, sizeof(connPoolStatsObj) );
+
+  for( i = 0; i < MS_POOL_BUCKETS; i++ ) {
+    connectionKeyObj *key;
+
+    msAcquireLock( MS_POOL_LOCK(i) );
+
+    /* counters are kept per shard, add them once per shard */
+    if( i < TLOCK_POOL_SHARD_COUNT ) {
+      connPoolStatsObj *shard = shardStats + i;
+      stats->requests += shard->requests;
+      stats->hits += shard->hits;
+      stats->misses += shard->misses;
+      stats->waits += shard->waits;
+      stats->wait_timeouts += shard->wait_timeouts;
+      stats->unhealthy += shard->unhealthy;
+    }
+
+    for( key = connectionBuckets[i]; key != NULL; key = key->next ) {
+      connectionObj *conn;
+
+      for( conn = key->connections; conn != NULL; conn = conn->next ) {
+        if( MS_POOL_IS_RESERVATION(conn) )
+          continue;
+        stats->connections++;
+        if( conn->ref_count > 0 )
+          stats->connections_in_use++;
+      }
+    }
+
+    msReleaseLock( MS_POOL_LOCK(i) );
+  }
 }
@@ -103,6 +103,36 @@ static void msPostGISCloseConnection(void *pgconn)
   PQfinish((PGconn*)pgconn);
 }
 
+/*
+** msPostGISCheckConnection()
+**
+** Handler registered with msConnPoolRegisterEx so that pooled connections
+** whose backend went away are dropped instead of being handed out. libpq
+** only notices a closed socket when reading from it, so whatever is pending
+** is read first, which does not block. A terminated backend however sends
+** an error before closing the socket, that libpq just reports as a notice
+** on an idle connection: an empty query, answered by the server without
+** doing any work, makes sure the connection still works.
+*/
+static int msPostGISCheckConnection(void *pgconn)
+{
+  PGconn *conn = (PGconn*)pgconn;
+
+  if (PQstatus(conn) != CONNECTION_OK || !PQconsumeInput(conn))
+    return MS_FALSE;
+
+  const PGTransactionStatusType status = PQtransactionStatus(conn);
+  if (status != PQTRANS_IDLE && status != PQTRANS_INTRANS)
+    return MS_FALSE;
+
+  PGresult *pgresult = PQexec(conn, "");
+  const int bUsable = pgresult != nullptr &&
+                      PQresultStatus(pgresult) == PGRES_EMPTY_QUERY;
+  PQclear(pgresult);
+
+  return bUsable && PQstatus(conn) == CONNECTION_OK;
+}
+
 /*
 ** msPostGISCreateLayerInfo()
 */
@@ -118,12 +148,79 @@ static msPostGISLayerInfo *msPostGISCreateLayerInfo(void)
   return layerinfo;
 }
 
+/*
+** msPostGISFinishPrefetch()
+**
+** Read the results of a query sent by msPostGISLayerPrefetch() into
+** prefetch_result, so that the connection can run other commands. If
+** bCancel is set the query is cancelled and its results are dropped.
+*/
+static void msPostGISFinishPrefetch(msPostGISLayerInfo *layerinfo, bool bCancel)
+{
+  if ( !layerinfo->prefetch_pending ) {
+    return;
+  }
+  layerinfo->prefetch_pending = false;
+
+  if ( bCancel ) {
+    PGcancel *cancel = PQgetCancel(layerinfo->pgconn);
+    if ( cancel ) {
+      char errbuf[256];
+      PQcancel(cancel, errbuf, sizeof(errbuf));
+      PQfreeCancel(cancel);
+    }
+  }
+
+  /* A single statement was sent: keep its result and drain the end marker */
+  PGresult *pgresult;
+  while ( (pgresult = PQgetResult(layerinfo->pgconn)) != nullptr ) {
+    if ( bCancel || layerinfo->prefetch_result ) {
+      PQclear(pgresult);
+    } else {
+      layerinfo->prefetch_result = pgresult;
+    }
+  }
+}
+
+/*
+** msPostGISCollectPrefetch()
+**
+** Read the results of the query prefetched on pgconn by a layer of map,
+** so that the connection can be shared again. Returns false if no layer
+** of the map has a query pending on it.
+*/
+static bool msPostGISCollectPrefetch(mapObj *map, PGconn *pgconn)
+{
+  if ( !map ) {
+    return false;
+  }
+
+  for ( int i = 0; i < map->numlayers; i++ ) {
+    layerObj *lp = GET_LAYER(map, i);
+    if ( lp->connectiontype != MS_POSTGIS || !lp->layerinfo ) {
+      continue;
+    }
+
+    msPostGISLayerInfo *layerinfo = (msPostGISLayerInfo*) lp->layerinfo;
+    if ( layerinfo->pgconn == pgconn && layerinfo->prefetch_pending ) {
+      if ( lp->debug ) {
+        msDebug("msPostGISCollectPrefetch: collecting the prefetched results of layer %s to share its connection.\n", lp->name);
+      }
+      msPostGISFinishPrefetch(layerinfo, false);
+      return true;
+    }
+  }
+  return false;
+}
+
 /*
 ** msPostGISFreeLayerInfo()
 */
 static void msPostGISFreeLayerInfo(layerObj *layer)
 {
   msPostGISLayerInfo *layerinfo = (msPostGISLayerInfo*)layer->layerinfo;
+  if ( layerinfo->pgconn ) msPostGISFinishPrefetch(layerinfo, true);
+  if ( layerinfo->prefetch_result ) PQclear(layerinfo->prefetch_result);
   if ( layerinfo->pgresult ) PQclear(layerinfo->pgresult);
   if ( layerinfo->pgconn ) msConnPoolRelease(layer, layerinfo->pgconn);
   delete layerinfo;
@@ -1055,6 +1152,7 @@ msPostGISRetrievePK(layerObj *layer)
     return MS_FAILURE;
   }
 
+  msPostGISFinishPrefetch(layerinfo, false);
   PGresult *pgresult = PQexecParams(layerinfo->pgconn, sql, 0, nullptr, nullptr, nullptr, nullptr, 0);
   if ( !pgresult || PQresultStatus(pgresult) != PGRES_TUPLES_OK) {
     msSetError(MS_QUERYERR, "%s", "msPostGISRetrievePK()",
@@ -2171,9 +2269,40 @@ static int msPostGISLayerOpen(layerObj *layer)
   }
 
   /*
-  ** Get a database connection from the pool.
+  ** Get a database connection from the pool. This fails when
+  ** CONNECTION_POOL_MAX connections stay in use too long.
+  */
+  void *pooled = nullptr;
+  if (msConnPoolAcquire(layer, 0, &pooled) != MS_SUCCESS) {
+    delete layerinfo;
+    return MS_FAILURE;
+  }
+  layerinfo->pgconn = (PGconn *) pooled;
+
+  /*
+  ** A connection busy with the prefetched query of another layer cannot
+  ** be shared, take one nobody uses instead. Rather than wait for one at
+  ** CONNECTION_POOL_MAX, collect the prefetched results so that the
+  ** connection can be shared after all.
   */
-  layerinfo->pgconn = (PGconn *) msConnPoolRequest(layer);
+  if (layerinfo->pgconn && PQtransactionStatus(layerinfo->pgconn) == PQTRANS_ACTIVE) {
+    int status = msConnPoolAcquire(layer, MS_POOL_IDLE_ONLY | MS_POOL_NO_WAIT, &pooled);
+    if (status == MS_SUCCESS) {
+      msConnPoolRelease(layer, layerinfo->pgconn);
+      layerinfo->pgconn = (PGconn *) pooled;
+    } else if (status == MS_DONE && !msPostGISCollectPrefetch(layer->map, layerinfo->pgconn)) {
+      msConnPoolRelease(layer, layerinfo->pgconn);
+      if (msConnPoolAcquire(layer, MS_POOL_IDLE_ONLY, &pooled) != MS_SUCCESS) {
+        delete layerinfo;
+        return MS_FAILURE;
+      }
+      layerinfo->pgconn = (PGconn *) pooled;
+    } else if (status == MS_FAILURE) {
+      msConnPoolRelease(layer, layerinfo->pgconn);
+      delete layerinfo;
+      return MS_FAILURE;
+    }
+  }
 
   /* No connection in the pool, so set one up. */
   if (!layerinfo->pgconn) {
@@ -2192,6 +2321,7 @@ static int msPostGISLayerOpen(layerObj *layer)
     */
     char* conn_decrypted = msDecryptStringTokens(layer->map, layer->connection);
     if (conn_decrypted == nullptr) {
+      msConnPoolCancel(layer);
       delete layerinfo;
       return MS_FAILURE;  /* An error should already have been produced */
     }
@@ -2221,6 +2351,7 @@ static int msPostGISLayerOpen(layerObj *layer)
       msSetError(MS_QUERYERR, "Database connection failed. Check server logs for more details.Is the database running? Is it allowing connections? Does the specified user exist? Is the password valid? Is the database on the standard port?", "msPostGISLayerOpen()");
 
       if(layerinfo->pgconn) PQfinish(layerinfo->pgconn);
+      msConnPoolCancel(layer);
       free(maskeddata);
       delete layerinfo;
       return MS_FAILURE;
@@ -2230,7 +2361,8 @@ static int msPostGISLayerOpen(layerObj *layer)
     PQsetNoticeProcessor(layerinfo->pgconn, postresqlNoticeHandler, (void *) layer);
 
     /* Save this connection in the pool for later. */
-    msConnPoolRegister(layer, layerinfo->pgconn, msPostGISCloseConnection);
+    msConnPoolRegisterEx(layer, layerinfo->pgconn, msPostGISCloseConnection,
+                         msPostGISCheckConnection);
   } else {
     /* Connection in the pool should be tested to see if backend is alive. */
     if( PQstatus(layerinfo->pgconn) != CONNECTION_OK ) {
@@ -2415,6 +2547,8 @@ static PGresult* runPQexecParamsWithBindSubstitution(layerObj *layer, const char
   PGresult *pgresult = nullptr;
   msPostGISLayerInfo* layerinfo = (msPostGISLayerInfo*) layer->layerinfo;
 
+  msPostGISFinishPrefetch(layerinfo, false);
+
   const auto layer_bind_values = buildBindValues(layer);
 
   if( !layer_bind_values.empty() ) {
@@ -2442,6 +2576,9 @@ static int msPostGISLayerWhichShapes(layerObj *layer, rectObj rect, int isQuery)
     msDebug("msPostGISLayerWhichShapes called.\n");
   }
 
+  /* Collect a prefetched result first, parsing DATA may need the connection. */
+  msPostGISFinishPrefetch((msPostGISLayerInfo*) layer->layerinfo, false);
+
   /* Fill out layerinfo with our current DATA state. */
   if ( msPostGISParseData(layer) != MS_SUCCESS) {
     return MS_FAILURE;
@@ -2464,7 +2601,24 @@ static int msPostGISLayerWhichShapes(layerObj *layer, rectObj rect, int isQuery)
     msDebug("msPostGISLayerWhichShapes query: %s\n", strSQL.c_str());
   }
 
-  PGresult* pgresult = runPQexecParamsWithBindSubstitution(layer, strSQL.c_str(), RESULTSET_TYPE);
+  /* Use the prefetched result if it was for the very same query. */
+  PGresult* pgresult = nullptr;
+  if ( layerinfo->prefetch_result ) {
+    if ( layerinfo->prefetch_sql == strSQL ) {
+      if (layer->debug) {
+        msDebug("msPostGISLayerWhichShapes: using prefetched result.\n");
+      }
+      pgresult = layerinfo->prefetch_result;
+    } else {
+      PQclear(layerinfo->prefetch_result);
+    }
+    layerinfo->prefetch_result = nullptr;
+    layerinfo->prefetch_sql.clear();
+  }
+
+  if ( !pgresult ) {
+    pgresult = runPQexecParamsWithBindSubstitution(layer, strSQL.c_str(), RESULTSET_TYPE);
+  }
 
   if ( layer->debug > 1 ) {
     msDebug("msPostGISLayerWhichShapes query status: %s (%d)\n", PQresStatus(PQresultStatus(pgresult)), PQresultStatus(pgresult));
@@ -2501,6 +2655,68 @@ static int msPostGISLayerWhichShapes(layerObj *layer, rectObj rect, int isQuery)
 #endif
 }
 
+/*
+** msPostGISLayerPrefetch()
+**
+** Send the query msPostGISLayerWhichShapes() would run for rect without
+** waiting for its results, so that the database works on it while other
+** layers are prefetched or drawn. The layer must be open, with its items
+** set. msPostGISLayerWhichShapes() uses the results if it is then called
+** with the same query.
+*/
+int msPostGISLayerPrefetch(layerObj *layer, rectObj rect)
+{
+#ifdef USE_POSTGIS
+  assert(layer != nullptr);
+
+  msPostGISLayerInfo* layerinfo = (msPostGISLayerInfo*) layer->layerinfo;
+  if ( !layerinfo || !layerinfo->pgconn ) {
+    msSetError(MS_QUERYERR, "Layer is not open.", "msPostGISLayerPrefetch()");
+    return MS_FAILURE;
+  }
+
+  msPostGISFinishPrefetch(layerinfo, true);
+  if ( layerinfo->prefetch_result ) {
+    PQclear(layerinfo->prefetch_result);
+    layerinfo->prefetch_result = nullptr;
+  }
+
+  if ( msPostGISParseData(layer) != MS_SUCCESS) {
+    return MS_FAILURE;
+  }
+
+  const std::string strSQL = msPostGISBuildSQL(layer, &rect, nullptr, nullptr, -1);
+  if ( strSQL.empty() ) {
+    msSetError(MS_QUERYERR, "Failed to build query SQL.", "msPostGISLayerPrefetch()");
+    return MS_FAILURE;
+  }
+
+  const auto layer_bind_values = buildBindValues(layer);
+  if ( !PQsendQueryParams(layerinfo->pgconn, strSQL.c_str(),
+                          static_cast<int>(layer_bind_values.size()), nullptr,
+                          layer_bind_values.empty() ? nullptr : layer_bind_values.data(),
+                          nullptr, nullptr, RESULTSET_TYPE) ) {
+    msDebug("msPostGISLayerPrefetch(): Error (%s) sending query: %s\n", PQerrorMessage(layerinfo->pgconn), strSQL.c_str());
+    msSetError(MS_QUERYERR, "Error sending query. Check server logs","msPostGISLayerPrefetch()");
+    return MS_FAILURE;
+  }
+
+  if (layer->debug) {
+    msDebug("msPostGISLayerPrefetch query: %s\n", strSQL.c_str());
+  }
+
+  layerinfo->prefetch_sql = strSQL;
+  layerinfo->prefetch_pending = true;
+
+  return MS_SUCCESS;
+#else
+  msSetError( MS_MISCERR,
+              "PostGIS support is not available.",
+              "msPostGISLayerPrefetch()");
+  return MS_FAILURE;
+#endif
+}
+
 /*
 ** msPostGISLayerNextShape()
 **
@@ -66,6 +66,9 @@ typedef struct {
   int         version = 0;           /* PostGIS version of the database */
   int         paging = 0;            /* Driver handling of pagination, enabled by default */
   int         force2d = 0;           /* Pass geometry through ST_Force2D */
+  std::string prefetch_sql{};        /* SQL sent by msPostGISLayerPrefetch() */
+  bool        prefetch_pending = false; /* prefetch_sql results not read yet */
+  PGresult    *prefetch_result = nullptr; /* Results of prefetch_sql once read */
 }
 msPostGISLayerInfo;
 
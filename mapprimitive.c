@@ -93,8 +93,12 @@ void msInitShape(shapeObj *shape)
   /* attribute component */
   shape->values = NULL;
   shape->numvalues = 0;
+  shape->valuecache = NULL;
+  shape->numvaluecache = 0;
 
   shape->geometry = NULL;
+  shape->preparedgeometry = NULL;
+  shape->segmentindex = NULL;
   shape->renderer_cache = NULL;
 
   /* annotation component */
@@ -136,9 +140,12 @@ int msCopyShape(shapeObj *from, shapeObj *to)
     for(i=0; i<from->numvalues; i++)
       to->values[i] = msStrdup(from->values[i]);
     to->numvalues = from->numvalues;
+    msShapeInvalidateValueCache(to);
   }
 
   to->geometry = NULL; /* GEOS code will build automatically if necessary */
+  to->preparedgeometry = NULL;
+  to->segmentindex = NULL;
   to->scratch = from->scratch;
 
   return(0);
@@ -155,7 +162,9 @@ void msFreeShape(shapeObj *shape)
 
   if (shape->line) free(shape->line);
   if(shape->values) msFreeCharArray(shape->values, shape->numvalues);
+  msFree(shape->valuecache);
   if(shape->text) free(shape->text);
+  msFreeSegmentIndex(shape);
 
 #ifdef USE_GEOS
   msGEOSFreeGeometry(shape);
@@ -164,6 +173,40 @@ void msFreeShape(shapeObj *shape)
   msInitShape(shape); /* now reset */
 }
 
+/*
+** Returns atof(shape->values[i]), parsing each value only once per shape
+** so that expressions, class tests and bindings referring to the same item
+** don't run strtod over and over. Entries are tied to the string they were
+** parsed from; code that replaces values in place on a shape that may
+** already have been evaluated must call msShapeInvalidateValueCache().
+*/
+double msShapeGetValueAsDouble(shapeObj *shape, int i)
+{
+  shapeValueObj *value;
+
+  if(!shape->values || i < 0 || i >= shape->numvalues || !shape->values[i])
+    return 0.0;
+
+  if(shape->numvaluecache < shape->numvalues) {
+    shape->valuecache = (shapeValueObj *) msSmallRealloc(shape->valuecache, sizeof(shapeValueObj)*shape->numvalues);
+    memset(shape->valuecache + shape->numvaluecache, 0, sizeof(shapeValueObj)*(shape->numvalues - shape->numvaluecache));
+    shape->numvaluecache = shape->numvalues;
+  }
+
+  value = &(shape->valuecache[i]);
+  if(value->source != shape->values[i]) {
+    value->dblval = atof(shape->values[i]);
+    value->source = shape->values[i];
+  }
+  return value->dblval;
+}
+
+void msShapeInvalidateValueCache(shapeObj *shape)
+{
+  if(shape->valuecache)
+    memset(shape->valuecache, 0, sizeof(shapeValueObj)*shape->numvaluecache);
+}
+
 int msGetShapeRAMSize(shapeObj* shape)
 {
     int i;
@@ -180,6 +223,7 @@ int msGetShapeRAMSize(shapeObj* shape)
         if( shape->values[i] )
             size += strlen( shape->values[i] ) + 1;
     }
+    size += shape->numvaluecache * sizeof(shapeValueObj);
     if( shape->text )
         size += strlen( shape->text ) + 1;
     return size;
@@ -487,18 +531,58 @@ static int clipLine(double *x1, double *y1, double *x2, double *y2, rectObj rect
   return(MS_TRUE);
 }
 
+/*
+** Makes sure the scratch point array handed to the clipping routines can
+** hold at least numpoints points.
+*/
+static void msClipReserveScratch(pointObj **scratch, int *scratchsize, int numpoints)
+{
+  if(*scratchsize < numpoints) {
+    *scratch = (pointObj *)msSmallRealloc(*scratch, sizeof(pointObj)*numpoints);
+    *scratchsize = numpoints;
+  }
+}
+
+/*
+** Inserts a copy of the given points as a new line at position index of
+** the shape, shifting the following lines.
+*/
+static void msClipInsertLine(shapeObj *shape, int index, pointObj *point, int numpoints)
+{
+  shape->line = (lineObj *)msSmallRealloc(shape->line, sizeof(lineObj)*(shape->numlines+1));
+  if(index < shape->numlines)
+    memmove(shape->line + index + 1, shape->line + index,
+            sizeof(lineObj) * (shape->numlines - index));
+  shape->line[index].point = (pointObj *)msSmallMalloc(sizeof(pointObj)*numpoints);
+  memcpy(shape->line[index].point, point, sizeof(pointObj)*numpoints);
+  shape->line[index].numpoints = numpoints;
+  shape->numlines++;
+}
+
 /*
 ** Routine for clipping a polyline, stored in a shapeObj struct, to a
-** rectangle. Uses clipLine() function to create a new shapeObj.
+** rectangle. Uses clipLine() function to clip each segment.
 */
 void msClipPolylineRect(shapeObj *shape, rectObj rect)
+{
+  pointObj *scratch = NULL;
+  int scratchsize = 0;
+  msClipPolylineRectEx(shape, rect, &scratch, &scratchsize);
+  free(scratch);
+}
+
+/*
+** Same as msClipPolylineRect(), but the work is done in place: the first
+** clipped part of each line is written back into the storage of that line
+** (it can never hold more points than the ones already read), and further
+** parts are built in the caller supplied scratch array, which is grown as
+** needed and can be reused from one shape to the next.
+*/
+void msClipPolylineRectEx(shapeObj *shape, rectObj rect, pointObj **scratch, int *scratchsize)
 {
   int i,j;
   lineObj line= {0,NULL};
   double x1, x2, y1, y2;
-  shapeObj tmp;
-
-  memset( &tmp, 0, sizeof(shapeObj) );
 
   if(shape->numlines == 0) /* nothing to clip */
     return;
@@ -518,15 +602,23 @@ void msClipPolylineRect(shapeObj *shape, rectObj rect)
   }
 
   for(i=0; i<shape->numlines; i++) {
+    /* the points array stays valid when parts get inserted after this line */
+    pointObj *point = shape->line[i].point;
+    int numpoints = shape->line[i].numpoints;
+    int numparts = 0, firstpartpoints = 0;
 
-    line.point = (pointObj *)msSmallMalloc(sizeof(pointObj)*shape->line[i].numpoints);
+    line.point = point;
     line.numpoints = 0;
 
-    x1 = shape->line[i].point[0].x;
-    y1 = shape->line[i].point[0].y;
-    for(j=1; j<shape->line[i].numpoints; j++) {
-      x2 = shape->line[i].point[j].x;
-      y2 = shape->line[i].point[j].y;
+    if(numpoints > 0) {
+      x1 = point[0].x;
+      y1 = point[0].y;
+    }
+    for(j=1; j<numpoints; j++) {
+      const double xj = point[j].x;
+      const double yj = point[j].y;
+      x2 = xj;
+      y2 = yj;
 
       if(clipLine(&x1,&y1,&x2,&y2,rect) == MS_TRUE) {
         if(line.numpoints == 0) { /* first segment, add both points */
@@ -541,29 +633,40 @@ void msClipPolylineRect(shapeObj *shape, rectObj rect)
           line.numpoints++;
         }
 
-        if((x2 != shape->line[i].point[j].x) || (y2 != shape->line[i].point[j].y)) {
-          msAddLine(&tmp, &line);
-          line.numpoints = 0; /* new line */
+        if((x2 != xj) || (y2 != yj)) { /* part is complete, start a new one */
+          if(numparts == 0) {
+            firstpartpoints = line.numpoints;
+            msClipReserveScratch(scratch, scratchsize, numpoints);
+            line.point = *scratch;
+          } else {
+            msClipInsertLine(shape, i+numparts, line.point, line.numpoints);
+          }
+          numparts++;
+          line.numpoints = 0;
         }
       }
 
-      x1 = shape->line[i].point[j].x;
-      y1 = shape->line[i].point[j].y;
+      x1 = xj;
+      y1 = yj;
     }
 
     if(line.numpoints > 0) {
-      msAddLineDirectly(&tmp, &line);
+      if(numparts == 0)
+        firstpartpoints = line.numpoints;
+      else
+        msClipInsertLine(shape, i+numparts, line.point, line.numpoints);
+      numparts++;
+    }
+
+    if(numparts == 0) {
+      msShapeDeleteLine(shape, i);
+      i--;
     } else {
-      free(line.point);
-      line.numpoints = 0; /* new line */
+      shape->line[i].numpoints = firstpartpoints;
+      i += numparts-1; /* skip the parts we just inserted */
     }
   }
 
-  for (i=0; i<shape->numlines; i++) free(shape->line[i].point);
-  free(shape->line);
-
-  shape->line = tmp.line;
-  shape->numlines = tmp.numlines;
   msComputeBounds(shape);
 }
 
@@ -571,17 +674,28 @@ void msClipPolylineRect(shapeObj *shape, rectObj rect)
 ** Slightly modified version of the Liang-Barsky polygon clipping algorithm
 */
 void msClipPolygonRect(shapeObj *shape, rectObj rect)
+{
+  pointObj *scratch = NULL;
+  int scratchsize = 0;
+  msClipPolygonRectEx(shape, rect, &scratch, &scratchsize);
+  free(scratch);
+}
+
+/*
+** Same as msClipPolygonRect(), but each ring is clipped into the caller
+** supplied scratch array (grown as needed, and reusable from one shape to
+** the next) and copied back into the storage of the ring, which is only
+** reallocated when the clipped ring ends up larger than the original one.
+*/
+void msClipPolygonRectEx(shapeObj *shape, rectObj rect, pointObj **scratch, int *scratchsize)
 {
   int i, j;
   double deltax, deltay, xin,xout,  yin,yout;
   double tinx,tiny,  toutx,touty,  tin1, tin2,  tout;
   double x1,y1, x2,y2;
 
-  shapeObj tmp;
   lineObj line= {0,NULL};
 
-  msInitShape(&tmp);
-
   if(shape->numlines == 0) /* nothing to clip */
     return;
 
@@ -600,11 +714,14 @@ void msClipPolygonRect(shapeObj *shape, rectObj rect)
   }
 
   for(j=0; j<shape->numlines; j++) {
+    const int numpoints = shape->line[j].numpoints;
 
-    line.point = (pointObj *)msSmallMalloc(sizeof(pointObj)*2*shape->line[j].numpoints+1); /* worst case scenario, +1 allows us to duplicate the 1st and last point */
+    /* worst case scenario, +1 allows us to duplicate the 1st and last point */
+    msClipReserveScratch(scratch, scratchsize, 2*numpoints+1);
+    line.point = *scratch;
     line.numpoints = 0;
 
-    for (i = 0; i < shape->line[j].numpoints-1; i++) {
+    for (i = 0; i < numpoints-1; i++) {
 
       x1 = shape->line[j].point[i].x;
       y1 = shape->line[j].point[i].y;
@@ -706,17 +823,16 @@ void msClipPolygonRect(shapeObj *shape, rectObj rect)
       line.point[line.numpoints].x = line.point[0].x; /* force closure */
       line.point[line.numpoints].y = line.point[0].y;
       line.numpoints++;
-      msAddLineDirectly(&tmp, &line);
+      if(line.numpoints > numpoints)
+        shape->line[j].point = (pointObj *)msSmallRealloc(shape->line[j].point, sizeof(pointObj)*line.numpoints);
+      memcpy(shape->line[j].point, line.point, sizeof(pointObj)*line.numpoints);
+      shape->line[j].numpoints = line.numpoints;
     } else {
-      free(line.point);
+      msShapeDeleteLine(shape, j);
+      j--;
     }
   } /* next line */
 
-  for (i=0; i<shape->numlines; i++) free(shape->line[i].point);
-  free(shape->line);
-
-  shape->line = tmp.line;
-  shape->numlines = tmp.numlines;
   msComputeBounds(shape);
 
   return;
@@ -1555,6 +1671,154 @@ int msPolygonLabelPoint(shapeObj *p, pointObj *lp, double min_dimension)
     return(MS_FAILURE);
 }
 
+/*
+** Pole of inaccessibility label point, i.e. the interior point farthest from
+** the polygon outline (after the "polylabel" algorithm). The bounding box is
+** covered with square cells that are refined, best candidate first, until no
+** cell can hold a point more than precision closer to the center than the
+** best one found so far.
+*/
+#define MS_POLYLABEL_MAX_CELLS 10000 /* bounds the cost for pathological shapes */
+
+typedef struct {
+  double x, y; /* cell center */
+  double h; /* half the cell size */
+  double d; /* signed distance from the center to the outline, < 0 outside */
+  double max; /* best distance any point in the cell can reach */
+} polylabelCellObj;
+
+static double polylabelSignedDistance(shapeObj *p, double x, double y)
+{
+  int i, j;
+  double dist, min_dist = -1;
+  pointObj point;
+
+  point.x = x;
+  point.y = y;
+
+  for(j=0; j<p->numlines; j++) {
+    for(i=1; i<p->line[j].numpoints; i++) {
+      dist = msSquareDistancePointToSegment(&point, &(p->line[j].point[i-1]), &(p->line[j].point[i]));
+      if((dist < min_dist) || (min_dist < 0)) min_dist = dist;
+    }
+  }
+  if(min_dist < 0) return 0;
+
+  min_dist = sqrt(min_dist);
+  return (msIntersectPointPolygon(&point, p) == MS_TRUE) ? min_dist : -min_dist;
+}
+
+static void polylabelInitCell(polylabelCellObj *cell, shapeObj *p, double x, double y, double h)
+{
+  cell->x = x;
+  cell->y = y;
+  cell->h = h;
+  cell->d = polylabelSignedDistance(p, x, y);
+  cell->max = cell->d + h*sqrt(2.0);
+}
+
+/* binary max-heap on polylabelCellObj.max */
+static void polylabelPushCell(polylabelCellObj **heap, int *numcells, int *maxcells, polylabelCellObj *cell)
+{
+  int i = *numcells, parent;
+  polylabelCellObj tmp;
+
+  if(*numcells == *maxcells) {
+    *maxcells = MS_MAX(64, *maxcells*2);
+    *heap = (polylabelCellObj *) msSmallRealloc(*heap, sizeof(polylabelCellObj)*(*maxcells));
+  }
+  (*heap)[(*numcells)++] = *cell;
+
+  while(i > 0) {
+    parent = (i-1)/2;
+    if((*heap)[parent].max >= (*heap)[i].max) break;
+    SWAP((*heap)[parent], (*heap)[i], tmp);
+    i = parent;
+  }
+}
+
+static void polylabelPopCell(polylabelCellObj *heap, int *numcells, polylabelCellObj *cell)
+{
+  int i = 0, child;
+  polylabelCellObj tmp;
+
+  *cell = heap[0];
+  heap[0] = heap[--(*numcells)];
+
+  while((child = 2*i+1) < *numcells) {
+    if(child+1 < *numcells && heap[child+1].max > heap[child].max) child++;
+    if(heap[i].max >= heap[child].max) break;
+    SWAP(heap[i], heap[child], tmp);
+    i = child;
+  }
+}
+
+int msPolygonPoleOfInaccessibility(shapeObj *p, pointObj *lp, double min_dimension, double precision)
+{
+  polylabelCellObj *heap = NULL, cell, parent, best;
+  int numcells = 0, maxcells = 0, probed = 0, ownindex = MS_FALSE;
+  double x, y, h, cellsize;
+  pointObj cg;
+
+  msComputeBounds(p);
+  cellsize = MS_MIN(p->bounds.maxx - p->bounds.minx, p->bounds.maxy - p->bounds.miny);
+
+  if(min_dimension > 0 && cellsize < min_dimension) return(MS_FAILURE);
+  if(cellsize <= 0) return(MS_FAILURE);
+
+  if(precision <= 0) precision = cellsize/100.0;
+
+  /* every cell costs a point in polygon test */
+  if(!p->segmentindex) ownindex = msBuildSegmentIndex(p);
+
+  /* start from the better of the center of gravity and the bounding box center */
+  if(getPolygonCenterOfGravity(p, &cg) == MS_SUCCESS)
+    polylabelInitCell(&best, p, cg.x, cg.y, 0);
+  else
+    best.d = -HUGE_VAL;
+  polylabelInitCell(&cell, p, (p->bounds.minx + p->bounds.maxx)/2.0, (p->bounds.miny + p->bounds.maxy)/2.0, 0);
+  if(cell.d > best.d) best = cell;
+
+  h = cellsize/2.0;
+  for(x=p->bounds.minx; x<p->bounds.maxx; x+=cellsize) {
+    for(y=p->bounds.miny; y<p->bounds.maxy; y+=cellsize) {
+      polylabelInitCell(&cell, p, x+h, y+h, h);
+      polylabelPushCell(&heap, &numcells, &maxcells, &cell);
+    }
+  }
+
+  while(numcells > 0 && probed < MS_POLYLABEL_MAX_CELLS) {
+    polylabelPopCell(heap, &numcells, &cell);
+
+    if(cell.d > best.d) best = cell;
+    if(cell.max - best.d <= precision) continue; /* can't do better in this cell */
+
+    /* split into four */
+    parent = cell;
+    h = parent.h/2.0;
+    polylabelInitCell(&cell, p, parent.x-h, parent.y-h, h);
+    polylabelPushCell(&heap, &numcells, &maxcells, &cell);
+    polylabelInitCell(&cell, p, parent.x+h, parent.y-h, h);
+    polylabelPushCell(&heap, &numcells, &maxcells, &cell);
+    polylabelInitCell(&cell, p, parent.x-h, parent.y+h, h);
+    polylabelPushCell(&heap, &numcells, &maxcells, &cell);
+    polylabelInitCell(&cell, p, parent.x+h, parent.y+h, h);
+    polylabelPushCell(&heap, &numcells, &maxcells, &cell);
+    probed += 4;
+  }
+
+  msFree(heap);
+  if(ownindex) msFreeSegmentIndex(p);
+
+  if(best.d <= 0) /* degenerate outline, no interior point found */
+    return msPolygonLabelPoint(p, lp, min_dimension);
+
+  lp->x = best.x;
+  lp->y = best.y;
+
+  return(MS_SUCCESS);
+}
+
 /* Compute all the lineString/segment lengths and determine the longest lineString of a multiLineString
  * shape: in paramater, the multiLineString to compute.
  * struct polyline_lengths pll: out parameter, all line and segment lengths
@@ -1575,8 +1839,11 @@ void msPolylineComputeLineSegments(shapeObj *shape, struct polyline_lengths *pll
     
     if(shape->line[i].numpoints > 1) {
       ll->segment_lengths = (double*) msSmallMalloc(sizeof(double) * (shape->line[i].numpoints - 1));
+      ll->cumulative_lengths = (double*) msSmallMalloc(sizeof(double) * shape->line[i].numpoints);
+      ll->cumulative_lengths[0] = 0;
     } else {
       ll->segment_lengths = NULL;
+      ll->cumulative_lengths = NULL;
     }
     ll->total_length = 0;
     
@@ -1584,6 +1851,7 @@ void msPolylineComputeLineSegments(shapeObj *shape, struct polyline_lengths *pll
       segment_length = sqrt((((shape->line[i].point[j].x-shape->line[i].point[j-1].x)*(shape->line[i].point[j].x-shape->line[i].point[j-1].x)) + ((shape->line[i].point[j].y-shape->line[i].point[j-1].y)*(shape->line[i].point[j].y-shape->line[i].point[j-1].y))));
       ll->total_length += segment_length;
       ll->segment_lengths[j-1] = segment_length;
+      ll->cumulative_lengths[j] = ll->total_length;
       if(segment_length > max_subline_segment_length) {
         max_subline_segment_length = segment_length;
         ll->longest_segment_index = j;
@@ -1603,6 +1871,25 @@ void msPolylineComputeLineSegments(shapeObj *shape, struct polyline_lengths *pll
   }
 }
 
+/*
+** Return the index of the segment of a line along which the distance "length" (measured
+** from the first point) falls, i.e. the smallest i such that cumulative_lengths[i+1] >= length.
+** The result is clamped to [0,numsegments-1] for distances falling outside of the line.
+*/
+static int msLineLengthsFindSegment(const struct line_lengths *ll, int numsegments, double length)
+{
+  int lo = 0, hi = numsegments - 1;
+
+  while(lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if(ll->cumulative_lengths[mid+1] >= length)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
 /*
 ** If no repeatdistance, find center of longest segment in polyline p. The polyline must have been converted
 ** to image coordinates before calling this function.
@@ -1650,6 +1937,7 @@ int msPolylineLabelPoint(mapObj *map, shapeObj *p, textSymbolObj *ts, labelObj *
   /* freeing memory: allocated by msPolylineComputeLineSegments */
   for ( i = 0; i < p->numlines; i++ ) {
     free(pll.ll[i].segment_lengths);
+    free(pll.ll[i].cumulative_lengths);
   }
   free(pll.ll);
   
@@ -1708,12 +1996,8 @@ int msLineLabelPoint(mapObj *map, lineObj *p, textSymbolObj *ts, struct line_len
         lar->label_points[lar->num_label_points].x = (p->point[j-1].x + p->point[j].x)/2.0;
         lar->label_points[lar->num_label_points].y = (p->point[j-1].y + p->point[j].y)/2.0;
       } else {
-        j=0;
-        fwd_length = 0;
-        while (fwd_length < point_position) {
-          fwd_length += ll->segment_lengths[j++];
-        }
-        assert(j>0);
+        j = msLineLengthsFindSegment(ll, p->numpoints - 1, point_position) + 1;
+        fwd_length = ll->cumulative_lengths[j];
 
         t = 1 - (fwd_length - point_position) / ll->segment_lengths[j-1];
         lar->label_points[lar->num_label_points].x = t * (p->point[j].x - p->point[j-1].x) + p->point[j-1].x;
@@ -1819,6 +2103,7 @@ int msPolylineLabelPath(mapObj *map, imageObj *image, shapeObj *p, textSymbolObj
   /* freeing memory: allocated by msPolylineComputeLineSegments */
   for ( i = 0; i < p->numlines; i++ ) {
     free(pll.ll[i].segment_lengths);
+    free(pll.ll[i].cumulative_lengths);
   }
   free(pll.ll);
   
@@ -2018,22 +2303,28 @@ int msLineLabelPath(mapObj *map, imageObj *img, lineObj *p, textSymbolObj *ts, s
       /* the points start at (line_length - text_length) / 2 in order to be centred */
       /* text_start_length = (line_length - text_length) / 2.0; */
       
+      /* locate the segments containing the start and the end of the text with a
+         binary search on the cumulative lengths, as these are recomputed for each
+         repeated label and each retried offset */
       j = 0;
       fwd_line_length = 0;
       if(text_start_length >= 0.0) {
-        while ( fwd_line_length < text_start_length )
-          fwd_line_length += ll->segment_lengths[j++];
-        
-        j--;
+        j = msLineLengthsFindSegment(ll, p->numpoints - 1, text_start_length);
+        fwd_line_length = ll->cumulative_lengths[j+1];
       }
       final_j = p->numpoints - 1;
       rev_line_length = 0;
       if(text_start_length+text_length <= ll->total_length) {
-        text_end_length = ll->total_length - (text_start_length + text_length);
-        while(rev_line_length < text_end_length) {
-          rev_line_length += ll->segment_lengths[final_j - 1];
+        double text_stop_length = text_start_length + text_length;
+        text_end_length = ll->total_length - text_stop_length;
+        /* last vertex located at or before the end of the text, compared the same way
+           as when walking the line backwards so results match on vertex boundaries */
+        final_j = msLineLengthsFindSegment(ll, p->numpoints - 1, text_stop_length);
+        if(final_j < p->numpoints - 2 && ll->total_length - ll->cumulative_lengths[final_j+1] >= text_end_length)
+          final_j++;
+        else if(final_j > 0 && ll->total_length - ll->cumulative_lengths[final_j] < text_end_length)
           final_j--;
-        }
+        rev_line_length = ll->total_length - ll->cumulative_lengths[final_j];
         final_j++;
       }
       
@@ -64,6 +64,14 @@ typedef struct {
 #endif
 } lineObj;
 
+#ifndef SWIG
+/* numeric form of an attribute value, see msShapeGetValueAsDouble() */
+typedef struct {
+  const char *source; /* the values[] string dblval was parsed from */
+  double dblval;
+} shapeValueObj;
+#endif
+
 typedef struct {
 #ifdef SWIG
   %immutable;
@@ -74,7 +82,11 @@ typedef struct {
   lineObj *line;
   char **values;
   void *geometry;
+  void *preparedgeometry; /* GEOS prepared geometry, see msGEOSPrepareShape() */
+  void *segmentindex; /* y-band segment index, see msBuildSegmentIndex() */
   void *renderer_cache;
+  shapeValueObj *valuecache; /* lazily parsed values, one per values[] entry */
+  int numvaluecache;
 #endif
 
 #ifdef SWIG
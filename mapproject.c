@@ -56,6 +56,7 @@ static int msTestNeedWrap( pointObj pt1, pointObj pt2, pointObj pt2_geo,
 
 static projectionContext* msProjectionContextCreate(void);
 static void msProjectionContextUnref(projectionContext* ctx);
+static int msProjectGetWellKnownProjection(projectionObj *p);
 
 #if PROJ_VERSION_MAJOR >= 6
 
@@ -69,6 +70,10 @@ struct reprojectionObj
     int should_do_line_cutting;
     shapeObj splitShape;
     int bFreePJ;
+    pointObj* tmpPoints; /* scratch buffer for msProjectShapeLine() */
+    int tmpPointsAlloc;
+    int wkp_in; /* well known projections handled without PROJ, see */
+    int wkp_out; /* msProjectWellKnownTransform() */
 };
 
 /* Helps considerably for use cases like msautotest/wxs/wms_inspire.map */
@@ -359,6 +364,83 @@ void msProjectionContextUnref(projectionContext* ctx)
     }
 }
 
+/************************************************************************/
+/*                     msProjectWellKnownTransform()                    */
+/*                                                                      */
+/*      Closed form EPSG:4326 <--> EPSG:3857 transformation, used in    */
+/*      place of PROJ for that very common pair. This is the spherical  */
+/*      "Popular Visualisation Pseudo-Mercator" conversion that PROJ    */
+/*      itself uses, including its handling of out of range input       */
+/*      (latitude beyond the poles fails, longitude is wrapped to       */
+/*      [-180,180]). The results agree with PROJ to within 1e-6 meter   */
+/*      and 1e-9 degree; they only differ by floating point rounding.   */
+/*                                                                      */
+/*      x and y are strided like for proj_trans_generic(). Points that  */
+/*      fail to transform are set to HUGE_VAL.                          */
+/************************************************************************/
+
+#define WEBMERC_RADIUS 6378137.0
+#define WKP_DEG_TO_RAD (MS_PI / 180.0)
+#define WKP_RAD_TO_DEG (180.0 / MS_PI)
+
+static double msProjectAdjustLongitude(double lon)
+{
+    /* same as PROJ adjlon(): let lon slightly overshoot at the date line */
+    if( fabs(lon) < MS_PI + 1e-12 )
+        return lon;
+    lon += MS_PI;
+    lon -= MS_2PI * floor(lon / MS_2PI);
+    lon -= MS_PI;
+    return lon;
+}
+
+static void msProjectWellKnownTransform(reprojectionObj* reprojector,
+                                        int npoints,
+                                        double* x, size_t stride_x,
+                                        double* y, size_t stride_y)
+{
+    int i;
+    if( reprojector->wkp_in == wkp_lonlat && reprojector->wkp_out == wkp_gmerc )
+    {
+        for( i = 0; i < npoints; i++ )
+        {
+            double* px = (double*)((char*)x + i * stride_x);
+            double* py = (double*)((char*)y + i * stride_y);
+            double lam, phi;
+            if( *px == HUGE_VAL || *py == HUGE_VAL )
+            {
+                *px = *py = HUGE_VAL;
+                continue;
+            }
+            lam = *px * WKP_DEG_TO_RAD;
+            phi = *py * WKP_DEG_TO_RAD;
+            if( fabs(phi) - MS_PI2 > 1e-12 || lam > 10 || lam < -10 ||
+                fabs(fabs(phi) - MS_PI2) <= 1e-10 )
+            {
+                *px = *py = HUGE_VAL;
+                continue;
+            }
+            *px = WEBMERC_RADIUS * msProjectAdjustLongitude(lam);
+            *py = WEBMERC_RADIUS * asinh(tan(phi));
+        }
+    }
+    else if( reprojector->wkp_in == wkp_gmerc && reprojector->wkp_out == wkp_lonlat )
+    {
+        for( i = 0; i < npoints; i++ )
+        {
+            double* px = (double*)((char*)x + i * stride_x);
+            double* py = (double*)((char*)y + i * stride_y);
+            if( *px == HUGE_VAL || *py == HUGE_VAL )
+            {
+                *px = *py = HUGE_VAL;
+                continue;
+            }
+            *px = msProjectAdjustLongitude(*px / WEBMERC_RADIUS) * WKP_RAD_TO_DEG;
+            *py = atan(sinh(*py / WEBMERC_RADIUS)) * WKP_RAD_TO_DEG;
+        }
+    }
+}
+
 /************************************************************************/
 /*                        msProjectCreateReprojector()                  */
 /************************************************************************/
@@ -379,6 +461,18 @@ reprojectionObj* msProjectCreateReprojector(projectionObj* in, projectionObj* ou
         /* do nothing, no transformation required */
     }
     /* -------------------------------------------------------------------- */
+    /*      Between EPSG:4326 and EPSG:3857 we use closed form formulas     */
+    /*      and bypass PROJ entirely.                                       */
+    /* -------------------------------------------------------------------- */
+    else if( in && in->proj && out && out->proj &&
+             in->wellknownprojection != wkp_none &&
+             out->wellknownprojection != wkp_none ) {
+        if( in->wellknownprojection != out->wellknownprojection ) {
+            obj->wkp_in = in->wellknownprojection;
+            obj->wkp_out = out->wellknownprojection;
+        }
+    }
+    /* -------------------------------------------------------------------- */
     /*      If we have a fully defined input coordinate system and          */
     /*      output coordinate system, then we will use createNormalizedPJ   */
     /* -------------------------------------------------------------------- */
@@ -452,6 +546,7 @@ void msProjectDestroyReprojector(reprojectionObj* reprojector)
     if( reprojector->bFreePJ )
         proj_destroy(reprojector->pj);
     msFreeShape(&(reprojector->splitShape));
+    msFree(reprojector->tmpPoints);
     msFree(reprojector);
 }
 
@@ -462,11 +557,15 @@ void msProjectDestroyReprojector(reprojectionObj* reprojector)
 int msProjectTransformPoints( reprojectionObj* reprojector,
                               int npoints, double* x, double* y )
 {
-    proj_trans_generic (reprojector->pj, PJ_FWD,
-                        x, sizeof(double), npoints,
-                        y, sizeof(double), npoints,
-                        NULL, 0, 0,
-                        NULL, 0, 0 );
+    if( reprojector->pj )
+        proj_trans_generic (reprojector->pj, PJ_FWD,
+                            x, sizeof(double), npoints,
+                            y, sizeof(double), npoints,
+                            NULL, 0, 0,
+                            NULL, 0, 0 );
+    else if( reprojector->wkp_in != wkp_none )
+        msProjectWellKnownTransform(reprojector, npoints,
+                                    x, sizeof(double), y, sizeof(double));
     return MS_SUCCESS;
 }
 
@@ -497,6 +596,8 @@ struct reprojectionObj
     int should_do_line_cutting;
     shapeObj splitShape;
     int no_op;
+    pointObj* tmpPoints; /* scratch buffer for msProjectShapeLine() */
+    int tmpPointsAlloc;
 };
 
 /************************************************************************/
@@ -556,6 +657,7 @@ void msProjectDestroyReprojector(reprojectionObj* reprojector)
     if( !reprojector )
         return;
     msFreeShape(&(reprojector->splitShape));
+    msFree(reprojector->tmpPoints);
     msFree(reprojector);
 }
 
@@ -784,6 +886,41 @@ static int _msProcessAutoProjection(projectionObj *p)
   return(0);
 }
 
+/************************************************************************/
+/*                    msProjectGetWellKnownProjection()                 */
+/*                                                                      */
+/*      Identify EPSG:4326 and EPSG:3857 (or its EPSG:900913 alias),    */
+/*      for which msProjectCreateReprojector() installs closed form     */
+/*      transformations. Any parameter other than +epsgaxis, which      */
+/*      only matters for the axis order of OGC requests and not for     */
+/*      the coordinates seen by the reprojector, disables the fast path.*/
+/************************************************************************/
+
+static int msProjectGetWellKnownProjection(projectionObj *p)
+{
+  int i;
+  const char *code;
+
+  if( p->numargs < 1 )
+    return wkp_none;
+  for( i = 1; i < p->numargs; i++ ) {
+    const char* arg = p->args[i][0] == '+' ? p->args[i] + 1 : p->args[i];
+    if( strncmp(arg, "epsgaxis=", strlen("epsgaxis=")) != 0 )
+      return wkp_none;
+  }
+
+  code = p->args[0][0] == '+' ? p->args[0] + 1 : p->args[0];
+  if( strncasecmp(code, "init=epsg:", strlen("init=epsg:")) != 0 )
+    return wkp_none;
+  code += strlen("init=epsg:");
+
+  if( strcmp(code, "4326") == 0 )
+    return wkp_lonlat;
+  if( strcmp(code, "3857") == 0 || strcmp(code, "900913") == 0 )
+    return wkp_gmerc;
+  return wkp_none;
+}
+
 int msProcessProjection(projectionObj *p)
 {
   assert( p->proj == NULL );
@@ -889,15 +1026,7 @@ int msProcessProjection(projectionObj *p)
   msReleaseLock( TLOCK_PROJ );
 #endif
 
-#ifdef USE_PROJ_FASTPATHS
-  if(strcasestr(p->args[0],"epsg:4326")) {
-    p->wellknownprojection = wkp_lonlat;
-  } else if(strcasestr(p->args[0],"epsg:3857")) {
-    p->wellknownprojection = wkp_gmerc;
-  } else {
-    p->wellknownprojection = wkp_none;
-  }
-#endif
+  p->wellknownprojection = msProjectGetWellKnownProjection(p);
 
 
   return(0);
@@ -970,6 +1099,14 @@ int msProjectPointEx(reprojectionObj* reprojector, pointObj *point)
     point->x = c.xyzt.x;
     point->y = c.xyzt.y;
   }
+  else if( reprojector->wkp_in != wkp_none ) {
+    msProjectWellKnownTransform(reprojector, 1,
+                                &(point->x), sizeof(pointObj),
+                                &(point->y), sizeof(pointObj));
+    if( point->x == HUGE_VAL || point->y == HUGE_VAL ) {
+      return MS_FAILURE;
+    }
+  }
 #else
   if( reprojector->no_op ) {
     /* do nothing, no transformation required */
@@ -1055,6 +1192,81 @@ int msProjectPointEx(reprojectionObj* reprojector, pointObj *point)
   return(MS_SUCCESS);
 }
 
+/************************************************************************/
+/*                          msProjectPoints()                           */
+/*                                                                      */
+/*      Reproject an array of points in place. With PROJ >= 6 all      */
+/*      the points are handed to PROJ in a single call. Points that    */
+/*      fail to reproject are set to HUGE_VAL, and MS_FAILURE is       */
+/*      returned if at least one of them failed.                        */
+/************************************************************************/
+int msProjectPoints(reprojectionObj* reprojector, int npoints, pointObj *points)
+{
+  projectionObj* in = reprojector->in;
+  projectionObj* out = reprojector->out;
+  int i;
+  int ret = MS_SUCCESS;
+
+  if( npoints <= 0 )
+    return MS_SUCCESS;
+
+#if PROJ_VERSION_MAJOR >= 6
+  if( in && in->gt.need_geotransform ) {
+    for( i = 0; i < npoints; i++ ) {
+      const double x = points[i].x;
+      const double y = points[i].y;
+      points[i].x = in->gt.geotransform[0]
+                    + in->gt.geotransform[1] * x
+                    + in->gt.geotransform[2] * y;
+      points[i].y = in->gt.geotransform[3]
+                    + in->gt.geotransform[4] * x
+                    + in->gt.geotransform[5] * y;
+    }
+  }
+
+  if( reprojector->pj ) {
+    proj_trans_generic (reprojector->pj, PJ_FWD,
+                        &(points[0].x), sizeof(pointObj), npoints,
+                        &(points[0].y), sizeof(pointObj), npoints,
+                        NULL, 0, 0,
+                        NULL, 0, 0 );
+  }
+  else if( reprojector->wkp_in != wkp_none ) {
+    msProjectWellKnownTransform(reprojector, npoints,
+                                &(points[0].x), sizeof(pointObj),
+                                &(points[0].y), sizeof(pointObj));
+  }
+
+  for( i = 0; i < npoints; i++ ) {
+    if( points[i].x == HUGE_VAL || points[i].y == HUGE_VAL ) {
+      points[i].x = points[i].y = HUGE_VAL;
+      ret = MS_FAILURE;
+    }
+    else if( out && out->gt.need_geotransform ) {
+      const double x = points[i].x;
+      const double y = points[i].y;
+      points[i].x = out->gt.invgeotransform[0]
+                    + out->gt.invgeotransform[1] * x
+                    + out->gt.invgeotransform[2] * y;
+      points[i].y = out->gt.invgeotransform[3]
+                    + out->gt.invgeotransform[4] * x
+                    + out->gt.invgeotransform[5] * y;
+    }
+  }
+#else
+  (void)in;
+  (void)out;
+  for( i = 0; i < npoints; i++ ) {
+    if( msProjectPointEx(reprojector, &(points[i])) == MS_FAILURE ) {
+      points[i].x = points[i].y = HUGE_VAL;
+      ret = MS_FAILURE;
+    }
+  }
+#endif
+
+  return ret;
+}
+
 /************************************************************************/
 /*                         msProjectGrowRect()                          */
 /************************************************************************/
@@ -1257,44 +1469,10 @@ msProjectShapeLine(reprojectionObj* reprojector,
   int numpoints_in = line->numpoints;
   int line_alloc = numpoints_in;
   int wrap_test;
+  pointObj *srcPoints, *prjPoints;
   projectionObj *in = reprojector->in;
   projectionObj *out = reprojector->out;
 
-#ifdef USE_PROJ_FASTPATHS
-#define MAXEXTENT 20037508.34
-#define M_PIby360 .0087266462599716479
-#define MAXEXTENTby180 111319.4907777777777777777
-#define p_x line->point[i].x
-#define p_y line->point[i].y
-  if(in->wellknownprojection == wkp_lonlat && out->wellknownprojection == wkp_gmerc) {
-    for( i = line->numpoints-1; i >= 0; i-- ) {
-      p_x *= MAXEXTENTby180;
-      p_y = log(tan((90 + p_y) * M_PIby360)) * MS_RAD_TO_DEG;
-      p_y *= MAXEXTENTby180;
-      if (p_x > MAXEXTENT) p_x = MAXEXTENT;
-      if (p_x < -MAXEXTENT) p_x = -MAXEXTENT;
-      if (p_y > MAXEXTENT) p_y = MAXEXTENT;
-      if (p_y < -MAXEXTENT) p_y = -MAXEXTENT;
-    }
-    return MS_SUCCESS;
-  }
-  if(in->wellknownprojection == wkp_gmerc && out->wellknownprojection == wkp_lonlat) {
-    for( i = line->numpoints-1; i >= 0; i-- ) {
-      if (p_x > MAXEXTENT) p_x = MAXEXTENT;
-      else if (p_x < -MAXEXTENT) p_x = -MAXEXTENT;
-      if (p_y > MAXEXTENT) p_y = MAXEXTENT;
-      else if (p_y < -MAXEXTENT) p_y = -MAXEXTENT;
-      p_x = (p_x / MAXEXTENT) * 180;
-      p_y = (p_y / MAXEXTENT) * 180;
-      p_y = MS_RAD_TO_DEG * (2 * atan(exp(p_y * MS_DEG_TO_RAD)) - MS_PI2);
-    }
-    msComputeBounds( shape ); /* fixes bug 1586 */
-    return MS_SUCCESS;
-  }
-#undef p_x
-#undef p_y
-#endif
-
 #ifdef USE_GEOS
   if( shape->type == MS_SHAPE_LINE &&
       msProjectShapeShouldDoLineCutting(reprojector) )
@@ -1342,6 +1520,23 @@ msProjectShapeLine(reprojectionObj* reprojector,
   wrap_test = out != NULL && out->proj != NULL && msProjIsGeographicCRS(out)
               && !msProjIsGeographicCRS(in);
 
+  /* -------------------------------------------------------------------- */
+  /*      Reproject all the points of the line at once. The first half   */
+  /*      of the scratch buffer keeps the source points, as the output   */
+  /*      line may overwrite them, and the second half receives the      */
+  /*      reprojected ones.                                               */
+  /* -------------------------------------------------------------------- */
+  if( reprojector->tmpPointsAlloc < 2 * numpoints_in ) {
+    reprojector->tmpPointsAlloc = 2 * numpoints_in;
+    reprojector->tmpPoints = (pointObj*) msSmallRealloc(
+        reprojector->tmpPoints, sizeof(pointObj) * reprojector->tmpPointsAlloc);
+  }
+  srcPoints = reprojector->tmpPoints;
+  prjPoints = reprojector->tmpPoints + numpoints_in;
+  memcpy(srcPoints, line->point, sizeof(pointObj) * numpoints_in);
+  memcpy(prjPoints, line->point, sizeof(pointObj) * numpoints_in);
+  msProjectPoints(reprojector, numpoints_in, prjPoints);
+
   line->numpoints = 0;
 
   memset( &lastPoint, 0, sizeof(lastPoint) );
@@ -1351,9 +1546,11 @@ msProjectShapeLine(reprojectionObj* reprojector,
   /* -------------------------------------------------------------------- */
   for( i=0; i < numpoints_in; i++ ) {
     int ms_err;
-    wrkPoint = thisPoint = line->point[i];
+    thisPoint = srcPoints[i];
+    wrkPoint = prjPoints[i];
 
-    ms_err = msProjectPointEx(reprojector, &wrkPoint );
+    ms_err = ( wrkPoint.x == HUGE_VAL || wrkPoint.y == HUGE_VAL ) ?
+             MS_FAILURE : MS_SUCCESS;
 
     /* -------------------------------------------------------------------- */
     /*      Apply wrap logic.                                               */
@@ -1525,44 +1722,6 @@ int msProjectShape(projectionObj *in, projectionObj *out, shapeObj *shape)
 int msProjectShapeEx(reprojectionObj* reprojector, shapeObj *shape)
 {
   int i;
-#ifdef USE_PROJ_FASTPATHS
-  int j;
-
-#define p_x shape->line[i].point[j].x
-#define p_y shape->line[i].point[j].y
-  if(in->wellknownprojection == wkp_lonlat && out->wellknownprojection == wkp_gmerc) {
-    for( i = shape->numlines-1; i >= 0; i-- ) {
-      for( j = shape->line[i].numpoints-1; j >= 0; j-- ) {
-        p_x *= MAXEXTENTby180;
-        p_y = log(tan((90 + p_y) * M_PIby360)) * MS_RAD_TO_DEG;
-        p_y *= MAXEXTENTby180;
-        if (p_x > MAXEXTENT) p_x = MAXEXTENT;
-        else if (p_x < -MAXEXTENT) p_x = -MAXEXTENT;
-        if (p_y > MAXEXTENT) p_y = MAXEXTENT;
-        else if (p_y < -MAXEXTENT) p_y = -MAXEXTENT;
-      }
-    }
-    msComputeBounds( shape ); /* fixes bug 1586 */
-    return MS_SUCCESS;
-  }
-  if(in->wellknownprojection == wkp_gmerc && out->wellknownprojection == wkp_lonlat) {
-    for( i = shape->numlines-1; i >= 0; i-- ) {
-      for( j = shape->line[i].numpoints-1; j >= 0; j-- ) {
-        if (p_x > MAXEXTENT) p_x = MAXEXTENT;
-        else if (p_x < -MAXEXTENT) p_x = -MAXEXTENT;
-        if (p_y > MAXEXTENT) p_y = MAXEXTENT;
-        else if (p_y < -MAXEXTENT) p_y = -MAXEXTENT;
-        p_x = (p_x / MAXEXTENT) * 180;
-        p_y = (p_y / MAXEXTENT) * 180;
-        p_y = MS_RAD_TO_DEG * (2 * atan(exp(p_y * MS_DEG_TO_RAD)) - MS_PI2);
-      }
-    }
-    msComputeBounds( shape ); /* fixes bug 1586 */
-    return MS_SUCCESS;
-  }
-#undef p_x
-#undef p_y
-#endif
 
   for( i = shape->numlines-1; i >= 0; i-- ) {
     if( shape->type == MS_SHAPE_LINE || shape->type == MS_SHAPE_POLYGON ) {
@@ -1644,10 +1803,8 @@ int msProjectLineEx(reprojectionObj* reprojector, lineObj *line)
       }
     }
   } else {
-    for(i=0; i<line->numpoints; i++) {
-      if( msProjectPointEx(reprojector, &(line->point[i])) == MS_FAILURE )
-        return MS_FAILURE;
-    }
+    if( msProjectPoints(reprojector, line->numpoints, line->point) == MS_FAILURE )
+      return MS_FAILURE;
   }
 
   return(MS_SUCCESS);
@@ -1663,6 +1820,7 @@ static
 int msProjectRectGrid(reprojectionObj* reprojector, rectObj *rect)
 {
   pointObj prj_point;
+  pointObj column[NUMBER_OF_SAMPLE_POINTS+1];
   rectObj prj_rect;
   int     failure=0;
   int     ix, iy;
@@ -1691,6 +1849,7 @@ int msProjectRectGrid(reprojectionObj* reprojector, rectObj *rect)
   msProjectGrowRect(reprojector,&prj_rect,&prj_point,
                     &failure);
 
+  /* reproject the grid one column at a time */
   failure = 0;
   for(ix = 0; ix <= NUMBER_OF_SAMPLE_POINTS; ix++ ) {
     x = rect->minx + ix * dx;
@@ -1698,10 +1857,25 @@ int msProjectRectGrid(reprojectionObj* reprojector, rectObj *rect)
     for(iy = 0; iy <= NUMBER_OF_SAMPLE_POINTS; iy++ ) {
       y = rect->miny + iy * dy;
 
-      prj_point.x = x;
-      prj_point.y = y;
-      msProjectGrowRect(reprojector,&prj_rect,&prj_point,
-                        &failure);
+      column[iy].x = x;
+      column[iy].y = y;
+#ifdef USE_POINT_Z_M
+      column[iy].z = 0.0;
+      column[iy].m = 0.0;
+#endif /* USE_POINT_Z_M */
+    }
+
+    msProjectPoints(reprojector, NUMBER_OF_SAMPLE_POINTS+1, column);
+
+    for(iy = 0; iy <= NUMBER_OF_SAMPLE_POINTS; iy++ ) {
+      if( column[iy].x == HUGE_VAL ) {
+        failure++;
+        continue;
+      }
+      prj_rect.miny = MS_MIN(prj_rect.miny, column[iy].y);
+      prj_rect.maxy = MS_MAX(prj_rect.maxy, column[iy].y);
+      prj_rect.minx = MS_MIN(prj_rect.minx, column[iy].x);
+      prj_rect.maxx = MS_MAX(prj_rect.maxx, column[iy].x);
     }
   }
 
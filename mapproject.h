@@ -93,6 +93,7 @@ typedef struct projectionContext projectionContext;
   MS_DLL_EXPORT int msIsAxisInverted(int epsg_code);
   MS_DLL_EXPORT int msProjectPoint(projectionObj *in, projectionObj *out, pointObj *point); /* legacy interface */
   MS_DLL_EXPORT int msProjectPointEx(reprojectionObj* reprojector, pointObj *point);
+  MS_DLL_EXPORT int msProjectPoints(reprojectionObj* reprojector, int npoints, pointObj *points);
   MS_DLL_EXPORT int msProjectShape(projectionObj *in, projectionObj *out, shapeObj *shape); /* legacy interface */
   MS_DLL_EXPORT int msProjectShapeEx(reprojectionObj* reprojector, shapeObj *shape);
   MS_DLL_EXPORT int msProjectLine(projectionObj *in, projectionObj *out, lineObj *line); /* legacy interface */
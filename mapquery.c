@@ -76,6 +76,9 @@ int msInitQuery(queryObj *query) {
   query->max_cached_shape_count = 0;
   query->max_cached_shape_ram_amount = 0;
 
+  query->shape_callback = NULL;
+  query->shape_callback_data = NULL;
+
   return MS_SUCCESS;
 }
 
@@ -199,42 +202,46 @@ static int canCacheShape(mapObj* map, queryCacheObj *queryCache,
   return MS_TRUE;
 }
 
-static int addResult(mapObj* map, resultCacheObj *cache,
+static int addResult(mapObj* map, layerObj *lp,
                      queryCacheObj* queryCache, shapeObj *shape)
 {
   int i;
-  int shape_ram_size = (map->query.max_cached_shape_ram_amount > 0) ? 
-                                            msGetShapeRAMSize( shape ) : 0;
-  int store_shape = canCacheShape (map, queryCache, shape, shape_ram_size);
+  resultCacheObj *cache = lp->resultcache;
 
-  if(cache->numresults == cache->cachesize) { /* just add it to the end */
-    if(cache->cachesize == 0)
-      cache->results = (resultObj *) malloc(sizeof(resultObj)*MS_RESULTCACHEINCREMENT);
-    else
-      cache->results = (resultObj *) realloc(cache->results, sizeof(resultObj)*(cache->cachesize+MS_RESULTCACHEINCREMENT));
-    if(!cache->results) {
-      msSetError(MS_MEMERR, "Realloc() error.", "addResult()");
-      return(MS_FAILURE);
+  if( !map->query.shape_callback ) {
+    int shape_ram_size = (map->query.max_cached_shape_ram_amount > 0) ?
+                                              msGetShapeRAMSize( shape ) : 0;
+    int store_shape = canCacheShape (map, queryCache, shape, shape_ram_size);
+
+    if(cache->numresults == cache->cachesize) { /* just add it to the end */
+      if(cache->cachesize == 0)
+        cache->results = (resultObj *) malloc(sizeof(resultObj)*MS_RESULTCACHEINCREMENT);
+      else
+        cache->results = (resultObj *) realloc(cache->results, sizeof(resultObj)*(cache->cachesize+MS_RESULTCACHEINCREMENT));
+      if(!cache->results) {
+        msSetError(MS_MEMERR, "Realloc() error.", "addResult()");
+        return(MS_FAILURE);
+      }
+      cache->cachesize += MS_RESULTCACHEINCREMENT;
     }
-    cache->cachesize += MS_RESULTCACHEINCREMENT;
-  }
 
-  i = cache->numresults;
+    i = cache->numresults;
 
-  cache->results[i].classindex = shape->classindex;
-  cache->results[i].tileindex = shape->tileindex;
-  cache->results[i].shapeindex = shape->index;
-  cache->results[i].resultindex = shape->resultindex;
-  if( store_shape )
-  {
-      cache->results[i].shape = (shapeObj*)msSmallMalloc(sizeof(shapeObj));
-      msInitShape(cache->results[i].shape);
-      msCopyShape(shape, cache->results[i].shape);
-      queryCache->cachedShapeCount ++;
-      queryCache->cachedShapeRAM += shape_ram_size;
+    cache->results[i].classindex = shape->classindex;
+    cache->results[i].tileindex = shape->tileindex;
+    cache->results[i].shapeindex = shape->index;
+    cache->results[i].resultindex = shape->resultindex;
+    if( store_shape )
+    {
+        cache->results[i].shape = (shapeObj*)msSmallMalloc(sizeof(shapeObj));
+        msInitShape(cache->results[i].shape);
+        msCopyShape(shape, cache->results[i].shape);
+        queryCache->cachedShapeCount ++;
+        queryCache->cachedShapeRAM += shape_ram_size;
+    }
+    else
+        cache->results[i].shape = NULL;
   }
-  else
-      cache->results[i].shape = NULL;
   cache->numresults++;
 
   cache->previousBounds = cache->bounds;
@@ -243,6 +250,10 @@ static int addResult(mapObj* map, resultCacheObj *cache,
   else
     msMergeRect(&(cache->bounds), &(shape->bounds));
 
+  /* streaming mode, the shape is not kept in the result cache */
+  if( map->query.shape_callback )
+    return map->query.shape_callback(map->query.shape_callback_data, lp, shape);
+
   return(MS_SUCCESS);
 }
 
@@ -651,12 +662,12 @@ int msQueryByIndex(mapObj *map)
     return(MS_FAILURE);
   }
   
-  addResult(map, lp->resultcache, &queryCache, &shape);
+  status = addResult(map, lp, &queryCache, &shape);
 
   msFreeShape(&shape);
   /* msLayerClose(lp); */
 
-  return(MS_SUCCESS);
+  return(status);
 }
 
 static char *filterTranslateToLogical(expressionObj *filter, char *filteritem) {
@@ -961,8 +972,11 @@ int msQueryByFilter(mapObj *map)
     
       if( map->query.only_cache_result_count )
         lp->resultcache->numresults ++;
-      else
-        addResult(map, lp->resultcache, &queryCache, &shape);
+      else if( addResult(map, lp, &queryCache, &shape) != MS_SUCCESS ) {
+        msFreeShape(&shape);
+        status = MS_FAILURE;
+        break;
+      }
       msFreeShape(&shape);
 
       if(map->query.mode == MS_QUERY_SINGLE) { /* no need to look any further */
@@ -1266,8 +1280,11 @@ int msQueryByRect(mapObj *map)
         }
         if( map->query.only_cache_result_count )
             lp->resultcache->numresults ++;
-        else
-            addResult(map, lp->resultcache, &queryCache, &shape);
+        else if( addResult(map, lp, &queryCache, &shape) != MS_SUCCESS ) {
+            msFreeShape(&shape);
+            status = MS_FAILURE;
+            break;
+        }
         --map->query.maxfeatures;
       }
       msFreeShape(&shape);
@@ -1445,6 +1462,9 @@ int msQueryByFeatures(mapObj *map)
       if(slp->project)
         msProjectShape(&(slp->projection), &(map->projection), &selectshape);
 
+      /* each selection feature is tested against many target shapes */
+      msBuildSegmentIndex(&selectshape);
+
       /* identify target shapes */
       searchrect = selectshape.bounds;
 
@@ -1595,7 +1615,11 @@ int msQueryByFeatures(mapObj *map)
             msFreeShape(&shape);
             continue;
           }
-          addResult(map, lp->resultcache, &queryCache, &shape);
+          if( addResult(map, lp, &queryCache, &shape) != MS_SUCCESS ) {
+            msFreeShape(&shape);
+            status = MS_FAILURE;
+            break;
+          }
         }
         msFreeShape(&shape);
 
@@ -1830,10 +1854,15 @@ int msQueryByPoint(mapObj *map)
         if(map->query.mode == MS_QUERY_SINGLE) {
           cleanupResultCache(lp->resultcache);
           initQueryCache(&queryCache);
-          addResult(map, lp->resultcache, &queryCache, &shape);
+          status = addResult(map, lp, &queryCache, &shape);
           t = d; /* next one must be closer */
         } else {
-          addResult(map, lp->resultcache, &queryCache, &shape);
+          status = addResult(map, lp, &queryCache, &shape);
+        }
+        if( status != MS_SUCCESS ) {
+          msFreeShape(&shape);
+          status = MS_FAILURE;
+          break;
         }
       }
 
@@ -1874,6 +1903,49 @@ int msQueryByPoint(mapObj *map)
   return(MS_FAILURE);
 }
 
+/*
+** Intersection test of a candidate shape with the query shape of
+** msQueryByShape(). The msIntersect*() functions define the result; for
+** instance a point on the right or top edge of a polygon is outside of it.
+** The prepared GEOS geometry of the query shape, when there is one, only
+** settles the cases where both agree: shapes that lie in the interior of
+** the query shape, and shapes that are disjoint from it. Shapes that reach
+** the boundary of the query shape are left to msIntersect*().
+*/
+static int msQueryShapeIntersects(shapeObj *qshape, shapeObj *shape)
+{
+#ifdef USE_GEOS
+  if(qshape->preparedgeometry) {
+    if(msGEOSContainsProperly(qshape, shape) == MS_TRUE)
+      return MS_TRUE;
+    if(msGEOSIntersects(qshape, shape) == MS_FALSE)
+      return MS_FALSE;
+  }
+#endif
+
+  switch(qshape->type) {
+    case MS_SHAPE_POLYGON:
+      switch(shape->type) {
+        case MS_SHAPE_POINT:
+          return msIntersectMultipointPolygon(shape, qshape);
+        case MS_SHAPE_LINE:
+          return msIntersectPolylinePolygon(shape, qshape);
+        case MS_SHAPE_POLYGON:
+          return msIntersectPolygons(shape, qshape);
+      }
+      break;
+    case MS_SHAPE_LINE:
+      switch(shape->type) {
+        case MS_SHAPE_LINE:
+          return msIntersectPolylines(shape, qshape);
+        case MS_SHAPE_POLYGON:
+          return msIntersectPolylinePolygon(qshape, shape);
+      }
+      break;
+  }
+  return MS_FALSE;
+}
+
 int msQueryByShape(mapObj *map)
 {
   int start, stop=0, l;
@@ -1914,6 +1986,20 @@ int msQueryByShape(mapObj *map)
 
   msComputeBounds(qshape); /* make sure an accurate extent exists */
 
+#ifdef USE_GEOS
+  /* the query shape is tested against every candidate of every layer, so
+     prepare it once (rebuilding it, the shape may have changed since) */
+  msGEOSFreeGeometry(qshape);
+  if(qshape->type != MS_SHAPE_POINT)
+    msGEOSPrepareShape(qshape);
+#endif
+
+  /* the segment index used by the msIntersect*() and distance functions is
+     rebuilt for the same reason, large query shapes keep it for the query */
+  msFreeSegmentIndex(qshape);
+  if(qshape->type != MS_SHAPE_POINT)
+    msBuildSegmentIndex(qshape);
+
   for(l=start; l>=stop; l--) { /* each layer */
     reprojectionObj* reprojector = NULL;
     lp = (GET_LAYER(map, l));
@@ -2053,7 +2139,7 @@ int msQueryByShape(mapObj *map)
           switch(shape.type) { /* make sure shape actually intersects the shape */
             case MS_SHAPE_POINT:
               if(tolerance == 0) /* just test for intersection */
-                status = msIntersectMultipointPolygon(&shape, qshape);
+                status = msQueryShapeIntersects(qshape, &shape);
               else { /* check distance, distance=0 means they intersect */
                 distance = msDistanceShapeToShape(qshape, &shape);
                 if(distance < tolerance) status = MS_TRUE;
@@ -2061,7 +2147,7 @@ int msQueryByShape(mapObj *map)
               break;
             case MS_SHAPE_LINE:
               if(tolerance == 0) { /* just test for intersection */
-                status = msIntersectPolylinePolygon(&shape, qshape);
+                status = msQueryShapeIntersects(qshape, &shape);
               } else { /* check distance, distance=0 means they intersect */
                 distance = msDistanceShapeToShape(qshape, &shape);
                 if(distance < tolerance) status = MS_TRUE;
@@ -2069,7 +2155,7 @@ int msQueryByShape(mapObj *map)
               break;
             case MS_SHAPE_POLYGON:
               if(tolerance == 0) /* just test for intersection */
-                status = msIntersectPolygons(&shape, qshape);
+                status = msQueryShapeIntersects(qshape, &shape);
               else { /* check distance, distance=0 means they intersect */
                 distance = msDistanceShapeToShape(qshape, &shape);
                 if(distance < tolerance) status = MS_TRUE;
@@ -2092,7 +2178,7 @@ int msQueryByShape(mapObj *map)
               break;
             case MS_SHAPE_LINE:
               if(tolerance == 0) { /* just test for intersection */
-                status = msIntersectPolylines(&shape, qshape);
+                status = msQueryShapeIntersects(qshape, &shape);
               } else { /* check distance, distance=0 means they intersect */
                 distance = msDistanceShapeToShape(qshape, &shape);
                 if(distance < tolerance) status = MS_TRUE;
@@ -2100,7 +2186,7 @@ int msQueryByShape(mapObj *map)
               break;
             case MS_SHAPE_POLYGON:
               if(tolerance == 0) /* just test for intersection */
-                status = msIntersectPolylinePolygon(qshape, &shape);
+                status = msQueryShapeIntersects(qshape, &shape);
               else { /* check distance, distance=0 means they intersect */
                 distance = msDistanceShapeToShape(qshape, &shape);
                 if(distance < tolerance) status = MS_TRUE;
@@ -2128,7 +2214,11 @@ int msQueryByShape(mapObj *map)
           msFreeShape(&shape);
           continue;
         }
-        addResult(map, lp->resultcache, &queryCache, &shape);
+        if( addResult(map, lp, &queryCache, &shape) != MS_SUCCESS ) {
+          msFreeShape(&shape);
+          status = MS_FAILURE;
+          break;
+        }
       }
       msFreeShape(&shape);
 
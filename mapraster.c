@@ -30,6 +30,7 @@
  ****************************************************************************/
 
 #include <assert.h>
+#include <sys/stat.h>
 #include "mapserver.h"
 #include "mapfile.h"
 #include "mapresample.h"
@@ -224,33 +225,418 @@ int msGetClass_FloatRGB_WithFirstClassToTry(layerObj *layer, float fValue, int r
 }
 
 /************************************************************************/
-/*                      msRasterSetupTileLayer()                        */
+/*                       In-memory tile indexes                         */
 /*                                                                      */
-/*      Setup the tile layer.                                           */
+/*      Tile indexes referenced by file are loaded once per process     */
+/*      into a packed R-tree holding the tile bounds and the already    */
+/*      composed tile names, so that drawing a mosaic does not need to  */
+/*      open and scan the index for each request.  An index is reloaded */
+/*      when its .shp or .dbf modification time changes.                */
 /************************************************************************/
 
-int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
-                               rectObj* psearchrect,
-                               int is_query,
-                               int* ptilelayerindex, /* output */
-                               int* ptileitemindex, /* output */
-                               int* ptilesrsindex, /* output */
-                               layerObj **ptlp  /* output */ )
+#define MS_RASTER_TILEINDEX_CACHE_SIZE 16
+#define MS_RASTER_TILEINDEX_NODE_SIZE 16
+
+typedef struct {
+  rectObj bounds;
+  int first; /* first child node, or first entry of order[] for leaves */
+  int count;
+} rasterTileIndexNode;
+
+typedef struct {
+  char *key;
+  time_t mtime;
+  int refcount;
+  int cached;
+  unsigned int last_used;
+
+  int numtiles;
+  rectObj *bounds;
+  char **tilenames;
+  char **tilesrsnames;
+
+  int *order; /* tile ids in leaf order */
+  rasterTileIndexNode *nodes;
+  int numnodes;
+  int numleafnodes; /* nodes[0..numleafnodes-1] are leaves */
+} rasterTileIndexObj;
+
+/* Stored in the layerinfo of the (never opened) temporary tile layer */
+typedef struct {
+  rasterTileIndexObj *index;
+  int *hits;
+  int numhits;
+  int nexthit;
+} rasterTileIndexCursor;
+
+typedef struct {
+  double x, y;
+  int id;
+} rasterTileIndexSortItem;
+
+static rasterTileIndexObj *rasterTileIndexCache[MS_RASTER_TILEINDEX_CACHE_SIZE];
+static unsigned int rasterTileIndexCacheTick = 0;
+
+static void msDrawRasterFreeTileIndex(rasterTileIndexObj *index)
+{
+  int i;
+
+  if(index == NULL)
+    return;
+  for(i=0; i<index->numtiles; i++) {
+    msFree(index->tilenames[i]);
+    msFree(index->tilesrsnames[i]);
+  }
+  msFree(index->tilenames);
+  msFree(index->tilesrsnames);
+  msFree(index->bounds);
+  msFree(index->order);
+  msFree(index->nodes);
+  msFree(index->key);
+  msFree(index);
+}
+
+static int msDrawRasterCompareSortItemX(const void *a, const void *b)
 {
+  double ax = ((const rasterTileIndexSortItem*)a)->x;
+  double bx = ((const rasterTileIndexSortItem*)b)->x;
+  return (ax < bx) ? -1 : (ax > bx) ? 1 : 0;
+}
+
+static int msDrawRasterCompareSortItemY(const void *a, const void *b)
+{
+  double ay = ((const rasterTileIndexSortItem*)a)->y;
+  double by = ((const rasterTileIndexSortItem*)b)->y;
+  return (ay < by) ? -1 : (ay > by) ? 1 : 0;
+}
+
+static int msDrawRasterCompareInt(const void *a, const void *b)
+{
+  return *(const int*)a - *(const int*)b;
+}
+
+static void msDrawRasterInitTileIndexNode(rasterTileIndexNode *node,
+                                          const rectObj *bounds)
+{
+  node->bounds = *bounds;
+  node->count = 1;
+}
+
+static void msDrawRasterGrowTileIndexNode(rasterTileIndexNode *node,
+                                          const rectObj *bounds)
+{
+  node->bounds.minx = MS_MIN(node->bounds.minx, bounds->minx);
+  node->bounds.miny = MS_MIN(node->bounds.miny, bounds->miny);
+  node->bounds.maxx = MS_MAX(node->bounds.maxx, bounds->maxx);
+  node->bounds.maxy = MS_MAX(node->bounds.maxy, bounds->maxy);
+  node->count++;
+}
+
+/*
+** Builds the packed R-tree using Sort-Tile-Recursive ordering of the
+** leaves. Upper levels group consecutive nodes, which are already
+** spatially close after the STR sort.
+*/
+static void msDrawRasterBuildTileIndexTree(rasterTileIndexObj *index)
+{
+  const int M = MS_RASTER_TILEINDEX_NODE_SIZE;
+  int n = index->numtiles;
+  int numleaves, numslices, slicesize, numnodes, levelstart, levelcount;
+  int i, j;
+  rasterTileIndexSortItem *items;
+
+  if(n == 0)
+    return;
+
+  items = (rasterTileIndexSortItem*) msSmallMalloc(sizeof(rasterTileIndexSortItem) * n);
+  for(i=0; i<n; i++) {
+    items[i].x = (index->bounds[i].minx + index->bounds[i].maxx) / 2;
+    items[i].y = (index->bounds[i].miny + index->bounds[i].maxy) / 2;
+    items[i].id = i;
+  }
+
+  numleaves = (n + M - 1) / M;
+  numslices = (int) ceil(sqrt((double) numleaves));
+  slicesize = numslices * M;
+  qsort(items, n, sizeof(rasterTileIndexSortItem), msDrawRasterCompareSortItemX);
+  for(i=0; i<n; i+=slicesize)
+    qsort(items + i, MS_MIN(slicesize, n - i), sizeof(rasterTileIndexSortItem),
+          msDrawRasterCompareSortItemY);
+
+  index->order = (int*) msSmallMalloc(sizeof(int) * n);
+  for(i=0; i<n; i++)
+    index->order[i] = items[i].id;
+  msFree(items);
+
+  /* count the nodes of all levels */
+  numnodes = numleaves;
+  for(levelcount=numleaves; levelcount > 1; ) {
+    levelcount = (levelcount + M - 1) / M;
+    numnodes += levelcount;
+  }
+  index->nodes = (rasterTileIndexNode*) msSmallMalloc(sizeof(rasterTileIndexNode) * numnodes);
+  index->numleafnodes = numleaves;
+
+  /* leaves */
+  for(i=0; i<numleaves; i++) {
+    rasterTileIndexNode *node = &index->nodes[i];
+    node->first = i * M;
+    msDrawRasterInitTileIndexNode(node, &index->bounds[index->order[node->first]]);
+    for(j=node->first+1; j<n && j<node->first+M; j++)
+      msDrawRasterGrowTileIndexNode(node, &index->bounds[index->order[j]]);
+  }
+  index->numnodes = numleaves;
+
+  /* upper levels, up to the root which is the last node */
+  levelstart = 0;
+  levelcount = numleaves;
+  while(levelcount > 1) {
+    int nextstart = index->numnodes;
+    for(i=0; i<levelcount; i+=M) {
+      rasterTileIndexNode *node = &index->nodes[index->numnodes++];
+      node->first = levelstart + i;
+      msDrawRasterInitTileIndexNode(node, &index->nodes[node->first].bounds);
+      for(j=i+1; j<levelcount && j<i+M; j++)
+        msDrawRasterGrowTileIndexNode(node, &index->nodes[levelstart + j].bounds);
+    }
+    levelstart = nextstart;
+    levelcount = index->numnodes - nextstart;
+  }
+}
+
+/*
+** Returns the ids of the tiles overlapping rect, in index order so that
+** tiles are drawn in the same order as when reading the index itself.
+*/
+static void msDrawRasterSearchTileIndex(rasterTileIndexObj *index,
+                                        const rectObj *rect,
+                                        rasterTileIndexCursor *cursor)
+{
+  int stack[256];
+  int depth = 0, maxhits = 0;
+
+  cursor->hits = NULL;
+  cursor->numhits = 0;
+  cursor->nexthit = 0;
+
+  if(index->numnodes == 0)
+    return;
+
+  stack[depth++] = index->numnodes - 1;
+  while(depth > 0) {
+    rasterTileIndexNode *node = &index->nodes[stack[--depth]];
     int i;
-    char* requested_fields;
-    int status;
-    layerObj* tlp = NULL;
 
-    *ptilelayerindex = msGetLayerIndex(layer->map, layer->tileindex);
-    if(*ptilelayerindex == -1) { /* the tileindex references a file, not a layer */
+    if(!msRectOverlap(&node->bounds, rect))
+      continue;
+
+    if(node - index->nodes < index->numleafnodes) {
+      for(i=node->first; i<node->first+MS_RASTER_TILEINDEX_NODE_SIZE && i<index->numtiles; i++) {
+        int id = index->order[i];
+        if(!msRectOverlap(&index->bounds[id], rect))
+          continue;
+        if(cursor->numhits == maxhits) {
+          maxhits = maxhits ? maxhits * 2 : 64;
+          cursor->hits = (int*) msSmallRealloc(cursor->hits, sizeof(int) * maxhits);
+        }
+        cursor->hits[cursor->numhits++] = id;
+      }
+    } else {
+      for(i=node->first; i<node->first+node->count; i++)
+        stack[depth++] = i;
+    }
+  }
+
+  qsort(cursor->hits, cursor->numhits, sizeof(int), msDrawRasterCompareInt);
+}
+
+/*
+** Returns the index cached for key if it is still current, with a
+** reference taken. A stale index is dropped from the cache.
+*/
+static rasterTileIndexObj *msDrawRasterTileIndexCacheGet(const char *key,
+                                                         time_t mtime)
+{
+  rasterTileIndexObj *index = NULL, *stale = NULL;
+  int i;
+
+  msAcquireLock( TLOCK_TILEINDEX );
+  for(i=0; i<MS_RASTER_TILEINDEX_CACHE_SIZE; i++) {
+    rasterTileIndexObj *entry = rasterTileIndexCache[i];
+    if(entry == NULL || strcmp(entry->key, key) != 0)
+      continue;
+    if(entry->mtime == mtime) {
+      entry->refcount++;
+      entry->last_used = ++rasterTileIndexCacheTick;
+      index = entry;
+    } else {
+      rasterTileIndexCache[i] = NULL;
+      entry->cached = MS_FALSE;
+      if(entry->refcount == 0)
+        stale = entry;
+    }
+    break;
+  }
+  msReleaseLock( TLOCK_TILEINDEX );
+
+  msDrawRasterFreeTileIndex(stale);
+  return index;
+}
+
+/*
+** Adds a freshly loaded index, referenced by the caller, to the cache.
+** Returns the index to use, which is the cached one if another thread
+** loaded the same index meanwhile.
+*/
+static rasterTileIndexObj *msDrawRasterTileIndexCacheAdd(rasterTileIndexObj *index)
+{
+  rasterTileIndexObj *toFree = NULL, *result = index;
+  int i, iFree = -1, iLRU = -1;
+
+  msAcquireLock( TLOCK_TILEINDEX );
+  for(i=0; i<MS_RASTER_TILEINDEX_CACHE_SIZE; i++) {
+    rasterTileIndexObj *entry = rasterTileIndexCache[i];
+    if(entry == NULL) {
+      if(iFree < 0)
+        iFree = i;
+      continue;
+    }
+    if(strcmp(entry->key, index->key) == 0 && entry->mtime == index->mtime) {
+      entry->refcount++;
+      entry->last_used = ++rasterTileIndexCacheTick;
+      result = entry;
+      toFree = index;
+      break;
+    }
+    if(entry->refcount == 0 &&
+       (iLRU < 0 || entry->last_used < rasterTileIndexCache[iLRU]->last_used))
+      iLRU = i;
+  }
+
+  if(result == index) {
+    if(iFree < 0 && iLRU >= 0) {
+      iFree = iLRU;
+      toFree = rasterTileIndexCache[iLRU];
+    }
+    if(iFree >= 0) {
+      rasterTileIndexCache[iFree] = index;
+      index->cached = MS_TRUE;
+      index->last_used = ++rasterTileIndexCacheTick;
+    }
+  }
+  msReleaseLock( TLOCK_TILEINDEX );
+
+  msDrawRasterFreeTileIndex(toFree);
+  return result;
+}
+
+static void msDrawRasterTileIndexRelease(rasterTileIndexObj *index)
+{
+  int bFree;
+
+  msAcquireLock( TLOCK_TILEINDEX );
+  index->refcount--;
+  bFree = (index->refcount == 0 && !index->cached);
+  msReleaseLock( TLOCK_TILEINDEX );
+
+  if(bFree)
+    msDrawRasterFreeTileIndex(index);
+}
+
+/************************************************************************/
+/*                msDrawRasterCleanupTileIndexCache()                   */
+/*                                                                      */
+/*      Frees the in-memory tile indexes. Called from msGDALCleanup().  */
+/************************************************************************/
+
+void msDrawRasterCleanupTileIndexCache(void)
+{
+  int i;
+
+  msAcquireLock( TLOCK_TILEINDEX );
+  for(i=0; i<MS_RASTER_TILEINDEX_CACHE_SIZE; i++) {
+    rasterTileIndexObj *entry = rasterTileIndexCache[i];
+    if(entry == NULL)
+      continue;
+    rasterTileIndexCache[i] = NULL;
+    entry->cached = MS_FALSE;
+    if(entry->refcount == 0)
+      msDrawRasterFreeTileIndex(entry);
+  }
+  msReleaseLock( TLOCK_TILEINDEX );
+}
+
+/*
+** Whether the tileindex of layer can be served from memory: it must be a
+** shapefile referenced by path, and no per request filtering of the
+** index features may be needed.
+*/
+static int msDrawRasterTileIndexIsCacheable(layerObj *layer, int is_query)
+{
+  const char *tileindex_cache = msLayerGetProcessingKey(layer, "TILEINDEX_CACHE");
+
+  if(tileindex_cache && !(strcasecmp(tileindex_cache, "YES") == 0 ||
+                          strcasecmp(tileindex_cache, "ON") == 0 ||
+                          strcasecmp(tileindex_cache, "TRUE") == 0))
+    return MS_FALSE;
+  if(layer->filter.string || layer->filteritem)
+    return MS_FALSE;
+  if(is_query && layer->numscaletokens > 0)
+    return MS_FALSE;
+  return MS_TRUE;
+}
+
+/*
+** Resolves the tileindex the way the shapefile driver does and returns the
+** latest modification time of its .shp and .dbf files.
+*/
+static int msDrawRasterStatTileIndex(mapObj *map, layerObj *layer,
+                                     char szPath[MS_MAXPATHLEN],
+                                     time_t *pmtime)
+{
+  char szFile[MS_MAXPATHLEN];
+  struct stat stat_buf;
+  size_t len;
+  int pass;
+
+  for(pass=0; pass<2; pass++) {
+    if(pass == 0)
+      msBuildPath3(szPath, map->mappath, map->shapepath, layer->tileindex);
+    else
+      msBuildPath(szPath, map->mappath, layer->tileindex);
+
+    len = strlen(szPath);
+    if(len > 4 && strcasecmp(szPath + len - 4, ".shp") == 0)
+      szPath[len - 4] = '\0';
+
+    snprintf(szFile, sizeof(szFile), "%s.shp", szPath);
+    if(stat(szFile, &stat_buf) != 0)
+      continue;
+    *pmtime = stat_buf.st_mtime;
+
+    snprintf(szFile, sizeof(szFile), "%s.dbf", szPath);
+    if(stat(szFile, &stat_buf) == 0 && stat_buf.st_mtime > *pmtime)
+      *pmtime = stat_buf.st_mtime;
+    return MS_SUCCESS;
+  }
+
+  return MS_FAILURE;
+}
+
+/*
+** Creates the temporary shapefile layer used to read a tileindex given
+** as a file.
+*/
+static layerObj *msDrawRasterCreateTileLayer(mapObj *map, layerObj *layer,
+                                             int is_query)
+{
+    int i;
+    layerObj* tlp;
 
-      /* so we create a temporary layer */
       tlp = (layerObj *) malloc(sizeof(layerObj));
-      MS_CHECK_ALLOC(tlp, sizeof(layerObj), MS_FAILURE);
+      MS_CHECK_ALLOC(tlp, sizeof(layerObj), NULL);
 
       initLayer(tlp, map);
-      *ptlp = tlp;
 
       /* set a few parameters for a very basic shapefile-based layer */
       tlp->name = msStrdup("TILE");
@@ -262,7 +648,9 @@ int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
         tlp->map = map;  /*needed when scaletokens are applied, to extract current map scale */
         for(i = 0; i < layer->numscaletokens; i++) {
           if(msGrowLayerScaletokens(tlp) == NULL) {
-            return MS_FAILURE;
+            freeLayer(tlp);
+            free(tlp);
+            return NULL;
           }
           initScaleToken(&tlp->scaletokens[i]);
           msCopyScaleToken(&layer->scaletokens[i],&tlp->scaletokens[i]);
@@ -299,16 +687,19 @@ int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
         tlp->filter.type = layer->filter.type;
       }
 
-    } else {
-      if ( msCheckParentPointer(layer->map,"map")==MS_FAILURE )
-        return MS_FAILURE;
-      tlp = (GET_LAYER(layer->map, *ptilelayerindex));
-      *ptlp = tlp;
-    }
-    status = msLayerOpen(tlp);
-    if(status != MS_SUCCESS) {
-      return status;
-    }
+    return tlp;
+}
+
+/*
+** Requests the tileitem and tilesrs fields on the opened tile layer and
+** returns their indexes.
+*/
+static int msDrawRasterSelectTileItems(layerObj *layer, layerObj *tlp,
+                                       int* ptileitemindex,
+                                       int* ptilesrsindex)
+{
+    int i, status;
+    char* requested_fields;
 
     /* fetch tileitem and tilesrs fields */
     requested_fields = (char*) msSmallMalloc(sizeof(char)*(strlen(layer->tileitem)+1+
@@ -347,7 +738,152 @@ int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
                  layer->tilesrs);
       return MS_FAILURE;
     }
+    return MS_SUCCESS;
+}
+
+/*
+** Formats the name of the raster of a tile from its tileitem value.
+*/
+static void msDrawRasterFormatTileName(layerObj *layer, const char *value,
+                                       char* tilename, size_t sizeof_tilename)
+{
+      if(layer->data == NULL || strlen(layer->data) == 0 ) { /* assume whole filename is in attribute field */
+        strlcpy( tilename, value, sizeof_tilename);
+      } else
+        snprintf(tilename, sizeof_tilename, "%s/%s", value, layer->data);
+}
+
+/*
+** Reads the whole tileindex of layer into a new in-memory index.
+*/
+static rasterTileIndexObj *msDrawRasterLoadTileIndex(mapObj *map,
+                                                     layerObj *layer,
+                                                     const char *key,
+                                                     time_t mtime)
+{
+  rasterTileIndexObj *index;
+  layerObj *tlp;
+  int tileitemindex = -1, tilesrsindex = -1, maxtiles = 0;
+  int status;
+  rectObj extent;
+  shapeObj shape;
+  char tilename[MS_MAXPATHLEN];
+
+  tlp = msDrawRasterCreateTileLayer(map, layer, MS_FALSE);
+  if(tlp == NULL)
+    return NULL;
+
+  index = (rasterTileIndexObj*) msSmallCalloc(1, sizeof(rasterTileIndexObj));
+  index->key = msStrdup(key);
+  index->mtime = mtime;
+  index->refcount = 1;
+
+  status = msLayerOpen(tlp);
+  if(status == MS_SUCCESS)
+    status = msDrawRasterSelectTileItems(layer, tlp, &tileitemindex, &tilesrsindex);
+  if(status == MS_SUCCESS) {
+    if(msLayerGetExtent(tlp, &extent) != MS_SUCCESS) {
+      extent.minx = extent.miny = -1e300;
+      extent.maxx = extent.maxy = 1e300;
+    }
+    status = msLayerWhichShapes(tlp, extent, MS_FALSE);
+  }
+
+  if(status == MS_SUCCESS) {
+    msInitShape(&shape);
+    while((status = msLayerNextShape(tlp, &shape)) == MS_SUCCESS) {
+      if(index->numtiles == maxtiles) {
+        maxtiles = maxtiles ? maxtiles * 2 : 256;
+        index->bounds = (rectObj*) msSmallRealloc(index->bounds, sizeof(rectObj) * maxtiles);
+        index->tilenames = (char**) msSmallRealloc(index->tilenames, sizeof(char*) * maxtiles);
+        index->tilesrsnames = (char**) msSmallRealloc(index->tilesrsnames, sizeof(char*) * maxtiles);
+      }
+      msDrawRasterFormatTileName(layer, shape.values[tileitemindex],
+                                 tilename, sizeof(tilename));
+      index->bounds[index->numtiles] = shape.bounds;
+      index->tilenames[index->numtiles] = msStrdup(tilename);
+      index->tilesrsnames[index->numtiles] =
+        (tilesrsindex >= 0 && shape.values[tilesrsindex] != NULL) ?
+          msStrdup(shape.values[tilesrsindex]) : NULL;
+      index->numtiles++;
+      msFreeShape(&shape);
+    }
+  }
+
+  msLayerClose(tlp);
+  freeLayer(tlp);
+  free(tlp);
+
+  if(status == MS_FAILURE) {
+    msDrawRasterFreeTileIndex(index);
+    return NULL;
+  }
+
+  msDrawRasterBuildTileIndexTree(index);
 
+  if(layer->debug || map->debug)
+    msDebug("msDrawRasterLoadTileIndex(%s): loaded %d tiles from %s.\n",
+            layer->name, index->numtiles, layer->tileindex);
+
+  return index;
+}
+
+/*
+** Returns the in-memory index for layer, loading it if needed, or NULL
+** when it cannot be used and the tileindex must be read as a layer.
+** Sets bFailure if loading the index failed.
+*/
+static rasterTileIndexObj *msDrawRasterGetTileIndex(mapObj *map,
+                                                    layerObj *layer,
+                                                    int *bFailure)
+{
+  char szPath[MS_MAXPATHLEN];
+  char *key;
+  time_t mtime;
+  rasterTileIndexObj *index;
+
+  *bFailure = MS_FALSE;
+  if(msDrawRasterStatTileIndex(map, layer, szPath, &mtime) != MS_SUCCESS)
+    return NULL;
+
+  key = msStrdup(szPath);
+  key = msStringConcatenate(key, "\n");
+  key = msStringConcatenate(key, layer->tileitem);
+  key = msStringConcatenate(key, "\n");
+  key = msStringConcatenate(key, layer->tilesrs ? layer->tilesrs : "");
+  key = msStringConcatenate(key, "\n");
+  key = msStringConcatenate(key, layer->data ? layer->data : "");
+
+  index = msDrawRasterTileIndexCacheGet(key, mtime);
+  if(index == NULL) {
+    index = msDrawRasterLoadTileIndex(map, layer, key, mtime);
+    if(index == NULL)
+      *bFailure = MS_TRUE;
+    else
+      index = msDrawRasterTileIndexCacheAdd(index);
+  }
+  msFree(key);
+
+  return index;
+}
+
+/* Returns the in-memory index cursor of a tile layer, if it has one */
+static rasterTileIndexCursor *msDrawRasterGetTileIndexCursor(layerObj *tlp)
+{
+  /* a tile layer using the in-memory index is never opened, so it has */
+  /* no vtable and its layerinfo is free to hold the cursor */
+  if(tlp->vtable == NULL && tlp->layerinfo != NULL)
+    return (rasterTileIndexCursor*) tlp->layerinfo;
+  return NULL;
+}
+
+/*
+** Projects the search rectangle into the tileindex coordinates.
+*/
+static int msDrawRasterProjectTileSearchRect(mapObj *map, layerObj *layer,
+                                             layerObj *tlp,
+                                             rectObj* psearchrect)
+{
     /* if necessary, project the searchrect to source coords */
     if((map->projection.numargs > 0) && (layer->projection.numargs > 0) &&
         !EQUAL(layer->projection.args[0], "auto")) {
@@ -365,6 +901,84 @@ int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
         return MS_FAILURE;
       }
     }
+    return MS_SUCCESS;
+}
+
+/************************************************************************/
+/*                      msRasterSetupTileLayer()                        */
+/*                                                                      */
+/*      Setup the tile layer.                                           */
+/************************************************************************/
+
+int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
+                               rectObj* psearchrect,
+                               int is_query,
+                               int* ptilelayerindex, /* output */
+                               int* ptileitemindex, /* output */
+                               int* ptilesrsindex, /* output */
+                               layerObj **ptlp  /* output */ )
+{
+    int status;
+    layerObj* tlp = NULL;
+
+    *ptilelayerindex = msGetLayerIndex(layer->map, layer->tileindex);
+    if(*ptilelayerindex == -1) { /* the tileindex references a file, not a layer */
+
+      if( msDrawRasterTileIndexIsCacheable(layer, is_query) ) {
+        int bFailure;
+        rasterTileIndexObj *index = msDrawRasterGetTileIndex(map, layer, &bFailure);
+        if( bFailure )
+          return MS_FAILURE;
+
+        if( index != NULL ) {
+          rasterTileIndexCursor *cursor;
+
+          /* an empty layer that only carries the cursor */
+          tlp = (layerObj *) malloc(sizeof(layerObj));
+          MS_CHECK_ALLOC(tlp, sizeof(layerObj), MS_FAILURE);
+          initLayer(tlp, map);
+          *ptlp = tlp;
+
+          cursor = (rasterTileIndexCursor*) msSmallCalloc(1, sizeof(rasterTileIndexCursor));
+          cursor->index = index;
+          tlp->layerinfo = cursor;
+
+          *ptileitemindex = 0;
+          *ptilesrsindex = layer->tilesrs ? 1 : -1;
+
+          if( msDrawRasterProjectTileSearchRect(map, layer, tlp, psearchrect) != MS_SUCCESS )
+            return MS_FAILURE;
+
+          msDrawRasterSearchTileIndex(index, psearchrect, cursor);
+          return cursor->numhits > 0 ? MS_SUCCESS : MS_DONE;
+        }
+      }
+
+      /* so we create a temporary layer */
+      tlp = msDrawRasterCreateTileLayer(map, layer, is_query);
+      if( tlp == NULL )
+        return MS_FAILURE;
+      *ptlp = tlp;
+
+    } else {
+      if ( msCheckParentPointer(layer->map,"map")==MS_FAILURE )
+        return MS_FAILURE;
+      tlp = (GET_LAYER(layer->map, *ptilelayerindex));
+      *ptlp = tlp;
+    }
+    status = msLayerOpen(tlp);
+    if(status != MS_SUCCESS) {
+      return status;
+    }
+
+    status = msDrawRasterSelectTileItems(layer, tlp, ptileitemindex, ptilesrsindex);
+    if(status != MS_SUCCESS) {
+      return status;
+    }
+
+    if( msDrawRasterProjectTileSearchRect(map, layer, tlp, psearchrect) != MS_SUCCESS )
+      return MS_FAILURE;
+
     return msLayerWhichShapes(tlp, *psearchrect, MS_FALSE);
 }
 
@@ -377,7 +991,20 @@ int msDrawRasterSetupTileLayer(mapObj *map, layerObj *layer,
 void msDrawRasterCleanupTileLayer(layerObj* tlp,
                                   int tilelayerindex)
 {
-    msLayerClose(tlp);
+    rasterTileIndexCursor *cursor;
+
+    if(tlp == NULL)
+      return;
+
+    cursor = msDrawRasterGetTileIndexCursor(tlp);
+    if(cursor) {
+      msDrawRasterTileIndexRelease(cursor->index);
+      msFree(cursor->hits);
+      msFree(cursor);
+      tlp->layerinfo = NULL;
+    } else {
+      msLayerClose(tlp);
+    }
     if(tilelayerindex == -1) {
       freeLayer(tlp);
       free(tlp);
@@ -401,16 +1028,29 @@ int msDrawRasterIterateTileIndex(layerObj *layer,
                                  size_t sizeof_tilesrsname)
 {
       int status;
+      rasterTileIndexCursor *cursor = msDrawRasterGetTileIndexCursor(tlp);
+
+      if( cursor ) {
+        int id;
+
+        if( cursor->nexthit >= cursor->numhits )
+          return MS_DONE;
+        id = cursor->hits[cursor->nexthit++];
+
+        strlcpy( tilename, cursor->index->tilenames[id], sizeof_tilename );
+        tilesrsname[0] = '\0';
+        if( tilesrsindex >= 0 && cursor->index->tilesrsnames[id] != NULL )
+          strlcpy( tilesrsname, cursor->index->tilesrsnames[id], sizeof_tilesrsname );
+        return MS_SUCCESS;
+      }
 
       status = msLayerNextShape(tlp, ptshp);
       if( status == MS_FAILURE || status == MS_DONE ) {
         return status;
       }
 
-      if(layer->data == NULL || strlen(layer->data) == 0 ) { /* assume whole filename is in attribute field */
-        strlcpy( tilename, ptshp->values[tileitemindex], sizeof_tilename);
-      } else
-        snprintf(tilename, sizeof_tilename, "%s/%s", ptshp->values[tileitemindex], layer->data);
+      msDrawRasterFormatTileName(layer, ptshp->values[tileitemindex],
+                                 tilename, sizeof_tilename);
 
       tilesrsname[0] = '\0';
 
@@ -603,6 +1243,170 @@ CheckDatasetReturnType msDrawRasterLayerLowCheckDataset(mapObj *map,
     return CDRT_OK;
 }
 
+/************************************************************************/
+/*                          Dataset handle pool                         */
+/*                                                                      */
+/*      Datasets whose close is deferred are kept open in a small       */
+/*      process wide pool, keyed by path and connection options.  A     */
+/*      pooled handle is lent to a single caller at a time, so that     */
+/*      concurrent draws each read through their own handle and no      */
+/*      global lock needs to be held while reading.  Idle handles are   */
+/*      evicted in least recently used order.                           */
+/************************************************************************/
+
+#define MS_RASTER_DATASET_POOL_SIZE 32
+
+typedef struct {
+  char *key;
+  GDALDatasetH hDS;
+  int in_use;
+  unsigned int last_used;
+} rasterDatasetPoolEntry;
+
+static rasterDatasetPoolEntry rasterDatasetPool[MS_RASTER_DATASET_POOL_SIZE];
+static unsigned int rasterDatasetPoolTick = 0;
+
+static char *msDrawRasterDatasetKey(const char *path, char **connectionoptions)
+{
+  char *key = msStrdup(path);
+  int i;
+
+  for(i=0; connectionoptions && connectionoptions[i]; i++) {
+    key = msStringConcatenate(key, "\n");
+    key = msStringConcatenate(key, connectionoptions[i]);
+  }
+  return key;
+}
+
+/* Lends an idle pooled handle for key, or returns NULL */
+static GDALDatasetH msDrawRasterPoolAcquire(const char *key)
+{
+  GDALDatasetH hDS = NULL;
+  int i;
+
+  msAcquireLock( TLOCK_RASTERPOOL );
+  for(i=0; i<MS_RASTER_DATASET_POOL_SIZE; i++) {
+    rasterDatasetPoolEntry *entry = &rasterDatasetPool[i];
+    if(entry->hDS && !entry->in_use && strcmp(entry->key, key) == 0) {
+      entry->in_use = MS_TRUE;
+      entry->last_used = ++rasterDatasetPoolTick;
+      hDS = entry->hDS;
+      break;
+    }
+  }
+  msReleaseLock( TLOCK_RASTERPOOL );
+
+  return hDS;
+}
+
+/*
+** Registers a freshly opened handle, lent to the caller, so that it can be
+** kept once released. If the pool is full the least recently used idle
+** handle is closed, if all handles are in use the new one is not pooled.
+*/
+static void msDrawRasterPoolRegister(GDALDatasetH hDS, const char *key)
+{
+  GDALDatasetH hDSToClose = NULL;
+  rasterDatasetPoolEntry *entry;
+  int i, iFree = -1, iLRU = -1;
+
+  msAcquireLock( TLOCK_RASTERPOOL );
+  for(i=0; i<MS_RASTER_DATASET_POOL_SIZE; i++) {
+    entry = &rasterDatasetPool[i];
+    if(entry->hDS == NULL) {
+      iFree = i;
+      break;
+    }
+    if(!entry->in_use &&
+       (iLRU < 0 || entry->last_used < rasterDatasetPool[iLRU].last_used))
+      iLRU = i;
+  }
+
+  if(iFree < 0 && iLRU >= 0) {
+    iFree = iLRU;
+    hDSToClose = rasterDatasetPool[iFree].hDS;
+    msFree(rasterDatasetPool[iFree].key);
+  }
+
+  if(iFree >= 0) {
+    entry = &rasterDatasetPool[iFree];
+    entry->key = msStrdup(key);
+    entry->hDS = hDS;
+    entry->in_use = MS_TRUE;
+    entry->last_used = ++rasterDatasetPoolTick;
+  }
+  msReleaseLock( TLOCK_RASTERPOOL );
+
+  if(hDSToClose)
+    GDALClose(hDSToClose);
+}
+
+/*
+** Gives a handle back. If bKeep is set and the handle is pooled it stays
+** open for later use, otherwise it is closed.
+*/
+static void msDrawRasterPoolRelease(GDALDatasetH hDS, int bKeep)
+{
+  int i;
+
+  msAcquireLock( TLOCK_RASTERPOOL );
+  for(i=0; i<MS_RASTER_DATASET_POOL_SIZE; i++) {
+    rasterDatasetPoolEntry *entry = &rasterDatasetPool[i];
+    if(entry->hDS == hDS) {
+      if(bKeep) {
+        entry->in_use = MS_FALSE;
+        entry->last_used = ++rasterDatasetPoolTick;
+      } else {
+        msFree(entry->key);
+        memset(entry, 0, sizeof(rasterDatasetPoolEntry));
+      }
+      break;
+    }
+  }
+  msReleaseLock( TLOCK_RASTERPOOL );
+
+  if(!bKeep || i == MS_RASTER_DATASET_POOL_SIZE)
+    GDALClose(hDS);
+}
+
+/************************************************************************/
+/*                  msDrawRasterCleanupDatasetPool()                    */
+/*                                                                      */
+/*      Closes all pooled dataset handles. Called from msGDALCleanup(). */
+/************************************************************************/
+
+void msDrawRasterCleanupDatasetPool(void)
+{
+  int i;
+
+  msAcquireLock( TLOCK_RASTERPOOL );
+  for(i=0; i<MS_RASTER_DATASET_POOL_SIZE; i++) {
+    rasterDatasetPoolEntry *entry = &rasterDatasetPool[i];
+    if(entry->hDS && !entry->in_use) {
+      GDALClose(entry->hDS);
+      msFree(entry->key);
+      memset(entry, 0, sizeof(rasterDatasetPoolEntry));
+    }
+  }
+  msReleaseLock( TLOCK_RASTERPOOL );
+}
+
+/*
+** Whether datasets of the layer are kept open after drawing: the default
+** for single file layers, or with PROCESSING "CLOSE_CONNECTION=DEFER".
+*/
+static int msDrawRasterLayerDefersClose(layerObj *layer)
+{
+  const char *close_connection;
+  close_connection = msLayerGetProcessingKey( layer,
+                   "CLOSE_CONNECTION" );
+
+  if( close_connection == NULL && layer->tileindex == NULL )
+    close_connection = "DEFER";
+
+  return close_connection != NULL && strcasecmp(close_connection,"DEFER") == 0;
+}
+
 /************************************************************************/
 /*              msDrawRasterLayerLowOpenDataset()                       */
 /************************************************************************/
@@ -613,6 +1417,9 @@ void* msDrawRasterLayerLowOpenDataset(mapObj *map, layerObj *layer,
                                       char** p_decrypted_path)
 {
   const char* pszPath;
+  char** connectionoptions = NULL;
+  char *key;
+  GDALDatasetH hDS;
 
   msGDALInitialize();
 
@@ -642,55 +1449,43 @@ void* msDrawRasterLayerLowOpenDataset(mapObj *map, layerObj *layer,
   if( *p_decrypted_path == NULL )
     return NULL;
 
-  msAcquireLock( TLOCK_GDAL );
   if( !layer->tileindex )
-  {
-    char** connectionoptions = msGetStringListFromHashTable(&(layer->connectionoptions));
-    GDALDatasetH hDS = GDALOpenEx( *p_decrypted_path,
-                                   GDAL_OF_RASTER | GDAL_OF_SHARED,
-                                   NULL,
-                                   (const char* const*)connectionoptions,
-                                   NULL);
-    CSLDestroy(connectionoptions);
-    return hDS;
-  }
-  else
-  {
-    return GDALOpenShared( *p_decrypted_path, GA_ReadOnly );
+    connectionoptions = msGetStringListFromHashTable(&(layer->connectionoptions));
+
+  /* Handles come from the dataset pool rather than from the GDAL shared */
+  /* dataset list, so no lock is held while the dataset is read */
+  key = msDrawRasterDatasetKey(*p_decrypted_path, connectionoptions);
+  hDS = msDrawRasterPoolAcquire(key);
+  if( hDS == NULL ) {
+    hDS = GDALOpenEx( *p_decrypted_path,
+                      GDAL_OF_RASTER,
+                      NULL,
+                      (const char* const*)connectionoptions,
+                      NULL);
+    if( hDS && msDrawRasterLayerDefersClose(layer) )
+      msDrawRasterPoolRegister(hDS, key);
   }
+  msFree(key);
+  CSLDestroy(connectionoptions);
+
+  return hDS;
 }
 
 /************************************************************************/
 /*                msDrawRasterLayerLowCloseDataset()                    */
+/*                                                                      */
+/*      Gives back a dataset returned by                                */
+/*      msDrawRasterLayerLowOpenDataset(). With CLOSE_CONNECTION=DEFER  */
+/*      (the default for non tileindexed layers) the handle is kept in  */
+/*      the dataset pool for later draws.                               */
 /************************************************************************/
 
 void msDrawRasterLayerLowCloseDataset(layerObj *layer, void* hDS)
 {
     if( hDS )
     {
-      const char *close_connection;
-      close_connection = msLayerGetProcessingKey( layer,
-                       "CLOSE_CONNECTION" );
-
-      if( close_connection == NULL && layer->tileindex == NULL )
-        close_connection = "DEFER";
-
-      {
-        /* Due to how GDAL processes OVERVIEW_LEVEL, datasets returned are */
-        /* not shared, despite being asked to, so close them for real */
-        char** connectionoptions = msGetStringListFromHashTable(&(layer->connectionoptions));
-        if( CSLFetchNameValue(connectionoptions, "OVERVIEW_LEVEL") )
-            close_connection = NULL;
-        CSLDestroy(connectionoptions);
-      }
-
-      if( close_connection != NULL
-          && strcasecmp(close_connection,"DEFER") == 0 ) {
-        GDALDereferenceDataset( (GDALDatasetH)hDS );
-      } else {
-        GDALClose( (GDALDatasetH)hDS );
-      }
-      msReleaseLock( TLOCK_GDAL );
+      msDrawRasterPoolRelease( (GDALDatasetH)hDS,
+                               msDrawRasterLayerDefersClose(layer) );
     }
 }
 
@@ -833,10 +1628,8 @@ int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *imag
     }
     
     if(layer->connectiontype == MS_KERNELDENSITY) {
-      msAcquireLock( TLOCK_GDAL );
       status = msComputeKernelDensityDataset(map, image, layer, &hDS, &kernel_density_cleanup_ptr);
       if(status != MS_SUCCESS) {
-        msReleaseLock( TLOCK_GDAL );
         final_status = status;
         goto cleanup;
       }
@@ -847,7 +1640,6 @@ int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *imag
         /* Set the projection to the map file projection */
         if (msLoadProjectionString(&(layer->projection), mapProjStr) != 0) {
           GDALClose( hDS );
-          msReleaseLock( TLOCK_GDAL );
           msSetError(MS_CGIERR, "Unable to set projection on interpolation layer.", "msDrawRasterLayerLow()");
           return(MS_FAILURE);
         }
@@ -875,24 +1667,15 @@ int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *imag
         decrypted_path = NULL;
 
         if( eRet == CDRT_CONTINUE_NEXT_TILE )
-        {
-            msReleaseLock( TLOCK_GDAL );
             continue;
-        }
         if( eRet == CDRT_RETURN_MS_FAILURE )
-        {
-            msReleaseLock( TLOCK_GDAL );
             return MS_FAILURE;
-        }
     }
 
     if( msDrawRasterLoadProjection(layer, hDS, filename, tilesrsindex, tilesrsname) != MS_SUCCESS )
     {
         if( hDatasetIn == NULL )
-        {
-          GDALClose( hDS );
-          msReleaseLock( TLOCK_GDAL );
-        }
+          msDrawRasterPoolRelease( hDS, MS_FALSE );
         final_status = MS_FAILURE;
         break;
     }
@@ -929,10 +1712,7 @@ int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *imag
 
     if( status == -1 ) {
       if( hDatasetIn == NULL )
-      {
-        GDALClose( hDS );
-        msReleaseLock( TLOCK_GDAL );
-      }
+        msDrawRasterPoolRelease( hDS, MS_FALSE );
       final_status = MS_FAILURE;
       break;
     }
@@ -953,7 +1733,6 @@ int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *imag
       ** CLOSE_CONNECTION=ALWAYS on the kerneldensity layer.
       */
       GDALClose( hDS );
-      msReleaseLock( TLOCK_GDAL );
     }
     else {
       if( hDatasetIn == NULL)
@@ -973,6 +1752,124 @@ cleanup:
   return final_status;
 }
 
+/************************************************************************/
+/*                    msDrawRasterLayerLowToStream()                    */
+/*                                                                      */
+/*      Render a raster layer straight to the client in horizontal      */
+/*      strips of the map: each strip is resampled from the source      */
+/*      and written to a streamed GDAL output (see                      */
+/*      msGDALOpenImageStream()) before the next one is rendered, so    */
+/*      only one strip is ever held in memory.  Only for unrotated      */
+/*      maps in a streamable output format (msGDALCanStreamImage()).    */
+/*      Strips are created with the bg background, and left empty if    */
+/*      bDraw is false.                                                 */
+/*                                                                      */
+/*      pfnBeginOutput() is called with the first strip once it is      */
+/*      rendered, before anything is written to the client: it          */
+/*      resolves the output format from the image and sends the         */
+/*      headers.  The resolved format must be the streamed one.         */
+/************************************************************************/
+
+#define MS_RASTER_STREAM_STRIP_BYTES (16*1024*1024)
+
+int msDrawRasterLayerLowToStream(mapObj *map, layerObj *layer,
+                                 void *hDatasetIn, colorObj *bg, int bDraw,
+                                 int (*pfnBeginOutput)(mapObj *map, imageObj *image, void *cbData),
+                                 void *cbData)
+{
+  outputFormatObj *format = map->outputformat;
+  rectObj saved_extent = map->extent;
+  geotransformObj saved_gt = map->gt;
+  geotransformObj saved_projection_gt = map->projection.gt;
+  int saved_height = map->height;
+  int bytes_per_pixel, strip_height, block_height, yoff;
+  int status = MS_SUCCESS;
+  void *hStream;
+
+  if(map->gt.need_geotransform) {
+    msSetError(MS_MISCERR, "Streamed output does not support rotated maps.",
+               "msDrawRasterLayerLowToStream()");
+    return MS_FAILURE;
+  }
+
+  hStream = msGDALOpenImageStream(map, format, map->width, map->height,
+                                  map->resolution);
+  if(hStream == NULL)
+    return MS_FAILURE;
+
+  /* strips of about MS_RASTER_STREAM_STRIP_BYTES, in whole blocks */
+  if(format->imagemode == MS_IMAGEMODE_RGB || format->imagemode == MS_IMAGEMODE_RGBA)
+    bytes_per_pixel = 4;
+  else if(format->imagemode == MS_IMAGEMODE_INT16)
+    bytes_per_pixel = 2 * format->bands;
+  else if(format->imagemode == MS_IMAGEMODE_FLOAT32)
+    bytes_per_pixel = 4 * format->bands;
+  else
+    bytes_per_pixel = format->bands;
+
+  block_height = msGDALImageStreamBlockHeight(hStream);
+  strip_height = MS_RASTER_STREAM_STRIP_BYTES / (MS_MAX(1, bytes_per_pixel) * map->width);
+  strip_height = MS_MAX(1, strip_height / block_height) * block_height;
+
+  if(layer->debug > 0 || map->debug > 1)
+    msDebug("msDrawRasterLayerLowToStream(%s): %dx%d image in strips of %d lines.\n",
+            layer->name, map->width, saved_height, strip_height);
+
+  for(yoff = 0; yoff < saved_height && status == MS_SUCCESS; yoff += strip_height) {
+    int lines = MS_MIN(strip_height, saved_height - yoff);
+    imageObj *strip;
+
+    /* narrow the map to the strip, keeping the pixel grid of the full image */
+    map->height = lines;
+    map->extent.maxy = saved_extent.maxy + yoff * saved_gt.geotransform[5];
+    map->extent.miny = saved_extent.maxy + (yoff + lines - 1) * saved_gt.geotransform[5];
+    map->gt.geotransform[3] = saved_gt.geotransform[3] + yoff * saved_gt.geotransform[5];
+    map->gt.invgeotransform[3] = -map->gt.geotransform[3] / map->gt.geotransform[5];
+    map->projection.gt = map->gt;
+
+    strip = msImageCreate(map->width, lines, format, map->web.imagepath,
+                          map->web.imageurl, map->resolution, map->defresolution, bg);
+    if(strip == NULL) {
+      status = MS_FAILURE;
+      break;
+    }
+
+    if(bDraw) {
+      if(MS_RENDERER_RAWDATA(format)) {
+        status = msDrawRasterLayerLowWithDataset(map, layer, strip, NULL, hDatasetIn);
+      } else {
+        rasterBufferObj rb;
+        status = MS_IMAGE_RENDERER(strip)->getRasterBufferHandle(strip, &rb);
+        if(status == MS_SUCCESS)
+          status = msDrawRasterLayerLowWithDataset(map, layer, strip, &rb, hDatasetIn);
+      }
+    }
+
+    if(status == MS_SUCCESS && yoff == 0) {
+      status = pfnBeginOutput(map, strip, cbData);
+      if(status == MS_SUCCESS && map->outputformat != format) {
+        msSetError(MS_MISCERR, "Output format %s resolved to another format, it cannot be streamed.",
+                   "msDrawRasterLayerLowToStream()", format->name);
+        status = MS_FAILURE;
+      }
+    }
+
+    if(status == MS_SUCCESS)
+      status = msGDALWriteImageStream(hStream, strip, yoff);
+    msFreeImage(strip);
+  }
+
+  map->extent = saved_extent;
+  map->gt = saved_gt;
+  map->projection.gt = saved_projection_gt;
+  map->height = saved_height;
+
+  if(msGDALCloseImageStream(hStream) != MS_SUCCESS)
+    status = MS_FAILURE;
+
+  return status;
+}
+
 /************************************************************************/
 /*                         msDrawReferenceMap()                         */
 /************************************************************************/
@@ -30,6 +30,7 @@
 #include "mapserver.h"
 #include "mapcopy.h"
 #include "fontcache.h"
+#include "mapthread.h"
 
 void computeSymbolStyle(symbolStyleObj *s, styleObj *src, symbolObj *symbol, double scalefactor,
     double resolutionfactor)
@@ -86,25 +87,378 @@ void computeSymbolStyle(symbolStyleObj *s, styleObj *src, symbolObj *symbol, dou
     ((a).blue==(b).blue) && \
     ((a).alpha==(b).alpha))
 
-tileCacheObj *searchTileCache(imageObj *img, symbolObj *symbol, symbolStyleObj *s, int width, int height)
+/*
+** Rendered symbol tiles are kept per imageObj in a hash table bounded to
+** MS_TILECACHE_MAX_TILES tiles and MS_TILECACHE_MAX_BYTES bytes, evicting
+** the least recently used tile. Setting the MS_SHARED_TILE_CACHE map
+** CONFIG option to YES additionally keeps the pixels of vector, ellipse
+** and truetype tiles in a process-wide cache, so later requests drawing the
+** same symbols with the same styles don't render them again.
+*/
+#define MS_TILECACHE_MAX_TILES 256
+#define MS_TILECACHE_MAX_BYTES (16*1024*1024)
+#define MS_SHARED_TILECACHE_SIZE 256
+#define MS_SHARED_TILECACHE_MAX_BYTES (32*1024*1024)
+
+typedef struct {
+  unsigned char *key;
+  size_t keylen;
+  unsigned int hash;
+  rasterBufferObj raster;
+  size_t bytes;
+  unsigned int last_used;
+} sharedTileCacheEntry;
+
+static sharedTileCacheEntry *sharedTileCache[MS_SHARED_TILECACHE_SIZE];
+static size_t sharedTileCacheBytes = 0;
+static unsigned int sharedTileCacheTick = 0;
+static unsigned long sharedTileCacheHits = 0, sharedTileCacheMisses = 0;
+
+/* FNV-1a */
+static unsigned int hashTileKey(unsigned int hash, const void *data, size_t len)
+{
+  const unsigned char *p = (const unsigned char*)data;
+  size_t i;
+  for(i=0; i<len; i++) {
+    hash ^= p[i];
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+static unsigned int hashTileColor(unsigned int hash, const colorObj *c)
+{
+  int present = (c != NULL);
+  hash = hashTileKey(hash, &present, sizeof(int));
+  if(c) {
+    int rgba[4];
+    rgba[0] = c->red;
+    rgba[1] = c->green;
+    rgba[2] = c->blue;
+    rgba[3] = c->alpha;
+    hash = hashTileKey(hash, rgba, sizeof(rgba));
+  }
+  return hash;
+}
+
+static unsigned int hashTile(symbolObj *symbol, symbolStyleObj *s, int width, int height, int seamless)
 {
-  tileCacheObj *cur = img->tilecache;
+  unsigned int hash = 2166136261U;
+  hash = hashTileKey(hash, &symbol, sizeof(symbolObj*));
+  hash = hashTileKey(hash, &width, sizeof(int));
+  hash = hashTileKey(hash, &height, sizeof(int));
+  hash = hashTileKey(hash, &seamless, sizeof(int));
+  hash = hashTileKey(hash, &s->outlinewidth, sizeof(double));
+  hash = hashTileKey(hash, &s->rotation, sizeof(double));
+  hash = hashTileKey(hash, &s->scale, sizeof(double));
+  hash = hashTileColor(hash, s->color);
+  hash = hashTileColor(hash, s->outlinecolor);
+  hash = hashTileColor(hash, s->backgroundcolor);
+  return hash;
+}
+
+#define TILE_COLOR_MATCHES(has,cached,c) \
+  ((has) ? ((c) && COMPARE_COLORS(cached,*(c))) : !(c))
+
+static void tileCacheUnlink(tileCacheTableObj *cache, tileCacheObj *tile)
+{
+  if(tile->lruprev) tile->lruprev->lrunext = tile->lrunext;
+  else cache->mru = tile->lrunext;
+  if(tile->lrunext) tile->lrunext->lruprev = tile->lruprev;
+  else cache->lru = tile->lruprev;
+  tile->lruprev = tile->lrunext = NULL;
+}
+
+static void tileCachePushFront(tileCacheTableObj *cache, tileCacheObj *tile)
+{
+  tile->lruprev = NULL;
+  tile->lrunext = cache->mru;
+  if(cache->mru) cache->mru->lruprev = tile;
+  cache->mru = tile;
+  if(!cache->lru) cache->lru = tile;
+}
+
+tileCacheObj *searchTileCache(imageObj *img, symbolObj *symbol, symbolStyleObj *s, int width, int height, int seamless)
+{
+  tileCacheTableObj *cache = img->tilecache;
+  tileCacheObj *cur;
+  unsigned int hash;
+
+  if(!cache)
+    return NULL;
+  hash = hashTile(symbol, s, width, height, seamless);
+  cur = cache->buckets[hash % MS_TILECACHE_BUCKETS];
   while(cur != NULL) {
-    if( cur->width == width
+    if( cur->hash == hash
+        && cur->width == width
         && cur->height == height
+        && cur->seamless == seamless
         && cur->symbol == symbol
         && cur->outlinewidth == s->outlinewidth
         && cur->rotation == s->rotation
         && cur->scale == s->scale
-        && (!s->color || COMPARE_COLORS(cur->color,*s->color))
-        && (!s->backgroundcolor || COMPARE_COLORS(cur->backgroundcolor,*s->backgroundcolor))
-        && (!s->outlinecolor || COMPARE_COLORS(cur->outlinecolor,*s->outlinecolor)))
+        && TILE_COLOR_MATCHES(cur->hascolor, cur->color, s->color)
+        && TILE_COLOR_MATCHES(cur->hasbackgroundcolor, cur->backgroundcolor, s->backgroundcolor)
+        && TILE_COLOR_MATCHES(cur->hasoutlinecolor, cur->outlinecolor, s->outlinecolor)) {
+      if(cache->mru != cur) {
+        tileCacheUnlink(cache, cur);
+        tileCachePushFront(cache, cur);
+      }
+      cache->hits++;
       return cur;
+    }
     cur = cur->next;
   }
+  cache->misses++;
   return NULL;
 }
 
+/*
+** Serializes everything a rendered tile depends on, for looking it up in
+** the process-wide cache where symbol pointers can't be used as keys.
+*/
+static void sharedTileCacheKey(bufferObj *key, imageObj *img, symbolObj *symbol,
+                               symbolStyleObj *s, int width, int height, int seamless)
+{
+  int ivalues[7];
+  double dvalues[8];
+  const char *strings[5];
+  colorObj *colors[3];
+  int i;
+
+  ivalues[0] = width;
+  ivalues[1] = height;
+  ivalues[2] = seamless;
+  ivalues[3] = img->format->imagemode;
+  ivalues[4] = symbol->type;
+  ivalues[5] = symbol->filled;
+  ivalues[6] = symbol->numpoints;
+  msBufferAppend(key, ivalues, sizeof(ivalues));
+
+  dvalues[0] = s->outlinewidth;
+  dvalues[1] = s->rotation;
+  dvalues[2] = s->scale;
+  dvalues[3] = img->resolution;
+  dvalues[4] = symbol->anchorpoint_x;
+  dvalues[5] = symbol->anchorpoint_y;
+  dvalues[6] = symbol->sizex;
+  dvalues[7] = symbol->sizey;
+  msBufferAppend(key, dvalues, sizeof(dvalues));
+
+  for(i=0; i<symbol->numpoints; i++) {
+    msBufferAppend(key, &symbol->points[i].x, sizeof(double));
+    msBufferAppend(key, &symbol->points[i].y, sizeof(double));
+  }
+
+  colors[0] = s->color;
+  colors[1] = s->outlinecolor;
+  colors[2] = s->backgroundcolor;
+  for(i=0; i<3; i++) {
+    int rgba[5] = {0,0,0,0,0};
+    if(colors[i]) {
+      rgba[0] = 1;
+      rgba[1] = colors[i]->red;
+      rgba[2] = colors[i]->green;
+      rgba[3] = colors[i]->blue;
+      rgba[4] = colors[i]->alpha;
+    }
+    msBufferAppend(key, rgba, sizeof(rgba));
+  }
+
+  /* the same font alias may point to different files in other fontsets */
+  strings[0] = img->format->driver;
+  strings[1] = symbol->character;
+  strings[2] = symbol->font;
+  strings[3] = img->map->fontset.filename;
+  strings[4] = symbol->font ? msLookupHashTable(&(img->map->fontset.fonts), symbol->font) : NULL;
+  for(i=0; i<5; i++) {
+    const char *str = strings[i] ? strings[i] : "";
+    msBufferAppend(key, (void*)str, strlen(str) + 1);
+  }
+
+  /* FORMATOPTIONs may change the rendering, e.g. the AGG GAMMA */
+  msBufferAppend(key, &img->format->numformatoptions, sizeof(int));
+  for(i=0; i<img->format->numformatoptions; i++) {
+    const char *str = img->format->formatoptions[i];
+    msBufferAppend(key, (void*)str, strlen(str) + 1);
+  }
+}
+
+static int sharedTileCacheEnabled(imageObj *img, symbolObj *symbol)
+{
+  rendererVTableObj *renderer = img->format->vtable;
+
+  /* pixmaps and SVGs are already shared by the symbol cache, see mapsymbol.c */
+  if(symbol->type == MS_SYMBOL_PIXMAP || symbol->type == MS_SYMBOL_SVG)
+    return MS_FALSE;
+  if(!img->map || !renderer->supports_pixel_buffer ||
+     !renderer->getRasterBufferHandle || !renderer->mergeRasterBuffer)
+    return MS_FALSE;
+  return msTestConfigOption(img->map, "MS_SHARED_TILE_CACHE", MS_FALSE);
+}
+
+/*
+** Fills the freshly created tileimg from the process-wide cache. Returns
+** MS_TRUE on a hit.
+*/
+static int sharedTileCacheGet(imageObj *tileimg, const bufferObj *key, unsigned int hash)
+{
+  rasterBufferObj raster;
+  int i, found = MS_FALSE;
+
+  msAcquireLock( TLOCK_TILECACHE );
+  for(i=0; i<MS_SHARED_TILECACHE_SIZE; i++) {
+    sharedTileCacheEntry *entry = sharedTileCache[i];
+    if(entry == NULL || entry->hash != hash || entry->keylen != key->size ||
+       memcmp(entry->key, key->data, key->size) != 0)
+      continue;
+    entry->last_used = ++sharedTileCacheTick;
+    msCopyRasterBuffer(&raster, &entry->raster);
+    found = MS_TRUE;
+    break;
+  }
+  if(found)
+    sharedTileCacheHits++;
+  else
+    sharedTileCacheMisses++;
+  msReleaseLock( TLOCK_TILECACHE );
+
+  if(found) {
+    int status = tileimg->format->vtable->mergeRasterBuffer(tileimg, &raster, 1.0,
+                 0, 0, 0, 0, raster.width, raster.height);
+    msFreeRasterBuffer(&raster);
+    if(status != MS_SUCCESS)
+      return MS_FALSE;
+  }
+  return found;
+}
+
+static void sharedTileCacheFreeEntry(sharedTileCacheEntry *entry)
+{
+  if(entry == NULL)
+    return;
+  msFreeRasterBuffer(&entry->raster);
+  msFree(entry->key);
+  msFree(entry);
+}
+
+static void sharedTileCacheAdd(imageObj *tileimg, const bufferObj *key, unsigned int hash)
+{
+  rasterBufferObj raster;
+  sharedTileCacheEntry *entry, *toFree[MS_SHARED_TILECACHE_SIZE];
+  int i, numToFree = 0;
+
+  if(tileimg->format->vtable->getRasterBufferHandle(tileimg, &raster) != MS_SUCCESS ||
+     raster.type != MS_BUFFER_BYTE_RGBA)
+    return;
+
+  entry = (sharedTileCacheEntry*) msSmallCalloc(1, sizeof(sharedTileCacheEntry));
+  entry->key = (unsigned char*) msSmallMalloc(key->size);
+  memcpy(entry->key, key->data, key->size);
+  entry->keylen = key->size;
+  entry->hash = hash;
+  entry->bytes = (size_t)raster.data.rgba.row_step * raster.height;
+  msCopyRasterBuffer(&entry->raster, &raster);
+
+  msAcquireLock( TLOCK_TILECACHE );
+  for(i=0; i<MS_SHARED_TILECACHE_SIZE; i++) {
+    sharedTileCacheEntry *cached = sharedTileCache[i];
+    if(cached != NULL && cached->hash == hash && cached->keylen == key->size &&
+       memcmp(cached->key, key->data, key->size) == 0) {
+      /* another thread rendered the same tile meanwhile */
+      toFree[numToFree++] = entry;
+      entry = NULL;
+      break;
+    }
+  }
+  while(entry) {
+    int iFree = -1, iLRU = -1;
+    for(i=0; i<MS_SHARED_TILECACHE_SIZE; i++) {
+      if(sharedTileCache[i] == NULL) {
+        if(iFree < 0)
+          iFree = i;
+      } else if(iLRU < 0 || sharedTileCache[i]->last_used < sharedTileCache[iLRU]->last_used) {
+        iLRU = i;
+      }
+    }
+    if(iFree >= 0 && sharedTileCacheBytes + entry->bytes <= MS_SHARED_TILECACHE_MAX_BYTES) {
+      entry->last_used = ++sharedTileCacheTick;
+      sharedTileCache[iFree] = entry;
+      sharedTileCacheBytes += entry->bytes;
+      entry = NULL;
+    } else if(iLRU >= 0) {
+      sharedTileCacheBytes -= sharedTileCache[iLRU]->bytes;
+      toFree[numToFree++] = sharedTileCache[iLRU];
+      sharedTileCache[iLRU] = NULL;
+    } else {
+      /* larger than the whole cache */
+      toFree[numToFree++] = entry;
+      entry = NULL;
+    }
+  }
+  msReleaseLock( TLOCK_TILECACHE );
+
+  for(i=0; i<numToFree; i++)
+    sharedTileCacheFreeEntry(toFree[i]);
+}
+
+/************************************************************************/
+/*                          msTileCacheCleanup()                        */
+/*                                                                      */
+/*      Frees the process-wide tile cache. Called from msCleanup().     */
+/************************************************************************/
+
+void msTileCacheCleanup(void)
+{
+  int i;
+
+  msAcquireLock( TLOCK_TILECACHE );
+  for(i=0; i<MS_SHARED_TILECACHE_SIZE; i++) {
+    sharedTileCacheFreeEntry(sharedTileCache[i]);
+    sharedTileCache[i] = NULL;
+  }
+  sharedTileCacheBytes = 0;
+  sharedTileCacheHits = sharedTileCacheMisses = 0;
+  msReleaseLock( TLOCK_TILECACHE );
+}
+
+/************************************************************************/
+/*                           msFreeTileCache()                          */
+/*                                                                      */
+/*      Frees the tiles cached on an image, reporting the cache hit     */
+/*      rates at the MS_DEBUGLEVEL_TUNING debug level.                  */
+/************************************************************************/
+
+void msFreeTileCache(imageObj *image)
+{
+  tileCacheTableObj *cache = image->tilecache;
+  tileCacheObj *cur, *next;
+
+  if(!cache)
+    return;
+
+  if(image->map && image->map->debug >= MS_DEBUGLEVEL_TUNING &&
+     (cache->hits || cache->misses)) {
+    unsigned long sharedhits, sharedmisses;
+    msAcquireLock( TLOCK_TILECACHE );
+    sharedhits = sharedTileCacheHits;
+    sharedmisses = sharedTileCacheMisses;
+    msReleaseLock( TLOCK_TILECACHE );
+    msDebug("msFreeTileCache(): %lu hits, %lu misses, %d tiles cached (%lu bytes). "
+            "Shared cache: %lu hits, %lu misses.\n",
+            cache->hits, cache->misses, cache->ntiles, (unsigned long)cache->nbytes,
+            sharedhits, sharedmisses);
+  }
+
+  for(cur = cache->mru; cur; cur = next) {
+    next = cur->lrunext;
+    msFreeImage(cur->image);
+    free(cur);
+  }
+  free(cache);
+  image->tilecache = NULL;
+}
+
 int preloadSymbol(symbolSetObj *symbolset, symbolObj *symbol, rendererVTableObj *renderer) {
   switch(symbol->type) {
   case MS_SYMBOL_VECTOR:
@@ -136,48 +490,63 @@ int preloadSymbol(symbolSetObj *symbolset, symbolObj *symbol, rendererVTableObj
 
 /* add a cached tile to the current image's cache */
 tileCacheObj *addTileCache(imageObj *img,
-                           imageObj *tile, symbolObj *symbol, symbolStyleObj *style, int width, int height)
+                           imageObj *tile, symbolObj *symbol, symbolStyleObj *style, int width, int height,
+                           int seamless)
 {
+  tileCacheTableObj *cache = img->tilecache;
   tileCacheObj *cachep;
+  size_t bytes = (size_t)width * height * 4;
 
-  if(img->ntiles >= MS_IMAGECACHESIZE) { /* remove last element, size stays the same */
-    cachep = img->tilecache;
-
-    /*go to the before last cache object*/
-    while(cachep->next && cachep->next->next) cachep = cachep->next;
-
-    /*free the last tile's data*/
-    msFreeImage(cachep->next->image);
-
-    /*reuse the last tile object*/
-    /* make the cache point to the start of the list*/
-    cachep->next->next = img->tilecache;
-    /* point the global cache to the new first */
-    img->tilecache = cachep->next;
-    /* the before last cache is now last, so it has no successor*/
-    cachep->next = NULL;
+  if(!cache) {
+    cache = (tileCacheTableObj*)calloc(1, sizeof(tileCacheTableObj));
+    MS_CHECK_ALLOC(cache, sizeof(tileCacheTableObj), NULL);
+    img->tilecache = cache;
+  }
 
-  } else {
-    img->ntiles += 1;
-    cachep = (tileCacheObj*)malloc(sizeof(tileCacheObj));
-    MS_CHECK_ALLOC(cachep, sizeof(tileCacheObj), NULL);
-    cachep->next = img->tilecache;
-    img->tilecache = cachep;
+  /* make room by dropping the least recently used tiles */
+  while(cache->lru &&
+        (cache->ntiles >= MS_TILECACHE_MAX_TILES || cache->nbytes + bytes > MS_TILECACHE_MAX_BYTES)) {
+    tileCacheObj *victim = cache->lru;
+    tileCacheObj **link = &cache->buckets[victim->hash % MS_TILECACHE_BUCKETS];
+    while(*link != victim) link = &(*link)->next;
+    *link = victim->next;
+    tileCacheUnlink(cache, victim);
+    cache->ntiles--;
+    cache->nbytes -= (size_t)victim->width * victim->height * 4;
+    msFreeImage(victim->image);
+    free(victim);
   }
 
-  cachep = img->tilecache;
+  cachep = (tileCacheObj*)calloc(1, sizeof(tileCacheObj));
+  MS_CHECK_ALLOC(cachep, sizeof(tileCacheObj), NULL);
 
   cachep->image = tile;
   cachep->outlinewidth = style->outlinewidth;
   cachep->scale = style->scale;
   cachep->rotation = style->rotation;
-  cachep->outlinewidth = style->outlinewidth;
-  if(style->color) MS_COPYCOLOR(&cachep->color,style->color);
-  if(style->outlinecolor) MS_COPYCOLOR(&cachep->outlinecolor,style->outlinecolor);
-  if(style->backgroundcolor) MS_COPYCOLOR(&cachep->backgroundcolor,style->backgroundcolor);
+  if(style->color) {
+    cachep->hascolor = MS_TRUE;
+    MS_COPYCOLOR(&cachep->color,style->color);
+  }
+  if(style->outlinecolor) {
+    cachep->hasoutlinecolor = MS_TRUE;
+    MS_COPYCOLOR(&cachep->outlinecolor,style->outlinecolor);
+  }
+  if(style->backgroundcolor) {
+    cachep->hasbackgroundcolor = MS_TRUE;
+    MS_COPYCOLOR(&cachep->backgroundcolor,style->backgroundcolor);
+  }
   cachep->width = width;
   cachep->height = height;
+  cachep->seamless = seamless;
   cachep->symbol = symbol;
+  cachep->hash = hashTile(symbol, style, width, height, seamless);
+
+  cachep->next = cache->buckets[cachep->hash % MS_TILECACHE_BUCKETS];
+  cache->buckets[cachep->hash % MS_TILECACHE_BUCKETS] = cachep;
+  tileCachePushFront(cache, cachep);
+  cache->ntiles++;
+  cache->nbytes += bytes;
   return(cachep);
 }
 
@@ -226,16 +595,27 @@ imageObj *getTile(imageObj *img, symbolObj *symbol,  symbolStyleObj *s, int widt
   if(width==-1 || height == -1) {
     width=height=MS_MAX(symbol->sizex,symbol->sizey);
   }
-  tile = searchTileCache(img,symbol,s,width,height);
+  tile = searchTileCache(img,symbol,s,width,height,seamlessmode);
 
   if(tile==NULL) {
     imageObj *tileimg;
     double p_x,p_y;
+    int shared = sharedTileCacheEnabled(img, symbol);
+    unsigned int sharedhash = 0;
+    bufferObj sharedkey;
     tileimg = msImageCreate(width,height,img->format,NULL,NULL,img->resolution, img->resolution, NULL);
     if(UNLIKELY(!tileimg)) {
       return NULL;
     }
-    if(!seamlessmode) {
+    msBufferInit(&sharedkey);
+    if(shared) {
+      sharedTileCacheKey(&sharedkey, img, symbol, s, width, height, seamlessmode);
+      sharedhash = hashTileKey(2166136261U, sharedkey.data, sharedkey.size);
+    }
+    if(shared && sharedTileCacheGet(tileimg, &sharedkey, sharedhash)) {
+      /* pixels restored from an earlier rendering, nothing to draw */
+      shared = MS_FALSE;
+    } else if(!seamlessmode) {
       p_x = width/2.0;
       p_y = height/2.0;
       switch(symbol->type) {
@@ -286,6 +666,7 @@ imageObj *getTile(imageObj *img, symbolObj *symbol,  symbolStyleObj *s, int widt
           break;
       }
       if(UNLIKELY(status == MS_FAILURE)) {
+        msBufferFree(&sharedkey);
         msFreeImage(tileimg);
         return NULL;
       }
@@ -330,21 +711,25 @@ imageObj *getTile(imageObj *img, symbolObj *symbol,  symbolStyleObj *s, int widt
               break;
             default:
               msSetError(MS_SYMERR, "BUG: Seamless mode is only for vector symbols", "getTile()");
+              msBufferFree(&sharedkey);
               return NULL;
           }
           if(UNLIKELY(status == MS_FAILURE)) {
+            msBufferFree(&sharedkey);
             msFreeImage(tile3img);
             return NULL;
           }
         }
       }
       if(UNLIKELY(status == MS_FAILURE)) {
+        msBufferFree(&sharedkey);
         msFreeImage(tile3img);
         return NULL;
       }
 
       status = MS_IMAGE_RENDERER(tile3img)->getRasterBufferHandle(tile3img,&tmpraster);
       if(UNLIKELY(status == MS_FAILURE)) {
+        msBufferFree(&sharedkey);
         msFreeImage(tile3img);
         return NULL;
       }
@@ -355,10 +740,18 @@ imageObj *getTile(imageObj *img, symbolObj *symbol,  symbolStyleObj *s, int widt
       msFreeImage(tile3img);
     }
     if(UNLIKELY(status == MS_FAILURE)) {
+      msBufferFree(&sharedkey);
+      msFreeImage(tileimg);
+      return NULL;
+    }
+    if(shared)
+      sharedTileCacheAdd(tileimg, &sharedkey, sharedhash);
+    msBufferFree(&sharedkey);
+    tile = addTileCache(img,tileimg,symbol,s,width,height,seamlessmode);
+    if(UNLIKELY(!tile)) {
       msFreeImage(tileimg);
       return NULL;
     }
-    tile = addTileCache(img,tileimg,symbol,s,width,height);
   }
   return tile->image;
 }
@@ -905,8 +1298,12 @@ int msDrawMarkerSymbol(mapObj *map, imageObj *image, pointObj *p, styleObj *styl
         }
       }
 
-      if(renderer->use_imagecache) {
-        imageObj *tile = getTile(image, symbol, &s, -1, -1,0);
+      if(renderer->use_imagecache && s.rotation == 0 &&
+         (symbol->type == MS_SYMBOL_VECTOR || symbol->type == MS_SYMBOL_ELLIPSE)) {
+        /* room for the symbol, mitered outlines and antialiasing */
+        int pw = (int)ceil(symbol->sizex * s.scale + 4 * s.outlinewidth) + 2;
+        int ph = (int)ceil(symbol->sizey * s.scale + 4 * s.outlinewidth) + 2;
+        imageObj *tile = getTile(image, symbol, &s, pw, ph, 0);
         if(tile!=NULL)
           return renderer->renderTile(image, tile, p_x, p_y);
         else {
@@ -30,3 +30,24 @@
 "Some memory leaks can be avoided by calling 
 ``msConnPoolCloseUnreferenced`` from time to time. See https://github.com/mapserver/mapserver/issues/1661";
 void msConnPoolCloseUnreferenced();
+
+%feature("docstring") connPoolStatsObj
+"Connection pool usage, filled by ``msConnPoolGetStats``: the number of pooled
+connections, and the request, hit, miss, wait and unhealthy connection counts
+since startup.";
+%immutable;
+typedef struct {
+  int connections;
+  int connections_in_use;
+  long requests;
+  long hits;
+  long misses;
+  long waits;
+  long wait_timeouts;
+  long unhealthy;
+} connPoolStatsObj;
+%mutable;
+
+%feature("docstring") msConnPoolGetStats
+"Fill ``stats`` with the current connection pool usage.";
+void msConnPoolGetStats(connPoolStatsObj *stats);
@@ -215,6 +215,7 @@
         {
             msFree(self->values[i]);
             self->values[i] = msStrdup(value);
+            msShapeInvalidateValueCache(self);
             if (!self->values[i])
             {
                 return MS_FAILURE;
@@ -236,6 +237,7 @@
         if(self->values) msFreeCharArray(self->values, self->numvalues);
         self->values = NULL;
         self->numvalues = 0;
+        msShapeInvalidateValueCache(self);
         
         /* Allocate memory for the values */
         if (numvalues > 0) {
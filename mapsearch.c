@@ -213,6 +213,187 @@ int msIntersectSegments(const pointObj *a, const pointObj *b, const pointObj *c,
   return(MS_TRUE);
 }
 
+/*
+** Segment index for large shapes. The segments of all parts are bucketed
+** into horizontal bands covering the shape's y range, so point in polygon
+** and segment intersection tests only look at the segments that share a
+** band with the query instead of scanning the whole shape. The index is
+** built on demand by the functions below for the duration of a single
+** test, or kept on the shape by callers that test it repeatedly (see
+** msBuildSegmentIndex()). It points into the shape's vertices and must be
+** freed if those change.
+*/
+#define MS_SEGMENTINDEX_MIN_POINTS 128 /* smaller shapes are simply scanned */
+#define MS_SEGMENTINDEX_MAX_BANDS 65536
+
+typedef struct {
+  const pointObj *a; /* previous vertex */
+  const pointObj *b; /* current vertex */
+  int closing; /* last to first vertex edge, only used for point in polygon */
+} segmentIndexEdgeObj;
+
+typedef struct {
+  double miny, maxy, scale;
+  int nbands;
+  int *bandstart; /* nbands+1 offsets into bandedges */
+  int *bandedges;
+  segmentIndexEdgeObj *edges;
+  int numedges;
+} segmentIndexObj;
+
+static int segmentIndexBand(const segmentIndexObj *index, double y)
+{
+  int band;
+
+  if(y <= index->miny) return 0;
+  if(y >= index->maxy) return index->nbands-1;
+  band = (int) ((y - index->miny)*index->scale);
+  return MS_MIN(band, index->nbands-1);
+}
+
+int msBuildSegmentIndex(shapeObj *shape)
+{
+  segmentIndexObj *index;
+  int i, j, n, b, b1, b2;
+
+  if(shape->segmentindex) return MS_TRUE;
+
+  n = 0;
+  for(i=0; i<shape->numlines; i++)
+    if(shape->line[i].numpoints > 1) n += shape->line[i].numpoints;
+  if(n < MS_SEGMENTINDEX_MIN_POINTS) return MS_FALSE;
+
+  index = (segmentIndexObj *) msSmallCalloc(1, sizeof(segmentIndexObj));
+  index->edges = (segmentIndexEdgeObj *) msSmallMalloc(n*sizeof(segmentIndexEdgeObj));
+
+  for(i=0; i<shape->numlines; i++) {
+    lineObj *line = &(shape->line[i]);
+    if(line->numpoints < 2) continue;
+    for(j=0; j<line->numpoints; j++) {
+      segmentIndexEdgeObj *edge = &(index->edges[index->numedges]);
+      edge->a = &(line->point[j == 0 ? line->numpoints-1 : j-1]);
+      edge->b = &(line->point[j]);
+      edge->closing = (j == 0);
+      if(index->numedges++ == 0)
+        index->miny = index->maxy = line->point[j].y;
+      index->miny = MS_MIN(index->miny, line->point[j].y);
+      index->maxy = MS_MAX(index->maxy, line->point[j].y);
+    }
+  }
+
+  /* roughly four edges per band for evenly distributed vertices */
+  index->nbands = MS_MAX(1, MS_MIN(index->numedges/4, MS_SEGMENTINDEX_MAX_BANDS));
+  if(index->maxy > index->miny)
+    index->scale = index->nbands/(index->maxy - index->miny);
+  else
+    index->nbands = 1;
+
+  index->bandstart = (int *) msSmallCalloc(index->nbands+1, sizeof(int));
+  for(i=0; i<index->numedges; i++) {
+    b1 = segmentIndexBand(index, MS_MIN(index->edges[i].a->y, index->edges[i].b->y));
+    b2 = segmentIndexBand(index, MS_MAX(index->edges[i].a->y, index->edges[i].b->y));
+    for(b=b1; b<=b2; b++) index->bandstart[b+1]++;
+  }
+  for(b=0; b<index->nbands; b++)
+    index->bandstart[b+1] += index->bandstart[b];
+
+  index->bandedges = (int *) msSmallMalloc(MS_MAX(1, index->bandstart[index->nbands])*sizeof(int));
+  for(i=0; i<index->numedges; i++) {
+    b1 = segmentIndexBand(index, MS_MIN(index->edges[i].a->y, index->edges[i].b->y));
+    b2 = segmentIndexBand(index, MS_MAX(index->edges[i].a->y, index->edges[i].b->y));
+    for(b=b1; b<=b2; b++) index->bandedges[index->bandstart[b]++] = i;
+  }
+  for(b=index->nbands; b>0; b--) /* the fill pass shifted the offsets by one band */
+    index->bandstart[b] = index->bandstart[b-1];
+  index->bandstart[0] = 0;
+
+  shape->segmentindex = index;
+  return MS_TRUE;
+}
+
+void msFreeSegmentIndex(shapeObj *shape)
+{
+  segmentIndexObj *index;
+
+  if(!shape || !shape->segmentindex) return;
+
+  index = (segmentIndexObj *) shape->segmentindex;
+  msFree(index->edges);
+  msFree(index->bandstart);
+  msFree(index->bandedges);
+  msFree(index);
+  shape->segmentindex = NULL;
+}
+
+/*
+** Builds an index for the duration of one test. Returns MS_TRUE if the
+** caller has to release it with msFreeSegmentIndex().
+*/
+static int msAcquireSegmentIndex(shapeObj *shape)
+{
+  if(shape->segmentindex) return MS_FALSE;
+  return msBuildSegmentIndex(shape);
+}
+
+/*
+** Same crossing rule as msPointInPolygon(), applied to the edges of all
+** parts sharing the point's band: parity over all parts is what
+** msIntersectPointPolygon() computes part by part.
+*/
+static int segmentIndexPointInPolygon(const segmentIndexObj *index, const pointObj *p)
+{
+  int i, band, status = MS_FALSE;
+
+  if(p->y < index->miny || p->y >= index->maxy) return MS_FALSE;
+
+  band = segmentIndexBand(index, p->y);
+  for(i=index->bandstart[band]; i<index->bandstart[band+1]; i++) {
+    const pointObj *a = index->edges[index->bandedges[i]].a;
+    const pointObj *b = index->edges[index->bandedges[i]].b;
+    if((((b->y<=p->y) && (p->y<a->y)) || ((a->y<=p->y) && (p->y<b->y))) && (p->x < (a->x - b->x) * (p->y - b->y) / (a->y - b->y) + b->x))
+      status = !status;
+  }
+  return status;
+}
+
+/*
+** Tests the segments of shape against the indexed shape, keeping the
+** argument order of msIntersectPolylines() for msIntersectSegments().
+*/
+static int segmentIndexIntersectPolylines(const segmentIndexObj *index, shapeObj *shape, int indexfirst)
+{
+  int c, v, i, band, b1, b2;
+  double miny, maxy;
+
+  for(c=0; c<shape->numlines; c++) {
+    for(v=1; v<shape->line[c].numpoints; v++) {
+      const pointObj *p1 = &(shape->line[c].point[v-1]);
+      const pointObj *p2 = &(shape->line[c].point[v]);
+
+      miny = MS_MIN(p1->y, p2->y);
+      maxy = MS_MAX(p1->y, p2->y);
+      if(maxy < index->miny || miny > index->maxy) continue;
+
+      b1 = segmentIndexBand(index, miny);
+      b2 = segmentIndexBand(index, maxy);
+      for(band=b1; band<=b2; band++) {
+        for(i=index->bandstart[band]; i<index->bandstart[band+1]; i++) {
+          const segmentIndexEdgeObj *edge = &(index->edges[index->bandedges[i]]);
+          if(edge->closing) continue;
+          if(MS_MAX(edge->a->y, edge->b->y) < miny || MS_MIN(edge->a->y, edge->b->y) > maxy) continue;
+          if(indexfirst) {
+            if(msIntersectSegments(edge->a, edge->b, p1, p2) == MS_TRUE) return MS_TRUE;
+          } else {
+            if(msIntersectSegments(p1, p2, edge->a, edge->b) == MS_TRUE) return MS_TRUE;
+          }
+        }
+      }
+    }
+  }
+
+  return MS_FALSE;
+}
+
 /*
 ** Instead of using ring orientation we count the number of parts the
 ** point falls in. If odd the point is in the polygon, if 0 or even
@@ -223,6 +404,9 @@ int msIntersectPointPolygon(pointObj *point, shapeObj *poly)
   int i;
   int status=MS_FALSE;
 
+  if(poly->segmentindex)
+    return segmentIndexPointInPolygon((segmentIndexObj *) poly->segmentindex, point);
+
   for(i=0; i<poly->numlines; i++) {
     if(msPointInPolygon(point, &poly->line[i]) == MS_TRUE) /* ok, the point is in a line */
       status = !status;
@@ -234,25 +418,38 @@ int msIntersectPointPolygon(pointObj *point, shapeObj *poly)
 int msIntersectMultipointPolygon(shapeObj *multipoint, shapeObj *poly)
 {
   int i,j;
+  int status=MS_FALSE, ownindex=MS_FALSE;
+
+  /* a single point is cheaper to test than to index for */
+  if(multipoint->numlines > 1 || (multipoint->numlines == 1 && multipoint->line[0].numpoints > 1))
+    ownindex = msAcquireSegmentIndex(poly);
 
   /* The change to loop through all the lines has been made for ticket
    * #2443 but is no more needed since ticket #2762. PostGIS now put all
    * points into a single line.  */
-  for(i=0; i<multipoint->numlines; i++ ) {
+  for(i=0; i<multipoint->numlines && status == MS_FALSE; i++ ) {
     lineObj points = multipoint->line[i];
     for(j=0; j<points.numpoints; j++) {
-      if(msIntersectPointPolygon(&(points.point[j]), poly) == MS_TRUE)
-        return(MS_TRUE);
+      if(msIntersectPointPolygon(&(points.point[j]), poly) == MS_TRUE) {
+        status = MS_TRUE;
+        break;
+      }
     }
   }
 
-  return(MS_FALSE);
+  if(ownindex) msFreeSegmentIndex(poly);
+  return(status);
 }
 
 int msIntersectPolylines(shapeObj *line1, shapeObj *line2)
 {
   int c1,v1,c2,v2;
 
+  if(line1->segmentindex)
+    return segmentIndexIntersectPolylines((segmentIndexObj *) line1->segmentindex, line2, MS_TRUE);
+  if(line2->segmentindex)
+    return segmentIndexIntersectPolylines((segmentIndexObj *) line2->segmentindex, line1, MS_FALSE);
+
   for(c1=0; c1<line1->numlines; c1++)
     for(v1=1; v1<line1->line[c1].numpoints; v1++)
       for(c2=0; c2<line2->numlines; c2++)
@@ -267,46 +464,58 @@ int msIntersectPolylines(shapeObj *line1, shapeObj *line2)
 int msIntersectPolylinePolygon(shapeObj *line, shapeObj *poly)
 {
   int i;
+  int status=MS_FALSE, ownindex;
+
+  ownindex = msAcquireSegmentIndex(poly);
 
   /* STEP 1: polygon might competely contain the polyline or one of it's parts (only need to check one point from each part) */
   for(i=0; i<line->numlines; i++) {
-    if(msIntersectPointPolygon(&(line->line[i].point[0]), poly) == MS_TRUE) /* this considers holes and multiple parts */
-      return(MS_TRUE);
+    if(msIntersectPointPolygon(&(line->line[i].point[0]), poly) == MS_TRUE) { /* this considers holes and multiple parts */
+      status = MS_TRUE;
+      break;
+    }
   }
 
   /* STEP 2: look for intersecting line segments */
-  if (msIntersectPolylines(line, poly) == MS_TRUE)
-    return (MS_TRUE);
+  if (status == MS_FALSE && msIntersectPolylines(line, poly) == MS_TRUE)
+    status = MS_TRUE;
 
-  return(MS_FALSE);
+  if(ownindex) msFreeSegmentIndex(poly);
+  return(status);
 }
 
 int msIntersectPolygons(shapeObj *p1, shapeObj *p2)
 {
   int i;
+  int status=MS_FALSE, ownindex1, ownindex2;
+
+  ownindex1 = msAcquireSegmentIndex(p1);
+  ownindex2 = msAcquireSegmentIndex(p2);
 
   /* STEP 1: polygon 1 completely contains 2 (only need to check one point from each part) */
-  for(i=0; i<p2->numlines; i++) {
+  for(i=0; i<p2->numlines && status == MS_FALSE; i++) {
     if(msIntersectPointPolygon(&(p2->line[i].point[0]), p1) == MS_TRUE) /* this considers holes and multiple parts */
-      return(MS_TRUE);
+      status = MS_TRUE;
   }
 
   /* STEP 2: polygon 2 completely contains 1 (only need to check one point from each part) */
-  for(i=0; i<p1->numlines; i++) {
+  for(i=0; i<p1->numlines && status == MS_FALSE; i++) {
     if(msIntersectPointPolygon(&(p1->line[i].point[0]), p2) == MS_TRUE) /* this considers holes and multiple parts */
-      return(MS_TRUE);
+      status = MS_TRUE;
   }
 
   /* STEP 3: look for intersecting line segments */
-  if (msIntersectPolylines(p1, p2) == MS_TRUE)
-    return(MS_TRUE);
+  if (status == MS_FALSE && msIntersectPolylines(p1, p2) == MS_TRUE)
+    status = MS_TRUE;
 
   /*
   ** At this point we know there are are no intersections between edges. There may be other tests necessary
   ** but I haven't run into any cases that require them.
   */
 
-  return(MS_FALSE);
+  if(ownindex1) msFreeSegmentIndex(p1);
+  if(ownindex2) msFreeSegmentIndex(p2);
+  return(status);
 }
 
 
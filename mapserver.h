@@ -110,6 +110,7 @@ typedef uint32_t        ms_uint32;
 /*forward declaration of rendering object*/
 typedef struct rendererVTableObj rendererVTableObj;
 typedef struct tileCacheObj tileCacheObj;
+typedef struct tileCacheTableObj tileCacheTableObj;
 typedef struct textPathObj textPathObj;
 typedef struct textRunObj textRunObj;
 typedef struct glyph_element glyph_element;
@@ -897,6 +898,11 @@ extern "C" {
     int cache_shapes; /* whether to cache shapes in resultCacheObj */
     int max_cached_shape_count; /* maximum number of shapes cached in the total number of resultCacheObj */
     int max_cached_shape_ram_amount; /* maximum number of bytes taken by shapes cached in the total number of resultCacheObj */
+
+    /* if set, matching shapes are handed to this callback as the query reads them */
+    /* and resultCacheObj only keeps their count and bounds (streaming mode) */
+    int (*shape_callback)(void *user_data, layerObj *layer, shapeObj *shape);
+    void *shape_callback_data;
   } queryObj;
 #endif
 
@@ -1123,6 +1129,7 @@ extern "C" {
     int repeatdistance;
     double maxoverlapangle;
     int partials; /* can labels run of an image */
+    int polylabel; /* place polygon labels at the pole of inaccessibility */
 
     int force; /* labels *must* be drawn */
 
@@ -1560,8 +1567,9 @@ typedef struct labelObj labelObj;
 
     outputFormatObj *format;
 #ifndef SWIG
-    tileCacheObj *tilecache;
-    int ntiles;
+    tileCacheTableObj *tilecache;
+    pointObj *clipscratch; /* scratch points reused by msClipPolygonRectEx() and friends */
+    int clipscratchsize;
 #endif
 #ifdef SWIG
     %mutable;
@@ -1831,6 +1839,9 @@ typedef struct labelObj labelObj;
 #ifndef SWIG
 void msFontCacheSetup();
 void msFontCacheCleanup();
+int msFontCacheIsGlobal();
+void* msFontCacheDetach();
+void msFontCacheFreeDetached(void *detached);
 
 typedef struct {
   double minx,miny,maxx,maxy,advance;
@@ -1863,6 +1874,7 @@ void initTextPath(textPathObj *tp);
 int WARN_UNUSED msComputeTextPath(mapObj *map, textSymbolObj *ts);
 void msCopyTextPath(textPathObj *dst, textPathObj *src);
 void freeTextPath(textPathObj *tp);
+int msRebindTextPath(fontSetObj *fontset, textPathObj *tp);
 void initTextSymbol(textSymbolObj *ts);
 void freeTextSymbol(textSymbolObj *ts);
 void msCopyTextSymbol(textSymbolObj *dst, textSymbolObj *src);
@@ -2232,6 +2244,8 @@ void msPopulateTextSymbolForLabelAndString(textSymbolObj *ts, labelObj *l, char
   MS_DLL_EXPORT int msIntersectPolylinePolygon(shapeObj *line, shapeObj *poly);
   MS_DLL_EXPORT int msIntersectPolygons(shapeObj *p1, shapeObj *p2);
   MS_DLL_EXPORT int msIntersectPolylines(shapeObj *line1, shapeObj *line2);
+  MS_DLL_EXPORT int msBuildSegmentIndex(shapeObj *shape);
+  MS_DLL_EXPORT void msFreeSegmentIndex(shapeObj *shape);
 
   MS_DLL_EXPORT int msInitQuery(queryObj *query); /* in mapquery.c */
   MS_DLL_EXPORT void msFreeQuery(queryObj *query);
@@ -2371,6 +2385,9 @@ extern "C" {
   MS_DLL_EXPORT int msPreloadImageSymbol(rendererVTableObj *renderer, symbolObj *symbol);
   MS_DLL_EXPORT int msPreloadSVGSymbol(symbolObj *symbol);
   MS_DLL_EXPORT symbolObj *msRotateSymbol(symbolObj *symbol, double angle);
+  int msSymbolCacheGetRaster(const char *path, double scale, double rotation, rasterBufferObj *rb);
+  void msSymbolCacheAddRaster(const char *path, double scale, double rotation, const rasterBufferObj *rb);
+  MS_DLL_EXPORT void msSymbolCacheCleanup(void);
 
   MS_DLL_EXPORT int WARN_UNUSED msGetCharacterSize(mapObj *map, char* font, int size, char *character, rectObj *r);
   MS_DLL_EXPORT int WARN_UNUSED msGetMarkerSize(mapObj *map, styleObj *style, double *width, double *height, double scalefactor);
@@ -2407,6 +2424,10 @@ extern "C" {
   MS_DLL_EXPORT void msInitShape(shapeObj *shape);
   MS_DLL_EXPORT void msShapeDeleteLine( shapeObj *shape, int line );
   MS_DLL_EXPORT int msCopyShape(shapeObj *from, shapeObj *to);
+#ifndef SWIG
+  MS_DLL_EXPORT double msShapeGetValueAsDouble(shapeObj *shape, int i);
+  MS_DLL_EXPORT void msShapeInvalidateValueCache(shapeObj *shape);
+#endif
   MS_DLL_EXPORT int msIsOuterRing(shapeObj *shape, int r);
   MS_DLL_EXPORT int *msGetOuterList(shapeObj *shape);
   MS_DLL_EXPORT int *msGetInnerList(shapeObj *shape, int r, int *outerlist);
@@ -2414,6 +2435,10 @@ extern "C" {
   MS_DLL_EXPORT void msRectToPolygon(rectObj rect, shapeObj *poly);
   MS_DLL_EXPORT void msClipPolylineRect(shapeObj *shape, rectObj rect);
   MS_DLL_EXPORT void msClipPolygonRect(shapeObj *shape, rectObj rect);
+#ifndef SWIG
+  void msClipPolylineRectEx(shapeObj *shape, rectObj rect, pointObj **scratch, int *scratchsize);
+  void msClipPolygonRectEx(shapeObj *shape, rectObj rect, pointObj **scratch, int *scratchsize);
+#endif
   MS_DLL_EXPORT void msTransformShape(shapeObj *shape, rectObj extent, double cellsize, imageObj *image);
   MS_DLL_EXPORT void msTransformPoint(pointObj *point, rectObj *extent, double cellsize, imageObj *image);
 
@@ -2428,6 +2453,7 @@ extern "C" {
 
   struct line_lengths {
     double *segment_lengths;
+    double *cumulative_lengths; /* distance from the first point to each vertex, numpoints entries */
     double total_length;
     int longest_segment_index;
   };
@@ -2460,6 +2486,7 @@ extern "C" {
   MS_DLL_EXPORT int WARN_UNUSED msLineLabelPath(mapObj *map, imageObj *img, lineObj *p, textSymbolObj *ts, struct line_lengths *ll, struct label_follow_result *lfr, labelObj *lbl);
   MS_DLL_EXPORT int WARN_UNUSED msLineLabelPoint(mapObj *map, lineObj *p, textSymbolObj *ts, struct line_lengths *ll, struct label_auto_result *lar, labelObj *lbl, double resolutionfactor);
   MS_DLL_EXPORT int msPolygonLabelPoint(shapeObj *p, pointObj *lp, double min_dimension);
+  MS_DLL_EXPORT int msPolygonPoleOfInaccessibility(shapeObj *p, pointObj *lp, double min_dimension, double precision);
   MS_DLL_EXPORT int msAddLine(shapeObj *p, lineObj *new_line);
   MS_DLL_EXPORT int msAddLineDirectly(shapeObj *p, lineObj *new_line);
   MS_DLL_EXPORT int msAddPointToLine(lineObj *line, pointObj *point );
@@ -2579,6 +2606,7 @@ extern "C" {
   MS_DLL_EXPORT int LayerDefaultGetShapeCount(layerObj *layer, rectObj rect, projectionObj *rectProjection);
   void msUVRASTERLayerUseMapExtentAndProjectionForNextWhichShapes(layerObj* layer, mapObj* map);
   rectObj msUVRASTERGetSearchRect( layerObj* layer, mapObj* map );
+  MS_DLL_EXPORT int msPostGISLayerPrefetch(layerObj *layer, rectObj rect);
 
   /* ==================================================================== */
   /*      Prototypes for functions in mapdraw.c                           */
@@ -2624,6 +2652,8 @@ extern "C" {
   MS_DLL_EXPORT int WARN_UNUSED msCircleDrawShadeSymbol(mapObj *map, imageObj *image, pointObj *p, double r, styleObj *style, double scalefactor);
   MS_DLL_EXPORT int WARN_UNUSED msDrawPieSlice(mapObj *map, imageObj *image, pointObj *p, styleObj *style, double radius, double start, double end);
   MS_DLL_EXPORT int WARN_UNUSED msDrawLabelBounds(mapObj *map, imageObj *image, label_bounds *bnds, styleObj *style, double scalefactor);
+  void msFreeTileCache(imageObj *image);
+  MS_DLL_EXPORT void msTileCacheCleanup(void);
 
   MS_DLL_EXPORT void msOutlineRenderingPrepareStyle(styleObj *pStyle, mapObj *map, layerObj *layer, imageObj *image);
   MS_DLL_EXPORT void msOutlineRenderingRestoreStyle(styleObj *pStyle, mapObj *map, layerObj *layer, imageObj *image);
@@ -2678,7 +2708,11 @@ extern "C" {
                                       char szPath[MS_MAXPATHLEN],
                                       char** p_decrypted_path);
   void msDrawRasterLayerLowCloseDataset(layerObj *layer, void* hDataset);
+  void msDrawRasterCleanupDatasetPool(void);
+  void msDrawRasterCleanupTileIndexCache(void);
   int msDrawRasterLayerLowWithDataset(mapObj *map, layerObj *layer, imageObj *image, rasterBufferObj *rb, void* hDatasetIn );
+  int msDrawRasterLayerLowToStream(mapObj *map, layerObj *layer, void* hDatasetIn, colorObj *bg, int bDraw,
+                                   int (*pfnBeginOutput)(mapObj *map, imageObj *image, void *cbData), void *cbData );
 
   MS_DLL_EXPORT int msDrawRasterLayerLow(mapObj *map, layerObj *layer, imageObj *image, rasterBufferObj *rb );
   MS_DLL_EXPORT int msGetClass(layerObj *layer, colorObj *color, int colormap_index);
@@ -2843,6 +2877,12 @@ extern "C" {
   /*      prototypes for functions in mapgdal.c                           */
   /* ==================================================================== */
   MS_DLL_EXPORT int msSaveImageGDAL( mapObj *map, imageObj *image, const char *filename );
+  int msGDALCanStreamImage( mapObj *map, outputFormatObj *format );
+  void *msGDALOpenImageStream( mapObj *map, outputFormatObj *format,
+                               int width, int height, double resolution );
+  int msGDALImageStreamBlockHeight( void *hStream );
+  int msGDALWriteImageStream( void *hStream, imageObj *image, int nYOff );
+  int msGDALCloseImageStream( void *hStream );
   MS_DLL_EXPORT int msInitDefaultGDALOutputFormat( outputFormatObj *format );
   void msCleanVSIDir( const char *pszDir );
   char** msGetStringListFromHashTable(hashTableObj* table);
@@ -2853,6 +2893,12 @@ extern "C" {
   MS_DLL_EXPORT int msInitDefaultOGROutputFormat( outputFormatObj *format );
   MS_DLL_EXPORT int msOGRWriteFromQuery( mapObj *map, outputFormatObj *format,
                                          int sendheaders );
+  typedef struct msOGROutputObj msOGROutputObj;
+  msOGROutputObj *msOGRStartQueryStream( mapObj *map, outputFormatObj *format,
+                                         int sendheaders );
+  int msOGRWriteQueryStreamShape( void *user_data, layerObj *layer,
+                                  shapeObj *shape );
+  int msOGREndQueryStream( msOGROutputObj *out, int bAbort );
 
   /* ==================================================================== */
   /*      Public prototype for mapogr.cpp functions.                      */
@@ -2894,13 +2940,38 @@ extern "C" {
   /* ==================================================================== */
   /*      mappool.c: connection pooling API.                              */
   /* ==================================================================== */
+  typedef struct {
+    int connections;         /* currently pooled */
+    int connections_in_use;
+    long requests;
+    long hits;
+    long misses;
+    long waits;              /* requests that waited for CONNECTION_POOL_MAX */
+    long wait_timeouts;
+    long unhealthy;          /* idle connections dropped by their check */
+  } connPoolStatsObj;
+
+  /* msConnPoolAcquire() flags */
+#define MS_POOL_IDLE_ONLY  1  /* no connection already used by this thread */
+#define MS_POOL_NO_WAIT    2  /* MS_DONE rather than wait at CONNECTION_POOL_MAX */
+
+  MS_DLL_EXPORT int msConnPoolAcquire( layerObj *layer, int nFlags,
+                                       void **conn_handle );
+  MS_DLL_EXPORT int msConnPoolIdleAvailable( layerObj *layer );
   MS_DLL_EXPORT void *msConnPoolRequest( layerObj *layer );
+  MS_DLL_EXPORT void *msConnPoolRequestIdle( layerObj *layer );
+  MS_DLL_EXPORT void msConnPoolCancel( layerObj *layer );
   MS_DLL_EXPORT void msConnPoolRelease( layerObj *layer, void * );
   MS_DLL_EXPORT void msConnPoolRegister( layerObj *layer,
                                          void *conn_handle,
                                          void (*close)( void * ) );
+  MS_DLL_EXPORT void msConnPoolRegisterEx( layerObj *layer,
+                                           void *conn_handle,
+                                           void (*close)( void * ),
+                                           int (*check)( void * ) );
   MS_DLL_EXPORT void msConnPoolCloseUnreferenced( void );
   MS_DLL_EXPORT void msConnPoolFinalCleanup( void );
+  MS_DLL_EXPORT void msConnPoolGetStats( connPoolStatsObj *stats );
 
   /* ==================================================================== */
   /*      prototypes for functions in mapcpl.c                            */
@@ -2932,7 +3003,9 @@ extern "C" {
   MS_DLL_EXPORT shapeObj *msGEOSSymDifference(shapeObj *shape1, shapeObj *shape2);
   MS_DLL_EXPORT shapeObj *msGEOSOffsetCurve(shapeObj *p, double offset);
 
+  MS_DLL_EXPORT int msGEOSPrepareShape(shapeObj *shape);
   MS_DLL_EXPORT int msGEOSContains(shapeObj *shape1, shapeObj *shape2);
+  MS_DLL_EXPORT int msGEOSContainsProperly(shapeObj *shape1, shapeObj *shape2);
   MS_DLL_EXPORT int msGEOSOverlaps(shapeObj *shape1, shapeObj *shape2);
   MS_DLL_EXPORT int msGEOSWithin(shapeObj *shape1, shapeObj *shape2);
   MS_DLL_EXPORT int msGEOSCrosses(shapeObj *shape1, shapeObj *shape2);
@@ -3087,10 +3160,25 @@ extern "C" {
     symbolObj *symbol;
     int width;
     int height;
+    int seamless;
+    int hascolor, hasoutlinecolor, hasbackgroundcolor;
     colorObj color, outlinecolor, backgroundcolor;
     double outlinewidth, rotation,scale;
+    unsigned int hash;
     imageObj *image;
-    tileCacheObj *next;
+    tileCacheObj *next; /* next tile in the same hash bucket */
+    tileCacheObj *lruprev, *lrunext; /* most recently used tiles first */
+  };
+
+#define MS_TILECACHE_BUCKETS 64
+
+  /* rendered symbol tiles of an imageObj, see getTile() */
+  struct tileCacheTableObj {
+    tileCacheObj *buckets[MS_TILECACHE_BUCKETS];
+    tileCacheObj *mru, *lru;
+    int ntiles;
+    size_t nbytes;
+    unsigned long hits, misses;
   };
 
 
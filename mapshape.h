@@ -138,6 +138,11 @@ extern "C" {
 
     char  *pszStringField;
     int   nStringFieldLen;
+
+#ifndef SWIG
+    const uchar *pabyMap; /* whole file mapped in memory, read-only handles only */
+    size_t nMapSize;
+#endif
 #ifdef SWIG
     %mutable;
 #endif
@@ -225,6 +230,9 @@ extern "C" {
   MS_DLL_EXPORT int msDBFReadIntegerAttribute( DBFHandle hDBF, int iShape, int iField );
   MS_DLL_EXPORT double msDBFReadDoubleAttribute( DBFHandle hDBF, int iShape, int iField );
   MS_DLL_EXPORT const char *msDBFReadStringAttribute( DBFHandle hDBF, int iShape, int iField );
+#ifndef SWIG
+  MS_DLL_EXPORT const char *msDBFReadAttributeSlice( DBFHandle hDBF, int iShape, int iField, int *pnLength );
+#endif
 
   MS_DLL_EXPORT int msDBFWriteIntegerAttribute( DBFHandle hDBF, int iShape, int iField, int nFieldValue );
   MS_DLL_EXPORT int msDBFWriteDoubleAttribute( DBFHandle hDBF, int iShape, int iField, double dFieldValue );
@@ -233,6 +241,9 @@ extern "C" {
   MS_DLL_EXPORT char **msDBFGetItems(DBFHandle dbffile);
   MS_DLL_EXPORT char **msDBFGetValues(DBFHandle dbffile, int record);
   MS_DLL_EXPORT char **msDBFGetValueList(DBFHandle dbffile, int record, int *itemindexes, int numitems);
+#ifndef SWIG
+  MS_DLL_EXPORT char **msDBFGetColumnValues(DBFHandle dbffile, int field, const int *records, int numrecords);
+#endif
   MS_DLL_EXPORT int *msDBFGetItemIndexes(DBFHandle dbffile, char **items, int numitems);
   MS_DLL_EXPORT int msDBFGetItemIndex(DBFHandle dbffile, char *name);
 
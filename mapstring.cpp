@@ -2297,6 +2297,7 @@ int msLayerEncodeShapeAttributes( layerObj *layer, shapeObj *shape) {
     shape->values[i] = out;
   }
   iconv_close(cd);
+  msShapeInvalidateValueCache(shape);
 
   return MS_SUCCESS;
 #else
@@ -29,6 +29,7 @@
 
 #include <stdarg.h> /* variable number of function arguments support */
 #include <time.h> /* since the parser handles time/date we need this */
+#include <sys/stat.h>
 
 #include "mapserver.h"
 #include "mapfile.h"
@@ -37,6 +38,9 @@
 #include "fontcache.h"
 #include "mapows.h"
 
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
 
 
 extern int msyylex(void); /* lexer globals */
@@ -48,6 +52,307 @@ extern FILE *msyyin;
 
 extern int msyystate;
 
+/*
+** Process-wide cache of parsed symbol files and of decoded symbol rasters
+** (pixmaps and rasterized SVGs). Processes loading the same mapfiles over
+** and over (FastCGI, mapscript) would otherwise re-parse every SYMBOLSET
+** and re-decode every pixmap on each request. Entries are keyed by path,
+** dropped when the file's modification time or size changes, and only
+** ever copied out so maps keep owning their symbols. Set the MS_SYMBOL_CACHE
+** configuration option to NO to disable.
+*/
+#define MS_SYMBOLSET_CACHE_SIZE 16
+#define MS_SYMBOL_RASTER_CACHE_SIZE 256
+#define MS_SYMBOL_RASTER_CACHE_MAX_BYTES (32*1024*1024)
+
+typedef struct {
+  char *path;
+  time_t mtime;
+  long size;
+  symbolObj **symbols;
+  int numsymbols;
+  unsigned int last_used;
+} symbolSetCacheEntry;
+
+typedef struct {
+  char *path;
+  time_t mtime;
+  long size;
+  double scale, rotation;
+  rasterBufferObj raster;
+  size_t bytes;
+  unsigned int last_used;
+} symbolRasterCacheEntry;
+
+static symbolSetCacheEntry *symbolSetCache[MS_SYMBOLSET_CACHE_SIZE];
+static symbolRasterCacheEntry *symbolRasterCache[MS_SYMBOL_RASTER_CACHE_SIZE];
+static size_t symbolRasterCacheBytes = 0;
+static unsigned int symbolCacheTick = 0;
+
+static int msSymbolCacheStat(const char *path, time_t *mtime, long *size)
+{
+  struct stat stat_buf;
+
+  if(path == NULL || !CSLTestBoolean(CPLGetConfigOption("MS_SYMBOL_CACHE", "YES")))
+    return MS_FAILURE;
+  if(stat(path, &stat_buf) != 0)
+    return MS_FAILURE;
+  *mtime = stat_buf.st_mtime;
+  *size = (long)stat_buf.st_size;
+  return MS_SUCCESS;
+}
+
+static void msSymbolSetCacheFreeEntry(symbolSetCacheEntry *entry)
+{
+  int i;
+
+  if(entry == NULL)
+    return;
+  for(i=0; i<entry->numsymbols; i++) {
+    msFreeSymbol(entry->symbols[i]);
+    msFree(entry->symbols[i]);
+  }
+  msFree(entry->symbols);
+  msFree(entry->path);
+  msFree(entry);
+}
+
+static void msSymbolRasterCacheFreeEntry(symbolRasterCacheEntry *entry)
+{
+  if(entry == NULL)
+    return;
+  msFreeRasterBuffer(&entry->raster);
+  msFree(entry->path);
+  msFree(entry);
+}
+
+/*
+** Appends copies of the symbols cached for path to symbolset. Returns
+** MS_TRUE on a hit, MS_FALSE if the file has to be parsed.
+*/
+static int msSymbolSetCacheGet(symbolSetObj *symbolset, const char *path,
+                               time_t mtime, long size, int *status)
+{
+  symbolSetCacheEntry *stale = NULL;
+  int i, j, found = MS_FALSE;
+
+  msAcquireLock( TLOCK_SYMBOLCACHE );
+  for(i=0; i<MS_SYMBOLSET_CACHE_SIZE; i++) {
+    symbolSetCacheEntry *entry = symbolSetCache[i];
+    if(entry == NULL || strcmp(entry->path, path) != 0)
+      continue;
+    if(entry->mtime != mtime || entry->size != size) {
+      symbolSetCache[i] = NULL;
+      stale = entry;
+      break;
+    }
+    found = MS_TRUE;
+    entry->last_used = ++symbolCacheTick;
+    for(j=0; j<entry->numsymbols; j++) {
+      if(msGrowSymbolSet(symbolset) == NULL ||
+         msCopySymbol(symbolset->symbol[symbolset->numsymbols], entry->symbols[j], symbolset->map) != MS_SUCCESS) {
+        *status = -1;
+        break;
+      }
+      symbolset->numsymbols++;
+    }
+    break;
+  }
+  msReleaseLock( TLOCK_SYMBOLCACHE );
+
+  msSymbolSetCacheFreeEntry(stale);
+  return found;
+}
+
+/*
+** Caches the symbols symbolset[first..numsymbols-1] just parsed from path.
+*/
+static void msSymbolSetCacheAdd(const char *path, time_t mtime, long size,
+                                symbolSetObj *symbolset, int first)
+{
+  symbolSetCacheEntry *entry, *toFree = NULL;
+  int i, iSlot = -1, iFree = -1, iLRU = -1;
+
+  entry = (symbolSetCacheEntry*) msSmallCalloc(1, sizeof(symbolSetCacheEntry));
+  entry->path = msStrdup(path);
+  entry->mtime = mtime;
+  entry->size = size;
+  entry->numsymbols = symbolset->numsymbols - first;
+  entry->symbols = (symbolObj**) msSmallCalloc(MS_MAX(entry->numsymbols, 1), sizeof(symbolObj*));
+  for(i=0; i<entry->numsymbols; i++) {
+    entry->symbols[i] = (symbolObj*) msSmallMalloc(sizeof(symbolObj));
+    msCopySymbol(entry->symbols[i], symbolset->symbol[first + i], NULL);
+  }
+
+  msAcquireLock( TLOCK_SYMBOLCACHE );
+  for(i=0; i<MS_SYMBOLSET_CACHE_SIZE; i++) {
+    symbolSetCacheEntry *cached = symbolSetCache[i];
+    if(cached == NULL) {
+      if(iFree < 0)
+        iFree = i;
+      continue;
+    }
+    if(strcmp(cached->path, path) == 0) {
+      iSlot = i; /* replace whatever another thread cached meanwhile */
+      break;
+    }
+    if(iLRU < 0 || cached->last_used < symbolSetCache[iLRU]->last_used)
+      iLRU = i;
+  }
+  if(iSlot < 0)
+    iSlot = (iFree >= 0) ? iFree : iLRU;
+  toFree = symbolSetCache[iSlot];
+  entry->last_used = ++symbolCacheTick;
+  symbolSetCache[iSlot] = entry;
+  msReleaseLock( TLOCK_SYMBOLCACHE );
+
+  msSymbolSetCacheFreeEntry(toFree);
+}
+
+/************************************************************************/
+/*                      msSymbolCacheGetRaster()                        */
+/*                                                                      */
+/*      Fills rb with a copy of the raster cached for the file at path  */
+/*      rendered at the given scale and rotation. Returns MS_TRUE on a  */
+/*      hit.                                                            */
+/************************************************************************/
+
+int msSymbolCacheGetRaster(const char *path, double scale, double rotation,
+                           rasterBufferObj *rb)
+{
+  symbolRasterCacheEntry *stale = NULL;
+  time_t mtime;
+  long size;
+  int i, found = MS_FALSE;
+
+  if(msSymbolCacheStat(path, &mtime, &size) != MS_SUCCESS)
+    return MS_FALSE;
+
+  msAcquireLock( TLOCK_SYMBOLCACHE );
+  for(i=0; i<MS_SYMBOL_RASTER_CACHE_SIZE; i++) {
+    symbolRasterCacheEntry *entry = symbolRasterCache[i];
+    if(entry == NULL || entry->scale != scale || entry->rotation != rotation ||
+       strcmp(entry->path, path) != 0)
+      continue;
+    if(entry->mtime != mtime || entry->size != size) {
+      symbolRasterCache[i] = NULL;
+      symbolRasterCacheBytes -= entry->bytes;
+      stale = entry;
+    } else {
+      entry->last_used = ++symbolCacheTick;
+      msCopyRasterBuffer(rb, &entry->raster);
+      found = MS_TRUE;
+    }
+    break;
+  }
+  msReleaseLock( TLOCK_SYMBOLCACHE );
+
+  msSymbolRasterCacheFreeEntry(stale);
+  return found;
+}
+
+/************************************************************************/
+/*                      msSymbolCacheAddRaster()                        */
+/*                                                                      */
+/*      Caches a copy of the raster decoded or rendered from the file   */
+/*      at path. Least recently used entries are evicted to stay within */
+/*      MS_SYMBOL_RASTER_CACHE_SIZE entries and                         */
+/*      MS_SYMBOL_RASTER_CACHE_MAX_BYTES bytes.                         */
+/************************************************************************/
+
+void msSymbolCacheAddRaster(const char *path, double scale, double rotation,
+                            const rasterBufferObj *rb)
+{
+  symbolRasterCacheEntry *entry, **toFree;
+  time_t mtime;
+  long size;
+  size_t bytes;
+  int i, numToFree = 0;
+
+  if(rb->type != MS_BUFFER_BYTE_RGBA || rb->data.rgba.pixels == NULL)
+    return;
+  bytes = (size_t)rb->data.rgba.row_step * rb->height;
+  if(bytes > MS_SYMBOL_RASTER_CACHE_MAX_BYTES / 8)
+    return;
+  if(msSymbolCacheStat(path, &mtime, &size) != MS_SUCCESS)
+    return;
+
+  entry = (symbolRasterCacheEntry*) msSmallCalloc(1, sizeof(symbolRasterCacheEntry));
+  entry->path = msStrdup(path);
+  entry->mtime = mtime;
+  entry->size = size;
+  entry->scale = scale;
+  entry->rotation = rotation;
+  entry->bytes = bytes;
+  msCopyRasterBuffer(&entry->raster, rb);
+
+  toFree = (symbolRasterCacheEntry**) msSmallMalloc(sizeof(symbolRasterCacheEntry*) * (MS_SYMBOL_RASTER_CACHE_SIZE + 1));
+
+  msAcquireLock( TLOCK_SYMBOLCACHE );
+  /* drop any previous rendering of the same key */
+  for(i=0; i<MS_SYMBOL_RASTER_CACHE_SIZE; i++) {
+    symbolRasterCacheEntry *cached = symbolRasterCache[i];
+    if(cached != NULL && cached->scale == scale && cached->rotation == rotation &&
+       strcmp(cached->path, path) == 0) {
+      symbolRasterCache[i] = NULL;
+      symbolRasterCacheBytes -= cached->bytes;
+      toFree[numToFree++] = cached;
+    }
+  }
+  for(;;) {
+    int iFree = -1, iLRU = -1;
+    for(i=0; i<MS_SYMBOL_RASTER_CACHE_SIZE; i++) {
+      if(symbolRasterCache[i] == NULL) {
+        if(iFree < 0)
+          iFree = i;
+      } else if(iLRU < 0 || symbolRasterCache[i]->last_used < symbolRasterCache[iLRU]->last_used) {
+        iLRU = i;
+      }
+    }
+    if(iFree >= 0 && symbolRasterCacheBytes + bytes <= MS_SYMBOL_RASTER_CACHE_MAX_BYTES) {
+      entry->last_used = ++symbolCacheTick;
+      symbolRasterCache[iFree] = entry;
+      symbolRasterCacheBytes += bytes;
+      entry = NULL;
+      break;
+    }
+    if(iLRU < 0)
+      break;
+    symbolRasterCacheBytes -= symbolRasterCache[iLRU]->bytes;
+    toFree[numToFree++] = symbolRasterCache[iLRU];
+    symbolRasterCache[iLRU] = NULL;
+  }
+  msReleaseLock( TLOCK_SYMBOLCACHE );
+
+  for(i=0; i<numToFree; i++)
+    msSymbolRasterCacheFreeEntry(toFree[i]);
+  msFree(toFree);
+  msSymbolRasterCacheFreeEntry(entry);
+}
+
+/************************************************************************/
+/*                       msSymbolCacheCleanup()                         */
+/*                                                                      */
+/*      Frees the process-wide symbol caches. Called from msCleanup().  */
+/************************************************************************/
+
+void msSymbolCacheCleanup(void)
+{
+  int i;
+
+  msAcquireLock( TLOCK_SYMBOLCACHE );
+  for(i=0; i<MS_SYMBOLSET_CACHE_SIZE; i++) {
+    msSymbolSetCacheFreeEntry(symbolSetCache[i]);
+    symbolSetCache[i] = NULL;
+  }
+  for(i=0; i<MS_SYMBOL_RASTER_CACHE_SIZE; i++) {
+    msSymbolRasterCacheFreeEntry(symbolRasterCache[i]);
+    symbolRasterCache[i] = NULL;
+  }
+  symbolRasterCacheBytes = 0;
+  msReleaseLock( TLOCK_SYMBOLCACHE );
+}
+
 void freeImageCache(struct imageCacheObj *ic)
 {
   if(ic) {
@@ -556,6 +861,9 @@ int loadSymbolSet(symbolSetObj *symbolset, mapObj *map)
   int foundSymbolSetToken=MS_FALSE;
   int symbolSetLevel=0;
   int token;
+  int firstsymbol, cached;
+  time_t mtime = 0;
+  long size = 0;
 
   if(!symbolset) {
     msSetError(MS_SYMERR, "Symbol structure unallocated.", "loadSymbolSet()");
@@ -566,10 +874,22 @@ int loadSymbolSet(symbolSetObj *symbolset, mapObj *map)
 
   if(!symbolset->filename) return(0);
 
+  /*
+  ** Use the symbols already parsed from this file if we have them
+  */
+  msBuildPath(szPath, symbolset->map->mappath, symbolset->filename);
+  firstsymbol = symbolset->numsymbols;
+  cached = (msSymbolCacheStat(szPath, &mtime, &size) == MS_SUCCESS);
+  if(cached) {
+    status = 0;
+    if(msSymbolSetCacheGet(symbolset, szPath, mtime, size, &status))
+      return(status);
+  }
+
   /*
   ** Open the file
   */
-  if((msyyin = fopen(msBuildPath(szPath, symbolset->map->mappath, symbolset->filename), "r")) == NULL) {
+  if((msyyin = fopen(szPath, "r")) == NULL) {
     msSetError(MS_IOERR, "(%s)", "loadSymbolSet()", symbolset->filename);
     return(-1);
   }
@@ -630,6 +950,10 @@ int loadSymbolSet(symbolSetObj *symbolset, mapObj *map)
   fclose(msyyin);
   msyyin = NULL;
   free(pszSymbolPath);
+
+  if(status == 0 && cached)
+    msSymbolSetCacheAdd(szPath, mtime, size, symbolset, firstsymbol);
+
   return(status);
 }
 
@@ -889,6 +1213,8 @@ int msLoadImageSymbol(symbolObj *symbol, const char *filename)
 
 int msPreloadImageSymbol(rendererVTableObj *renderer, symbolObj *symbol)
 {
+  int bCacheable;
+
   if(symbol->pixmap_buffer && symbol->renderer == renderer)
     return MS_SUCCESS;
   if(symbol->pixmap_buffer) { /* other renderer was used, start again */
@@ -896,11 +1222,17 @@ int msPreloadImageSymbol(rendererVTableObj *renderer, symbolObj *symbol)
   } else {
     symbol->pixmap_buffer = (rasterBufferObj*)calloc(1,sizeof(rasterBufferObj));
   }
-  if(MS_SUCCESS != renderer->loadImageFromFile(symbol->full_pixmap_path, symbol->pixmap_buffer)) {
-    /* Free pixmap_buffer already allocated */
-    free(symbol->pixmap_buffer);
-    symbol->pixmap_buffer = NULL;
-    return MS_FAILURE;
+  /* decoded pixmaps are only shared when produced by the common loader */
+  bCacheable = (renderer->loadImageFromFile == msLoadMSRasterBufferFromFile);
+  if(!bCacheable || !msSymbolCacheGetRaster(symbol->full_pixmap_path, 1.0, 0.0, symbol->pixmap_buffer)) {
+    if(MS_SUCCESS != renderer->loadImageFromFile(symbol->full_pixmap_path, symbol->pixmap_buffer)) {
+      /* Free pixmap_buffer already allocated */
+      free(symbol->pixmap_buffer);
+      symbol->pixmap_buffer = NULL;
+      return MS_FAILURE;
+    }
+    if(bCacheable)
+      msSymbolCacheAddRaster(symbol->full_pixmap_path, 1.0, 0.0, symbol->pixmap_buffer);
   }
   symbol->renderer = renderer;
   symbol->sizex = symbol->pixmap_buffer->width;
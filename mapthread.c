@@ -59,6 +59,18 @@ possible to implement for other thread libraries if needed.
         Releases the indicated mutex.  If the lock id is invalid, or if the
         mutex is not currently held by this thread then results are undefined.
 
+  int msWaitLock(int, int):
+        Releases the indicated mutex, which must be held by this thread,
+        waits till another thread calls msSignalLock() on it or till the
+        given number of milliseconds is elapsed, and acquires the mutex
+        again.  Returns MS_FALSE on timeout.  Spurious wakeups may happen,
+        so the caller must check again the state it waits for.  Without
+        USE_THREAD there is nobody to wait for and MS_FALSE is returned.
+
+  void msSignalLock(int):
+        Wakes up all the threads waiting in msWaitLock() on the indicated
+        mutex.  It should be called with the mutex held.
+
 It is incredibly important to ensure that any mutex that is acquired is
 released as soon as possible.  Any flow of control that could result in a
 mutex not being release is going to be a disaster.
@@ -143,8 +155,11 @@ files instead.
 static int thread_debug = 0;
 
 static char *lock_names[] = {
-  NULL, "PARSER", "GDAL", "ERROROBJ", "PROJ", "TTF", "POOL", "SDE",
-  "ORACLE", "OWS", "LAYER_VTABLE", "IOCONTEXT", "TMPFILE", "DEBUGOBJ", "OGR", "TIME", "FRIBIDI", "WXS", "GEOS", NULL
+  NULL, "PARSER", "GDAL", "ERROROBJ", "PROJ", "TTF", "UNUSED", "SDE",
+  "ORACLE", "OWS", "LAYER_VTABLE", "IOCONTEXT", "TMPFILE", "DEBUGOBJ", "OGR", "TIME", "FRIBIDI", "WXS", "GEOS", "RASTERPOOL", "TILEINDEX",
+  "POOL_SHARD", "POOL_SHARD", "POOL_SHARD", "POOL_SHARD",
+  "POOL_SHARD", "POOL_SHARD", "POOL_SHARD", "POOL_SHARD", "SYMBOLCACHE", "TILECACHE", "HTTPCACHE", "HTTPPOOL",
+  "HTTPSHARE", "HTTPSHARE", "HTTPSHARE", "HTTPSHARE", NULL
 };
 #endif
 
@@ -157,9 +172,11 @@ static char *lock_names[] = {
 #if defined(USE_THREAD) && !defined(_WIN32)
 
 #include "pthread.h"
+#include <sys/time.h>
 
 static int mutexes_initialized = 0;
 static pthread_mutex_t mutex_locks[TLOCK_MAX];
+static pthread_cond_t cond_locks[TLOCK_MAX];
 
 /************************************************************************/
 /*                            msThreadInit()                            */
@@ -175,8 +192,10 @@ void msThreadInit()
 
   pthread_mutex_lock( &core_lock );
 
-  for( ; mutexes_initialized < TLOCK_STATIC_MAX; mutexes_initialized++ )
+  for( ; mutexes_initialized < TLOCK_STATIC_MAX; mutexes_initialized++ ) {
     pthread_mutex_init( mutex_locks + mutexes_initialized, NULL );
+    pthread_cond_init( cond_locks + mutexes_initialized, NULL );
+  }
 
   pthread_mutex_unlock( &core_lock );
 }
@@ -227,6 +246,48 @@ void msReleaseLock( int nLockId )
   pthread_mutex_unlock( mutex_locks + nLockId );
 }
 
+/************************************************************************/
+/*                             msWaitLock()                             */
+/************************************************************************/
+
+int msWaitLock( int nLockId, int nTimeoutMs )
+
+{
+  struct timeval now;
+  struct timespec deadline;
+
+  assert( mutexes_initialized > 0 );
+  assert( nLockId >= 0 && nLockId < mutexes_initialized );
+
+  if( thread_debug )
+    fprintf( stderr, "msWaitLock(%d/%s,%d) (posix)\n",
+             nLockId, lock_names[nLockId], nTimeoutMs );
+
+  gettimeofday( &now, NULL );
+  deadline.tv_sec = now.tv_sec + nTimeoutMs / 1000;
+  deadline.tv_nsec = now.tv_usec * 1000L + (nTimeoutMs % 1000) * 1000000L;
+  if( deadline.tv_nsec >= 1000000000L ) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+
+  return pthread_cond_timedwait( cond_locks + nLockId, mutex_locks + nLockId,
+                                 &deadline ) == 0;
+}
+
+/************************************************************************/
+/*                            msSignalLock()                            */
+/************************************************************************/
+
+void msSignalLock( int nLockId )
+
+{
+  assert( mutexes_initialized > 0 );
+  assert( nLockId >= 0 && nLockId < mutexes_initialized );
+
+  pthread_cond_broadcast( cond_locks + nLockId );
+}
+
 #endif /* defined(USE_THREAD) && !defined(_WIN32) */
 
 /************************************************************************/
@@ -242,6 +303,10 @@ void msReleaseLock( int nLockId )
 static int mutexes_initialized = 0;
 static HANDLE mutex_locks[TLOCK_MAX];
 
+/* msWaitLock() waiters, woken up by releasing the semaphore of the lock */
+static HANDLE wait_semaphores[TLOCK_MAX];
+static int wait_counts[TLOCK_MAX];
+
 /************************************************************************/
 /*                            msThreadInit()                            */
 /************************************************************************/
@@ -263,8 +328,11 @@ void msThreadInit()
   else
     WaitForSingleObject( core_lock, INFINITE );
 
-  for( ; mutexes_initialized < TLOCK_STATIC_MAX; mutexes_initialized++ )
+  for( ; mutexes_initialized < TLOCK_STATIC_MAX; mutexes_initialized++ ) {
     mutex_locks[mutexes_initialized] = CreateMutex( NULL, FALSE, NULL );
+    wait_semaphores[mutexes_initialized] =
+      CreateSemaphore( NULL, 0, 0x7fffffff, NULL );
+  }
 
   ReleaseMutex( core_lock );
 }
@@ -315,4 +383,44 @@ void msReleaseLock( int nLockId )
   ReleaseMutex( mutex_locks[nLockId] );
 }
 
+/************************************************************************/
+/*                             msWaitLock()                             */
+/************************************************************************/
+
+int msWaitLock( int nLockId, int nTimeoutMs )
+
+{
+  DWORD result;
+
+  assert( mutexes_initialized > 0 );
+  assert( nLockId >= 0 && nLockId < mutexes_initialized );
+
+  if( thread_debug )
+    fprintf( stderr, "msWaitLock(%d/%s,%d) (win32)\n",
+             nLockId, lock_names[nLockId], nTimeoutMs );
+
+  wait_counts[nLockId]++;
+  result = SignalObjectAndWait( mutex_locks[nLockId], wait_semaphores[nLockId],
+                                (DWORD) nTimeoutMs, FALSE );
+  WaitForSingleObject( mutex_locks[nLockId], INFINITE );
+  wait_counts[nLockId]--;
+
+  return result == WAIT_OBJECT_0;
+}
+
+/************************************************************************/
+/*                            msSignalLock()                            */
+/************************************************************************/
+
+void msSignalLock( int nLockId )
+
+{
+  assert( mutexes_initialized > 0 );
+  assert( nLockId >= 0 && nLockId < mutexes_initialized );
+
+  /* a waiter woken up twice just checks its state once more */
+  if( wait_counts[nLockId] > 0 )
+    ReleaseSemaphore( wait_semaphores[nLockId], wait_counts[nLockId], NULL );
+}
+
 #endif /* defined(USE_THREAD) && defined(_WIN32) */
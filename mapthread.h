@@ -39,11 +39,15 @@ extern "C" {
   void* msGetThreadId(void);
   void msAcquireLock(int);
   void msReleaseLock(int);
+  int msWaitLock(int, int);
+  void msSignalLock(int);
 #else
 #define msThreadInit()
 #define msGetThreadId() (0)
 #define msAcquireLock(x)
 #define msReleaseLock(x)
+#define msWaitLock(x,ms) (0)
+#define msSignalLock(x)
 #endif
 
   /*
@@ -56,7 +60,7 @@ extern "C" {
 #define TLOCK_ERROROBJ  3
 #define TLOCK_PROJ      4
 #define TLOCK_TTF       5
-#define TLOCK_POOL      6
+/* 6 was TLOCK_POOL, replaced by the TLOCK_POOL_SHARD locks */
 #define TLOCK_SDE       7
 #define TLOCK_ORACLE    8
 #define TLOCK_OWS       9
@@ -69,8 +73,23 @@ extern "C" {
 #define TLOCK_FRIBIDI   16
 #define TLOCK_WxS       17
 #define TLOCK_GEOS       18
+#define TLOCK_RASTERPOOL 19
+#define TLOCK_TILEINDEX  20
 
-#define TLOCK_STATIC_MAX 20
+/* connection pool buckets are spread over these */
+#define TLOCK_POOL_SHARD 21
+#define TLOCK_POOL_SHARD_COUNT 8
+
+#define TLOCK_SYMBOLCACHE 29
+#define TLOCK_TILECACHE 30
+#define TLOCK_HTTPCACHE 31
+#define TLOCK_HTTPPOOL  32
+
+/* curl share handle locks, one per kind of shared data */
+#define TLOCK_HTTPSHARE 33
+#define TLOCK_HTTPSHARE_COUNT 4
+
+#define TLOCK_STATIC_MAX 37
 #define TLOCK_MAX       100
 
 #ifdef __cplusplus
@@ -73,17 +73,19 @@ int msScaleInBounds(double scale, double minscale, double maxscale)
 /*
 ** Helper functions to convert from strings to other types or objects.
 */
-static int bindIntegerAttribute(int *attribute, const char *value)
+static int bindIntegerAttribute(int *attribute, shapeObj *shape, int index)
 {
+  const char *value = shape->values[index];
   if(!value || strlen(value) == 0) return MS_FAILURE;
-  *attribute = MS_NINT(atof(value)); /*use atof instead of atoi as a fix for bug 2394*/
+  *attribute = MS_NINT(msShapeGetValueAsDouble(shape, index)); /*use atof instead of atoi as a fix for bug 2394*/
   return MS_SUCCESS;
 }
 
-static int bindDoubleAttribute(double *attribute, const char *value)
+static int bindDoubleAttribute(double *attribute, shapeObj *shape, int index)
 {
+  const char *value = shape->values[index];
   if(!value || strlen(value) == 0) return MS_FAILURE;
-  *attribute = atof(value);
+  *attribute = msShapeGetValueAsDouble(shape, index);
   return MS_SUCCESS;
 }
 
@@ -144,15 +146,15 @@ static void bindStyle(layerObj *layer, shapeObj *shape, styleObj *style, int dra
     }
     if(style->bindings[MS_STYLE_BINDING_ANGLE].index != -1) {
       style->angle = 360.0;
-      bindDoubleAttribute(&style->angle, shape->values[style->bindings[MS_STYLE_BINDING_ANGLE].index]);
+      bindDoubleAttribute(&style->angle, shape, style->bindings[MS_STYLE_BINDING_ANGLE].index);
     }
     if(style->bindings[MS_STYLE_BINDING_SIZE].index != -1) {
       style->size = 1;
-      bindDoubleAttribute(&style->size, shape->values[style->bindings[MS_STYLE_BINDING_SIZE].index]);
+      bindDoubleAttribute(&style->size, shape, style->bindings[MS_STYLE_BINDING_SIZE].index);
     }
     if(style->bindings[MS_STYLE_BINDING_WIDTH].index != -1) {
       style->width = 1;
-      bindDoubleAttribute(&style->width, shape->values[style->bindings[MS_STYLE_BINDING_WIDTH].index]);
+      bindDoubleAttribute(&style->width, shape, style->bindings[MS_STYLE_BINDING_WIDTH].index);
     }
     if(style->bindings[MS_STYLE_BINDING_COLOR].index != -1 && !MS_DRAW_QUERY(drawmode)) {
       MS_INIT_COLOR(style->color, -1,-1,-1,255);
@@ -164,27 +166,27 @@ static void bindStyle(layerObj *layer, shapeObj *shape, styleObj *style, int dra
     }
     if(style->bindings[MS_STYLE_BINDING_OUTLINEWIDTH].index != -1) {
       style->outlinewidth = 1;
-      bindDoubleAttribute(&style->outlinewidth, shape->values[style->bindings[MS_STYLE_BINDING_OUTLINEWIDTH].index]);
+      bindDoubleAttribute(&style->outlinewidth, shape, style->bindings[MS_STYLE_BINDING_OUTLINEWIDTH].index);
     }
     if(style->bindings[MS_STYLE_BINDING_OPACITY].index != -1) {
       style->opacity = 100;
-      bindIntegerAttribute(&style->opacity, shape->values[style->bindings[MS_STYLE_BINDING_OPACITY].index]);
+      bindIntegerAttribute(&style->opacity, shape, style->bindings[MS_STYLE_BINDING_OPACITY].index);
     }
     if(style->bindings[MS_STYLE_BINDING_OFFSET_X].index != -1) {
       style->offsetx = 0;
-      bindDoubleAttribute(&style->offsetx, shape->values[style->bindings[MS_STYLE_BINDING_OFFSET_X].index]);
+      bindDoubleAttribute(&style->offsetx, shape, style->bindings[MS_STYLE_BINDING_OFFSET_X].index);
     }
     if(style->bindings[MS_STYLE_BINDING_OFFSET_Y].index != -1) {
       style->offsety = 0;
-      bindDoubleAttribute(&style->offsety, shape->values[style->bindings[MS_STYLE_BINDING_OFFSET_Y].index]);
+      bindDoubleAttribute(&style->offsety, shape, style->bindings[MS_STYLE_BINDING_OFFSET_Y].index);
     }
     if(style->bindings[MS_STYLE_BINDING_POLAROFFSET_PIXEL].index != -1) {
       style->polaroffsetpixel = 0;
-      bindDoubleAttribute(&style->polaroffsetpixel, shape->values[style->bindings[MS_STYLE_BINDING_POLAROFFSET_PIXEL].index]);
+      bindDoubleAttribute(&style->polaroffsetpixel, shape, style->bindings[MS_STYLE_BINDING_POLAROFFSET_PIXEL].index);
     }
     if(style->bindings[MS_STYLE_BINDING_POLAROFFSET_ANGLE].index != -1) {
       style->polaroffsetangle = 0;
-      bindDoubleAttribute(&style->polaroffsetangle, shape->values[style->bindings[MS_STYLE_BINDING_POLAROFFSET_ANGLE].index]);
+      bindDoubleAttribute(&style->polaroffsetangle, shape, style->bindings[MS_STYLE_BINDING_POLAROFFSET_ANGLE].index);
     }
   }
   if (style->nexprbindings > 0)
@@ -267,12 +269,12 @@ static void bindLabel(layerObj *layer, shapeObj *shape, labelObj *label, int dra
   if(label->numbindings > 0) {
     if(label->bindings[MS_LABEL_BINDING_ANGLE].index != -1) {
       label->angle = 0.0;
-      bindDoubleAttribute(&label->angle, shape->values[label->bindings[MS_LABEL_BINDING_ANGLE].index]);
+      bindDoubleAttribute(&label->angle, shape, label->bindings[MS_LABEL_BINDING_ANGLE].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_SIZE].index != -1) {
       label->size = 1;
-      bindIntegerAttribute(&label->size, shape->values[label->bindings[MS_LABEL_BINDING_SIZE].index]);
+      bindIntegerAttribute(&label->size, shape, label->bindings[MS_LABEL_BINDING_SIZE].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_COLOR].index != -1) {
@@ -292,31 +294,31 @@ static void bindLabel(layerObj *layer, shapeObj *shape, labelObj *label, int dra
 
     if(label->bindings[MS_LABEL_BINDING_PRIORITY].index != -1) {
       label->priority = MS_DEFAULT_LABEL_PRIORITY;
-      bindIntegerAttribute(&label->priority, shape->values[label->bindings[MS_LABEL_BINDING_PRIORITY].index]);
+      bindIntegerAttribute(&label->priority, shape, label->bindings[MS_LABEL_BINDING_PRIORITY].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_SHADOWSIZEX].index != -1) {
       label->shadowsizex = 1;
-      bindIntegerAttribute(&label->shadowsizex, shape->values[label->bindings[MS_LABEL_BINDING_SHADOWSIZEX].index]);
+      bindIntegerAttribute(&label->shadowsizex, shape, label->bindings[MS_LABEL_BINDING_SHADOWSIZEX].index);
     }
     if(label->bindings[MS_LABEL_BINDING_SHADOWSIZEY].index != -1) {
       label->shadowsizey = 1;
-      bindIntegerAttribute(&label->shadowsizey, shape->values[label->bindings[MS_LABEL_BINDING_SHADOWSIZEY].index]);
+      bindIntegerAttribute(&label->shadowsizey, shape, label->bindings[MS_LABEL_BINDING_SHADOWSIZEY].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_OFFSET_X].index != -1) {
       label->offsetx = 0;
-      bindIntegerAttribute(&label->offsetx, shape->values[label->bindings[MS_LABEL_BINDING_OFFSET_X].index]);
+      bindIntegerAttribute(&label->offsetx, shape, label->bindings[MS_LABEL_BINDING_OFFSET_X].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_OFFSET_Y].index != -1) {
       label->offsety = 0;
-      bindIntegerAttribute(&label->offsety, shape->values[label->bindings[MS_LABEL_BINDING_OFFSET_Y].index]);
+      bindIntegerAttribute(&label->offsety, shape, label->bindings[MS_LABEL_BINDING_OFFSET_Y].index);
     }
 
     if(label->bindings[MS_LABEL_BINDING_ALIGN].index != -1) {
       int tmpAlign = 0;
-      bindIntegerAttribute(&tmpAlign, shape->values[label->bindings[MS_LABEL_BINDING_ALIGN].index]);
+      bindIntegerAttribute(&tmpAlign, shape, label->bindings[MS_LABEL_BINDING_ALIGN].index);
       if(tmpAlign != 0) { /* is this test sufficient? */
         label->align = tmpAlign;
       } else { /* Integer binding failed, look for strings like cc, ul, lr, etc... */
@@ -334,7 +336,7 @@ static void bindLabel(layerObj *layer, shapeObj *shape, labelObj *label, int dra
 
     if(label->bindings[MS_LABEL_BINDING_POSITION].index != -1) {
       int tmpPosition = 0;
-      bindIntegerAttribute(&tmpPosition, shape->values[label->bindings[MS_LABEL_BINDING_POSITION].index]);
+      bindIntegerAttribute(&tmpPosition, shape, label->bindings[MS_LABEL_BINDING_POSITION].index);
       if(tmpPosition != 0) { /* is this test sufficient? */
         label->position = tmpPosition;
       } else { /* Integer binding failed, look for strings like cc, ul, lr, etc... */
@@ -1103,14 +1105,7 @@ void msFreeImage(imageObj *image)
   if (image) {
     if(MS_RENDERER_PLUGIN(image->format)) {
       rendererVTableObj *renderer = image->format->vtable;
-      tileCacheObj *next,*cur = image->tilecache;
-      while(cur) {
-        msFreeImage(cur->image);
-        next = cur->next;
-        free(cur);
-        cur = next;
-      }
-      image->ntiles = 0;
+      msFreeTileCache(image);
       renderer->freeImage(image);
     } else if( MS_RENDERER_IMAGEMAP(image->format) )
       msFreeImageIM(image);
@@ -1134,6 +1129,10 @@ void msFreeImage(imageObj *image)
     msFree( image->img_mask );
     image->img_mask= NULL;
 
+    msFree( image->clipscratch );
+    image->clipscratch = NULL;
+    image->clipscratchsize = 0;
+
     msFree( image );
   }
 }
@@ -1686,7 +1685,8 @@ imageObj *msImageCreate(int width, int height, outputFormatObj *format,
     image->imagepath = NULL;
     image->imageurl = NULL;
     image->tilecache = NULL;
-    image->ntiles = 0;
+    image->clipscratch = NULL;
+    image->clipscratchsize = 0;
     image->resolution = resolution;
     image->resolutionfactor = resolution/defresolution;
 
@@ -2143,6 +2143,8 @@ void msCleanup()
 #endif
 
   msFontCacheCleanup();
+  msSymbolCacheCleanup();
+  msTileCacheCleanup();
 
   msTimeCleanup();
 
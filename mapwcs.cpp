@@ -1737,6 +1737,29 @@ void msWCSApplyDatasetMetadataAsCreationOptions(layerObj* lp,
     }
 }
 
+/************************************************************************/
+/*                       msWCSSendCoverageHeaders()                     */
+/*                                                                      */
+/*      Resolve the output format from the (first lines of the)         */
+/*      coverage image and send the headers of a WCS 1.0 coverage.      */
+/*      cbData is the FILENAME format option.                           */
+/************************************************************************/
+
+static int msWCSSendCoverageHeaders(mapObj *map, imageObj *image, void *cbData)
+{
+  const char *fo_filename = (const char *) cbData;
+
+  /* Do we have a predefined filename? */
+  if( fo_filename )
+    msIO_setHeader("Content-Disposition","attachment; filename=%s",
+                   fo_filename );
+
+  msOutputFormatResolveFromImage( map, image );
+  msIO_setHeader("Content-Type","%s",MS_IMAGE_MIME_TYPE(map->outputformat));
+  msIO_sendHeaders();
+  return MS_SUCCESS;
+}
+
 /************************************************************************/
 /*                          msWCSGetCoverage()                          */
 /************************************************************************/
@@ -2113,7 +2136,8 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage()", par
     return msWCSException(map, "MissingParameterValue", "format", params->version);
   }
   msApplyDefaultOutputFormats(map);
-  if(msGetOutputFormatIndex(map,params->format) == -1) {
+  /* also instantiates on demand formats, such as COG */
+  if(msSelectOutputFormat(map,params->format) == NULL) {
     msWCSFreeCoverageMetadata(&cm);
     msSetError( MS_WCSERR,  "Unrecognized value for the FORMAT parameter.", "msWCSGetCoverage()" );
     return msWCSException(map, "InvalidParameterValue", "format",
@@ -2238,6 +2262,28 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage()", par
     }
   }
   
+  /* -------------------------------------------------------------------- */
+  /*      WCS 1.0 coverages in a streamable format are rendered in        */
+  /*      strips and written straight to the client, without holding      */
+  /*      the whole image nor going through a temporary file.             */
+  /* -------------------------------------------------------------------- */
+  if( strncmp(params->version, "1.0",3) == 0 && !lp->mask &&
+      !map->gt.need_geotransform &&
+      msGDALCanStreamImage(map, map->outputformat) ) {
+    status = msDrawRasterLayerLowToStream( map, lp, hDS, NULL, doDrawRasterLayerDraw,
+                                           msWCSSendCoverageHeaders,
+                                           (void*) msGetOutputFormatOption( format, "FILENAME", NULL ) );
+    msDrawRasterLayerLowCloseDataset(lp, hDS);
+
+    msApplyOutputFormat(&(map->outputformat), NULL, MS_NOOVERRIDE, MS_NOOVERRIDE, MS_NOOVERRIDE);
+    msWCSFreeCoverageMetadata(&cm);
+
+    /* as for msSaveImage() below, the content type may already be sent */
+    if( status != MS_SUCCESS )
+      return msWCSException(map, NULL, NULL, params->version );
+    return status;
+  }
+
   /* create the image object  */
   if(!map->outputformat) {
     msWCSFreeCoverageMetadata(&cm);
@@ -2291,18 +2337,9 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage()", par
   if( strncmp(params->version, "1.1",3) == 0 ) {
     msWCSReturnCoverage11( params, map, image );
   } else { /* WCS 1.0.0 - just return the binary data with a content type */
-    const char *fo_filename;
-
-    /* Do we have a predefined filename? */
-    fo_filename = msGetOutputFormatOption( format, "FILENAME", NULL );
-    if( fo_filename )
-      msIO_setHeader("Content-Disposition","attachment; filename=%s",
-                     fo_filename );
-
     /* Emit back to client. */
-    msOutputFormatResolveFromImage( map, image );
-    msIO_setHeader("Content-Type","%s",MS_IMAGE_MIME_TYPE(map->outputformat));
-    msIO_sendHeaders();
+    msWCSSendCoverageHeaders( map, image,
+                              (void*) msGetOutputFormatOption( format, "FILENAME", NULL ) );
     status = msSaveImage(map, image, NULL);
 
     if( status != MS_SUCCESS ) {
@@ -2280,6 +2280,43 @@ static int msWCSWriteDocument20(mapObj* map, xmlDocPtr psDoc)
   return MS_SUCCESS;
 }
 
+/************************************************************************/
+/*                     msWCSSendCoverageHeaders20()                     */
+/*                                                                      */
+/*      Send the HTTP headers of a coverage returned without GML.       */
+/************************************************************************/
+
+static void msWCSSendCoverageHeaders20(mapObj* map, const char *fo_filename)
+{
+  msIO_setHeader("Content-Type","%s",MS_IMAGE_MIME_TYPE(map->outputformat));
+  msIO_setHeader("Content-Description","coverage data");
+  msIO_setHeader("Content-Transfer-Encoding","binary");
+
+  if( fo_filename != NULL ) {
+    msIO_setHeader("Content-ID","coverage/%s",fo_filename);
+    msIO_setHeader("Content-Disposition","INLINE; filename=%s",fo_filename);
+  } else {
+    msIO_setHeader("Content-ID","coverage/wcs.%s",MS_IMAGE_EXTENSION(map->outputformat));
+    msIO_setHeader("Content-Disposition","INLINE");
+  }
+  msIO_sendHeaders();
+}
+
+/************************************************************************/
+/*                    msWCSBeginCoverageStream20()                      */
+/*                                                                      */
+/*      msDrawRasterLayerLowToStream() callback: resolve the output     */
+/*      format from the first lines of the coverage and send the        */
+/*      headers.  cbData is the FILENAME format option.                 */
+/************************************************************************/
+
+static int msWCSBeginCoverageStream20(mapObj* map, imageObj* image, void *cbData)
+{
+  msOutputFormatResolveFromImage( map, image );
+  msWCSSendCoverageHeaders20(map, (const char *) cbData);
+  return MS_SUCCESS;
+}
+
 /************************************************************************/
 /*                   msWCSWriteFile20()                                 */
 /*                                                                      */
@@ -2371,18 +2408,7 @@ static int msWCSWriteFile20(mapObj* map, imageObj* image, wcs20ParamsObjPtr para
                       "Content-Disposition: INLINE\r\n\r\n",
                       MS_IMAGE_EXTENSION(map->outputformat));
     } else {
-      msIO_setHeader("Content-Type","%s",MS_IMAGE_MIME_TYPE(map->outputformat));
-      msIO_setHeader("Content-Description","coverage data");
-      msIO_setHeader("Content-Transfer-Encoding","binary");
-
-      if( fo_filename != NULL ) {
-        msIO_setHeader("Content-ID","coverage/%s",fo_filename);
-        msIO_setHeader("Content-Disposition","INLINE; filename=%s",fo_filename);
-      } else {
-        msIO_setHeader("Content-ID","coverage/wcs.%s",MS_IMAGE_EXTENSION(map->outputformat));
-        msIO_setHeader("Content-Disposition","INLINE");
-      }
-      msIO_sendHeaders();
+      msWCSSendCoverageHeaders20(map, fo_filename);
     }
 
     status = msSaveImage(map, image, NULL);
@@ -4109,7 +4135,10 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
   /* currently geotiff only */
   char *format_option;
   int i = 0;
-  int is_geotiff = (format->mimetype && EQUAL(format->mimetype, "image/tiff"));
+  int is_geotiff = (format->mimetype && EQUALN(format->mimetype, "image/tiff", 10));
+  /* COG output is always tiled, with square tiles of BLOCKSIZE */
+  int is_cog = (format->driver && EQUAL(format->driver, "GDAL/COG"));
+  int tilewidth = 0, tileheight = 0;
 
   if (!is_geotiff || !format_options) {
     /* Currently only geotiff available */
@@ -4134,7 +4163,7 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
     }
 
     if (EQUAL(key, "geotiff:compression") && is_geotiff) {
-      /*COMPRESS=[JPEG/LZW/PACKBITS/DEFLATE/CCITTRLE/CCITTFAX3/CCITTFAX4/NONE]*/
+      /*COMPRESS=[JPEG/LZW/PACKBITS/DEFLATE/ZSTD/LERC/CCITTRLE/CCITTFAX3/CCITTFAX4/NONE]*/
       if (EQUAL(value, "None")) {
         msSetOutputFormatOption(format, "COMPRESS", "NONE");
       }
@@ -4153,6 +4182,19 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
       else if (EQUAL(value, "JPEG")) {
         msSetOutputFormatOption(format, "COMPRESS", "JPEG");
       }
+      /* not in the GeoTIFF extension, but offered by GDAL */
+      else if (EQUAL(value, "ZSTD")) {
+        msSetOutputFormatOption(format, "COMPRESS", "ZSTD");
+      }
+      else if (EQUAL(value, "LERC")) {
+        msSetOutputFormatOption(format, "COMPRESS", "LERC");
+      }
+      else if (EQUAL(value, "LERC_Deflate")) {
+        msSetOutputFormatOption(format, "COMPRESS", "LERC_DEFLATE");
+      }
+      else if (EQUAL(value, "LERC_ZSTD")) {
+        msSetOutputFormatOption(format, "COMPRESS", "LERC_ZSTD");
+      }
       /* unsupported compression methods: CCITTFAX3/CCITTFAX4 */
       else {
         msSetError(MS_WCSERR, "Compression method '%s' not supported.",
@@ -4212,9 +4254,15 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
     else if (EQUAL(key, "geotiff:tiling") && is_geotiff) {
       /* TILED=YES */
       if (EQUAL(value, "true")) {
-        msSetOutputFormatOption(format, "TILED", "YES");
+        if (!is_cog)
+          msSetOutputFormatOption(format, "TILED", "YES");
       }
       else if (EQUAL(value, "false")) {
+        if (is_cog) {
+          msSetError(MS_WCSERR, "Cloud optimized GeoTIFF output is always tiled.",
+                     "msWCSSetFormatParams20()");
+          return MS_FAILURE;
+        }
         msSetOutputFormatOption(format, "TILED", "NO");
       }
       else {
@@ -4225,8 +4273,6 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
     }
     else if (EQUAL(key, "geotiff:tileheight") && is_geotiff) {
       /* BLOCKXSIZE=n */
-      int tileheight;
-
       if (msStringParseInteger(value, &tileheight) != MS_SUCCESS) {
         msSetError(MS_WCSERR, "Could not parse tileheight value.",
                  "msWCSSetFormatParams20()");
@@ -4238,12 +4284,10 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
                    "msWCSSetFormatParams20()", tileheight);
         return MS_FAILURE;
       }
-      msSetOutputFormatOption(format, "BLOCKXSIZE", value);
+      msSetOutputFormatOption(format, is_cog ? "BLOCKSIZE" : "BLOCKXSIZE", value);
     }
     else if (EQUAL(key, "geotiff:tilewidth") && is_geotiff) {
       /* BLOCKYSIZE=n */
-      int tilewidth;
-
       if (msStringParseInteger(value, &tilewidth) != MS_SUCCESS) {
         msSetError(MS_WCSERR, "Could not parse tilewidth value.",
                  "msWCSSetFormatParams20()");
@@ -4255,7 +4299,7 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
                    "msWCSSetFormatParams20()", tilewidth);
         return MS_FAILURE;
       }
-      msSetOutputFormatOption(format, "BLOCKYSIZE", value);
+      msSetOutputFormatOption(format, is_cog ? "BLOCKSIZE" : "BLOCKYSIZE", value);
     }
     else if (EQUALN(key, "geotiff:", 8)) {
       msSetError(MS_WCSERR, "Unrecognized GeoTIFF parameter '%s'.",
@@ -4269,6 +4313,13 @@ static int msWCSSetFormatParams20(outputFormatObj* format, char** format_options
     format_option = format_options[++i];
   }
 
+  if (is_cog && tilewidth && tileheight && tilewidth != tileheight) {
+    msSetError(MS_WCSERR, "Invalid tilewidth '%d' and tileheight '%d' values. "
+               "COG tiles are square, they must be equal.",
+               "msWCSSetFormatParams20()", tilewidth, tileheight);
+    return MS_FAILURE;
+  }
+
   return MS_SUCCESS;
 }
 
@@ -4684,7 +4735,8 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage20()", p
 
   msApplyDefaultOutputFormats(map);
 
-  if (msGetOutputFormatIndex(map, params->format) == -1) {
+  /* also instantiates on demand formats, such as COG */
+  if (msSelectOutputFormat(map, params->format) == NULL) {
     msSetError(MS_WCSERR, "Unrecognized value '%s' for the FORMAT parameter.",
                "msWCSGetCoverage20()", params->format);
     msWCSClearCoverageMetadata20(&cm);
@@ -4765,6 +4817,29 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage20()", p
       }
   }
 
+  /* -------------------------------------------------------------------- */
+  /*      Without GML, coverages in a streamable format are rendered in   */
+  /*      strips and written straight to the client, without holding      */
+  /*      the whole image nor going through /vsimem/.                     */
+  /* -------------------------------------------------------------------- */
+  if( params->multipart == MS_FALSE && !layer->mask &&
+      !map->gt.need_geotransform &&
+      msGDALCanStreamImage(map, map->outputformat) ) {
+    status = msDrawRasterLayerLowToStream(map, layer, hDS, &map->imagecolor,
+                                          doDrawRasterLayerDraw,
+                                          msWCSBeginCoverageStream20,
+                                          (void *) msGetOutputFormatOption(map->outputformat, "FILENAME", NULL));
+    msDrawRasterLayerLowCloseDataset(layer, hDS);
+
+    msFree(bandlist);
+    msWCSClearCoverageMetadata20(&cm);
+
+    /* the content type may already be sent, as when msSaveImage() fails */
+    if( status != MS_SUCCESS )
+      return msWCSException(map, NULL, NULL, params->version );
+    return MS_SUCCESS;
+  }
+
   /* create the image object  */
   if (!map->outputformat) {
     msWCSClearCoverageMetadata20(&cm);
@@ -4971,7 +5046,7 @@ this request. Check wcs/ows_enable_request settings.", "msWCSGetCoverage20()", p
     msFree(default_filename);
 
     std::string role;
-    if(EQUAL(MS_IMAGE_MIME_TYPE(map->outputformat), "image/tiff")) {
+    if(EQUALN(MS_IMAGE_MIME_TYPE(map->outputformat), "image/tiff", 10)) {
       role = MS_WCS_20_PROFILE_GML_GEOTIFF;
     } else {
       role = MS_IMAGE_MIME_TYPE(map->outputformat);
@@ -1858,7 +1858,7 @@ static int msWFSGetFeature_GMLPreamble( mapObj *map,
     {
         if( maxfeatures > 0 && 
             iResultTypeHits != 1 && paramsObj->nStartIndex > 0 &&
-            ((nMatchingFeatures < 0  && iNumberOfFeatures > 0) ||
+            ((nMatchingFeatures < 0  && iNumberOfFeatures != 0) ||
              (nMatchingFeatures >= 0 && paramsObj->nStartIndex < nMatchingFeatures)) )
         {
             int nPrevStartIndex;
@@ -3323,6 +3323,255 @@ static void msWFSSetShapeCache(mapObj* map)
     }
 }
 
+/*
+** msWFSSetGMLMetadata()
+**
+** Apply the per layer GML_GROUPS, GML_INCLUDE_ITEMS and GML_GEOMETRIES
+** derived from the request to the layer metadata used by the GML writer.
+*/
+static void msWFSSetGMLMetadata(mapObj* map, char** papszGMLGroups,
+                                char** papszGMLIncludeItems,
+                                char** papszGMLGeometries)
+{
+    int i;
+    for(i=0;i<map->numlayers;i++)
+    {
+      layerObj* lp = GET_LAYER(map, i);
+      if( papszGMLGroups[i] )
+          msInsertHashTable(&(lp->metadata), "GML_GROUPS", papszGMLGroups[i]);
+      if( papszGMLIncludeItems[i] )
+          msInsertHashTable(&(lp->metadata), "GML_INCLUDE_ITEMS", papszGMLIncludeItems[i]);
+      if( papszGMLGeometries[i] )
+          msInsertHashTable(&(lp->metadata), "GML_GEOMETRIES", papszGMLGeometries[i]);
+    }
+}
+
+/*
+** msWFSGetFeatureUseURN()
+**
+** Whether GetFeature returns SRS names as URNs.
+*/
+static int msWFSGetFeatureUseURN(mapObj* map, int nWFSVersion)
+{
+    /* Would make sense for WFS 1.1.0 too ! See #3576 */
+    int bUseURN = (nWFSVersion == OWS_2_0_0);
+    const char* useurn = msOWSLookupMetadata(&(map->web.metadata), "F", "return_srs_as_urn");
+    if (useurn && strcasecmp(useurn, "true") == 0)
+      bUseURN = 1;
+    else if (useurn && strcasecmp(useurn, "false") == 0)
+      bUseURN = 0;
+    return bUseURN;
+}
+
+/*
+** msWFSUseFeatureStreaming()
+**
+** Whether features can be written as the query reads them, rather than
+** being fetched again one by one from the result cache. Enabled with the
+** wfs_features_streaming metadata, for GML and OGR output formats.
+*/
+static int msWFSUseFeatureStreaming(mapObj* map, wfsParamsObj *paramsObj,
+                                    outputFormatObj *psFormat,
+                                    int iResultTypeHits, int maxfeatures,
+                                    int numlayers, int nWFSVersion)
+{
+    const char* pszFeaturesStreaming =
+                msOWSLookupMetadata(&(map->web.metadata), "F",
+                                                "features_streaming");
+    if( pszFeaturesStreaming == NULL ||
+        strcasecmp(pszFeaturesStreaming, "true") != 0 )
+        return MS_FALSE;
+
+    /* Template output formats are not streamed. A single GetFeatureById */
+    /* response is post-processed, and WFS 2.0 GML needs a */
+    /* FeatureCollection per type when several types are requested. */
+    if( (psFormat != NULL && !MS_RENDERER_OGR(psFormat)) ||
+        iResultTypeHits || maxfeatures == 0 ||
+        paramsObj->countGetFeatureById == 1 ||
+        (psFormat == NULL && nWFSVersion >= OWS_2_0_0 && numlayers != 1) )
+        return MS_FALSE;
+
+    return MS_TRUE;
+}
+
+/*
+** msWFSUseFeatureStreamingCountPass()
+**
+** A streamed response is normally written in a single pass. WFS 2.0 GML
+** output must however report the number of returned features
+** (numberReturned) and the link to the next page before the first
+** feature, and wfs_compute_number_matched asks for exact counts: in those
+** cases a first pass counts the features before they are written.
+*/
+static int msWFSUseFeatureStreamingCountPass(mapObj* map,
+                                             outputFormatObj *psFormat,
+                                             int nWFSVersion)
+{
+    const char* pszComputeNumberMatched;
+
+    if( nWFSVersion < OWS_2_0_0 )
+        return MS_FALSE;
+    if( psFormat == NULL )
+        return MS_TRUE;
+
+    pszComputeNumberMatched =
+                msOWSLookupMetadata(&(map->web.metadata), "F",
+                                                "compute_number_matched");
+
+    return pszComputeNumberMatched != NULL &&
+           strcasecmp(pszComputeNumberMatched, "true") == 0;
+}
+
+/*
+** Shape callback of the counting pass of a streamed GetFeature: the
+** result cache only keeps the count and bounds of the results.
+*/
+static int msWFSDiscardShape(void *user_data, layerObj *lp, shapeObj *shape)
+{
+    (void)user_data;
+    (void)lp;
+    (void)shape;
+    return MS_SUCCESS;
+}
+
+/*
+** State of a streamed GetFeature response. The response is only started
+** when the query hands over its first feature, so that errors raised before
+** (invalid filter, ...) are still reported as an exception, and a request
+** without results gets the regular empty response.
+*/
+typedef struct {
+    mapObj *map;
+    cgiRequestObj *req;
+    WFSGMLInfo *gmlinfo;
+    wfsParamsObj *paramsObj;
+    outputFormatObj *psFormat; /* NULL for GML output */
+    OWSGMLVersion outputformat;
+    int nWFSVersion;
+    int bUseURN;
+    int maxfeatures;
+    int bCounted; /* the values below come from a counting pass */
+    int iNumberOfFeatures;
+    int nMatchingFeatures;
+    int bHasNextFeatures;
+    int bStarted;
+    int nWritten;
+    gmlWFSQueryStreamObj *gmlstream;
+    msOGROutputObj *ogrstream;
+    int status;
+} WFSFeatureStreamObj;
+
+static int msWFSStartFeatureStream(WFSFeatureStreamObj *wfsstream)
+{
+    wfsstream->bStarted = MS_TRUE;
+
+    if( wfsstream->psFormat == NULL )
+    {
+        msIO_setHeader("Content-Type","%s; charset=UTF-8",
+                       wfsstream->gmlinfo->output_mime_type);
+        msIO_sendHeaders();
+
+        if( msWFSGetFeature_GMLPreamble(wfsstream->map, wfsstream->req,
+                                        wfsstream->gmlinfo,
+                                        wfsstream->paramsObj,
+                                        wfsstream->outputformat,
+                                        MS_FALSE,
+                                        wfsstream->bCounted ?
+                                            wfsstream->iNumberOfFeatures : -1,
+                                        wfsstream->nMatchingFeatures,
+                                        wfsstream->maxfeatures,
+                                        wfsstream->bHasNextFeatures,
+                                        wfsstream->nWFSVersion) != MS_SUCCESS )
+            return MS_FAILURE;
+
+        wfsstream->gmlstream = msGMLStartWFSQueryStream(wfsstream->map, stdout,
+                                        wfsstream->gmlinfo->user_namespace_prefix,
+                                        wfsstream->outputformat,
+                                        wfsstream->nWFSVersion,
+                                        wfsstream->bUseURN,
+                                        wfsstream->bCounted);
+    }
+    else
+    {
+        if( wfsstream->nMatchingFeatures >= 0 )
+        {
+            char szMatchingFeatures[12];
+            sprintf(szMatchingFeatures, "%d", wfsstream->nMatchingFeatures);
+            msSetOutputFormatOption(wfsstream->psFormat, "_matching_features_",
+                                    szMatchingFeatures);
+        }
+        else
+        {
+            msSetOutputFormatOption(wfsstream->psFormat, "_matching_features_", "");
+        }
+
+        wfsstream->ogrstream = msOGRStartQueryStream(wfsstream->map,
+                                                     wfsstream->psFormat,
+                                                     MS_TRUE);
+        if( wfsstream->ogrstream == NULL )
+            return MS_FAILURE;
+    }
+
+    return MS_SUCCESS;
+}
+
+/*
+** Shape callback of a streamed GetFeature, writing the features.
+*/
+static int msWFSWriteStreamedFeature(void *user_data, layerObj *lp, shapeObj *shape)
+{
+    WFSFeatureStreamObj *wfsstream = (WFSFeatureStreamObj *) user_data;
+    int status;
+
+    if( wfsstream->status != MS_SUCCESS )
+        return MS_FAILURE;
+
+    /* The query asks for one more feature than requested, to know if */
+    /* there are next features: drop it. */
+    if( wfsstream->maxfeatures >= 0 &&
+        wfsstream->nWritten >= wfsstream->maxfeatures )
+        return MS_SUCCESS;
+
+    if( !wfsstream->bStarted &&
+        msWFSStartFeatureStream(wfsstream) != MS_SUCCESS )
+    {
+        wfsstream->status = MS_FAILURE;
+        return MS_FAILURE;
+    }
+
+    if( wfsstream->gmlstream )
+        status = msGMLWriteWFSQueryStreamShape(wfsstream->gmlstream, lp, shape);
+    else
+        status = msOGRWriteQueryStreamShape(wfsstream->ogrstream, lp, shape);
+    if( status != MS_SUCCESS )
+        wfsstream->status = MS_FAILURE;
+    else
+        wfsstream->nWritten ++;
+
+    return status;
+}
+
+/*
+** Completes a started streamed response. If bAbort is set, the query failed
+** and the OGR output is dropped.
+*/
+static int msWFSEndFeatureStream(WFSFeatureStreamObj *wfsstream, int bAbort)
+{
+    int status = bAbort ? MS_FAILURE : wfsstream->status;
+
+    if( wfsstream->gmlstream &&
+        msGMLEndWFSQueryStream(wfsstream->gmlstream) != MS_SUCCESS )
+        status = MS_FAILURE;
+    if( wfsstream->ogrstream &&
+        msOGREndQueryStream(wfsstream->ogrstream,
+                            status != MS_SUCCESS) != MS_SUCCESS )
+        status = MS_FAILURE;
+    wfsstream->gmlstream = NULL;
+    wfsstream->ogrstream = NULL;
+
+    return status;
+}
+
 /*
 ** msWFSGetFeature()
 */
@@ -3348,6 +3597,9 @@ int msWFSGetFeature(mapObj *map, wfsParamsObj *paramsObj, cgiRequestObj *req,
   int iResultTypeHits = 0;
   int nMatchingFeatures = -1;
   int bHasNextFeatures = MS_FALSE;
+  int bStreaming = MS_FALSE;
+  int bStreamingCountPass = MS_FALSE;
+  int nSavedStartIndex = -1, nSavedMaxFeatures = -1;
 
   char** papszGMLGroups = NULL;
   char** papszGMLIncludeItems = NULL;
@@ -3766,53 +4018,176 @@ int msWFSGetFeature(mapObj *map, wfsParamsObj *paramsObj, cgiRequestObj *req,
       return status;
   }
 
+  bStreaming = msWFSUseFeatureStreaming(map, paramsObj, psFormat,
+                                        iResultTypeHits, maxfeatures,
+                                        numlayers, nWFSVersion);
+  bStreamingCountPass = bStreaming &&
+                        msWFSUseFeatureStreamingCountPass(map, psFormat,
+                                                          nWFSVersion);
+
   if( iResultTypeHits == 1 )
   {
       map->query.only_cache_result_count = MS_TRUE;
   }
+  else if( bStreaming )
+  {
+      /* The query consumes startindex/maxfeatures, keep them for the */
+      /* pass writing the features. */
+      nSavedStartIndex = map->query.startindex;
+      nSavedMaxFeatures = map->query.maxfeatures;
+      if( bStreamingCountPass )
+      {
+          map->query.shape_callback = msWFSDiscardShape;
+          map->query.shape_callback_data = NULL;
+      }
+  }
   else
   {
       msWFSSetShapeCache(map);
   }
 
-  status = msWFSRetrieveFeatures(map,
-                                 ows_request,
-                           paramsObj,
-                           &gmlinfo,
-                           paramsObj->pszFilter,
-                           paramsObj->pszBbox != NULL,
-                           sBBoxSrs,
-                           bbox,
-                           paramsObj->pszFeatureId,
-                           layers,
-                           numlayers,
-                           maxfeatures,
-                           nWFSVersion,
-                           &iNumberOfFeatures,
-                           &bHasNextFeatures);
-  if( status != MS_SUCCESS )
+  if( !bStreaming || bStreamingCountPass )
+  {
+    status = msWFSRetrieveFeatures(map,
+                                   ows_request,
+                                   paramsObj,
+                                   &gmlinfo,
+                                   paramsObj->pszFilter,
+                                   paramsObj->pszBbox != NULL,
+                                   sBBoxSrs,
+                                   bbox,
+                                   paramsObj->pszFeatureId,
+                                   layers,
+                                   numlayers,
+                                   maxfeatures,
+                                   nWFSVersion,
+                                   &iNumberOfFeatures,
+                                   &bHasNextFeatures);
+    map->query.shape_callback = NULL;
+    if( status != MS_SUCCESS )
+    {
+        msFreeCharArray(layers, numlayers);
+        msFree(sBBoxSrs);
+        msFreeCharArray(papszGMLGroups, map->numlayers);
+        msFreeCharArray(papszGMLIncludeItems, map->numlayers);
+        msFreeCharArray(papszGMLGeometries, map->numlayers);
+        return status;
+    }
+
+    /* ----------------------------------------- */
+    /* Now compute nMatchingFeatures for WFS 2.0 */
+    /* ----------------------------------------- */
+
+    nMatchingFeatures = msWFSComputeMatchingFeatures(map,ows_request,paramsObj,
+                                                     iNumberOfFeatures,
+                                                     maxfeatures,
+                                                     &gmlinfo,
+                                                     bbox,
+                                                     sBBoxSrs,
+                                                     layers,
+                                                     numlayers,
+                                                     nWFSVersion);
+  }
+
+  /* ------------------------------------------------------------------ */
+  /* Streamed response: the features are written as the query reads    */
+  /* them, and the response is started with the first one.             */
+  /* ------------------------------------------------------------------ */
+  if( bStreaming )
   {
+    WFSFeatureStreamObj wfsstream;
+    int iNumberOfStreamedFeatures = 0;
+    int bHasNextStreamedFeatures = MS_FALSE;
+
+    msWFSSetGMLMetadata(map, papszGMLGroups, papszGMLIncludeItems,
+                        papszGMLGeometries);
+
+    memset(&wfsstream, 0, sizeof(wfsstream));
+    wfsstream.map = map;
+    wfsstream.req = req;
+    wfsstream.gmlinfo = &gmlinfo;
+    wfsstream.paramsObj = paramsObj;
+    wfsstream.psFormat = psFormat;
+    wfsstream.outputformat = outputformat;
+    wfsstream.nWFSVersion = nWFSVersion;
+    wfsstream.bUseURN = msWFSGetFeatureUseURN(map, nWFSVersion);
+    wfsstream.maxfeatures = maxfeatures;
+    wfsstream.bCounted = bStreamingCountPass;
+    wfsstream.iNumberOfFeatures = iNumberOfFeatures;
+    wfsstream.nMatchingFeatures = nMatchingFeatures;
+    wfsstream.bHasNextFeatures = bHasNextFeatures;
+    wfsstream.status = MS_SUCCESS;
+
+    map->query.startindex = nSavedStartIndex;
+    map->query.maxfeatures = nSavedMaxFeatures;
+    map->query.shape_callback = msWFSWriteStreamedFeature;
+    map->query.shape_callback_data = &wfsstream;
+
+    status = msWFSRetrieveFeatures(map,
+                                   ows_request,
+                                   paramsObj,
+                                   &gmlinfo,
+                                   paramsObj->pszFilter,
+                                   paramsObj->pszBbox != NULL,
+                                   sBBoxSrs,
+                                   bbox,
+                                   paramsObj->pszFeatureId,
+                                   layers,
+                                   numlayers,
+                                   maxfeatures,
+                                   nWFSVersion,
+                                   &iNumberOfStreamedFeatures,
+                                   &bHasNextStreamedFeatures);
+
+    map->query.shape_callback = NULL;
+    map->query.shape_callback_data = NULL;
+
+    if( wfsstream.bStarted )
+    {
+      status = msWFSEndFeatureStream(&wfsstream, status != MS_SUCCESS);
+
+      if( psFormat == NULL && status == MS_SUCCESS )
+        msWFSGetFeature_GMLPostfix( map, req, &gmlinfo, paramsObj,
+                                    outputformat,
+                                    maxfeatures, iResultTypeHits,
+                                    wfsstream.nWritten,
+                                    nWFSVersion );
+
       msFreeCharArray(layers, numlayers);
       msFree(sBBoxSrs);
+      msWFSCleanupGMLInfo(&gmlinfo);
       msFreeCharArray(papszGMLGroups, map->numlayers);
       msFreeCharArray(papszGMLIncludeItems, map->numlayers);
       msFreeCharArray(papszGMLGeometries, map->numlayers);
       return status;
-  }
+    }
 
-  /* ----------------------------------------- */
-  /* Now compute nMatchingFeatures for WFS 2.0 */
-  /* ----------------------------------------- */
-  
-  nMatchingFeatures = msWFSComputeMatchingFeatures(map,ows_request,paramsObj,
-                                                   iNumberOfFeatures,
-                                                   maxfeatures,
-                                                   &gmlinfo,
-                                                   bbox,
-                                                   sBBoxSrs,
-                                                   layers,
-                                                   numlayers,
-                                                   nWFSVersion);
+    if( status != MS_SUCCESS )
+    {
+        msFreeCharArray(layers, numlayers);
+        msFree(sBBoxSrs);
+        msFreeCharArray(papszGMLGroups, map->numlayers);
+        msFreeCharArray(papszGMLIncludeItems, map->numlayers);
+        msFreeCharArray(papszGMLGeometries, map->numlayers);
+        return status;
+    }
+
+    /* Nothing was found: send the regular empty response */
+    if( !bStreamingCountPass )
+    {
+      iNumberOfFeatures = iNumberOfStreamedFeatures;
+      bHasNextFeatures = bHasNextStreamedFeatures;
+      nMatchingFeatures = msWFSComputeMatchingFeatures(map,ows_request,paramsObj,
+                                                       iNumberOfFeatures,
+                                                       maxfeatures,
+                                                       &gmlinfo,
+                                                       bbox,
+                                                       sBBoxSrs,
+                                                       layers,
+                                                       numlayers,
+                                                       nWFSVersion);
+    }
+  }
 
   msFreeCharArray(layers, numlayers);
 
@@ -3859,19 +4234,8 @@ int msWFSGetFeature(mapObj *map, wfsParamsObj *paramsObj, cgiRequestObj *req,
     }
   }
 
-  {
-    int i;
-    for(i=0;i<map->numlayers;i++)
-    {
-      layerObj* lp = GET_LAYER(map, i);
-      if( papszGMLGroups[i] )
-          msInsertHashTable(&(lp->metadata), "GML_GROUPS", papszGMLGroups[i]);
-      if( papszGMLIncludeItems[i] )
-          msInsertHashTable(&(lp->metadata), "GML_INCLUDE_ITEMS", papszGMLIncludeItems[i]);
-      if( papszGMLGeometries[i] )
-          msInsertHashTable(&(lp->metadata), "GML_GEOMETRIES", papszGMLGeometries[i]);
-    }
-  }
+  msWFSSetGMLMetadata(map, papszGMLGroups, papszGMLIncludeItems,
+                      papszGMLGeometries);
 
   /* handle case of maxfeatures = 0 */
   /*internally use a start index that start with 0 as the first index*/
@@ -3880,13 +4244,7 @@ int msWFSGetFeature(mapObj *map, wfsParamsObj *paramsObj, cgiRequestObj *req,
     {
       int bWFS2MultipleFeatureCollection = MS_FALSE;
 
-      /* Would make sense for WFS 1.1.0 too ! See #3576 */
-      int bUseURN = (nWFSVersion == OWS_2_0_0);
-      const char* useurn = msOWSLookupMetadata(&(map->web.metadata), "F", "return_srs_as_urn");
-      if (useurn && strcasecmp(useurn, "true") == 0)
-        bUseURN = 1;
-      else if (useurn && strcasecmp(useurn, "false") == 0)
-        bUseURN = 0;
+      int bUseURN = msWFSGetFeatureUseURN(map, nWFSVersion);
 
       /* For WFS 2.0, when we request several types, we must present each type */
       /* in its own FeatureCollection (§ 11.3.3.5 ) */
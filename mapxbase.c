@@ -33,6 +33,15 @@
 #include <math.h>
 
 #include "cpl_vsi.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 static inline void IGUR_sizet(size_t ignored) { (void)ignored; }  /* Ignore GCC Unused Result */
 
@@ -123,6 +132,19 @@ static void flushRecord( DBFHandle psDBF )
   }
 }
 
+/************************************************************************/
+/*                              msDBFUnmap()                            */
+/************************************************************************/
+static void msDBFUnmap( DBFHandle psDBF )
+{
+#ifdef HAVE_MMAP
+  if( psDBF->pabyMap != NULL )
+    munmap( (void *) psDBF->pabyMap, psDBF->nMapSize );
+#endif
+  psDBF->pabyMap = NULL;
+  psDBF->nMapSize = 0;
+}
+
 /************************************************************************/
 /*                              msDBFOpen()                             */
 /*                                                                      */
@@ -184,6 +206,36 @@ DBFHandle msDBFOpen( const char * pszFilename, const char * pszAccess )
   psDBF->pszStringField = NULL;
   psDBF->nStringFieldLen = 0;
 
+  psDBF->pabyMap = NULL;
+  psDBF->nMapSize = 0;
+#ifdef HAVE_MMAP
+  /* -------------------------------------------------------------------- */
+  /*      With CONFIG "MS_DBF_MMAP" "YES", map read-only tables in        */
+  /*      memory, so that records are read straight from the page        */
+  /*      cache instead of seek()+read() into pszCurrentRecord.  This     */
+  /*      is opt-in: reading a mapped file that gets truncated (e.g.      */
+  /*      replaced in place) raises SIGBUS instead of a read error.       */
+  /*      Virtual file systems keep using VSI.                            */
+  /* -------------------------------------------------------------------- */
+  if( (strcmp(pszAccess,"r") == 0 || strcmp(pszAccess,"rb") == 0)
+      && strncmp(pszDBFFilename, "/vsi", 4) != 0
+      && CSLTestBoolean(CPLGetConfigOption("MS_DBF_MMAP", "NO")) ) {
+    int fd = open(pszDBFFilename, O_RDONLY);
+    struct stat sStat;
+
+    if( fd >= 0 ) {
+      if( fstat(fd, &sStat) == 0 && sStat.st_size > 0 ) {
+        void *pMap = mmap(NULL, (size_t)sStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if( pMap != MAP_FAILED ) {
+          psDBF->pabyMap = (const uchar *) pMap;
+          psDBF->nMapSize = (size_t)sStat.st_size;
+        }
+      }
+      close(fd);
+    }
+  }
+#endif
+
   free( pszDBFFilename );
 
   /* -------------------------------------------------------------------- */
@@ -192,6 +244,7 @@ DBFHandle msDBFOpen( const char * pszFilename, const char * pszAccess )
   pabyBuf = (uchar *) msSmallMalloc(500);
   if( VSIFReadL( pabyBuf, 32, 1, psDBF->fp ) != 1 )
   {
+    msDBFUnmap(psDBF);
     msFree(psDBF);
     msFree(pabyBuf);
     return( NULL );
@@ -216,6 +269,7 @@ DBFHandle msDBFOpen( const char * pszFilename, const char * pszAccess )
   VSIFSeekL( psDBF->fp, 32, 0 );
   if( VSIFReadL( pabyBuf, nHeadLen - 32, 1, psDBF->fp ) != 1 )
   {
+    msDBFUnmap(psDBF);
     msFree(psDBF->pszCurrentRecord);
     msFree(psDBF);
     msFree(pabyBuf);
@@ -248,6 +302,12 @@ DBFHandle msDBFOpen( const char * pszFilename, const char * pszAccess )
         psDBF->panFieldOffset[iField-1] + psDBF->panFieldSize[iField-1];
   }
 
+  /* A truncated file is left to the regular reading code, which reports */
+  /* the missing records as errors. */
+  if( psDBF->pabyMap != NULL &&
+      psDBF->nMapSize < (size_t)nHeadLen + (size_t)nRecLen * (size_t)nRecords )
+    msDBFUnmap( psDBF );
+
   return( psDBF );
 }
 
@@ -292,6 +352,7 @@ void  msDBFClose(DBFHandle psDBF)
   /*      Close, and free resources.                                      */
   /* -------------------------------------------------------------------- */
   VSIFCloseL( psDBF->fp );
+  msDBFUnmap( psDBF );
 
   if( psDBF->panFieldOffset != NULL ) {
     free( psDBF->panFieldOffset );
@@ -366,6 +427,9 @@ DBFHandle msDBFCreate( const char * pszFilename )
   psDBF->pszStringField = NULL;
   psDBF->nStringFieldLen = 0;
 
+  psDBF->pabyMap = NULL;
+  psDBF->nMapSize = 0;
+
   psDBF->bNoHeader = MS_TRUE;
   psDBF->bUpdated = MS_FALSE;
 
@@ -468,55 +532,48 @@ int msDBFAddField(DBFHandle psDBF, const char * pszFieldName, DBFFieldType eType
 /*      Based on DBFIsAttributeNULL of shapelib                         */
 /************************************************************************/
 
-static int DBFIsValueNULL( const char* pszValue, char type )
+static int DBFIsValueNULL( const char* pszValue, int nLength, char type )
 
 {
   switch(type) {
     case 'N':
     case 'F':
       /* NULL numeric fields have value "****************" */
-      return pszValue[0] == '*';
+      return nLength > 0 && pszValue[0] == '*';
 
     case 'D':
       /* NULL date fields have value "00000000" */
-      return strncmp(pszValue,"00000000",8) == 0;
+      return nLength >= 8 && strncmp(pszValue,"00000000",8) == 0;
 
     case 'L':
       /* NULL boolean fields have value "?" */
-      return pszValue[0] == '?';
+      return nLength > 0 && pszValue[0] == '?';
 
     default:
       /* empty string fields are considered NULL */
-      return strlen(pszValue) == 0;
+      return nLength == 0;
   }
 }
 
 /************************************************************************/
-/*                          msDBFReadAttribute()                        */
+/*                            msDBFGetRecord()                          */
 /*                                                                      */
-/*      Read one of the attribute fields of a record.                   */
+/*      Return the raw bytes of a record, either from the mapped file   */
+/*      or loaded in pszCurrentRecord.                                  */
 /************************************************************************/
-static const char *msDBFReadAttribute(DBFHandle psDBF, int hEntity, int iField )
+static const uchar *msDBFGetRecord(DBFHandle psDBF, int hEntity )
 
 {
-  int         i;
   unsigned int nRecordOffset;
-  const uchar *pabyRec;
-  const char  *pReturnField = NULL;
-
-  /* -------------------------------------------------------------------- */
-  /*  Is the request valid?                             */
-  /* -------------------------------------------------------------------- */
-  if( iField < 0 || iField >= psDBF->nFields ) {
-    msSetError(MS_DBFERR, "Invalid field index %d.", "msDBFReadAttribute()",iField );
-    return( NULL );
-  }
 
   if( hEntity < 0 || hEntity >= psDBF->nRecords ) {
     msSetError(MS_DBFERR, "Invalid record number %d.", "msDBFReadAttribute()",hEntity );
     return( NULL );
   }
 
+  if( psDBF->pabyMap != NULL )
+    return( psDBF->pabyMap + (size_t)psDBF->nRecordLength * hEntity + psDBF->nHeaderLength );
+
   /* -------------------------------------------------------------------- */
   /*  Have we read the record?              */
   /* -------------------------------------------------------------------- */
@@ -535,54 +592,97 @@ static const char *msDBFReadAttribute(DBFHandle psDBF, int hEntity, int iField )
     psDBF->nCurrentRecord = hEntity;
   }
 
-  pabyRec = (const uchar *) psDBF->pszCurrentRecord;
-  /* DEBUG */
-  /* printf("CurrentRecord(%c):%s\n", psDBF->pachFieldType[iField], pabyRec); */
+  return( (const uchar *) psDBF->pszCurrentRecord );
+}
+
+/************************************************************************/
+/*                        msDBFReadAttributeSlice()                     */
+/*                                                                      */
+/*      Return one of the attribute fields of a record, trimmed and     */
+/*      NULL-checked like msDBFReadStringAttribute(), without copying   */
+/*      it.  The value is not nul terminated, its length is returned    */
+/*      in *pnLength.  It is valid until the next read on the handle.   */
+/************************************************************************/
+const char *msDBFReadAttributeSlice(DBFHandle psDBF, int hEntity, int iField, int *pnLength )
+
+{
+  const uchar *pabyRec;
+  const char  *pszValue, *pszEnd;
+  int         nLength;
+  char        chType;
 
   /* -------------------------------------------------------------------- */
-  /*  Ensure our field buffer is large enough to hold this buffer.      */
+  /*  Is the request valid?                             */
   /* -------------------------------------------------------------------- */
-  if( psDBF->panFieldSize[iField]+1 > psDBF->nStringFieldLen ) {
-    psDBF->nStringFieldLen = psDBF->panFieldSize[iField]*2 + 10;
-    psDBF->pszStringField = (char *) SfRealloc(psDBF->pszStringField,psDBF->nStringFieldLen);
+  if( iField < 0 || iField >= psDBF->nFields ) {
+    msSetError(MS_DBFERR, "Invalid field index %d.", "msDBFReadAttribute()",iField );
+    return( NULL );
   }
 
+  if( (pabyRec = msDBFGetRecord( psDBF, hEntity )) == NULL )
+    return( NULL );
+
   /* -------------------------------------------------------------------- */
-  /*  Extract the requested field.              */
+  /*  Extract the requested field, up to an embedded nul if any.        */
   /* -------------------------------------------------------------------- */
-  strncpy( psDBF->pszStringField,(const char *) pabyRec+psDBF->panFieldOffset[iField], psDBF->panFieldSize[iField] );
-  psDBF->pszStringField[psDBF->panFieldSize[iField]] = '\0';
+  pszValue = (const char *) pabyRec + psDBF->panFieldOffset[iField];
+  nLength = psDBF->panFieldSize[iField];
+  if( (pszEnd = (const char *) memchr( pszValue, '\0', nLength )) != NULL )
+    nLength = pszEnd - pszValue;
 
   /*
   ** Trim trailing blanks (SDL Modification)
   */
-  for(i=strlen(psDBF->pszStringField)-1; i>=0; i--) {
-    if(psDBF->pszStringField[i] != ' ') {
-      psDBF->pszStringField[i+1] = '\0';
-      break;
-    }
-  }
-
-  if(i == -1) psDBF->pszStringField[0] = '\0'; /* whole string is blank (SDL fix)       */
+  while( nLength > 0 && pszValue[nLength-1] == ' ' )
+    nLength--;
 
   /*
   ** Trim/skip leading blanks (SDL/DM Modification - only on numeric types)
   */
-  if( psDBF->pachFieldType[iField] == 'N' || psDBF->pachFieldType[iField] == 'F' || psDBF->pachFieldType[iField] == 'D' ) {
-    for(i=0; psDBF->pszStringField[i] != '\0' ; i++) {
-      if(psDBF->pszStringField[i] != ' ')
-        break;
+  chType = psDBF->pachFieldType[iField];
+  if( chType == 'N' || chType == 'F' || chType == 'D' ) {
+    while( nLength > 0 && *pszValue == ' ' ) {
+      pszValue++;
+      nLength--;
     }
-    pReturnField = psDBF->pszStringField+i;
-  } else
-    pReturnField = psDBF->pszStringField;
 
-  /*  detect null values */
-  if ( DBFIsValueNULL( pReturnField, psDBF->pachFieldType[iField] )  ) {
-    if (psDBF->pachFieldType[iField] == 'N' || psDBF->pachFieldType[iField] == 'F' || psDBF->pachFieldType[iField] == 'D')
-      pReturnField="0";
+    /*  detect null values */
+    if ( DBFIsValueNULL( pszValue, nLength, chType ) ) {
+      pszValue = "0";
+      nLength = 1;
+    }
   }
-  return( pReturnField );
+
+  *pnLength = nLength;
+  return( pszValue );
+}
+
+/************************************************************************/
+/*                          msDBFReadAttribute()                        */
+/*                                                                      */
+/*      Read one of the attribute fields of a record.                   */
+/************************************************************************/
+static const char *msDBFReadAttribute(DBFHandle psDBF, int hEntity, int iField )
+
+{
+  const char  *pszValue;
+  int         nLength;
+
+  if( (pszValue = msDBFReadAttributeSlice( psDBF, hEntity, iField, &nLength )) == NULL )
+    return( NULL );
+
+  /* -------------------------------------------------------------------- */
+  /*  Ensure our field buffer is large enough to hold this buffer.      */
+  /* -------------------------------------------------------------------- */
+  if( nLength+1 > psDBF->nStringFieldLen ) {
+    psDBF->nStringFieldLen = psDBF->panFieldSize[iField]*2 + 10;
+    psDBF->pszStringField = (char *) SfRealloc(psDBF->pszStringField,psDBF->nStringFieldLen);
+  }
+
+  memcpy( psDBF->pszStringField, pszValue, nLength );
+  psDBF->pszStringField[nLength] = '\0';
+
+  return( psDBF->pszStringField );
 }
 
 /************************************************************************/
@@ -874,11 +974,26 @@ int *msDBFGetItemIndexes(DBFHandle dbffile, char **items, int numitems)
   return(itemindexes);
 }
 
+/*
+** Copy a value returned by msDBFReadAttributeSlice()
+*/
+static char *msDBFDupSlice(const char *value, int length)
+{
+  char *copy = (char *) msSmallMalloc(length + 1);
+  memcpy(copy, value, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+/*
+** Load the values of the requested items of a record. Only the fields
+** listed in itemindexes are decoded, straight from the record bytes.
+*/
 char **msDBFGetValueList(DBFHandle dbffile, int record, int *itemindexes, int numitems)
 {
   const char *value;
   char **values=NULL;
-  int i;
+  int i, length;
 
   if(numitems == 0) return(NULL);
 
@@ -886,12 +1001,40 @@ char **msDBFGetValueList(DBFHandle dbffile, int record, int *itemindexes, int nu
   MS_CHECK_ALLOC(values, sizeof(char *)*numitems, NULL);
 
   for(i=0; i<numitems; i++) {
-    value = msDBFReadStringAttribute(dbffile, record, itemindexes[i]);
+    value = msDBFReadAttributeSlice(dbffile, record, itemindexes[i], &length);
+    if (value == NULL) {
+      msFreeCharArray(values, i);
+      return NULL; /* Error already reported by msDBFReadAttributeSlice() */
+    }
+    values[i] = msDBFDupSlice(value, length);
+  }
+
+  return(values);
+}
+
+/*
+** Load the values of one field for a list of records, e.g. to classify or
+** sort a result set on a single column. If records is NULL, the first
+** numrecords records of the table are read.
+*/
+char **msDBFGetColumnValues(DBFHandle dbffile, int field, const int *records, int numrecords)
+{
+  const char *value;
+  char **values=NULL;
+  int i, length;
+
+  if(numrecords <= 0) return(NULL);
+
+  values = (char **)malloc(sizeof(char *)*numrecords);
+  MS_CHECK_ALLOC(values, sizeof(char *)*numrecords, NULL);
+
+  for(i=0; i<numrecords; i++) {
+    value = msDBFReadAttributeSlice(dbffile, records ? records[i] : i, field, &length);
     if (value == NULL) {
-      free(values);
-      return NULL; /* Error already reported by msDBFReadStringAttribute() */
+      msFreeCharArray(values, i);
+      return NULL; /* Error already reported by msDBFReadAttributeSlice() */
     }
-    values[i] = msStrdup(value);
+    values[i] = msDBFDupSlice(value, length);
   }
 
   return(values);
@@ -0,0 +1,166 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the AGG MARKER_CACHE format option.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+gdal_available = False
+try:
+    from osgeo import gdal
+    gdal_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+###############################################################################
+# Darkness of each pixel of a white background RGB image, read through GDAL.
+
+def ink(data):
+
+    filename = '/vsimem/test_agg_marker_cache.png'
+    gdal.FileFromMemBuffer(filename, data)
+    ds = gdal.Open(filename)
+    width, height = ds.RasterXSize, ds.RasterYSize
+    bands = [bytearray(ds.GetRasterBand(i + 1).ReadRaster()) for i in range(3)]
+    ds = None
+    gdal.Unlink(filename)
+
+    return [[765 - sum(band[y * width + x] for band in bands) for x in range(width)]
+            for y in range(height)]
+
+
+def draw_markers(marker_cache, angle=0):
+
+    points = ''
+    for i in range(4):
+        for j in range(3):
+            points += """
+    FEATURE
+      POINTS %f %f END
+    END""" % (10.3 + 20 * i, 10.7 + 20 * j)
+
+    map = mapscript.fromstring("""
+MAP
+  SIZE 80 60
+  EXTENT 0 0 80 60
+  IMAGECOLOR 255 255 255
+  IMAGETYPE "pngcache"
+  OUTPUTFORMAT
+    NAME "pngcache"
+    DRIVER "AGG/PNG"
+    IMAGEMODE RGB
+    FORMATOPTION "MARKER_CACHE=%s"
+  END
+  SYMBOL
+    NAME "triangle"
+    TYPE VECTOR
+    FILLED TRUE
+    POINTS 0 1 0.5 0 1 1 0 1 END
+  END
+  SYMBOL
+    NAME "circle"
+    TYPE ELLIPSE
+    FILLED TRUE
+    POINTS 1 1 END
+  END
+  LAYER
+    NAME "markers"
+    TYPE POINT
+    STATUS DEFAULT
+    CLASS
+      STYLE
+        SYMBOL "triangle"
+        SIZE 9
+        ANGLE %d
+        COLOR 0 0 0
+        OUTLINECOLOR 255 0 0
+        WIDTH 1
+      END
+      STYLE
+        SYMBOL "circle"
+        SIZE 3
+        ANGLE %d
+        COLOR 0 0 255
+      END
+    END
+    %s
+  END
+END
+""" % ('ON' if marker_cache else 'OFF', angle, angle, points))
+    return map.draw().getBytes()
+
+###############################################################################
+# Markers blitted from the cache land on the nearest pixel: the image
+# matches the directly rendered one within a pixel.
+
+def test_agg_marker_cache():
+
+    if 'OUTPUT=PNG' not in mapscript.msGetVersion():
+        pytest.skip()
+    if not gdal_available:
+        pytest.skip('GDAL python bindings not available')
+
+    expected = ink(draw_markers(False))
+    result = ink(draw_markers(True))
+
+    assert sum(map(sum, result)) > 0
+    assert abs(sum(map(sum, result)) - sum(map(sum, expected))) < 0.05 * sum(map(sum, expected))
+
+    # every marker is found within a pixel of its direct rendering
+    for i in range(4):
+        for j in range(3):
+            cx, cy = int(10.3 + 20 * i), 60 - int(10.7 + 20 * j)
+            def darkest(img):
+                window = [(img[y][x], x, y) for y in range(cy - 8, cy + 9) for x in range(cx - 8, cx + 9)]
+                return sum(v * x for v, x, y in window) / sum(v for v, x, y in window), \
+                    sum(v * y for v, x, y in window) / sum(v for v, x, y in window)
+            ex, ey = darkest(expected)
+            rx, ry = darkest(result)
+            assert abs(ex - rx) <= 1 and abs(ey - ry) <= 1
+
+###############################################################################
+# Cached renderings are reused as is, and rotated markers are not cached.
+
+def test_agg_marker_cache_rotated():
+
+    if 'OUTPUT=PNG' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    assert draw_markers(True) == draw_markers(True)
+    assert draw_markers(True, angle=30) == draw_markers(False, angle=30)
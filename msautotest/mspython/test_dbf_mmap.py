@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Compare DBF attribute reads with and without memory mapping.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import struct
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+###############################################################################
+# A point shapefile whose .dbf is written byte by byte: padded and embedded
+# nul terminated strings, numeric fields with blanks and null markers, and
+# a record flagged as deleted.
+
+FIELDS = [(b'NAME', b'C', 10, 0), (b'AMOUNT', b'N', 8, 2), (b'COUNT', b'N', 5, 0)]
+
+RECORDS = [(b' ', b'ab        ', b'   12.50', b'   42'),
+           (b' ', b' x        ', b'********', b'   -3'),
+           (b'*', b'gone      ', b'    1.00', b'    7'),
+           (b' ', b'nul\x00junk  ', b'   -0.25', b'    0'),
+           (b' ', b'          ', b'        ', b'     ')]
+
+EXPECTED = [['ab', '12.50', '42'],
+            [' x', '0', '-3'],
+            ['gone', '1.00', '7'],
+            ['nul', '-0.25', '0'],
+            ['', '', '']]
+
+
+def write_dbf(filename):
+
+    record_length = 1 + sum(f[2] for f in FIELDS)
+    header_length = 32 + 32 * len(FIELDS) + 1
+
+    data = struct.pack('<BBBBIHH20x', 3, 126, 10, 19, len(RECORDS),
+                       header_length, record_length)
+    for name, type, width, decimals in FIELDS:
+        data += struct.pack('<11sc4xBB14x', name, type, width, decimals)
+    data += b'\x0d'
+    for record in RECORDS:
+        data += b''.join(record)
+    data += b'\x1a'
+
+    with open(filename, 'wb') as f:
+        f.write(data)
+
+
+def create_shapefile(path):
+
+    shp = mapscript.shapefileObj(str(path / 'points.shp'), 1)  # SHP_POINT
+    for i in range(len(RECORDS)):
+        shape = mapscript.shapeObj(mapscript.MS_SHAPE_POINT)
+        line = mapscript.lineObj()
+        line.add(mapscript.pointObj(i, i))
+        shape.add(line)
+        shp.add(shape)
+    del shp
+    write_dbf(str(path / 'points.dbf'))
+
+
+def read_values(path, mmap):
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT -1 -1 10 10
+  SIZE 100 100
+  SHAPEPATH "%s"
+  LAYER
+    NAME points
+    TYPE POINT
+    STATUS ON
+    DATA "points"
+  END
+END
+""" % path)
+    map.setConfigOption('MS_DBF_MMAP', mmap)
+    map.applyConfigOptions()
+
+    layer = map.getLayer(0)
+    layer.open()
+    layer.whichShapes(map.extent)
+    values = []
+    while True:
+        shape = layer.nextShape()
+        if shape is None:
+            break
+        values.append([shape.getValue(i) for i in range(layer.numitems)])
+    layer.close()
+
+    map.setConfigOption('MS_DBF_MMAP', 'NO')
+    map.applyConfigOptions()
+    return values
+
+###############################################################################
+# Records are decoded the same way from the mapped file and through regular
+# reads.
+
+
+def test_dbf_mmap(tmp_path):
+
+    create_shapefile(tmp_path)
+
+    assert read_values(tmp_path, 'NO') == EXPECTED
+    assert read_values(tmp_path, 'YES') == EXPECTED
@@ -0,0 +1,245 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the HTTP response cache of WMS client layers.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+import stat
+import struct
+import sys
+import threading
+import zlib
+
+import pytest
+
+try:
+    from http.server import BaseHTTPRequestHandler, HTTPServer
+    from urllib.parse import parse_qs, urlparse
+except ImportError:
+    from BaseHTTPServer import BaseHTTPRequestHandler, HTTPServer
+    from urlparse import parse_qs, urlparse
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+###############################################################################
+# Stand-in WMS server answering GetMap requests with a plain red PNG, and
+# recording the requests it received.
+
+def png_image(width, height):
+
+    def chunk(tag, data):
+        return struct.pack('>I', len(data)) + tag + data + \
+            struct.pack('>I', zlib.crc32(tag + data) & 0xffffffff)
+
+    raw = b''.join(b'\x00' + b'\xff\x00\x00' * width for _ in range(height))
+    return b'\x89PNG\r\n\x1a\n' + \
+        chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)) + \
+        chunk(b'IDAT', zlib.compress(raw)) + \
+        chunk(b'IEND', b'')
+
+
+class WMSHandler(BaseHTTPRequestHandler):
+
+    requests = []
+
+    def log_message(self, format, *args):
+        pass
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        params = dict((k.upper(), v[0]) for k, v in parse_qs(url.query).items())
+        WMSHandler.requests.append((url.path, self.headers.get('If-None-Match')))
+
+        if url.path == '/etag' and self.headers.get('If-None-Match') == '"v1"':
+            self.send_response(304)
+            self.send_header('ETag', '"v1"')
+            self.end_headers()
+            return
+
+        body = png_image(int(params.get('WIDTH', '1')), int(params.get('HEIGHT', '1')))
+        self.send_response(200)
+        self.send_header('Content-Type', 'image/png')
+        self.send_header('Content-Length', str(len(body)))
+        if url.path in ('/maxage', '/longurl', '/auth'):
+            self.send_header('Cache-Control', 'max-age=3600')
+        elif url.path == '/authpublic':
+            self.send_header('Cache-Control', 'public, max-age=3600')
+        elif url.path == '/etag':
+            self.send_header('Cache-Control', 'no-cache')
+            self.send_header('ETag', '"v1"')
+        else:
+            self.send_header('Cache-Control', 'no-store')
+        self.end_headers()
+        self.wfile.write(body)
+
+
+@pytest.fixture(scope='module')
+def wms_server():
+
+    server = HTTPServer(('127.0.0.1', 0), WMSHandler)
+    thread = threading.Thread(target=server.serve_forever)
+    thread.daemon = True
+    thread.start()
+    yield server.server_address[1]
+    server.shutdown()
+
+
+def draw_cascaded_map(port, path, query='', config='', metadata=''):
+
+    map = mapscript.fromstring("""
+MAP
+  NAME "http_cache"
+  SIZE 20 20
+  EXTENT 0 0 20 20
+  IMAGETYPE png
+  CONFIG "MS_HTTP_CACHE" "YES"
+  %s
+  PROJECTION
+    "init=epsg:4326"
+  END
+  LAYER
+    NAME "remote"
+    TYPE RASTER
+    STATUS ON
+    CONNECTIONTYPE WMS
+    CONNECTION "http://127.0.0.1:%d%s?%s"
+    PROJECTION
+      "init=epsg:4326"
+    END
+    METADATA
+      "wms_srs" "EPSG:4326"
+      "wms_name" "remote"
+      "wms_server_version" "1.1.1"
+      "wms_format" "image/png"
+      %s
+    END
+  END
+END
+""" % (config, port, path, query, metadata))
+    img = map.draw()
+    assert img is not None
+    return img
+
+
+def requests_for(path):
+    return [r for r in WMSHandler.requests if r[0] == path]
+
+
+###############################################################################
+# Fresh responses are served without contacting the server again.
+
+def test_http_cache_max_age(wms_server):
+
+    if 'SUPPORTS=WMS_CLIENT' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    draw_cascaded_map(wms_server, '/maxage')
+    draw_cascaded_map(wms_server, '/maxage')
+
+    assert len(requests_for('/maxage')) == 1
+
+
+###############################################################################
+# Responses to revalidate are fetched conditionally, and a 304 answer is
+# served from the cache.
+
+def test_http_cache_etag_revalidation(wms_server):
+
+    if 'SUPPORTS=WMS_CLIENT' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    draw_cascaded_map(wms_server, '/etag')
+    img = draw_cascaded_map(wms_server, '/etag')
+
+    assert requests_for('/etag') == [('/etag', None), ('/etag', '"v1"')]
+    assert img.getBytes()
+
+
+###############################################################################
+# no-store responses are never cached.
+
+def test_http_cache_no_store(wms_server):
+
+    if 'SUPPORTS=WMS_CLIENT' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    draw_cascaded_map(wms_server, '/nostore')
+    draw_cascaded_map(wms_server, '/nostore')
+
+    assert len(requests_for('/nostore')) == 2
+
+
+###############################################################################
+# Responses to authenticated requests are only cached when marked public.
+
+def test_http_cache_authenticated(wms_server):
+
+    if 'SUPPORTS=WMS_CLIENT' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    auth = '"wms_auth_username" "user"\n      "wms_auth_password" "secret"'
+    for _ in range(2):
+        draw_cascaded_map(wms_server, '/auth', metadata=auth)
+        draw_cascaded_map(wms_server, '/authpublic', metadata=auth)
+
+    assert len(requests_for('/auth')) == 2
+    assert len(requests_for('/authpublic')) == 1
+
+
+###############################################################################
+# Entries with long URLs are read back from the on disk cache, from files
+# private to their owner that do not leak the URL.
+
+def test_http_cache_dir_long_url(wms_server, tmp_path):
+
+    if 'SUPPORTS=WMS_CLIENT' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    # a zero sized memory cache makes the second draw read the entry file
+    config = 'CONFIG "MS_HTTP_CACHE_DIR" "%s"\n  CONFIG "MS_HTTP_CACHE_SIZE" "0"' % tmp_path
+    query = 'PAD=' + 'x' * 6000 + '&'
+
+    draw_cascaded_map(wms_server, '/longurl', query, config)
+    files = list(tmp_path.glob('*.http'))
+    assert len(files) == 1
+    assert b'xxxxxxxx' not in files[0].read_bytes()
+    if sys.platform != 'win32':
+        assert stat.S_IMODE(os.stat(str(files[0])).st_mode) == 0o600
+    img = draw_cascaded_map(wms_server, '/longurl', query, config)
+
+    assert len(requests_for('/longurl')) == 1
+    assert img.getBytes()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the parallel text layout of the label cache.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+def get_relpath_to_this(filename):
+    return os.path.join(os.path.dirname(__file__), filename)
+
+
+def draw_labels(tmp_path, threads):
+
+    fontset = str(tmp_path / 'fonts.txt')
+    with open(fontset, 'w') as f:
+        f.write('lucida %s\n' % os.path.abspath(get_relpath_to_this('../misc/data/LucidaBrightRegular.ttf')))
+
+    # Enough labels for several workers, dense enough for collisions, with
+    # repeated texts
+    features = ''
+    for i in range(600):
+        features += """
+    FEATURE
+      POINTS %d %d END
+      ITEMS "Label %d"
+    END""" % (i % 30 * 10 + 5, i // 30 * 10 + 5, i % 50)
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT 0 0 300 200
+  SIZE 600 400
+  FONTSET "%s"
+  IMAGETYPE PNG
+  LAYER
+    NAME "points"
+    TYPE POINT
+    STATUS ON
+    LABELITEM "name"
+    PROCESSING "ITEMS=name"
+    %s
+    CLASS
+      LABEL
+        TYPE TRUETYPE
+        FONT "lucida"
+        SIZE 8
+        COLOR 0 0 0
+        POSITION AUTO
+        PRIORITY 5
+      END
+    END
+  END
+END
+""" % (fontset, features))
+    if threads is not None:
+        map.setConfigOption('MS_LABELCACHE_THREADS', threads)
+    return map.draw().getBytes()
+
+###############################################################################
+# Laying out the label cache texts in worker threads places and draws the
+# same labels as the serial layout.
+
+
+@pytest.mark.parametrize('threads', ['4', 'ALL_CPUS'])
+def test_labelcache_threads(tmp_path, threads):
+
+    expected = draw_labels(tmp_path, None)
+    assert draw_labels(tmp_path, threads) == expected
+    # Second draw, with the main thread font cache already populated
+    assert draw_labels(tmp_path, threads) == expected
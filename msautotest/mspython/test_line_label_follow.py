@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Regression tests for labels following lines.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+gdal_available = False
+try:
+    from osgeo import gdal
+    gdal_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+def get_relpath_to_this(filename):
+    return os.path.join(os.path.dirname(__file__), filename)
+
+
+###############################################################################
+# Black pixels of a white background image, read through GDAL.
+
+def dark_pixels(data):
+
+    filename = '/vsimem/test_line_label_follow.png'
+    gdal.FileFromMemBuffer(filename, data)
+    ds = gdal.Open(filename)
+    width, height = ds.RasterXSize, ds.RasterYSize
+    band = bytearray(ds.GetRasterBand(1).ReadRaster())
+    ds = None
+    gdal.Unlink(filename)
+
+    return [(i % width, i // width) for i in range(width * height) if band[i] < 128]
+
+
+###############################################################################
+# Draws the "Follow" text along horizontal lines. Each line is given by its
+# start, its pixel row and the offsets of its vertices. Map units are pixels,
+# so lengths along the lines are exact in image space.
+
+def draw_labels(tmp_path, width, height, lines, angle='FOLLOW', repeatdistance=0):
+
+    fontset = str(tmp_path / 'fonts.txt')
+    with open(fontset, 'w') as f:
+        f.write('lucida %s\n' % os.path.abspath(get_relpath_to_this('../misc/data/LucidaBrightRegular.ttf')))
+
+    features = ''
+    for x, y, offsets in lines:
+        features += """
+    FEATURE
+      POINTS %s END
+    END""" % ' '.join('%.12g %d' % (x + offset, height - y) for offset in offsets)
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT 0 0 %d %d
+  SIZE %d %d
+  FONTSET "%s"
+  IMAGETYPE PNG
+  LAYER
+    NAME "lines"
+    TYPE LINE
+    STATUS ON
+    %s
+    CLASS
+      LABEL
+        TEXT "Follow"
+        TYPE TRUETYPE
+        FONT "lucida"
+        SIZE 8
+        COLOR 0 0 0
+        ANGLE %s
+        REPEATDISTANCE %d
+      END
+    END
+  END
+END
+""" % (width, height, width, height, fontset, features, angle, repeatdistance))
+    return dark_pixels(map.draw().getBytes())
+
+###############################################################################
+# A follow label whose text is exactly as long as its line starts and ends
+# on the line endpoints, where msLineLabelPath() locates the first and last
+# segments of the text. The text length is not known up front, so lines are
+# drawn for every length within a few pixels of it, in 1/64 pixel steps like
+# the glyph advances, and each must get its label.
+
+
+def test_line_label_follow_exact_length(tmp_path):
+
+    if not gdal_available:
+        pytest.skip('GDAL not available')
+
+    # ink width of the text, within a couple of pixels of its length
+    pixels = draw_labels(tmp_path, 400, 40, [(50, 20, (0, 150, 300))])
+    assert pixels
+    text_length = max(x for x, _ in pixels) - min(x for x, _ in pixels) + 1
+
+    cell_width = text_length + 30
+    cell_height = 24
+    columns = 10
+    lengths = [text_length - 3 + k / 64.0 for k in range(6 * 64 + 1)]
+    rows = (len(lengths) + columns - 1) // columns
+    width, height = columns * cell_width, rows * cell_height
+
+    lines = [(i % columns * cell_width + 15, i // columns * cell_height + cell_height // 2,
+              (0, length / 2.0, length))
+             for i, length in enumerate(lengths)]
+    cells = set((x // cell_width, y // cell_height)
+                for x, y in draw_labels(tmp_path, width, height, lines, repeatdistance=50))
+
+    missing = [lengths[i] for i in range(len(lengths))
+               if (i % columns, i // columns) not in cells]
+    assert missing == []
+
+###############################################################################
+# Repeated labels whose positions fall exactly on line vertices, where
+# msLineLabelPoint() locates the segment holding each position.
+
+
+def test_line_label_point_on_vertices(tmp_path):
+
+    if not gdal_available:
+        pytest.skip('GDAL not available')
+
+    # 300 pixels with a repeat distance of 100 puts labels at 50, 150 and 250
+    pixels = draw_labels(tmp_path, 400, 40, [(50, 20, (0, 50, 150, 250, 300))],
+                         angle='AUTO', repeatdistance=100)
+
+    columns = sorted(set(x for x, _ in pixels))
+    clusters = [[columns[0]]]
+    for x in columns[1:]:
+        if x - clusters[-1][-1] > 5:
+            clusters.append([])
+        clusters[-1].append(x)
+
+    centers = [(c[0] + c[-1] + 1) / 2.0 for c in clusters]
+    assert len(centers) == 3
+    for center, expected in zip(centers, [100, 200, 300]):
+        assert abs(center - expected) <= 3
@@ -293,3 +293,98 @@ def test_ogr_query_7():
     layer.close() 
     layer.close() # discard resultset.
 
+
+###############################################################################
+# Layers of drivers handing out Arrow record batches (GeoPackage here) are
+# read through them, unless OGR_ARROW_STREAM=NO. Both ways must return the
+# same shapes and values, null attributes and multi-geometries included.
+
+def read_ogr_layer(filename, processing, errorfile):
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT 0 0 100 100
+  SIZE 100 100
+  LAYER
+    NAME arrow
+    TYPE POLYGON
+    STATUS ON
+    DEBUG 4
+    CONNECTIONTYPE OGR
+    CONNECTION "%s"
+    DATA "arrow"
+    %s
+  END
+END
+""" % (filename, processing))
+    map.setConfigOption('MS_ERRORFILE', str(errorfile))
+    layer = map.getLayer(0)
+
+    layer.open()
+    layer.whichShapes(map.extent)
+    shapes = []
+    while True:
+        s = layer.nextShape()
+        if s is None:
+            break
+        values = [s.getValue(i) for i in range(layer.numitems)]
+        shapes.append((s.index, s.numlines, values, s.toWKT()))
+    layer.close()
+
+    map.setConfigOption('MS_ERRORFILE', 'stderr')
+    log = errorfile.read_text()
+    errorfile.unlink()
+    return shapes, 'through Arrow record batches' in log
+
+
+def test_ogr_query_arrow_stream(tmp_path):
+
+    if 'INPUT=OGR' not in mapscript.msGetVersion():
+        pytest.skip('OGR support missing')
+    ogr = pytest.importorskip('osgeo.ogr')
+    gdal = pytest.importorskip('osgeo.gdal')
+    if int(gdal.VersionInfo()) < 3060000:
+        pytest.skip('GDAL >= 3.6 required')
+
+    filename = str(tmp_path / 'arrow.gpkg')
+    ds = ogr.GetDriverByName('GPKG').CreateDataSource(filename)
+    lyr = ds.CreateLayer('arrow', geom_type=ogr.wkbUnknown)
+    lyr.CreateField(ogr.FieldDefn('name', ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn('num', ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn('big', ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn('value', ogr.OFTReal))
+    fld = ogr.FieldDefn('flag', ogr.OFTInteger)
+    fld.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld)
+
+    rows = [('POLYGON ((10 10,20 10,20 20,10 20,10 10))',
+             ('first', 1, 1234567890123, 1.5, 1)),
+            ('MULTIPOLYGON (((30 30,40 30,40 40,30 40,30 30)),'
+             '((50 50,60 50,60 60,50 60,50 50),(52 52,52 58,58 58,58 52,52 52)))',
+             ('multi', None, None, None, 0)),
+            ('POLYGON ((70 70,80 70,80 80,70 80,70 70))',
+             (None, -3, -5, -0.25, None)),
+            (None, ('no geometry', 4, 4, 4.0, 1)),
+            ('LINESTRING (0 0,1 1)', ('line', 5, 5, 5.0, 0))]
+    for wkt, values in rows:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if wkt is not None:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        for i, value in enumerate(values):
+            if value is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, value)
+        lyr.CreateFeature(f)
+    ds = None
+
+    expected, arrow = read_ogr_layer(filename, 'PROCESSING "OGR_ARROW_STREAM=NO"',
+                                     tmp_path / 'features.log')
+    assert not arrow
+    shapes, arrow = read_ogr_layer(filename, '', tmp_path / 'arrow.log')
+    assert arrow
+
+    # the features without a polygon geometry are skipped
+    assert [s[0] for s in expected] == [1, 2, 3]
+    assert expected[1][1] == 3
+    assert shapes == expected
@@ -0,0 +1,195 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the POLYLABEL label parameter.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import math
+import os
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+gdal_available = False
+try:
+    from osgeo import gdal
+    gdal_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+MAPFILE = """
+MAP
+  EXTENT 0 0 100 100
+  SIZE 100 100
+  LAYER
+    NAME "polygons"
+    TYPE POLYGON
+    STATUS ON
+    LABELITEM "name"
+    FEATURE
+      WKT "POLYGON((10 10,90 10,90 20,20 20,20 90,10 90,10 10))"
+      ITEMS "L"
+    END
+    CLASS
+      LABEL
+        TYPE BITMAP
+        POLYLABEL %s
+      END
+    END
+  END
+END
+"""
+
+
+def get_label(map):
+    return map.getLayerByName('polygons').getClass(0).getLabel(0)
+
+###############################################################################
+# POLYLABEL is parsed from a mapfile
+
+
+def test_polylabel_parse():
+
+    assert get_label(mapscript.fromstring(MAPFILE % 'TRUE')).polylabel == mapscript.MS_TRUE
+    assert get_label(mapscript.fromstring(MAPFILE % 'FALSE')).polylabel == mapscript.MS_FALSE
+
+###############################################################################
+# A saved map with POLYLABEL TRUE loads again with the same setting
+
+
+def test_polylabel_roundtrip():
+
+    map = mapscript.fromstring(MAPFILE % 'TRUE')
+    text = map.convertToString()
+    assert 'POLYLABEL TRUE' in text
+
+    map2 = mapscript.fromstring(text)
+    assert get_label(map2).polylabel == mapscript.MS_TRUE
+    assert map2.convertToString() == text
+
+###############################################################################
+# POLYLABEL is still usable as a plain string value
+
+
+def test_polylabel_as_string():
+
+    map = mapscript.fromstring(MAPFILE % 'TRUE')
+    map.getLayerByName('polygons').setMetaData('polylabel', 'polylabel')
+    map2 = mapscript.fromstring(map.convertToString())
+    assert map2.getLayerByName('polygons').getMetaData('polylabel') == 'polylabel'
+
+###############################################################################
+# Drawn with POLYLABEL TRUE, the label of an L whose horizontal arm widens
+# toward its end is placed at the pole of inaccessibility near that end,
+# inside the polygon and away from the bend.
+
+L_POLYGON = [(10, 10), (90, 10), (90, 50), (20, 30), (20, 90), (10, 90), (10, 10)]
+
+DRAW_MAPFILE = """
+MAP
+  EXTENT 0 0 100 100
+  SIZE 100 100
+  FONTSET "%s"
+  IMAGETYPE PNG
+  LAYER
+    NAME "polygons"
+    TYPE POLYGON
+    STATUS ON
+    LABELITEM "name"
+    FEATURE
+      WKT "POLYGON((%s))"
+      ITEMS "X"
+    END
+    CLASS
+      LABEL
+        TYPE TRUETYPE
+        FONT "lucida"
+        SIZE 8
+        COLOR 0 0 0
+        FORCE TRUE
+        POLYLABEL TRUE
+      END
+    END
+  END
+END
+"""
+
+
+def point_in_polygon(x, y, ring):
+
+    inside = False
+    for (x1, y1), (x2, y2) in zip(ring, ring[1:]):
+        if (y1 <= y < y2 or y2 <= y < y1) and x < (x2 - x1) * (y - y1) / (y2 - y1) + x1:
+            inside = not inside
+    return inside
+
+
+def label_center(data):
+
+    filename = '/vsimem/test_polylabel.png'
+    gdal.FileFromMemBuffer(filename, data)
+    ds = gdal.Open(filename)
+    width, height = ds.RasterXSize, ds.RasterYSize
+    band = bytearray(ds.GetRasterBand(1).ReadRaster())
+    ds = None
+    gdal.Unlink(filename)
+
+    xs = [i % width for i in range(width * height) if band[i] < 128]
+    ys = [i // width for i in range(width * height) if band[i] < 128]
+    assert xs, 'no label drawn'
+    # one map unit per pixel, y up
+    return (min(xs) + max(xs) + 1) / 2.0, height - (min(ys) + max(ys) + 1) / 2.0
+
+
+def test_polylabel_draw(tmp_path):
+
+    if not gdal_available:
+        pytest.skip('GDAL not available')
+
+    fontset = str(tmp_path / 'fonts.txt')
+    with open(fontset, 'w') as f:
+        f.write('lucida %s\n' % os.path.abspath(os.path.join(os.path.dirname(__file__),
+                                                             '../misc/data/LucidaBrightRegular.ttf')))
+
+    wkt = ','.join('%d %d' % p for p in L_POLYGON)
+    map = mapscript.fromstring(DRAW_MAPFILE % (fontset, wkt))
+    x, y = label_center(map.draw().getBytes())
+
+    assert point_in_polygon(x, y, L_POLYGON)
+    # the pole is near (70.6 26.9), the bend is in the (10 10)-(20 30) corner
+    assert math.hypot(x - 15, y - 20) > 40
+    assert abs(x - 70.6) <= 4 and abs(y - 26.9) <= 4
@@ -30,6 +30,8 @@
 ###############################################################################
 
 import sys
+import threading
+import time
 
 sys.path.append( '../pymod' )
 import pytest
@@ -316,3 +318,187 @@ def test_postgis_box_bind_values_queryByRect():
             break
         count += 1
     assert count == 15
+
+###############################################################################
+# Layers whose queries are prefetched at the start of msDrawMap() draw the
+# same image as when queried one after another. All the layers share the
+# same connection string, so the prefetched queries need connections of
+# their own. The debug output tells which prefetched results were used.
+
+
+def draw_postgis_map(prefetch, tmp_path,
+                     connection='dbname=msautotest user=postgres',
+                     processing=''):
+
+    layers = ''
+    for name, type, style in (('province', 'POLYGON',
+                               'COLOR 200 200 200 OUTLINECOLOR 0 0 0'),
+                              ('road', 'LINE', 'COLOR 255 0 0'),
+                              ('popplace', 'POINT', 'COLOR 0 0 255 SIZE 3')):
+        layers += """
+            LAYER
+                CONNECTIONTYPE postgis
+                CONNECTION "%s"
+                NAME %s
+                DATA "the_geom from (select * from %s order by gid) as foo using srid=3978 using unique gid"
+                TYPE %s
+                STATUS ON
+                DEBUG ON
+                %s
+                CLASS
+                    STYLE
+                        %s
+                    END
+                END
+            END""" % (connection, name, name, type, processing, style)
+
+    errorfile = tmp_path / 'prefetch.log'
+    map = mapscript.fromstring("""
+        MAP
+            SIZE 200 100
+            EXTENT 2018000 -73300 3410396 647400
+            IMAGETYPE png
+            CONFIG "MS_POSTGIS_PREFETCH" "%s"
+            %s
+        END
+        """ % ('ON' if prefetch else 'OFF', layers))
+    map.setConfigOption('MS_ERRORFILE', str(errorfile))
+    image = map.draw().getBytes()
+    map.setConfigOption('MS_ERRORFILE', 'stderr')
+
+    log = errorfile.read_text()
+    errorfile.unlink()
+    return image, log.count('using prefetched result')
+
+
+def test_postgis_prefetch(tmp_path):
+
+    expected, prefetched = draw_postgis_map(False, tmp_path)
+    assert prefetched == 0
+
+    image, prefetched = draw_postgis_map(True, tmp_path)
+    assert image == expected
+    assert prefetched == 3
+
+###############################################################################
+# Prefetching does not wait for connections at CONNECTION_POOL_MAX: the
+# layers without a connection of their own are queried when drawn.
+
+
+def test_postgis_prefetch_pool_max(tmp_path):
+
+    expected, _ = draw_postgis_map(False, tmp_path)
+
+    before = pool_stats()
+    image, prefetched = draw_postgis_map(
+        True, tmp_path,
+        connection='dbname=msautotest user=postgres application_name=mspool_prefetch',
+        processing='PROCESSING "CONNECTION_POOL_MAX=1"')
+    after = pool_stats()
+
+    assert image == expected
+    assert prefetched == 1
+    assert after.waits == before.waits
+
+###############################################################################
+# Connection pool. The connections of each test are told apart by their
+# application_name, so that they get pool entries of their own.
+
+
+def pool_layer(application_name, processing):
+
+    map = mapscript.mapObj()
+    layer = mapscript.layerObj(map)
+    layer.updateFromString("""
+        LAYER
+            CONNECTIONTYPE postgis
+            CONNECTION "dbname=msautotest user=postgres application_name=%s"
+            NAME mylayer
+            DATA "the_geom from (select * from multipolygon3d order by id) as foo using srid=27700 using unique id"
+            TYPE POLYGON
+            %s
+        END
+        """ % (application_name, processing))
+    return map, layer
+
+
+def pool_stats():
+
+    stats = mapscript.connPoolStatsObj()
+    mapscript.msConnPoolGetStats(stats)
+    return stats
+
+###############################################################################
+# With CONNECTION_POOL_MAX=1, another thread waits CONNECTION_POOL_WAIT for
+# the connection, and fails if it is not released in the meantime.
+
+
+def test_postgis_pool_max_wait():
+
+    if 'SUPPORTS=THREADS' not in mapscript.msGetVersion():
+        pytest.skip('thread support missing')
+
+    processing = """PROCESSING "CONNECTION_POOL_MAX=1"
+            PROCESSING "CONNECTION_POOL_WAIT=1"
+            PROCESSING "CLOSE_CONNECTION=DEFER"
+            """
+
+    holder_map, holder = pool_layer('mspool_max', processing)
+    assert holder.open() == mapscript.MS_SUCCESS
+
+    def open_in_thread(results):
+        map, layer = pool_layer('mspool_max', processing)
+        start = time.time()
+        try:
+            layer.open()
+            results.append(('opened', time.time() - start))
+            layer.close()
+        except mapscript.MapServerError as e:
+            results.append((str(e), time.time() - start))
+
+    before = pool_stats()
+    results = []
+    thread = threading.Thread(target=open_in_thread, args=(results,))
+    thread.start()
+    thread.join()
+    after = pool_stats()
+
+    message, elapsed = results[0]
+    assert 'connections of layer mylayer are in use' in message
+    assert elapsed >= 0.9
+    assert after.waits - before.waits == 1
+    assert after.wait_timeouts - before.wait_timeouts == 1
+
+    # once released, the connection is handed to the other thread
+    holder.close()
+    results = []
+    thread = threading.Thread(target=open_in_thread, args=(results,))
+    thread.start()
+    thread.join()
+    assert results[0][0] == 'opened'
+    assert pool_stats().hits - after.hits == 1
+
+###############################################################################
+# A pooled connection whose backend was terminated is dropped and replaced
+# when the layer is opened again.
+
+
+def test_postgis_pool_check_connection():
+
+    map, layer = pool_layer('mspool_check',
+                            'PROCESSING "CLOSE_CONNECTION=DEFER"')
+    assert layer.getNumFeatures() == 1
+
+    # terminate the backend of the pooled connection from another one
+    killer_map, killer = pool_layer('mspool_killer',
+                                    'PROCESSING "CLOSE_CONNECTION=ALWAYS"')
+    killer.data = "the_geom from (select m.* from multipolygon3d m, " \
+                  "(select pg_terminate_backend(pid) from pg_stat_activity " \
+                  "where application_name = 'mspool_check') t) as foo " \
+                  "using srid=27700 using unique id"
+    assert killer.getNumFeatures() == 1
+    time.sleep(0.5)
+
+    before = pool_stats()
+    assert layer.getNumFeatures() == 1
+    assert pool_stats().unhealthy - before.unhealthy == 1
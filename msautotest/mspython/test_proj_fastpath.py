@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Compare the closed form EPSG:4326 <-> EPSG:3857 reprojection
+#           with the PROJ results.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+###############################################################################
+# init=epsg:4326 and init=epsg:3857 take the closed form path, while the
+# equivalent explicit definitions below are handed to PROJ.
+
+FAST_LONLAT = 'init=epsg:4326'
+FAST_MERC = 'init=epsg:3857'
+PROJ_LONLAT = '+proj=longlat +datum=WGS84 +no_defs'
+PROJ_MERC = ('+proj=merc +a=6378137 +b=6378137 +lat_ts=0 +lon_0=0 +x_0=0 '
+             '+y_0=0 +k=1 +units=m +nadgrids=@null +wktext +no_defs')
+
+MERC_MAX_LAT = 85.0511287798066
+MERC_MAX_X = 20037508.342789244
+
+LONLAT_POINTS = [
+    (0, 0),
+    (2.35, 48.85),
+    (-122.4, 37.8),
+    (151.2, -33.9),
+    (0, MERC_MAX_LAT),
+    (0, -MERC_MAX_LAT),
+    (45, 85.0511),
+    (-45, -85.0511),
+    (10, 89.9),
+    (180, 0),
+    (-180, 0),
+    (179.9999999, 60),
+    (-179.9999999, -60),
+    (180, MERC_MAX_LAT),
+    (-180, -MERC_MAX_LAT),
+    (180.5, 10),
+    (-181, -10),
+]
+
+MERC_POINTS = [
+    (0, 0),
+    (261600.0, 6250000.0),
+    (MERC_MAX_X, 0),
+    (-MERC_MAX_X, 0),
+    (MERC_MAX_X, MERC_MAX_X),
+    (-MERC_MAX_X, -MERC_MAX_X),
+    (MERC_MAX_X - 0.01, 19971868.88),
+    (-MERC_MAX_X + 0.01, -19971868.88),
+    (MERC_MAX_X + 1000, 1000),
+    (0, 30000000),
+]
+
+
+def project_point(x, y, projin, projout):
+    pt = mapscript.pointObj(x, y)
+    ret = pt.project(mapscript.projectionObj(projin),
+                     mapscript.projectionObj(projout))
+    return ret, pt.x, pt.y
+
+
+def check_points(points, fast_in, fast_out, proj_in, proj_out, tolerance):
+    for x, y in points:
+        fast_ret, fast_x, fast_y = project_point(x, y, fast_in, fast_out)
+        proj_ret, proj_x, proj_y = project_point(x, y, proj_in, proj_out)
+        assert fast_ret == proj_ret, (x, y)
+        if proj_ret != mapscript.MS_SUCCESS:
+            continue
+        assert fast_x == pytest.approx(proj_x, abs=tolerance), (x, y)
+        assert fast_y == pytest.approx(proj_y, abs=tolerance), (x, y)
+
+###############################################################################
+# EPSG:4326 -> EPSG:3857, including the latitude limit of the square world
+# extent and the antimeridian.
+
+def test_proj_fastpath_lonlat_to_merc():
+
+    check_points(LONLAT_POINTS, FAST_LONLAT, FAST_MERC,
+                 PROJ_LONLAT, PROJ_MERC, 1e-6)
+
+###############################################################################
+# EPSG:3857 -> EPSG:4326, including the corners of the square world extent.
+
+def test_proj_fastpath_merc_to_lonlat():
+
+    check_points(MERC_POINTS, FAST_MERC, FAST_LONLAT,
+                 PROJ_MERC, PROJ_LONLAT, 1e-9)
+
+###############################################################################
+# The poles cannot be represented in EPSG:3857: both paths must fail.
+
+def test_proj_fastpath_poles():
+
+    for lat in (90, -90):
+        fast_ret, _, _ = project_point(0, lat, FAST_LONLAT, FAST_MERC)
+        proj_ret, _, _ = project_point(0, lat, PROJ_LONLAT, PROJ_MERC)
+        assert fast_ret != mapscript.MS_SUCCESS
+        assert proj_ret != mapscript.MS_SUCCESS
+
+###############################################################################
+# Shapes go through the batched msProjectPoints() code path.
+
+def test_proj_fastpath_shape():
+
+    wkt = 'LINESTRING (-180 -85.0511, -179.5 0, 0 45, 179.5 0, 180 85.0511)'
+
+    fast = mapscript.shapeObj.fromWKT(wkt)
+    assert fast.project(mapscript.projectionObj(FAST_LONLAT),
+                        mapscript.projectionObj(FAST_MERC)) == mapscript.MS_SUCCESS
+    ref = mapscript.shapeObj.fromWKT(wkt)
+    assert ref.project(mapscript.projectionObj(PROJ_LONLAT),
+                       mapscript.projectionObj(PROJ_MERC)) == mapscript.MS_SUCCESS
+
+    assert fast.numlines == ref.numlines == 1
+    fast_line = fast.get(0)
+    ref_line = ref.get(0)
+    assert fast_line.numpoints == ref_line.numpoints == 5
+    for i in range(ref_line.numpoints):
+        assert fast_line.get(i).x == pytest.approx(ref_line.get(i).x, abs=1e-6)
+        assert fast_line.get(i).y == pytest.approx(ref_line.get(i).y, abs=1e-6)
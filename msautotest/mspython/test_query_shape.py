@@ -0,0 +1,187 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the intersection tests of queries by shape.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+###############################################################################
+# Shapes around the (0,0)-(10,10) square used as query shape. The expected
+# flag is the result of the msIntersect*() functions: they include shapes
+# touching the square, but points on its right and top edges are outside.
+
+POINTS = [
+    ('POINT(5 5)', True),      # inside
+    ('POINT(0 5)', True),      # on the left edge
+    ('POINT(10 5)', False),    # on the right edge
+    ('POINT(5 0)', True),      # on the bottom edge
+    ('POINT(5 10)', False),    # on the top edge
+    ('POINT(20 20)', False),   # outside
+]
+
+LINES = [
+    ('LINESTRING(10 5,20 5)', True),            # touches the right edge
+    ('LINESTRING(-5 5,5 5)', True),             # crosses the left edge
+    ('LINESTRING(20 0,30 0)', False),           # outside
+    ('LINESTRING(0 10,10 10)', True),           # along the top edge
+]
+
+POLYGONS = [
+    ('POLYGON((10 0,20 0,20 10,10 10,10 0))', True),     # shares an edge
+    ('POLYGON((10 10,20 10,20 20,10 20,10 10))', True),  # shares a vertex
+    ('POLYGON((30 0,40 0,40 10,30 10,30 0))', False),    # outside
+    ('POLYGON((5 5,15 5,15 15,5 15,5 5))', True),        # overlaps
+    ('POLYGON((2 2,8 2,8 8,2 8,2 2))', True),            # inside
+]
+
+
+def query_map(layertype, shapes):
+
+    features = ''
+    for wkt, _ in shapes:
+        features += """
+    FEATURE
+      WKT "%s"
+    END""" % wkt
+
+    return mapscript.fromstring("""
+MAP
+  EXTENT -50 -50 50 50
+  SIZE 100 100
+  LAYER
+    NAME "shapes"
+    TYPE %s
+    STATUS ON
+    TEMPLATE "dummy.html"
+    TOLERANCE 0
+    %s
+  END
+END
+""" % (layertype, features))
+
+
+def query_by_shape(map, wkt):
+
+    layer = map.getLayer(0)
+    layer.queryByShape(map, mapscript.shapeObj.fromWKT(wkt))
+    return sorted(layer.getResult(i).shapeindex for i in range(layer.getNumResults()))
+
+
+@pytest.mark.parametrize("layertype,shapes", [
+    ("POINT", POINTS),
+    ("LINE", LINES),
+    ("POLYGON", POLYGONS),
+])
+def test_query_by_shape_boundaries(layertype, shapes):
+
+    map = query_map(layertype, shapes)
+    expected = [i for i, (_, intersects) in enumerate(shapes) if intersects]
+
+    assert query_by_shape(map, 'POLYGON((0 0,10 0,10 10,0 10,0 0))') == expected
+    # the query shape is prepared again on each query
+    assert query_by_shape(map, 'POLYGON((0 0,10 0,10 10,0 10,0 0))') == expected
+
+###############################################################################
+# A line used as query shape.
+
+def test_query_by_shape_line():
+
+    map = query_map("POLYGON", POLYGONS)
+
+    # crosses the first polygon, and ends on an edge of the fourth one
+    assert query_by_shape(map, 'LINESTRING(15 -5,15 5)') == [0, 3]
+    # runs along an edge of the second polygon, and inside the fourth one
+    assert query_by_shape(map, 'LINESTRING(10 12,10 18)') == [1, 3]
+    assert query_by_shape(map, 'LINESTRING(50 50,60 60)') == []
+
+###############################################################################
+# A query polygon with enough vertices for msQueryByShape() to index its
+# segments by y band, and the same polygon with its edges left undivided,
+# which is scanned. Both have two holes and must select the same points.
+# The densified polygon has 203 vertices, that is 50 bands of height 2
+# over its y range, so y=30 falls exactly on a band boundary.
+
+def square_ring(x1, y1, x2, y2, steps=1):
+
+    ring = []
+    for i in range(steps):
+        ring.append((x1 + (x2 - x1) * i / steps, y1))
+    for i in range(steps):
+        ring.append((x2, y1 + (y2 - y1) * i / steps))
+    for i in range(steps):
+        ring.append((x2 - (x2 - x1) * i / steps, y2))
+    for i in range(steps):
+        ring.append((x1, y2 - (y2 - y1) * i / steps))
+    ring.append(ring[0])
+    return '(' + ','.join('%.12g %.12g' % p for p in ring) + ')'
+
+
+def holed_polygon(steps):
+
+    return 'POLYGON(%s,%s,%s)' % (square_ring(0, 0, 100, 100, steps),
+                                  square_ring(20, 20, 40, 40),
+                                  square_ring(60, 60, 80, 80))
+
+
+INDEXED_POINTS = [
+    ('POINT(10 30)', True),     # on a band boundary, left of the first hole
+    ('POINT(30 30)', False),    # on a band boundary, in the first hole
+    ('POINT(50 30)', True),     # on a band boundary, right of the first hole
+    ('POINT(20 30)', False),    # on the left edge of the first hole
+    ('POINT(40 30)', True),     # on the right edge of the first hole
+    ('POINT(100 30)', False),   # on the right edge
+    ('POINT(150 30)', False),   # outside
+    ('POINT(0 50)', True),      # on the left edge
+    ('POINT(70 70)', False),    # in the second hole
+    ('POINT(50 0)', True),      # on the bottom edge
+    ('POINT(50 100)', False),   # on the top edge
+]
+
+
+def test_query_by_shape_segment_index():
+
+    map = query_map("POINT", INDEXED_POINTS)
+    expected = [i for i, (_, intersects) in enumerate(INDEXED_POINTS) if intersects]
+
+    indexed = mapscript.shapeObj.fromWKT(holed_polygon(48))
+    assert indexed.numlines == 3
+    assert sum(indexed.get(i).numpoints for i in range(indexed.numlines)) == 203
+
+    assert query_by_shape(map, holed_polygon(48)) == expected
+    assert query_by_shape(map, holed_polygon(1)) == expected
@@ -0,0 +1,132 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the in-memory cache of raster tile indexes.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+import shutil
+import struct
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+def get_relpath_to_this(filename):
+    return os.path.join(os.path.dirname(__file__), filename)
+
+
+###############################################################################
+# Copy of ../gdal/data/tile_index.shp whose DBF points to the tiles given
+# by absolute path. An empty location skips the tile.
+
+def write_tile_index(path, tiles):
+
+    datadir = os.path.abspath(get_relpath_to_this('../gdal/data'))
+    for ext in ('shp', 'shx'):
+        shutil.copyfile(os.path.join(datadir, 'tile_index.' + ext), path + '.' + ext)
+
+    with open(os.path.join(datadir, 'tile_index.dbf'), 'rb') as f:
+        dbf = f.read()
+    numrecords, headerlength, recordlength = struct.unpack('<IHH', dbf[4:12])
+    assert numrecords == len(tiles)
+
+    records = b''
+    for tile in tiles:
+        location = os.path.join(datadir, tile) if tile else ''
+        assert len(location) < recordlength
+        records += b' ' + location.encode('ascii').ljust(recordlength - 1)
+
+    with open(path + '.dbf', 'wb') as f:
+        f.write(dbf[0:headerlength] + records + dbf[headerlength + len(records):])
+
+
+def draw_tile_index(path, cache):
+
+    map = mapscript.fromstring("""
+MAP
+  SIZE 80 60
+  EXTENT 0.5 0.5 79.5 59.5
+  IMAGETYPE "png"
+  LAYER
+    NAME "grey"
+    TYPE RASTER
+    STATUS DEFAULT
+    TILEINDEX "%s.shp"
+    TILEITEM "location"
+    %s
+  END
+END
+""" % (path, '' if cache else 'PROCESSING "TILEINDEX_CACHE=NO"'))
+    return map.draw().getBytes()
+
+###############################################################################
+# The cached tile index draws the same image as a direct read of the index.
+
+def test_raster_tileindex_cache(tmp_path):
+
+    if 'INPUT=GDAL' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    path = str(tmp_path / 'tile_index')
+    write_tile_index(path, ['tile11.vrt', 'tile12.vrt', 'tile21.vrt', 'tile22.vrt'])
+
+    expected = draw_tile_index(path, False)
+    assert draw_tile_index(path, True) == expected
+    # Second draw, served from the cache
+    assert draw_tile_index(path, True) == expected
+
+###############################################################################
+# The cached tile index is reloaded when the index file is modified.
+
+def test_raster_tileindex_cache_invalidation(tmp_path):
+
+    if 'INPUT=GDAL' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    path = str(tmp_path / 'tile_index')
+    write_tile_index(path, ['tile11.vrt', 'tile12.vrt', 'tile21.vrt', 'tile22.vrt'])
+    full = draw_tile_index(path, True)
+
+    write_tile_index(path, ['tile11.vrt', 'tile12.vrt', 'tile21.vrt', ''])
+    # Make sure the modification time changes, whatever the resolution of
+    # the file system timestamps.
+    mtime = os.path.getmtime(path + '.dbf') + 10
+    os.utime(path + '.dbf', (mtime, mtime))
+
+    expected = draw_tile_index(path, False)
+    assert expected != full
+    assert draw_tile_index(path, True) == expected
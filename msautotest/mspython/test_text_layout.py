@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for the text layout cache.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+def get_relpath_to_this(filename):
+    return os.path.join(os.path.dirname(__file__), filename)
+
+
+def write_fontset(path, alias, font):
+
+    fontfile = os.path.abspath(get_relpath_to_this('../misc/data/' + font))
+    with open(path, 'w') as f:
+        f.write('%s %s\n' % (alias, fontfile))
+    return path
+
+
+def draw_label(fontset, alias):
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT 0 0 100 100
+  SIZE 200 100
+  FONTSET "%s"
+  IMAGETYPE PNG
+  LAYER
+    NAME "points"
+    TYPE POINT
+    STATUS ON
+    FEATURE
+      POINTS 50 50 END
+    END
+    CLASS
+      LABEL
+        TEXT "Mapserver"
+        TYPE TRUETYPE
+        FONT "%s"
+        SIZE 20
+        COLOR 0 0 0
+      END
+    END
+  END
+END
+""" % (fontset, alias))
+    return map.draw().getBytes()
+
+###############################################################################
+# Two fontsets binding the same alias to different font files do not share
+# cached faces or text layouts.
+
+
+def test_text_layout_fontset_alias(tmp_path):
+
+    fontset_a = write_fontset(str(tmp_path / 'fonts_a.txt'), 'label', 'LucidaBrightRegular.ttf')
+    fontset_b = write_fontset(str(tmp_path / 'fonts_b.txt'), 'label', 'DroidNaskh-Regular.ttf')
+    fontset_c = write_fontset(str(tmp_path / 'fonts_c.txt'), 'other', 'DroidNaskh-Regular.ttf')
+
+    image_a = draw_label(fontset_a, 'label')
+    image_b = draw_label(fontset_b, 'label')
+    assert image_a != image_b
+
+    # the same font file through another alias gives the same image
+    assert draw_label(fontset_c, 'other') == image_b
+
+    # and each fontset keeps rendering with its own font
+    assert draw_label(fontset_a, 'label') == image_a
+    assert draw_label(fontset_b, 'label') == image_b
@@ -0,0 +1,147 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test the process-wide cache of rendered symbol tiles.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import re
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+###############################################################################
+# Squares filled with an ellipse symbol, whose color and size come from the
+# feature attributes: each feature needs a tile of its own.
+
+
+def draw_tiles(tmp_path, features, shared):
+
+    inline = ''
+    for i, (color, size) in enumerate(features):
+        inline += """
+    FEATURE
+      POINTS %d 0 %d 10 %d 10 %d 0 %d 0 END
+      ITEMS "%s;%s"
+    END""" % (2 * i, 2 * i, 2 * i + 2, 2 * i + 2, 2 * i, color, size)
+
+    map = mapscript.fromstring("""
+MAP
+  EXTENT 0 0 %d 10
+  SIZE %d 20
+  IMAGETYPE png
+  DEBUG 2
+  CONFIG "MS_SHARED_TILE_CACHE" "%s"
+  SYMBOL
+    NAME "circle"
+    TYPE ELLIPSE
+    POINTS 1 1 END
+    FILLED TRUE
+  END
+  LAYER
+    NAME "squares"
+    TYPE POLYGON
+    STATUS ON
+    PROCESSING "ITEMS=color,size"
+    CLASS
+      STYLE
+        SYMBOL "circle"
+        COLOR [color]
+        SIZE [size]
+      END
+    END
+    %s
+  END
+END
+""" % (2 * len(features), 4 * len(features), 'ON' if shared else 'OFF', inline))
+
+    errorfile = tmp_path / 'tilecache.log'
+    map.setConfigOption('MS_ERRORFILE', str(errorfile))
+    image = map.draw()
+    data = image.getBytes()
+    del image
+    map.setConfigOption('MS_ERRORFILE', 'stderr')
+
+    log = errorfile.read_text()
+    errorfile.unlink()
+    stats = re.findall(r'Shared cache: (\d+) hits, (\d+) misses', log)
+    return data, [int(x) for x in stats[-1]] if stats else None
+
+
+def colors(first, last):
+    return [('#%02x%02x%02x' % (i % 256, i // 256 * 16, 128), 5) for i in range(first, last)]
+
+###############################################################################
+# Styles only differing by a fraction of their size get tiles of their own.
+
+
+def test_tile_cache_key_collisions(tmp_path):
+
+    features = [('#ff0000', size) for size in (5, 5.25, 5.5, 5.75, 6)]
+
+    expected, _ = draw_tiles(tmp_path, features, False)
+    assert draw_tiles(tmp_path, features, True)[0] == expected
+    # a second rendering reuses each of the tiles
+    image, before = draw_tiles(tmp_path, features, True)
+    assert image == expected
+    image, after = draw_tiles(tmp_path, features, True)
+    assert image == expected
+    assert after[0] - before[0] == len(features)
+    assert after[1] == before[1]
+
+###############################################################################
+# The cache keeps the 256 most recently used tiles.
+
+
+def test_tile_cache_eviction(tmp_path):
+
+    features = colors(0, 300)
+
+    expected, _ = draw_tiles(tmp_path, features, False)
+    image, start = draw_tiles(tmp_path, features, True)
+    assert image == expected
+
+    # least recently used first: every tile was evicted before being reused
+    image, stats = draw_tiles(tmp_path, features, True)
+    assert image == expected
+    assert stats[0] == start[0]
+    assert stats[1] - start[1] == 300
+
+    # the last 256 tiles are still there, the first ones are not
+    _, before = draw_tiles(tmp_path, colors(200, 300), True)
+    assert before[0] - stats[0] == 100
+    _, after = draw_tiles(tmp_path, colors(0, 10), True)
+    assert after[0] == before[0]
+    assert after[1] - before[1] == 10
@@ -0,0 +1,211 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+###############################################################################
+# $Id$
+#
+# Project:  MapServer
+# Purpose:  Test suite for streamed WFS GetFeature responses.
+# Author:   agent, agent@local
+#
+###############################################################################
+#  Copyright (c) 2026, agent <agent@local>
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a
+#  copy of this software and associated documentation files (the "Software"),
+#  to deal in the Software without restriction, including without limitation
+#  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#  and/or sell copies of the Software, and to permit persons to whom the
+#  Software is furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included
+#  in all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+#  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#  DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import json
+import re
+
+import pytest
+
+mapscript_available = False
+try:
+    import mapscript
+    mapscript_available = True
+except ImportError:
+    pass
+
+pytestmark = pytest.mark.skipif(not mapscript_available, reason="mapscript not available")
+
+
+###############################################################################
+# Map with a WFS layer of five inline points, identified by 1 to 5.
+
+def points_map(streaming, compute_number_matched=False):
+
+    features = ''
+    for i in range(5):
+        features += """
+    FEATURE
+      POINTS %d 45 END
+      ITEMS "%d"
+    END""" % (i, i + 1)
+
+    metadata = ''
+    if streaming:
+        metadata += '"wfs_features_streaming" "true"\n'
+    if compute_number_matched:
+        metadata += '"wfs_compute_number_matched" "true"\n'
+
+    return mapscript.fromstring("""
+MAP
+  NAME "streaming"
+  EXTENT -180 -90 180 90
+  PROJECTION
+    "init=epsg:4326"
+  END
+  OUTPUTFORMAT
+    NAME "geojson"
+    DRIVER "OGR/GeoJSON"
+    MIMETYPE "application/json; subtype=geojson"
+    FORMATOPTION "STORAGE=stream"
+    FORMATOPTION "FORM=simple"
+  END
+  WEB
+    METADATA
+      "ows_enable_request" "*"
+      "ows_onlineresource" "http://localhost/"
+      "wfs_srs" "EPSG:4326"
+      "wfs_getfeature_formatlist" "geojson"
+      %s
+    END
+  END
+  LAYER
+    NAME "points"
+    TYPE POINT
+    STATUS ON
+    PROCESSING "ITEMS=id"
+    METADATA
+      "wfs_featureid" "id"
+      "gml_include_items" "all"
+    END
+    %s
+  END
+END
+""" % (metadata, features))
+
+
+def get_feature(map, query):
+
+    request = mapscript.OWSRequest()
+    mapscript.msIO_installStdoutToBuffer()
+    request.loadParamsFromURL('SERVICE=WFS&REQUEST=GetFeature&TYPENAME=points&' + query)
+    status = map.OWSDispatch(request)
+    mapscript.msIO_getAndStripStdoutBufferMimeHeaders()
+    result = mapscript.msIO_getStdoutBufferBytes().decode('utf-8')
+    mapscript.msIO_resetHandlers()
+    assert status == mapscript.MS_SUCCESS
+    return result
+
+
+def gml_ids(result):
+    return [int(x) for x in re.findall(r'(?:gml:id|fid)="points\.(\d+)"', result)]
+
+
+###############################################################################
+# A streamed response holds the same features as a regular one.
+
+@pytest.mark.parametrize("version", ["1.0.0", "1.1.0", "2.0.0"])
+def test_wfs_streaming_same_features(version):
+
+    if 'SUPPORTS=WFS' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    query = 'VERSION=' + version
+    expected = get_feature(points_map(False), query)
+    result = get_feature(points_map(True), query)
+
+    assert gml_ids(expected) == [1, 2, 3, 4, 5]
+    assert gml_ids(result) == gml_ids(expected)
+    assert '<ms:id>3</ms:id>' in result
+
+###############################################################################
+# Paging is applied while streaming. WFS 2.0 GML output makes a counting
+# pass first, so numberReturned and the next link are the regular ones.
+
+def collection_attributes(result):
+    return (re.findall(r'number(?:Matched|Returned)="[^"]*"', result),
+            re.findall(r'next="[^"]*"', result))
+
+
+def test_wfs_streaming_paging():
+
+    if 'SUPPORTS=WFS' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    query = 'VERSION=2.0.0&COUNT=2&STARTINDEX=1'
+    expected = get_feature(points_map(False), query)
+    result = get_feature(points_map(True), query)
+
+    assert gml_ids(expected) == [2, 3]
+    assert gml_ids(result) == [2, 3]
+    assert 'numberReturned="2"' in result
+    assert 'next="' in result
+    assert collection_attributes(result) == collection_attributes(expected)
+
+    result = get_feature(points_map(True), 'VERSION=1.1.0&MAXFEATURES=3')
+    assert gml_ids(result) == [1, 2, 3]
+
+###############################################################################
+# wfs_compute_number_matched makes a first pass counting the features, so
+# the exact numbers are reported.
+
+def test_wfs_streaming_compute_number_matched():
+
+    if 'SUPPORTS=WFS' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    query = 'VERSION=2.0.0&COUNT=2'
+    result = get_feature(points_map(True, compute_number_matched=True), query)
+
+    assert gml_ids(result) == [1, 2]
+    assert 'numberMatched="5"' in result
+    assert 'numberReturned="2"' in result
+
+###############################################################################
+# A request without results gets the regular empty response.
+
+def test_wfs_streaming_no_result():
+
+    if 'SUPPORTS=WFS' not in mapscript.msGetVersion():
+        pytest.skip()
+
+    query = 'VERSION=1.1.0&BBOX=60,60,70,70'
+    expected = get_feature(points_map(False), query)
+    result = get_feature(points_map(True), query)
+
+    assert gml_ids(result) == []
+    assert result == expected
+
+###############################################################################
+# Features are also streamed to OGR output formats.
+
+def test_wfs_streaming_geojson():
+
+    version = mapscript.msGetVersion()
+    if 'SUPPORTS=WFS' not in version or 'INPUT=OGR' not in version:
+        pytest.skip()
+
+    query = 'VERSION=1.1.0&OUTPUTFORMAT=geojson&MAXFEATURES=4'
+    expected = json.loads(get_feature(points_map(False), query))
+    result = json.loads(get_feature(points_map(True), query))
+
+    ids = [f['properties']['id'] for f in result['features']]
+    assert ids == ['1', '2', '3', '4']
+    assert result['features'] == expected['features']
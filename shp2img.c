@@ -87,12 +87,13 @@ int main(int argc, char *argv[])
       fprintf(stdout, "\nPurpose: convert a mapfile to an image\n\n");
       fprintf(stdout,
               "Syntax: shp2img -m mapfile [-o image] [-e minx miny maxx maxy] [-s sizex sizey]\n"
-              "               [-l \"layer1 [layers2...]\"] [-i format]\n"
+              "               [-l \"layer1 [layers2...]\"] [-i format] [-fo name=value]\n"
               "               [-all_debug n] [-map_debug n] [-layer_debug n] [-p n] [-c n] [-d layername datavalue]\n");
 
 
       fprintf(stdout,"  -m mapfile: Map file to operate on - required\n" );
       fprintf(stdout,"  -i format: Override the IMAGETYPE value to pick output format\n" );
+      fprintf(stdout,"  -fo name=value: Set a FORMATOPTION of the output format, e.g. -i COG -fo COMPRESS=ZSTD (may be repeated)\n" );
       fprintf(stdout,"  -o image: output filename (stdout if not provided)\n");
       fprintf(stdout,"  -e minx miny maxx maxy: extents to render\n");
       fprintf(stdout,"  -s sizex sizey: output image size\n");
@@ -293,6 +294,26 @@ int main(int argc, char *argv[])
       }
     }
 
+    for(i=1; i<argc-1; i++) { /* format options, once the output format is known */
+      if(strcmp(argv[i],"-fo") == 0) {
+        char *key = msStrdup(argv[i+1]);
+        char *value = strchr(key, '=');
+
+        if( value == NULL || map->outputformat == NULL ) {
+          fprintf( stderr,
+                   "Argument -fo needs a name=value argument.\n" );
+          msFree(key);
+          msFreeMap(map);
+          msCleanup();
+          exit(1);
+        }
+        *value++ = '\0';
+        msSetOutputFormatOption( map->outputformat, key, value );
+        msFree(key);
+        i+=1;
+      }
+    }
+
     image = msDrawMap(map, MS_FALSE);
 
     if(!image) {
@@ -88,6 +88,7 @@ int main(int argc, char *argv[])
   char         fName[20];
   int          fWidth,fnDecimals;
   char         buffer[1024];
+  char         **values;
   int i,j;
   int num_fields, num_records;
 
@@ -154,10 +155,16 @@ int main(int argc, char *argv[])
   dbfField = msDBFGetFieldInfo(inDBF,fieldNumber,NULL,NULL,NULL);
   switch (dbfField) {
     case FTString:
+      values = msDBFGetColumnValues(inDBF, fieldNumber, NULL, num_records);
+      if(num_records > 0 && !values) {
+        msWriteError(stderr);
+        exit(1);
+      }
       for(i=0; i<num_records; i++) {
-        strlcpy(array[i].string, msDBFReadStringAttribute( inDBF, i, fieldNumber), sizeof(array[i].string));
+        strlcpy(array[i].string, values[i], sizeof(array[i].string));
         array[i].index = i;
       }
+      msFreeCharArray(values, num_records);
 
       if(*argv[4] == 'd')
         qsort(array, num_records, sizeof(sortStruct), compare_string_descending);
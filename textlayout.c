@@ -237,6 +237,37 @@ int WARN_UNUSED check_single_font(fontSetObj *fontset, char *fontkey, text_run *
   return MS_SUCCESS;
 }
 
+/*
+** Returns the font files the aliases of a label font list resolve to in the
+** given fontset, in the same order and with the same prefix handling as
+** check_single_font(). Two fontsets may map the same alias to different
+** files, so the aliases alone cannot identify a cached layout.
+*/
+static char* get_fontlist_files(fontSetObj *fontset, const char *fontlist) {
+  char *files = msStrdup("");
+  char *list, *startfont, *endfont;
+  if(!fontset || !fontlist) return files;
+  list = msStrdup(fontlist);
+  startfont = list;
+  for(;;) {
+    const char *fontfile = NULL;
+    char *fontkey2;
+    endfont = strchr(startfont,',');
+    if(endfont) *endfont = 0;
+    fontkey2 = strchr(startfont,':');
+    if(fontkey2)
+      fontfile = msLookupHashTable(&(fontset->fonts),fontkey2+1);
+    if(!fontfile)
+      fontfile = msLookupHashTable(&(fontset->fonts),startfont);
+    files = msStringConcatenate(files, fontfile ? fontfile : "");
+    if(!endfont) break;
+    files = msStringConcatenate(files, ",");
+    startfont = endfont+1;
+  }
+  free(list);
+  return files;
+}
+
 int WARN_UNUSED get_face_for_run(fontSetObj *fontset, char *fontlist, text_run *run, TextInfo *glyphs) {
   char *startfont, *endfont;
   int ok;
@@ -442,6 +473,8 @@ int msLayoutTextSymbol(mapObj *map, textSymbolObj *ts, textPathObj *tgret) {
 
   TextInfo glyphs;
   int num_glyphs = 0;
+  char *layout_key, *fontfiles;
+  size_t layout_key_size;
 
   assert(ts->annotext && *ts->annotext); /* ensure we have at least one character/glyph to treat */
 
@@ -487,6 +520,20 @@ int msLayoutTextSymbol(mapObj *map, textSymbolObj *ts, textPathObj *tgret) {
   if( text_num_bytes == 0 )
       return 0;
 
+  /* the same text with the same label parameters always gives the same
+     layout, so shape it only once (e.g. street names repeated along a map) */
+  fontfiles = get_fontlist_files(fontset, ts->label->font);
+  layout_key_size = text_num_bytes + (ts->label->font ? strlen(ts->label->font) : 0) + strlen(fontfiles) + 80;
+  layout_key = msSmallMalloc(layout_key_size);
+  snprintf(layout_key, layout_key_size, "%d:%d:%d:%d:%d:%d:%s\n%s\n%s",
+           tgret->glyph_size, tgret->line_height, ts->label->align, (int)ts->label->wrap,
+           ts->label->maxlength, fontset ? 1 : 0, ts->label->font ? ts->label->font : "", fontfiles, ts->annotext);
+  free(fontfiles);
+  if(msGetCachedTextLayout(layout_key, tgret) == MS_TRUE) {
+    free(layout_key);
+    return MS_SUCCESS;
+  }
+
   if(text_num_bytes > STATIC_GLYPHS) {
 #ifdef USE_FRIBIDI
     glyphs.bidi_levels = msSmallMalloc(text_num_bytes * sizeof(FriBidiLevel));
@@ -830,7 +877,10 @@ int msLayoutTextSymbol(mapObj *map, textSymbolObj *ts, textPathObj *tgret) {
    * msDebug("bounds for %s: %f %f %f %f\n",ts->annotext,tgret->bounds.bbox.minx,tgret->bounds.bbox.miny,tgret->bounds.bbox.maxx,tgret->bounds.bbox.maxy);
    */
 
+  msAddCachedTextLayout(layout_key, tgret);
+
 cleanup:
+  free(layout_key);
   if(line_descs != static_line_descs) free(line_descs);
   if(glyphs.codepoints != static_codepoints) {
 #ifdef USE_FRIBIDI